@@ -24,6 +24,7 @@ main( int argc, char* argv[] )
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",1);
         const Int maxOuterIts = Input("--maxOuterIts","maximum it's/split",10);
         const Real tol = Input("--tol","relative tol.",Real(0));
+        const bool qdwh = Input("--qdwh","attempt QDWH-based splits?",false);
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -39,6 +40,7 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.maxInnerIts = maxInnerIts;
         ctrl.sdcCtrl.maxOuterIts = maxOuterIts;
         ctrl.sdcCtrl.tol = tol;
+        ctrl.sdcCtrl.qdwh = qdwh;
 
         // Attempt to compute the spectral decomposition of A, 
         // but do not overwrite A
@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try 
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const Real radius = Input("--radius","radius of uniform entries",0.1);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrix?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        DistMatrix<C> A;
+        Uniform( A, n, n, C(0), radius );
+        if( print )
+            Print( A, "A" );
+        const Real frobA = FrobeniusNorm( A );
+
+        // Compute exp(A) via scaling and squaring
+        DistMatrix<C> expA( A );
+        MatrixExp( expA );
+        if( print )
+            Print( expA, "exp(A)" );
+
+        // Compute exp(A) via the Schur-Parlett algorithm
+        SchurParlettCtrl<Real> ctrl;
+        ctrl.progress = progress;
+        // Every derivative of exp(z) is exp(z)
+        function<C(C,Int)> expFunc = []( C z, Int k ) { return Exp(z); };
+        DistMatrix<C> expAParlett( A );
+        MatrixFunction( expAParlett, expFunc, ctrl );
+        expAParlett -= expA;
+        const Real frobExpA = FrobeniusNorm( expA );
+        const Real frobDiff = FrobeniusNorm( expAParlett );
+        if( mpi::Rank() == 0 )
+            Output
+            ("|| exp(A) - f(A) ||_F / || exp(A) ||_F = ",frobDiff/frobExpA);
+
+        // Recover A from log(exp(A))
+        MatrixLogCtrl<Real> logCtrl;
+        logCtrl.progress = progress;
+        MatrixLog( expA, logCtrl );
+        expA -= A;
+        const Real frobLogDiff = FrobeniusNorm( expA );
+        if( mpi::Rank() == 0 )
+            Output("|| A - log(exp(A)) ||_F / || A ||_F = ",frobLogDiff/frobA);
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -23,6 +23,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const bool colPiv = Input("--colPiv","QR with col pivoting?",false);
+        const double cholThresh = 
+          Input("--cholThresh","switch to Cholesky-based QDWH below",100.);
         ProcessInput();
         PrintInputReport();
 
@@ -36,6 +38,7 @@ main( int argc, char* argv[] )
         PolarCtrl ctrl;
         ctrl.qdwh = true;
         ctrl.colPiv = colPiv;
+        ctrl.qdwhCholThreshold = cholThresh;
         Polar( Q, ctrl );
         Zeros( P, n, n );
         Gemm( ADJOINT, NORMAL, C(1), Q, A, C(0), P );
@@ -37,6 +37,12 @@ int main( int argc, char* argv[] )
           Input("--smallestFirst","sort smallest first?",true);
         const bool recursive = Input("--recursive","try recursive LLL?",true);
         const Int cutoff = Input("--cutoff","recursive cutoff",10);
+        const bool allSwaps =
+          Input("--allSwaps","use all-swaps LLL (if not recursive)?",false);
+        const bool adaptive =
+          Input("--adaptive","use adaptive-precision LLL?",false);
+        const bool benchmark =
+          Input("--benchmark","compare LLL implementations?",false);
         const bool progress = Input("--progress","print progress?",false); 
         const bool time = Input("--time","time LLL?",false);
         const bool print = Input("--print","output all matrices?",true);
@@ -45,6 +51,15 @@ int main( int argc, char* argv[] )
         const bool probEnum =
           Input("--probEnum","probabalistic enumeration?",true);
         const bool fullEnum = Input("--fullEnum","SVP via full enum?",false);
+        const bool sieve =
+          Input("--sieve","SVP via sieving rather than enumeration?",false);
+        const bool bkz = Input("--bkz","BKZ after LLL?",false);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",20);
+        const Int maxTours =
+          Input("--maxTours","max BKZ tours (0 for no limit)",0);
+        const Int numTrials =
+          Input("--numTrials","BKZ enumeration trials per block",1);
+        const bool prune = Input("--prune","prune BKZ enumeration?",true);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           Input("--prec","MPFR precision",mpfr_prec_t(1024));
@@ -75,11 +90,66 @@ int main( int argc, char* argv[] )
         ctrl.smallestFirst = smallestFirst;
         ctrl.progress = progress;
         ctrl.time = time;
+        if( benchmark )
+        {
+            LLLCtrl<Real> benchCtrl( ctrl );
+            benchCtrl.variant = LLL_NORMAL;
+            benchCtrl.progress = false;
+            benchCtrl.time = false;
+            auto report =
+              [&]( const string& name, double benchTime,
+                   const LLLInfo<Real>& benchInfo )
+              {
+                Output
+                ("  ",name," took ",benchTime," seconds (",benchInfo.numSwaps,
+                 " swaps, achieved delta=",benchInfo.delta,")");
+              };
+
+            Matrix<Real> BBench, RBench;
+            double benchStart;
+
+            BBench = B;
+            benchStart = mpi::Time();
+            auto normalInfo = LLL( BBench, RBench, benchCtrl );
+            report( "LLL_NORMAL", mpi::Time()-benchStart, normalInfo );
+
+            BBench = B;
+            benchStart = mpi::Time();
+            auto recursiveInfo =
+              RecursiveLLL( BBench, RBench, cutoff, benchCtrl );
+            report( "RecursiveLLL", mpi::Time()-benchStart, recursiveInfo );
+
+            BBench = B;
+            benchStart = mpi::Time();
+            auto adaptiveInfo = AdaptiveLLL( BBench, RBench, benchCtrl );
+            report( "AdaptiveLLL", mpi::Time()-benchStart, adaptiveInfo );
+
+            BBench = B;
+            benchStart = mpi::Time();
+            auto allSwapsInfo = AllSwapsLLL( BBench, RBench, benchCtrl );
+            report( "AllSwapsLLL", mpi::Time()-benchStart, allSwapsInfo );
+
+            // Every process read the entire basis
+            DistMatrix<Real,STAR,STAR> B_STAR_STAR;
+            B_STAR_STAR.Resize( B.Height(), B.Width() );
+            B_STAR_STAR.Matrix() = B;
+            DistMatrix<Real> BDist( B_STAR_STAR ), RDist;
+            mpi::Barrier( mpi::COMM_WORLD );
+            benchStart = mpi::Time();
+            auto distInfo = AllSwapsLLL( BDist, RDist, benchCtrl );
+            report
+            ( "Distributed AllSwapsLLL", mpi::Time()-benchStart, distInfo );
+        }
+
         const double startTime = mpi::Time();
         LLLInfo<Real> info;
         Matrix<Real> R;
-        if( recursive )
+        if( adaptive )
+            info = AdaptiveLLL( B, R, ctrl );
+        else if( recursive )
             info = RecursiveLLL( B, R, cutoff, ctrl );
+        else if( allSwaps )
+            info = AllSwapsLLL( B, R, ctrl );
         else
             info = LLL( B, R, ctrl );
         const double runTime = mpi::Time() - startTime;
@@ -97,6 +167,29 @@ int main( int argc, char* argv[] )
             Print( B, "B" ); 
             Print( R, "R" );
         }
+        if( bkz && FrobeniusNorm(B(ALL,IR(0))) > challenge )
+        {
+            BKZCtrl<Real> bkzCtrl;
+            bkzCtrl.blocksize = blocksize;
+            bkzCtrl.maxTours = maxTours;
+            bkzCtrl.targetRatio = targetRatio;
+            bkzCtrl.numTrials = numTrials;
+            bkzCtrl.prune = prune;
+            bkzCtrl.lllCtrl = ctrl;
+            bkzCtrl.lllCtrl.presort = false;
+            bkzCtrl.progress = true;
+            bkzCtrl.time = time;
+            const double bkzStartTime = mpi::Time();
+            auto bkzInfo = BKZ( B, R, bkzCtrl );
+            const double bkzRunTime = mpi::Time() - bkzStartTime;
+            Output("  BKZ(",blocksize,") took ",bkzRunTime," seconds");
+            Output("    num tours:      ",bkzInfo.numTours);
+            Output("    num insertions: ",bkzInfo.numInsertions);
+            Output("    num swaps:      ",bkzInfo.numSwaps);
+            Output("    achieved delta: ",bkzInfo.delta);
+            Output("    achieved eta:   ",bkzInfo.eta);
+        }
+
         const Real BOneNorm = OneNorm( B );
         Output("|| B ||_1 = ",BOneNorm);
 
@@ -109,13 +202,15 @@ int main( int argc, char* argv[] )
         if( b0Norm <= challenge )
         {
             Output
-            ("SVP Challenge solved via LLL: || b_0 ||_2=",b0Norm,
+            ("SVP Challenge solved via ",(bkz ? "BKZ" : "LLL"),
+             ": || b_0 ||_2=",b0Norm,
              " <= targetRatio*GH(L)=",challenge);
             succeeded = true;
         }
         else
             Output
-            ("SVP Challenge NOT solved via LLL: || b_0 ||_2=",b0Norm,
+            ("SVP Challenge NOT solved via ",(bkz ? "BKZ" : "LLL"),
+             ": || b_0 ||_2=",b0Norm,
              " > targetRatio*GH(L)=",challenge);
 
         if( !succeeded )
@@ -124,7 +219,14 @@ int main( int argc, char* argv[] )
             Timer timer;
             timer.Start();
             Real result;
-            if( fullEnum )
+            if( sieve )
+            {
+                SieveCtrl sieveCtrl;
+                sieveCtrl.progress = progress;
+                sieveCtrl.time = time;
+                result = ShortVectorSieve( B, R, challenge, v, sieveCtrl );
+            }
+            else if( fullEnum )
               result = 
                 ShortestVectorEnumeration( B, R, challenge, v, probEnum );
             else
@@ -132,7 +234,9 @@ int main( int argc, char* argv[] )
                 ShortVectorEnumeration( B, R, challenge, v, probEnum );
             if( result < challenge )
             {
-                Output("Enumeration: ",timer.Stop()," seconds");
+                Output
+                ((sieve ? "Sieving: " : "Enumeration: "),timer.Stop(),
+                 " seconds");
                 Print( B, "B" );
                 Print( v, "v" );
                 const Int m = B.Height();
@@ -145,7 +249,9 @@ int main( int argc, char* argv[] )
                 Output("Claimed || x ||_2 = ",result);
             }
             else
-                Output("Enumeration failed after ",timer.Stop()," seconds");
+                Output
+                ((sieve ? "Sieving" : "Enumeration")," failed after ",
+                 timer.Stop()," seconds");
         }
     }
     catch( std::exception& e ) { ReportException(e); }
@@ -33,6 +33,7 @@ int main( int argc, char* argv[] )
         const bool printCoeff =
           Input("--printCoeff","output coefficients?",false);
         const Real NSqrt = Input("--NSqrt","sqrt of N",Real(1e6));
+        const bool pslq = Input("--pslq","also search via PSLQ?",false);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           Input("--prec","MPFR precision",mpfr_prec_t(256));
@@ -98,6 +99,26 @@ int main( int argc, char* argv[] )
                 Print( U(ALL,IR(0)), "u0" );
             }
         }
+
+        if( pslq )
+        {
+            Output("PSLQ");
+            PSLQCtrl<Real> pslqCtrl;
+            pslqCtrl.progress = progress;
+            pslqCtrl.time = time;
+            double startTime = mpi::Time();
+            Matrix<Real> U;
+            Int numExact = ZDependenceSearch( z, U, pslqCtrl );
+            double runtime = mpi::Time() - startTime;
+            Output("  runtime: ",runtime," seconds");
+            Output("  num \"exact\": ",numExact);
+            if( numExact > 0 )
+                Output("  || u0 ||_oo = ",MaxNorm(U(ALL,IR(0))));
+            if( printAll )
+                Print( U, "U" );
+            else if( printCoeff && numExact > 0 )
+                Print( U(ALL,IR(0)), "u0" );
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
     return 0;
@@ -923,6 +923,29 @@ inline ElPencil CReflect( Pencil pencil )
 inline Pencil CReflect( ElPencil pencil )
 { return static_cast<Pencil>(pencil); }
 
+/* PolarCtrl */
+inline ElPolarCtrl CReflect( const PolarCtrl& ctrl )
+{
+    ElPolarCtrl ctrlC;
+    ctrlC.qdwh = ctrl.qdwh;
+    ctrlC.colPiv = ctrl.colPiv;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.numIts = ctrl.numIts;
+    ctrlC.qdwhCholThreshold = ctrl.qdwhCholThreshold;
+    return ctrlC;
+}
+
+inline PolarCtrl CReflect( const ElPolarCtrl& ctrlC )
+{
+    PolarCtrl ctrl;
+    ctrl.qdwh = ctrlC.qdwh;
+    ctrl.colPiv = ctrlC.colPiv;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.numIts = ctrlC.numIts;
+    ctrl.qdwhCholThreshold = ctrlC.qdwhCholThreshold;
+    return ctrl;
+}
+
 /* HermitianSDCCtrl */
 inline ElHermitianSDCCtrl_s CReflect( const HermitianSDCCtrl<float>& ctrl )
 {
@@ -933,6 +956,8 @@ inline ElHermitianSDCCtrl_s CReflect( const HermitianSDCCtrl<float>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.spreadFactor = ctrl.spreadFactor;
     ctrlC.progress = ctrl.progress;
+    ctrlC.qdwh = ctrl.qdwh;
+    ctrlC.polarCtrl = CReflect(ctrl.polarCtrl);
     return ctrlC;
 }
 inline ElHermitianSDCCtrl_d CReflect( const HermitianSDCCtrl<double>& ctrl )
@@ -944,6 +969,8 @@ inline ElHermitianSDCCtrl_d CReflect( const HermitianSDCCtrl<double>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.spreadFactor = ctrl.spreadFactor;
     ctrlC.progress = ctrl.progress;
+    ctrlC.qdwh = ctrl.qdwh;
+    ctrlC.polarCtrl = CReflect(ctrl.polarCtrl);
     return ctrlC;
 }
 
@@ -956,6 +983,8 @@ inline HermitianSDCCtrl<float> CReflect( const ElHermitianSDCCtrl_s& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.spreadFactor = ctrlC.spreadFactor;
     ctrl.progress = ctrlC.progress;
+    ctrl.qdwh = ctrlC.qdwh;
+    ctrl.polarCtrl = CReflect(ctrlC.polarCtrl);
     return ctrl;
 }
 inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
@@ -967,6 +996,8 @@ inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.spreadFactor = ctrlC.spreadFactor;
     ctrl.progress = ctrlC.progress;
+    ctrl.qdwh = ctrlC.qdwh;
+    ctrl.polarCtrl = CReflect(ctrlC.polarCtrl);
     return ctrl;
 }
 
@@ -1093,37 +1124,20 @@ CReflect( const ElHermitianEigCtrl_z& ctrlC )
     return ctrl;
 }
 
-/* PolarCtrl */
-inline ElPolarCtrl CReflect( const PolarCtrl& ctrl )
-{
-    ElPolarCtrl ctrlC;
-    ctrlC.qdwh = ctrl.qdwh;
-    ctrlC.colPiv = ctrl.colPiv;
-    ctrlC.maxIts = ctrl.maxIts;
-    ctrlC.numIts = ctrl.numIts;
-    return ctrlC;
-}
-
-inline PolarCtrl CReflect( const ElPolarCtrl& ctrlC )
-{
-    PolarCtrl ctrl;
-    ctrl.qdwh = ctrlC.qdwh;
-    ctrl.colPiv = ctrlC.colPiv;
-    ctrl.maxIts = ctrlC.maxIts;
-    ctrl.numIts = ctrlC.numIts;
-    return ctrl;
-}
-
 /* SVDCtrl */
 inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
 {
     SVDCtrl<float> ctrl;
     ctrl.seqQR = ctrlC.seqQR;
+    ctrl.distDC = ctrlC.distDC;
+    ctrl.dcCutoff = ctrlC.dcCutoff;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.thresholded = ctrlC.thresholded;
     ctrl.relative = ctrlC.relative;
     ctrl.tol = ctrlC.tol;
+    ctrl.useQDWH = ctrlC.useQDWH;
+    ctrl.qdwhCtrl = CReflect(ctrlC.qdwhCtrl);
     return ctrl;
 }
 
@@ -1131,11 +1145,15 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
 {
     SVDCtrl<double> ctrl;
     ctrl.seqQR = ctrlC.seqQR;
+    ctrl.distDC = ctrlC.distDC;
+    ctrl.dcCutoff = ctrlC.dcCutoff;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.thresholded = ctrlC.thresholded;
     ctrl.relative = ctrlC.relative;
     ctrl.tol = ctrlC.tol;
+    ctrl.useQDWH = ctrlC.useQDWH;
+    ctrl.qdwhCtrl = CReflect(ctrlC.qdwhCtrl);
     return ctrl;
 }
 
@@ -1143,11 +1161,15 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
 {
     ElSVDCtrl_s ctrlC;
     ctrlC.seqQR = ctrl.seqQR;
+    ctrlC.distDC = ctrl.distDC;
+    ctrlC.dcCutoff = ctrl.dcCutoff;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.thresholded = ctrl.thresholded;
     ctrlC.relative = ctrl.relative;
     ctrlC.tol = ctrl.tol;
+    ctrlC.useQDWH = ctrl.useQDWH;
+    ctrlC.qdwhCtrl = CReflect(ctrl.qdwhCtrl);
     return ctrlC;
 }
 
@@ -1155,11 +1177,15 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
 {
     ElSVDCtrl_d ctrlC;
     ctrlC.seqQR = ctrl.seqQR;
+    ctrlC.distDC = ctrl.distDC;
+    ctrlC.dcCutoff = ctrl.dcCutoff;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.thresholded = ctrl.thresholded;
     ctrlC.relative = ctrl.relative;
     ctrlC.tol = ctrl.tol;
+    ctrlC.useQDWH = ctrl.useQDWH;
+    ctrlC.qdwhCtrl = CReflect(ctrl.qdwhCtrl);
     return ctrlC;
 }
 
@@ -1700,7 +1726,17 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.denseCols     = ctrl.denseCols;
+    ctrlC.denseColRatio = ctrl.denseColRatio;
+    ctrlC.maxDenseCols  = ctrl.maxDenseCols;
+    ctrlC.denseColMaxRefineIts = ctrl.denseColMaxRefineIts;
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.gondzio = ctrl.gondzio;
+    ctrlC.maxGondzioCorrectors = ctrl.maxGondzioCorrectors;
+    ctrlC.gondzioStepIncrease = ctrl.gondzioStepIncrease;
+    ctrlC.gondzioMinImprovement = ctrl.gondzioMinImprovement;
+    ctrlC.gondzioBetaMin = ctrl.gondzioBetaMin;
+    ctrlC.gondzioBetaMax = ctrl.gondzioBetaMax;
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
@@ -1726,7 +1762,17 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.denseCols     = ctrl.denseCols;
+    ctrlC.denseColRatio = ctrl.denseColRatio;
+    ctrlC.maxDenseCols  = ctrl.maxDenseCols;
+    ctrlC.denseColMaxRefineIts = ctrl.denseColMaxRefineIts;
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.gondzio = ctrl.gondzio;
+    ctrlC.maxGondzioCorrectors = ctrl.maxGondzioCorrectors;
+    ctrlC.gondzioStepIncrease = ctrl.gondzioStepIncrease;
+    ctrlC.gondzioMinImprovement = ctrl.gondzioMinImprovement;
+    ctrlC.gondzioBetaMin = ctrl.gondzioBetaMin;
+    ctrlC.gondzioBetaMax = ctrl.gondzioBetaMax;
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
@@ -1752,7 +1798,17 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     ctrl.maxIts        = ctrlC.maxIts;
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
+    ctrl.denseCols     = ctrlC.denseCols;
+    ctrl.denseColRatio = ctrlC.denseColRatio;
+    ctrl.maxDenseCols  = ctrlC.maxDenseCols;
+    ctrl.denseColMaxRefineIts = ctrlC.denseColMaxRefineIts;
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.gondzio = ctrlC.gondzio;
+    ctrl.maxGondzioCorrectors = ctrlC.maxGondzioCorrectors;
+    ctrl.gondzioStepIncrease = ctrlC.gondzioStepIncrease;
+    ctrl.gondzioMinImprovement = ctrlC.gondzioMinImprovement;
+    ctrl.gondzioBetaMin = ctrlC.gondzioBetaMin;
+    ctrl.gondzioBetaMax = ctrlC.gondzioBetaMax;
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
@@ -1778,7 +1834,17 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     ctrl.maxIts        = ctrlC.maxIts;
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
+    ctrl.denseCols     = ctrlC.denseCols;
+    ctrl.denseColRatio = ctrlC.denseColRatio;
+    ctrl.maxDenseCols  = ctrlC.maxDenseCols;
+    ctrl.denseColMaxRefineIts = ctrlC.denseColMaxRefineIts;
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.gondzio = ctrlC.gondzio;
+    ctrl.maxGondzioCorrectors = ctrlC.maxGondzioCorrectors;
+    ctrl.gondzioStepIncrease = ctrlC.gondzioStepIncrease;
+    ctrl.gondzioMinImprovement = ctrlC.gondzioMinImprovement;
+    ctrl.gondzioBetaMin = ctrlC.gondzioBetaMin;
+    ctrl.gondzioBetaMax = ctrlC.gondzioBetaMax;
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
@@ -2332,35 +2398,52 @@ inline NNLSCtrl<double> CReflect( const ElNNLSCtrl_d& ctrlC )
 
 // Non-negative Matrix Factorization
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+inline NMFApproach CReflect( ElNMFApproach approach ) 
+{ return static_cast<NMFApproach>(approach); }
+inline ElNMFApproach CReflect( NMFApproach approach )
+{ return static_cast<ElNMFApproach>(approach); }
+
 inline ElNMFCtrl_s CReflect( const NMFCtrl<float>& ctrl )
 {
     ElNMFCtrl_s ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
 inline ElNMFCtrl_d CReflect( const NMFCtrl<double>& ctrl )
 {
     ElNMFCtrl_d ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
 inline NMFCtrl<float> CReflect( const ElNMFCtrl_s& ctrlC )
 {
     NMFCtrl<float> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
 inline NMFCtrl<double> CReflect( const ElNMFCtrl_d& ctrlC )
 {
     NMFCtrl<double> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
@@ -2628,6 +2711,10 @@ inline LLLCtrl<float> CReflect( const ElLLLCtrl_s& ctrlC )
     ctrl.time = ctrlC.time;
     ctrl.jumpstart = ctrlC.jumpstart;
     ctrl.startCol = ctrlC.startCol;
+    ctrl.blocksize = ctrlC.blocksize;
+    ctrl.blockedCutoff = ctrlC.blockedCutoff;
+    ctrl.kernelBlocksize = ctrlC.kernelBlocksize;
+    ctrl.kernelBlockedCutoff = ctrlC.kernelBlockedCutoff;
     return ctrl;
 }
 
@@ -2646,6 +2733,10 @@ inline LLLCtrl<double> CReflect( const ElLLLCtrl_d& ctrlC )
     ctrl.time = ctrlC.time;
     ctrl.jumpstart = ctrlC.jumpstart;
     ctrl.startCol = ctrlC.startCol;
+    ctrl.blocksize = ctrlC.blocksize;
+    ctrl.blockedCutoff = ctrlC.blockedCutoff;
+    ctrl.kernelBlocksize = ctrlC.kernelBlocksize;
+    ctrl.kernelBlockedCutoff = ctrlC.kernelBlockedCutoff;
     return ctrl;
 }
 
@@ -2664,6 +2755,10 @@ inline ElLLLCtrl_s CReflect( const LLLCtrl<float>& ctrl )
     ctrlC.time = ctrl.time;
     ctrlC.jumpstart = ctrl.jumpstart;
     ctrlC.startCol = ctrl.startCol;
+    ctrlC.blocksize = ctrl.blocksize;
+    ctrlC.blockedCutoff = ctrl.blockedCutoff;
+    ctrlC.kernelBlocksize = ctrl.kernelBlocksize;
+    ctrlC.kernelBlockedCutoff = ctrl.kernelBlockedCutoff;
     return ctrlC;
 }
 
@@ -2682,6 +2777,10 @@ inline ElLLLCtrl_d CReflect( const LLLCtrl<double>& ctrl )
     ctrlC.time = ctrl.time;
     ctrlC.jumpstart = ctrl.jumpstart;
     ctrlC.startCol = ctrl.startCol;
+    ctrlC.blocksize = ctrl.blocksize;
+    ctrlC.blockedCutoff = ctrl.blockedCutoff;
+    ctrlC.kernelBlocksize = ctrl.kernelBlocksize;
+    ctrlC.kernelBlockedCutoff = ctrl.kernelBlockedCutoff;
     return ctrlC;
 }
 
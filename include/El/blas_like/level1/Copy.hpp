@@ -248,10 +248,9 @@ void Copy( const SparseMatrix<S>& A, Matrix<T>& B )
     const Int* ARowBuf = A.LockedSourceBuffer();
     const Int* AColBuf = A.LockedTargetBuffer();
     
+    Zeros( B, m, n );
     T* BBuf = B.Buffer();
     const Int BLDim = B.LDim();
-    
-    Zeros( B, m, n );
     for( Int e=0; e<numEntries; ++e )
         BBuf[ARowBuf[e]+AColBuf[e]*BLDim] = Caster<S,T>::Cast(AValBuf[e]);
 }
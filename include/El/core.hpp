@@ -89,6 +89,7 @@ typedef __float128 Quad;
 #include "El/core/imports/valgrind.hpp"
 #include "El/core/imports/omp.hpp"
 #include "El/core/imports/mpc.hpp"
+#include "El/core/DoubleDouble.hpp"
 #include "El/core/Memory.hpp"
 #include "El/core/Element/decl.hpp"
 #include "El/core/types.hpp"
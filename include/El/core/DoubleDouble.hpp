@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_DOUBLEDOUBLE_HPP
+#define EL_DOUBLEDOUBLE_HPP
+
+namespace El {
+
+// A "double-double" is the unevaluated sum of two doubles, hi + lo, with
+// |lo| <= ulp(hi)/2, which provides roughly 106 bits of precision (versus
+// the 113 of Quad) with the exponent range of a double. The arithmetic is
+// built from the error-free transformations of Knuth and Dekker (as in the
+// QD library of Hida, Li, and Bailey), with the exact products formed via
+// fused multiply-adds, and is thus several times faster than the software
+// emulation of Quad.
+//
+// The struct is trivially copyable so that Memory, MemCopy, and the BLAS
+// kernels may treat it as a pair of doubles.
+
+namespace dd {
+
+// Error-free transformations
+// ==========================
+
+// s + e = a + b, assuming |a| >= |b|
+inline double QuickTwoSum( double a, double b, double& e ) EL_NO_EXCEPT
+{
+    const double s = a + b;
+    e = b - (s-a);
+    return s;
+}
+
+// s + e = a + b
+inline double TwoSum( double a, double b, double& e ) EL_NO_EXCEPT
+{
+    const double s = a + b;
+    const double bb = s - a;
+    e = (a-(s-bb)) + (b-bb);
+    return s;
+}
+
+// p + e = a b
+inline double TwoProd( double a, double b, double& e ) EL_NO_EXCEPT
+{
+    const double p = a*b;
+    e = std::fma( a, b, -p );
+    return p;
+}
+
+// s + e = a, where both halves of the 64-bit integer are exactly
+// representable (and so no conversion of s back to an integer is required)
+inline double TwoSumInteger( long long int a, double& e ) EL_NO_EXCEPT
+{
+    const double aHi = double(a >> 32)*4294967296.;
+    const double aLo = double(a & 0xffffffffLL);
+    return TwoSum( aHi, aLo, e );
+}
+
+inline double TwoSumInteger( unsigned long long a, double& e ) EL_NO_EXCEPT
+{
+    const double aHi = double(a >> 32)*4294967296.;
+    const double aLo = double(a & 0xffffffffULL);
+    return TwoSum( aHi, aLo, e );
+}
+
+// Round hi + lo towards zero. If hi is not an integer, then |lo| is too
+// small to carry the sum past one, and otherwise the sum lies on the same
+// side of zero as hi, so that the sign of lo decides whether its integer
+// part is rounded down or up.
+template<typename T>
+inline T Truncate( double hi, double lo ) EL_NO_EXCEPT
+{
+    if( std::trunc(hi) != hi || lo == 0 )
+        return static_cast<T>(hi);
+    const double loInt = ( hi > 0 ? std::floor(lo) : std::ceil(lo) );
+    if( loInt >= 0 )
+        return static_cast<T>(hi) + static_cast<T>(loInt);
+    if( std::abs(hi) < 9007199254740992. )
+        return static_cast<T>(hi) - static_cast<T>(-loInt);
+
+    // hi might only be in the range of T once lo is added (e.g., 2^63-1 is
+    // stored as 2^63 - 1), but, beyond 2^53, it is even and can be halved
+    const T hiHalf = static_cast<T>(hi/2);
+    return hiHalf + (hiHalf - static_cast<T>(-loInt));
+}
+
+} // namespace dd
+
+struct DoubleDouble
+{
+    double hi, lo;
+
+    DoubleDouble() = default;
+    DoubleDouble( double a, double b ) EL_NO_EXCEPT : hi(a), lo(b) { }
+
+    DoubleDouble( const float& a ) EL_NO_EXCEPT : hi(a), lo(0) { }
+    DoubleDouble( const double& a ) EL_NO_EXCEPT : hi(a), lo(0) { }
+    DoubleDouble( const int& a ) EL_NO_EXCEPT : hi(a), lo(0) { }
+    DoubleDouble( const unsigned& a ) EL_NO_EXCEPT : hi(a), lo(0) { }
+    // 64-bit integers are not always exactly representable by a double
+    DoubleDouble( const long int& a ) EL_NO_EXCEPT
+    { hi = dd::TwoSumInteger( static_cast<long long int>(a), lo ); }
+    DoubleDouble( const long long int& a ) EL_NO_EXCEPT
+    { hi = dd::TwoSumInteger( a, lo ); }
+    DoubleDouble( const unsigned long& a ) EL_NO_EXCEPT
+    { hi = dd::TwoSumInteger( static_cast<unsigned long long>(a), lo ); }
+    DoubleDouble( const unsigned long long& a ) EL_NO_EXCEPT
+    { hi = dd::TwoSumInteger( a, lo ); }
+    DoubleDouble( const long double& a ) EL_NO_EXCEPT
+    : hi(double(a)), lo(double(a-(long double)hi)) { }
+#ifdef EL_HAVE_QUAD
+    DoubleDouble( const Quad& a ) EL_NO_EXCEPT
+    : hi(double(a)), lo(double(a-Quad(hi))) { }
+#endif
+
+    // Casting
+    explicit operator bool() const EL_NO_EXCEPT { return hi != 0; }
+    explicit operator int() const EL_NO_EXCEPT
+    { return dd::Truncate<int>( hi, lo ); }
+    explicit operator long int() const EL_NO_EXCEPT
+    { return dd::Truncate<long int>( hi, lo ); }
+    explicit operator long long int() const EL_NO_EXCEPT
+    { return dd::Truncate<long long int>( hi, lo ); }
+    explicit operator unsigned() const EL_NO_EXCEPT
+    { return dd::Truncate<unsigned>( hi, lo ); }
+    explicit operator unsigned long() const EL_NO_EXCEPT
+    { return dd::Truncate<unsigned long>( hi, lo ); }
+    explicit operator unsigned long long() const EL_NO_EXCEPT
+    { return dd::Truncate<unsigned long long>( hi, lo ); }
+    explicit operator float() const EL_NO_EXCEPT { return float(hi); }
+    explicit operator double() const EL_NO_EXCEPT { return hi; }
+    explicit operator long double() const EL_NO_EXCEPT
+    { return (long double)hi + (long double)lo; }
+#ifdef EL_HAVE_QUAD
+    explicit operator Quad() const EL_NO_EXCEPT { return Quad(hi) + Quad(lo); }
+#endif
+
+    DoubleDouble& operator+=( const DoubleDouble& b ) EL_NO_EXCEPT
+    {
+        double e, f;
+        double s = dd::TwoSum( hi, b.hi, e );
+        const double t = dd::TwoSum( lo, b.lo, f );
+        e += t;
+        s = dd::QuickTwoSum( s, e, e );
+        e += f;
+        hi = dd::QuickTwoSum( s, e, lo );
+        return *this;
+    }
+
+    DoubleDouble& operator-=( const DoubleDouble& b ) EL_NO_EXCEPT
+    { return *this += DoubleDouble(-b.hi,-b.lo); }
+
+    DoubleDouble& operator*=( const DoubleDouble& b ) EL_NO_EXCEPT
+    {
+        double e;
+        const double p = dd::TwoProd( hi, b.hi, e );
+        e = std::fma( hi, b.lo, std::fma( lo, b.hi, e ) );
+        hi = dd::QuickTwoSum( p, e, lo );
+        return *this;
+    }
+
+    DoubleDouble& operator/=( const DoubleDouble& b ) EL_NO_EXCEPT
+    {
+        // Three steps of long division
+        const double q1 = hi / b.hi;
+        DoubleDouble r = *this;
+        r -= DoubleDouble(q1)*=b;
+        const double q2 = r.hi / b.hi;
+        r -= DoubleDouble(q2)*=b;
+        const double q3 = r.hi / b.hi;
+        double e;
+        const double q = dd::QuickTwoSum( q1, q2, e );
+        *this = DoubleDouble(q,e);
+        return *this += DoubleDouble(q3);
+    }
+
+    DoubleDouble operator-() const EL_NO_EXCEPT
+    { return DoubleDouble(-hi,-lo); }
+    DoubleDouble operator+() const EL_NO_EXCEPT
+    { return *this; }
+};
+
+inline DoubleDouble
+operator+( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return DoubleDouble(a) += b; }
+inline DoubleDouble
+operator-( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return DoubleDouble(a) -= b; }
+inline DoubleDouble
+operator*( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return DoubleDouble(a) *= b; }
+inline DoubleDouble
+operator/( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return DoubleDouble(a) /= b; }
+
+inline bool
+operator==( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return a.hi == b.hi && a.lo == b.lo; }
+inline bool
+operator!=( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return !(a == b); }
+inline bool
+operator<( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+inline bool
+operator>( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return b < a; }
+inline bool
+operator<=( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return !(b < a); }
+inline bool
+operator>=( const DoubleDouble& a, const DoubleDouble& b ) EL_NO_EXCEPT
+{ return !(a < b); }
+
+std::ostream& operator<<( std::ostream& os, const DoubleDouble& alpha );
+std::istream& operator>>( std::istream& is,       DoubleDouble& alpha );
+
+} // namespace El
+
+#endif // ifndef EL_DOUBLEDOUBLE_HPP
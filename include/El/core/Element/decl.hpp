@@ -60,6 +60,7 @@ template<> std::string TypeName<Complex<Quad>>();
 #ifdef EL_HAVE_MPC
 template<> std::string TypeName<BigFloat>();
 #endif
+template<> std::string TypeName<DoubleDouble>();
 
 // For usage in EnableIf
 // =====================
@@ -83,6 +84,7 @@ template<> struct IsScalar<float> { static const bool value=true; };
 template<> struct IsScalar<double> { static const bool value=true; };
 template<> struct IsScalar<Complex<float>> { static const bool value=true; };
 template<> struct IsScalar<Complex<double>> { static const bool value=true; };
+template<> struct IsScalar<DoubleDouble> { static const bool value=true; };
 #ifdef EL_HAVE_QUAD
 template<> struct IsScalar<Quad> { static const bool value=true; };
 template<> struct IsScalar<Complex<Quad>> { static const bool value=true; };
@@ -107,7 +109,13 @@ struct PrecisionIsGreater
 { static const bool value=false; };
 template<> struct PrecisionIsGreater<double,float>
 { static const bool value=true; };
+template<> struct PrecisionIsGreater<DoubleDouble,double>
+{ static const bool value=true; };
+template<> struct PrecisionIsGreater<DoubleDouble,float>
+{ static const bool value=true; };
 #ifdef EL_HAVE_QUAD
+template<> struct PrecisionIsGreater<Quad,DoubleDouble>
+{ static const bool value=true; };
 template<> struct PrecisionIsGreater<Quad,double>
 { static const bool value=true; };
 template<> struct PrecisionIsGreater<Quad,float>
@@ -120,6 +128,8 @@ template<> struct PrecisionIsGreater<Quad,float>
 template<> struct PrecisionIsGreater<BigFloat,Quad>
 { static const bool value=true; };
 #endif
+template<> struct PrecisionIsGreater<BigFloat,DoubleDouble>
+{ static const bool value=true; };
 template<> struct PrecisionIsGreater<BigFloat,double>
 { static const bool value=true; };
 template<> struct PrecisionIsGreater<BigFloat,float>
@@ -201,6 +211,7 @@ template<> struct IsData<float> { static const bool value=true; };
 template<> struct IsData<double> { static const bool value=true; };
 template<> struct IsData<Complex<float>> { static const bool value=true; };
 template<> struct IsData<Complex<double>> { static const bool value=true; };
+template<> struct IsData<DoubleDouble> { static const bool value=true; };
 #ifdef EL_HAVE_QUAD
 template<> struct IsData<Quad> { static const bool value=true; };
 template<> struct IsData<Complex<Quad>> { static const bool value=true; };
@@ -308,6 +319,7 @@ template<> Quad Abs( const Complex<Quad>& alpha ) EL_NO_EXCEPT;
 #ifdef EL_HAVE_MPC
 template<> BigFloat Abs( const BigFloat& alpha ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Abs( const DoubleDouble& alpha ) EL_NO_EXCEPT;
 
 // Carefully avoid unnecessary overflow in an absolute value computation
 // ---------------------------------------------------------------------
@@ -346,6 +358,7 @@ template<> Complex<Quad> Exp( const Complex<Quad>& alpha ) EL_NO_EXCEPT;
 #ifdef EL_HAVE_MPC
 template<> BigFloat Exp( const BigFloat& alpha ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Exp( const DoubleDouble& alpha ) EL_NO_EXCEPT;
 
 template<typename F,typename T,
          typename=EnableIf<IsScalar<F>>,
@@ -366,6 +379,8 @@ template<> Complex<Quad> Pow
 template<> BigFloat Pow
 ( const BigFloat& alpha, const BigFloat& beta ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Pow
+( const DoubleDouble& alpha, const DoubleDouble& beta ) EL_NO_EXCEPT;
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Log( const F& alpha );
@@ -376,6 +391,7 @@ template<> Complex<Quad> Log( const Complex<Quad>& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Log( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Log( const DoubleDouble& alpha );
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 Real Log2( const Real& alpha );
@@ -385,6 +401,7 @@ template<> Quad Log2( const Quad& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Log2( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Log2( const DoubleDouble& alpha );
 template<typename Integer,typename=EnableIf<IsIntegral<Integer>>,typename=void>
 double Log2( const Integer& alpha );
 
@@ -397,6 +414,7 @@ template<> Complex<Quad> Sqrt( const Complex<Quad>& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Sqrt( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Sqrt( const DoubleDouble& alpha );
 
 // Trigonometric functions
 // =======================
@@ -543,6 +561,7 @@ template<> Quad Round( const Quad& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Round( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Round( const DoubleDouble& alpha );
 
 // Ceiling
 // -------
@@ -560,6 +579,7 @@ template<> Quad Ceil( const Quad& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Ceil( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Ceil( const DoubleDouble& alpha );
 
 // Floor
 // -----
@@ -577,6 +597,7 @@ template<> Quad Floor( const Quad& alpha );
 #ifdef EL_HAVE_MPC
 template<> BigFloat Floor( const BigFloat& alpha );
 #endif
+template<> DoubleDouble Floor( const DoubleDouble& alpha );
 
 // Two-norm formation
 // ==================
@@ -599,6 +620,7 @@ template<> Quad Pi<Quad>();
 template<> BigFloat Pi<BigFloat>();
 BigFloat Pi( mpfr_prec_t prec );
 #endif
+template<> DoubleDouble Pi<DoubleDouble>();
 
 // Gamma function (and its natural log)
 // ====================================
@@ -37,6 +37,49 @@ public:
     void Empty();
 };
 
+#ifdef EL_HAVE_MPC
+// Rather than each entry separately allocating its limbs, the entries are
+// constructed (via MPFR's custom interface) on top of a single contiguous,
+// aligned slab of limbs, with the limbs of entry k beginning at offset
+// k*NumLimbs(). Copies of and arithmetic on such buffers therefore stream
+// through memory rather than chasing an independent pointer per entry.
+//
+// NOTE: Only copies between slab-contiguous ranges of a common precision
+//       reduce to a single memmove (see MemCopy). Packing for MPI is still
+//       performed entry by entry, as the registered reduction operations
+//       expect each entry's header to be interleaved with its limbs.
+template<>
+class Memory<BigFloat>
+{
+    size_t size_;
+    BigFloat* buffer_;
+    mp_limb_t* rawLimbs_;
+    mp_limb_t* limbs_;
+    size_t numLimbs_;
+public:
+    Memory();
+    Memory( size_t size );
+    ~Memory();
+
+    Memory( Memory<BigFloat>&& mem );
+    Memory<BigFloat>& operator=( Memory<BigFloat>&& mem );
+
+    // Exchange metadata with 'mem'
+    void ShallowSwap( Memory<BigFloat>& mem );
+
+    BigFloat* Buffer() const EL_NO_EXCEPT;
+    size_t Size() const EL_NO_EXCEPT;
+
+    // The slab of limbs and the number of limbs per entry
+    mp_limb_t* Limbs() const EL_NO_EXCEPT;
+    size_t NumLimbs() const EL_NO_EXCEPT;
+
+    BigFloat* Require( size_t size );
+    void Release();
+    void Empty();
+};
+#endif // ifdef EL_HAVE_MPC
+
 } // namespace El
 
 #endif // ifndef EL_MEMORY_HPP
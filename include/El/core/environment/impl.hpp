@@ -41,8 +41,45 @@ MemCopy( T* dest, const T* source, size_t numEntries )
 inline void
 MemCopy( BigFloat* dest, const BigFloat* source, size_t numEntries )
 {
+    if( numEntries == 0 )
+        return;
+
+    // If both ranges lie contiguously within a slab of limbs (as is the
+    // case for the entries of a Memory<BigFloat>) with a common precision,
+    // then the limbs can be copied with a single memcpy
+    const mpfr_prec_t prec = source[0].Precision();
+    const size_t numLimbs = source[0].NumLimbs();
+    const mp_limb_t* sourceLimbs = source[0].LockedPointer()->_mpfr_d;
+    mp_limb_t* destLimbs = dest[0].Pointer()->_mpfr_d;
+    bool contiguous = true;
     for( size_t k=0; k<numEntries; ++k )
-        dest[k] = source[k];
+    {
+        if( source[k].OwnsLimbs() || dest[k].OwnsLimbs() ||
+            source[k].Precision() != prec || dest[k].Precision() != prec ||
+            source[k].LockedPointer()->_mpfr_d != &sourceLimbs[k*numLimbs] ||
+            dest[k].LockedPointer()->_mpfr_d != &destLimbs[k*numLimbs] )
+        {
+            contiguous = false;
+            break;
+        }
+    }
+    if( contiguous )
+    {
+        for( size_t k=0; k<numEntries; ++k )
+        {
+            mpfr_ptr destPtr = dest[k].Pointer();
+            mpfr_srcptr sourcePtr = source[k].LockedPointer();
+            destPtr->_mpfr_sign = sourcePtr->_mpfr_sign;
+            destPtr->_mpfr_exp = sourcePtr->_mpfr_exp;
+        }
+        std::memmove
+        ( destLimbs, sourceLimbs, numEntries*numLimbs*sizeof(mp_limb_t) );
+    }
+    else
+    {
+        for( size_t k=0; k<numEntries; ++k )
+            dest[k] = source[k];
+    }
 }
 #endif
 
@@ -67,6 +67,10 @@ void Axpy
   const double* x, BlasInt incx,
         double* y, BlasInt incy );
 void Axpy
+( BlasInt n, DoubleDouble alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy );
+void Axpy
 ( BlasInt n, scomplex alpha, 
   const scomplex* x, BlasInt incx,
         scomplex* y, BlasInt incy );
@@ -107,6 +111,10 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
 
 template<typename T>
 T Dotc
@@ -127,6 +135,10 @@ double Dotu
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+DoubleDouble Dotu
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
 
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx );
@@ -226,6 +238,11 @@ void Gemv
                 const double* x, BlasInt incx,
   double beta,        double* y, BlasInt incy );
 void Gemv
+( char trans, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* x, BlasInt incx,
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
+void Gemv
 ( char trans, BlasInt m, BlasInt n,
   scomplex alpha, const scomplex* A, BlasInt ALDim, 
                   const scomplex* x, BlasInt incx,
@@ -511,6 +528,11 @@ void Gemm
                 const double* B, BlasInt BLDim,
   double beta,        double* C, BlasInt CLDim );
 void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
+void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
   scomplex alpha, const scomplex* A, BlasInt ALDim, 
                   const scomplex* B, BlasInt BLDim,
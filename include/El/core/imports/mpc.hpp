@@ -45,11 +45,23 @@ mpfr_rnd_t RoundingMode();
 // This API is extremely loosely related to that of Pavel Holoborodko's
 // MPFR C++, which was not used within Elemental for a variety of 
 // idiosyncratic reasons.
+//
+// A BigFloat normally owns its limbs (via mpfr_init2), but the entries of a
+// Memory<BigFloat> instead point into a single contiguous slab of limbs
+// (via MPFR's custom interface), which avoids an allocation per entry.
+// Such entries never exchange their limbs with another BigFloat.
+
+template<typename G> class Memory;
 
 class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    bool ownsLimbs_=true;
+
+    // Only used by Memory<BigFloat>
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
+    friend class Memory<BigFloat>;
 
 public:
     mpfr_ptr    Pointer();
@@ -59,6 +71,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        OwnsLimbs() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
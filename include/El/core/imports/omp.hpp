@@ -40,4 +40,11 @@
 # define EL_OUTER_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR_COLLAPSE2
 #endif
 
+// Request vectorization of an inner loop whose iterations are independent
+#if defined(_OPENMP) && _OPENMP >= 201307
+# define EL_SIMD _Pragma("omp simd")
+#else
+# define EL_SIMD
+#endif
+
 #endif // ifndef EL_IMPORTS_OMP_HPP
@@ -77,6 +77,29 @@ template<typename Real,typename=EnableIf<IsReal<Real>>>
 inline bool IsFinite( const Real& alpha )
 { return std::isfinite(alpha); }
 
+// A double-double has the exponent range of a double, but, since its
+// trailing word may be subnormal, we only claim a precision of 2^-104
+template<> inline DoubleDouble Max<DoubleDouble>( const DoubleDouble& alpha )
+{ return DoubleDouble(std::numeric_limits<double>::max()); }
+template<> inline DoubleDouble Min<DoubleDouble>( const DoubleDouble& alpha )
+{ return DoubleDouble(std::ldexp(1.,-969)); }
+template<>
+inline DoubleDouble Lowest<DoubleDouble>( const DoubleDouble& alpha )
+{ return -Max<DoubleDouble>(alpha); }
+
+template<> inline DoubleDouble Precision( const DoubleDouble& alpha )
+{ return DoubleDouble(std::ldexp(1.,-104)); }
+template<> inline DoubleDouble Epsilon( const DoubleDouble& alpha )
+{ return DoubleDouble(std::ldexp(1.,-105)); }
+
+template<>
+inline DoubleDouble Infinity<DoubleDouble>( const DoubleDouble& alpha )
+{ return DoubleDouble(std::numeric_limits<double>::infinity()); }
+
+template<>
+inline bool IsFinite( const DoubleDouble& alpha )
+{ return std::isfinite(alpha.hi); }
+
 #ifdef EL_HAVE_QUAD
 template<>
 inline ExponentType<Quad> MaxExponent<Quad>( const Quad& alpha )
@@ -10,6 +10,8 @@
 #ifndef EL_IO_HPP
 #define EL_IO_HPP
 
+#include <future>
+
 namespace El {
 
 const char* QtImageFormat( FileFormat format );
@@ -154,6 +156,52 @@ void Read
 ( AbstractDistMatrix<T>& A, 
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Streaming
+// =========
+// Reads a (column-major) BINARY or BINARY_FLAT matrix in blocks of rows so
+// that matrices which do not fit in memory can be processed out-of-core.
+// If 'prefetch' is true, the next block is read asynchronously while the
+// current one is being processed (i.e., the reads are double-buffered).
+// The height and width must be specified for BINARY_FLAT files.
+template<typename T>
+class RowChunkStream
+{
+public:
+    RowChunkStream
+    ( const string filename, Int chunkSize, FileFormat format=AUTO,
+      Int height=-1, Int width=-1, bool prefetch=true );
+    ~RowChunkStream();
+
+    Int Height() const;
+    Int Width() const;
+    Int ChunkSize() const;
+    Int NumChunks() const;
+
+    // Restart the stream from the first block of rows
+    void Rewind();
+
+    // Overwrite 'chunk' with the next block of rows and set 'rowOffset' to
+    // the index of its first row. False is returned once the stream has been
+    // exhausted.
+    bool Next( Matrix<T>& chunk, Int& rowOffset );
+
+private:
+    string filename_;
+    std::ifstream file_;
+    std::streamoff dataOffset_;
+    Int height_, width_, chunkSize_;
+    bool prefetch_;
+
+    Int nextChunk_, pendingChunk_;
+    Matrix<T> buffer_;
+    std::future<bool> pending_;
+
+    bool ReadRows( Int rowBeg, Int numRows, T* buffer, Int ldim );
+    void ReadChunk( Int chunk, Matrix<T>& A );
+    void Prefetch( Int chunk );
+    void Wait();
+};
+
 // Spy
 // ===
 template<typename T>
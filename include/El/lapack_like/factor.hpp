@@ -392,6 +392,77 @@ Int RegularizedSolveAfter
         bool progress=false,
         bool time=false );
 
+// Solves with sparse-plus-low-rank matrices
+// -----------------------------------------
+// For systems of the form (A + diag(reg) + U U^H) X = B, where U is tall and
+// skinny (e.g., the contribution of a few dense columns to a normal matrix)
+// and only the sparse matrix S = A + diag(reg) has been factored, the
+// low-rank term is handled via the Sherman-Morrison-Woodbury formula,
+//
+//   inv(S + U U^H) = inv(S) - W inv(I + U^H W) W^H,  where W = inv(S) U,
+//
+// which is used as the preconditioner for iterative refinement. 
+// FormLowRankCorrection should be called once per factorization in order to
+// form W and the Cholesky factor of the k x k Schur complement I + U^H W.
+template<typename F>
+struct LowRankCorrection
+{
+    Matrix<F> U, W;
+    Matrix<F> schur;
+};
+
+template<typename F>
+struct DistLowRankCorrection
+{
+    DistMultiVec<F> U, W;
+    // NOTE: The Cholesky factor of the Schur complement is redundantly stored
+    Matrix<F> schur;
+
+    DistLowRankCorrection( mpi::Comm comm=mpi::COMM_WORLD )
+    : U(comm), W(comm)
+    { }
+};
+
+template<typename F>
+void FormLowRankCorrection
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        LowRankCorrection<F>& correction );
+template<typename F>
+void FormLowRankCorrection
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistLowRankCorrection<F>& correction );
+
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const LowRankCorrection<F>& correction,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        Matrix<F>& B,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false,
+        bool time=false );
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistLowRankCorrection<F>& correction,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistMultiVec<F>& B,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false,
+        bool time=false );
+
 template<typename F>
 Int SolveAfter
 ( const SparseMatrix<F>& A,
@@ -28,6 +28,9 @@ typedef struct {
   float power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulz;
+  float newtonSchulzThresh;
+  ElInt newtonSchulzDegree;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
 
@@ -37,6 +40,9 @@ typedef struct {
   double power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulz;
+  double newtonSchulzThresh;
+  ElInt newtonSchulzDegree;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
 
@@ -32,6 +32,18 @@ struct SignCtrl
     Real power=1;
     SignScaling scaling=SIGN_SCALE_FROB;
     bool progress=false;
+
+    // If enabled, once || X^2 - I ||_1 <= newtonSchulzThresh, switch from
+    // the inversion-based Newton iteration to the inverse-free [k/0] Pade
+    // iteration, with k=newtonSchulzDegree, which only requires Gemm's.
+    // The degree one iteration is Newton-Schulz. Since this changes the
+    // iterates (and the iteration count), it must be explicitly requested.
+    bool newtonSchulz=false;
+    Real newtonSchulzThresh=Real(1)/Real(2);
+    Int newtonSchulzDegree=1;
+
+    // The number of iterations (of either kind) taken by the last call
+    mutable Int numIts=0;
 };
 
 template<typename Real>
@@ -43,6 +55,32 @@ struct SquareRootCtrl
     bool progress=false;
 };
 
+template<typename Real>
+struct MatrixLogCtrl
+{
+    // The maximum number of square roots taken before the Pade approximant
+    // of log(I+X) is applied
+    Int maxSqrts=64;
+    SquareRootCtrl<Real> sqrtCtrl;
+    bool progress=false;
+};
+
+template<typename Real>
+struct SchurParlettCtrl
+{
+    // Eigenvalues which are (transitively) within blockTol of each other are
+    // grouped into the same diagonal block after reordering the Schur form
+    Real blockTol=Real(1)/Real(10);
+
+    // Consecutive clusters are merged into diagonal blocks of roughly this
+    // size so that the block Parlett recurrence is dominated by Gemm
+    Int blockSize=64;
+
+    Int maxTaylorTerms=250;
+    bool progress=false;
+    SchurCtrl<Real> schurCtrl;
+};
+
 // Hermitian function
 // ==================
 template<typename F>
@@ -62,6 +100,22 @@ void HermitianFunction
 ( UpperOrLower uplo, ElementalMatrix<Complex<Real>>& A,
   function<Complex<Real>(Real)> func );
 
+// General matrix function
+// ========================
+// Compute f(A) for a general square A using a blocked Schur-Parlett
+// algorithm. The function should return the k'th derivative of f when called
+// as func(z,k).
+template<typename Real>
+void MatrixFunction
+( Matrix<Complex<Real>>& A,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl=SchurParlettCtrl<Real>() );
+template<typename Real>
+void MatrixFunction
+( ElementalMatrix<Complex<Real>>& A,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl=SchurParlettCtrl<Real>() );
+
 // Inverse
 // =======
 template<typename F>
@@ -123,6 +177,32 @@ template<typename F>
 void LocalTriangularInverse
 ( UpperOrLower uplo, UnitOrNonUnit diag, DistMatrix<F,STAR,STAR>& A );
 
+// Matrix exponential
+// ==================
+// Pade scaling and squaring
+template<typename F>
+void MatrixExp( Matrix<F>& A );
+template<typename F>
+void MatrixExp( ElementalMatrix<F>& A );
+
+// Overwrite B with exp(t A) B without forming exp(t A)
+template<typename F>
+void MatrixExpAction( const SparseMatrix<F>& A, Matrix<F>& B, Base<F> t=1 );
+template<typename F>
+void MatrixExpAction
+( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, Base<F> t=1 );
+
+// Matrix logarithm
+// ================
+// Inverse scaling and squaring
+template<typename F>
+void MatrixLog
+( Matrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl=MatrixLogCtrl<Base<F>>() );
+template<typename F>
+void MatrixLog
+( ElementalMatrix<F>& A,
+  const MatrixLogCtrl<Base<F>>& ctrl=MatrixLogCtrl<Base<F>>() );
+
 // Pseudoinverse
 // =============
 template<typename F>
@@ -141,19 +221,20 @@ void HermitianPseudoinverse
 // ====
 template<typename F>
 void Sign
-( Matrix<F>& A, const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl=SignCtrl<Base<F>>() );
 template<typename F>
 void Sign
-( ElementalMatrix<F>& A, const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+( ElementalMatrix<F>& A,
+  const SignCtrl<Base<F>>& ctrl=SignCtrl<Base<F>>() );
 
 template<typename F>
 void Sign
 ( Matrix<F>& A, Matrix<F>& N, 
-  const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  const SignCtrl<Base<F>>& ctrl=SignCtrl<Base<F>>() );
 template<typename F>
 void Sign
 ( ElementalMatrix<F>& A, ElementalMatrix<F>& N, 
-  const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  const SignCtrl<Base<F>>& ctrl=SignCtrl<Base<F>>() );
 
 template<typename F>
 void HermitianSign
@@ -155,6 +155,16 @@ EL_EXPORT ElError ElHermitianTridiagEigPairPartialDist_z
 
 /* Hermitian eigensolvers
    ====================== */
+/* PolarCtrl */
+typedef struct {
+  bool qdwh;
+  bool colPiv;
+  ElInt maxIts;
+  ElInt numIts;
+  double qdwhCholThreshold;
+} ElPolarCtrl;
+EL_EXPORT ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl );
+
 /* HermitianSDCCtrl */
 typedef struct {
   ElInt cutoff;
@@ -162,6 +172,8 @@ typedef struct {
   float tol;
   float spreadFactor;
   bool progress;
+  bool qdwh;
+  ElPolarCtrl polarCtrl;
 } ElHermitianSDCCtrl_s;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_s( ElHermitianSDCCtrl_s* ctrl );
 
@@ -171,6 +183,8 @@ typedef struct {
   double tol;
   double spreadFactor;
   bool progress;
+  bool qdwh;
+  ElPolarCtrl polarCtrl;
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
@@ -646,14 +660,7 @@ EL_EXPORT ElError ElHermitianSVDDist_z
 
 /* Polar decomposition
    =================== */
-/* PolarCtrl */
-typedef struct {
-  bool qdwh;
-  bool colPiv;
-  ElInt maxIts;
-  ElInt numIts;
-} ElPolarCtrl;
-EL_EXPORT ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl );
+/* NOTE: ElPolarCtrl is declared above since ElHermitianSDCCtrl uses it */
 
 /* Compute just the polar factor
    ----------------------------- */
@@ -832,21 +839,29 @@ EL_EXPORT ElError ElEigDist_z
 /* SVDCtrl */
 typedef struct {
   bool seqQR;
+  bool distDC;
+  ElInt dcCutoff;
   double valChanRatio;
   double fullChanRatio;
   bool thresholded;
   bool relative;
   float tol;
+  bool useQDWH;
+  ElHermitianSDCCtrl_s qdwhCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
 
 typedef struct {
   bool seqQR;
+  bool distDC;
+  ElInt dcCutoff;
   double valChanRatio;
   double fullChanRatio;
   bool thresholded;
   bool relative;
   double tol;
+  bool useQDWH;
+  ElHermitianSDCCtrl_d qdwhCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
 
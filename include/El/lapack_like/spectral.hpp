@@ -24,6 +24,20 @@ struct HermitianEigSubset
     Real lowerBound=0, upperBound=0;
 };
 
+// NOTE: PolarCtrl is declared here since HermitianSDCCtrl makes use of it
+struct PolarCtrl 
+{
+    bool qdwh=false;
+    bool colPiv=false;
+    Int maxIts=20;
+    mutable Int numIts=0;
+
+    // QDWH switches from QR-based to Cholesky-based iterations once the 
+    // dynamic weight c (which bounds the condition number of I + c A^H A)
+    // drops below this threshold
+    double qdwhCholThreshold=100;
+};
+
 template<typename Real>
 struct HermitianSDCCtrl 
 {
@@ -32,6 +46,12 @@ struct HermitianSDCCtrl
     Real tol=0;
     Real spreadFactor=1e-6;
     bool progress=false;
+
+    // If true, each split is first attempted with a deterministic QDWH-based
+    // spectral projector about the median of the diagonal (Nakatsukasa and
+    // Higham's QDWH-eig), falling back to randomized shifts on failure
+    bool qdwh=false;
+    PolarCtrl polarCtrl;
 };
 
 template<typename F>
@@ -223,14 +243,6 @@ void Sort
 
 // Polar decomposition
 // ===================
-struct PolarCtrl 
-{
-    bool qdwh=false;
-    bool colPiv=false;
-    Int maxIts=20;
-    mutable Int numIts=0;
-};
-
 template<typename F>
 void Polar( Matrix<F>& A, const PolarCtrl& ctrl=PolarCtrl() );
 template<typename F>
@@ -472,6 +484,18 @@ struct SVDCtrl
     // algorithm is always run.
     bool seqQR=false;
 
+    // Whether or not distributed implementations should use a parallel
+    // bidiagonal divide and conquer algorithm, rather than the QR algorithm,
+    // when computing singular vectors. Subtrees of the recursion are solved
+    // by individual processes and the remaining merges are formed with
+    // distributed Gemm's.
+    // NOTE: Currently only supported for single and double precision
+    bool distDC=false;
+
+    // The largest bidiagonal subproblem which the divide and conquer
+    // algorithm solves directly with the QR algorithm
+    Int dcCutoff=64;
+
     // Chan's algorithm
     // ----------------
 
@@ -500,6 +524,16 @@ struct SVDCtrl
     // The numerical tolerance for the thresholding. If this value is kept at
     // zero, then a value is automatically chosen based upon the matrix
     Real tol=0; 
+
+    // QDWH-SVD
+    // --------
+    // If true, A = Q H is first computed via QDWH and then H = V Sigma V^H 
+    // is computed with QDWH-based spectral divide and conquer (recursing on
+    // subgrids), so that essentially all of the work is BLAS-3.
+    // NOTE: Currently only supported when computing both singular values
+    //       and vectors
+    bool useQDWH=false;
+    HermitianSDCCtrl<Real> qdwhCtrl;
 };
 
 // Compute the singular values
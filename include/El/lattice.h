@@ -58,6 +58,10 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    ElInt blocksize;
+    ElInt blockedCutoff;
+    ElInt kernelBlocksize;
+    ElInt kernelBlockedCutoff;
 } ElLLLCtrl_s;
 EL_EXPORT ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl );
 
@@ -75,6 +79,10 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    ElInt blocksize;
+    ElInt blockedCutoff;
+    ElInt kernelBlocksize;
+    ElInt kernelBlockedCutoff;
 } ElLLLCtrl_d;
 EL_EXPORT ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl );
 
@@ -124,6 +124,20 @@ struct LLLCtrl
     // 'startCol' columns are already processed
     bool jumpstart=false;
     Int startCol=0;
+
+    // Bases with at least 'blockedCutoff' columns (and at least as many rows
+    // as columns) are reduced with LLL_NORMAL by a blocked algorithm, which
+    // processes overlapping windows of 'blocksize' columns so that most of
+    // the work is performed with Level 3 BLAS.
+    Int blocksize=32;
+    Int blockedCutoff=200;
+
+    // LatticeImageAndKernel (and LatticeKernel) instead stream the columns
+    // of matrices with more columns than rows and at least
+    // 'kernelBlockedCutoff' columns in blocks of 'kernelBlocksize' columns
+    // (see BlockedLatticeImageAndKernel)
+    Int kernelBlocksize=32;
+    Int kernelBlockedCutoff=200;
 };
 
 // TODO: Maintain B in BigInt form
@@ -182,6 +196,45 @@ LLLInfo<Base<F>> RecursiveLLL
   Int cutoff=10,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// An adaptive-precision LLL which reduces the leading columns of B in
+// segments of 'ctrl.blocksize' columns. Each segment is first reduced (with
+// the reduction jumpstarted at the start of the segment) in the lowest
+// precision (double, then DoubleDouble, then Quad, then increasingly precise
+// BigFloat) that the size of its entries suggests might suffice; the
+// unimodular transformation is then applied, and the result verified, in the
+// original precision, with escalation to the next precision upon failure.
+// Bases with at most double precision are simply passed to LLL.
+template<typename F>
+LLLInfo<Base<F>> AdaptiveLLL
+( Matrix<F>& B,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+template<typename F>
+LLLInfo<Base<F>> AdaptiveLLL
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+// Villard's "all swaps" variant of LLL, which alternates between a blocked
+// (Level 3) size reduction and the simultaneous swapping of every even (or
+// every odd) pair of adjacent columns which violates the Lovasz condition.
+// Each phase is trivially parallel, and so this variant is used for threaded
+// and distributed reductions. The columns of B must be linearly independent,
+// and R is returned as an n x n upper-triangular matrix.
+template<typename F>
+LLLInfo<Base<F>> AllSwapsLLL
+( Matrix<F>& B,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+template<typename F>
+LLLInfo<Base<F>> AllSwapsLLL
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+template<typename F>
+LLLInfo<Base<F>> AllSwapsLLL
+( ElementalMatrix<F>& B,
+  ElementalMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 // Overwrite B, fill M with its (quasi-reduced) image of B, and fill K with the
 // LLL-reduced basis for the kernel of B.
 //
@@ -189,6 +242,15 @@ LLLInfo<Base<F>> RecursiveLLL
 // "A course in computational algebraic number theory". The main difference
 // is that we avoid solving the normal equations and call a least squares
 // solver.
+//
+// NOTE: When B has more columns than rows and at least
+//       'ctrl.kernelBlockedCutoff' columns (and 'ctrl.jumpstart' is false),
+//       BlockedLatticeImageAndKernel is called instead. M is then the
+//       LLL-reduced image basis produced by the last streamed block rather
+//       than the result of LLL on all of B, the least-squares reduction of M
+//       against K described above is skipped, and B is overwritten with
+//       [0, M] rather than with the LLL reduction of B. K is still an
+//       LLL-reduced basis for the kernel, and has the same rank.
 // 
 template<typename F>
 void LatticeImageAndKernel
@@ -206,6 +268,25 @@ void LatticeKernel
   Matrix<F>& K,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Fill M with an LLL-reduced basis for the image of B and K with the
+// LLL-reduced basis for its kernel without ever forming the unimodular
+// transformation of all of the columns of B. The columns are instead streamed
+// in blocks of 'ctrl.kernelBlocksize', and, after each block, LLL is only
+// applied to the reduced image of the preceding columns augmented with the
+// new block (at most rank(B)+kernelBlocksize columns). The (nearly) zero
+// columns that result are lifted to kernel vectors, which are only reduced
+// once at the end.
+//
+// For wide matrices with large kernels, this is much cheaper in both time
+// and memory than LatticeImageAndKernel, which calls this routine whenever B
+// has more columns than rows and at least 'ctrl.kernelBlockedCutoff' columns.
+template<typename F>
+void BlockedLatticeImageAndKernel
+( const Matrix<F>& B,
+        Matrix<F>& M,
+        Matrix<F>& K,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 // Search for Z-dependence
 // =======================
 // Search for Z-dependence of a vector of real or complex numbers, z, via
@@ -244,6 +325,80 @@ Int AlgebraicRelationSearch
   Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Multi-pair PSLQ
+// ===============
+// Search for integer relations of a real vector x, i.e., integer vectors a
+// such that x^T a = 0, via the multi-pair variant of the PSLQ algorithm of
+// Ferguson, Bailey, and Arno, as described in
+//
+//   David H. Bailey and David J. Broadhurst,
+//   "Parallel integer relation detection: Techniques and applications",
+//   Mathematics of Computation, Vol. 70, No. 236, pp. 1719--1736, 2000.
+//
+// Each iteration exchanges up to beta n independent pairs of rows, and most
+// iterations are performed in double (or Quad) precision, with the
+// accumulated integer transformations periodically applied in the precision
+// of x. For large dimensions, this is typically much faster than the above
+// LLL-based searches.
+
+template<typename Real>
+struct PSLQCtrl
+{
+    // Pairs are selected so as to maximize gamma^(i+1) |H(i,i)|, where gamma
+    // must be at least sqrt(4/3)
+    Real gamma=Real(2)/Sqrt(Real(3));
+
+    // The maximum number of exchanged pairs is beta n
+    Real beta=Real(2)/Real(5);
+
+    // An entry of y = B^T (x / || x ||_2) with magnitude at most 'zeroTol'
+    // signals that the corresponding column of B is a relation
+    Real zeroTol=Pow(limits::Epsilon<Real>(),Real(0.9));
+
+    Int maxIts=100000;
+
+    // Perform most of the iterations in double or Quad precision?
+    bool lowerPrecision=true;
+
+    bool progress=false;
+    bool time=false;
+};
+
+template<typename Real>
+struct PSLQInfo
+{
+    Int numIts=0;
+    Int numLowerIts=0;
+
+    // Every relation which was not found has a two-norm of at least
+    // 'normBound'
+    Real normBound=0;
+
+    Int nullity=0;
+};
+
+// Overwrite U with a unimodular matrix whose leading 'nullity' columns are
+// (nearly) exact integer relations of x
+template<typename Real>
+PSLQInfo<Real> PSLQ
+( const Matrix<Real>& x,
+        Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl=PSLQCtrl<Real>() );
+
+// PSLQ-based alternatives to the above searches; the number of relations
+// found is returned, and they are stored in the leading columns of U
+template<typename Real>
+Int ZDependenceSearch
+( const Matrix<Real>& z,
+        Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl );
+template<typename Real>
+Int AlgebraicRelationSearch
+( Real alpha,
+  Int n,
+  Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl );
+
 // Schnorr-Euchner enumeration
 // ===========================
 
@@ -266,6 +421,63 @@ Base<F> BoundedEnumeration
   const Matrix<Base<F>>& u,
         Matrix<F>& v );
 
+// Parallel enumeration
+// --------------------
+// The top 'cutDepth' levels of the Schnorr-Euchner tree are expanded into a
+// frontier of independent subtrees, which are then dynamically handed out
+// to the available threads (and, optionally, split between the processes
+// of a communicator). Whenever a shorter vector is found, the improved
+// radius is immediately shared with every thread so that all of the
+// remaining subtrees are pruned more aggressively; the radius is exchanged
+// between processes after every 'syncInterval' subtrees.
+//
+// NOTE: Threading is only enabled when Elemental was configured with
+//       EL_HYBRID (OpenMP).
+
+struct ParallelEnumCtrl
+{
+    // The number of trailing coordinates fixed within each subtree. If zero,
+    // the depth is increased until there are at least 'subtreesPerWorker'
+    // subtrees for each thread of each process.
+    Int cutDepth=0;
+    Int subtreesPerWorker=16;
+
+    // The number of subtrees each process searches between exchanges of the
+    // best radius found so far (only relevant for distributed enumeration)
+    Int syncInterval=64;
+
+    bool progress=false;
+    bool time=false;
+};
+
+// Search for the shortest nonzero member of the lattice with Gaussian Normal
+// Form R with norm strictly less than 'normUpperBound' and whose partial
+// norms satisfy
+//
+//   || (B v)(n-1-i:n-1) ||_2^2 < coeffs(i) radius^2,
+//
+// where the radius is tightened each time a shorter vector is found. An
+// empty 'coeffs' corresponds to no pruning (all coefficients equal to one).
+// As with BoundedEnumeration, a value greater than 'normUpperBound' is
+// returned if no such vector exists.
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<F>& R,
+  const Matrix<Base<F>>& coeffs,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const ParallelEnumCtrl& ctrl=ParallelEnumCtrl() );
+// Split the subtrees between the processes in 'comm' (each of which should
+// provide the same R, coefficients, and bound)
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<F>& R,
+  const Matrix<Base<F>>& coeffs,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+        mpi::Comm comm,
+  const ParallelEnumCtrl& ctrl=ParallelEnumCtrl() );
+
 } // namespace svp
 
 // Given a reduced lattice B and its Gaussian Normal Form, R, either find a
@@ -300,6 +512,195 @@ Base<F> ShortestVectorEnumeration
         Matrix<F>& v,
   bool probabalistic=false );
 
+// Sieving
+// =======
+// A rank-progressive, batched variant of the Gauss sieve from
+//
+//   Daniele Micciancio and Panagiotis Voulgaris,
+//   "Faster exponential time algorithms for the shortest vector problem",
+//   SODA 2010,
+//
+// whose (heuristic) running time is single-exponential in the dimension,
+// rather than the superexponential time of enumeration. As suggested in
+//
+//   Thijs Laarhoven and Artur Mariano,
+//   "Progressive lattice sieving", PQCrypto 2018,
+//
+// the sublattices spanned by increasingly many of the leading columns of B
+// are sieved in turn, with the list of each carried over to the next.
+//
+// The list is stored in single precision within a contiguous, cache-aligned
+// database, and most pair tests are rejected by comparing 128-bit SimHashes
+// (the sign patterns of random projections) before any inner product is
+// formed. Batches of candidates are reduced against the list in parallel, as
+// are the searches for the list vectors reducible by each new vector.
+//
+// As with enumeration, B must be accompanied by its Gaussian Normal Form, R
+// (e.g., from LLL or BKZ), and the coordinates of the result are returned in
+// v. The columns of B must be linearly independent.
+//
+// NOTE: There is not currently a complex implementation.
+
+struct SieveCtrl
+{
+    // The sieve of each dimension is stopped once the number of candidates
+    // which were reduced to zero exceeds collisionRatio |L| + minCollisions,
+    // where |L| is the size of the list
+    double collisionRatio=0.1;
+    Int minCollisions=200;
+
+    // If positive, the sieve is stopped once the list has this many vectors
+    Int maxListSize=0;
+
+    // The number of candidates reduced against the list in parallel
+    // (if zero, four per thread)
+    Int batchSize=0;
+
+    // Begin by sieving the sublattice of the leading 'progressiveStart'
+    // columns?
+    bool progressive=true;
+    Int progressiveStart=10;
+
+    // Each pair test is skipped unless the Hamming distance between the
+    // SimHashes of the pair is at most 'simHashThreshold' (or at least
+    // 128-simHashThreshold). The expected distance is 128 theta/pi for a
+    // pair separated by an angle of theta, e.g., about 43 at the 60 degrees
+    // below which a pair of equal length is reducible.
+    bool simHash=true;
+    Int simHashThreshold=48;
+
+    // Samples are drawn using Klein's algorithm with a Gaussian width of
+    // samplerScale sqrt(log n) max_i |R(i,i)|
+    double samplerScale=1;
+
+    bool progress=false;
+    bool time=false;
+};
+
+// Either find a member of the lattice (given by B v) with norm less than the
+// upper bound (and return its norm), or return a value greater than the
+// upper bound.
+template<typename F>
+Base<F> ShortVectorSieve
+( const Matrix<F>& B,
+  const Matrix<F>& R,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const SieveCtrl& ctrl=SieveCtrl() );
+
+// Return the norm of the (approximately) shortest member of the lattice,
+// which is given by B v
+template<typename F>
+Base<F> ShortestVectorSieve
+( const Matrix<F>& B,
+  const Matrix<F>& R,
+        Matrix<F>& v,
+  const SieveCtrl& ctrl=SieveCtrl() );
+
+// Block Korkine-Zolotarev (BKZ) reduction
+// =======================================
+// Each 'tour' of BKZ walks a window of (at most) 'blocksize' columns across
+// the basis and, whenever the (pruned) enumeration of the projected block
+// lattice finds a vector shorter than sqrt(delta) times the Gram-Schmidt
+// norm of the leading column of the block, inserts said vector and updates
+// the basis with an LLL which is jumpstarted at the start of the block.
+//
+// Three of the modifications proposed in
+//
+//   Yuanmi Chen and Phong Q. Nguyen,
+//   "BKZ 2.0: Better Lattice Security Estimates", Asiacrypt 2011,
+//
+// are supported: extreme pruning (with rerandomized trials), bounding the
+// enumeration radius by a multiple of the Gaussian heuristic of the block,
+// and aborting after a fixed number of tours (or once the first basis vector
+// is within a given ratio of the Gaussian heuristic). The blocks are not
+// recursively preprocessed with a smaller BKZ, so this is not BKZ 2.0.
+//
+// NOTE: There is not currently a complex implementation.
+
+template<typename Real>
+struct BKZInfo
+{
+    Real delta;
+    Real eta;
+    Int rank;
+    Int nullity;
+    Int numSwaps;
+    Real logVol;
+
+    Int numTours;
+    Int numInsertions;
+};
+
+template<typename Real>
+struct BKZCtrl
+{
+    Int blocksize=20;
+
+    // If positive, the number of tours is bounded by 'maxTours'
+    // (the "early abort" strategy of Chen and Nguyen)
+    Int maxTours=0;
+
+    // If positive, BKZ is stopped once || b_0 ||_2 <= targetRatio GH(L)
+    Real targetRatio=0;
+
+    // If positive, the enumeration radius of each block is bounded by
+    // sqrt(ghFactor) times the Gaussian heuristic of the block
+    Real ghFactor=Real(11)/Real(10);
+
+    // Each enumeration only explores the nodes whose partial squared norms
+    // (over the last i+1 coordinates of the block) are within pruning
+    // coefficient i times the squared radius. If 'pruningCoeffs' is empty,
+    // the linear pruning function of Gama, Nguyen, and Regev, c_i=(i+1)/k,
+    // is used for each block of size k. Otherwise, it is interpreted as the
+    // (non-decreasing) coefficients for a block of size 'blocksize' and is
+    // subsampled for the smaller trailing blocks.
+    bool prune=true;
+    vector<Real> pruningCoeffs;
+
+    // The number of rerandomized enumerations of each block before it is
+    // declared reduced (extreme pruning trades the success probability of
+    // each trial for much cheaper trials)
+    Int numTrials=1;
+
+    // Both the initial reduction and the insertion updates are performed
+    // using the following LLL parameters (and delta is also the BKZ
+    // insertion parameter)
+    LLLCtrl<Real> lllCtrl;
+
+    bool progress=false;
+    bool time=false;
+};
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( Matrix<F>& B,
+  const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
+
+namespace bkz {
+
+// Search the block lattice with Gaussian Normal Form R for its shortest
+// vector with norm strictly less than 'radius' whose partial norms lie within
+// the pruning coefficients 'coeffs'. Each of the (numTrials-1) trials after
+// the first enumerates a rerandomized, LLL-reduced basis of the block, and
+// the coordinates of the result are returned with respect to R in 'v'. If
+// no such vector was found, a value of at least 'radius' is returned.
+template<typename Real>
+Real BlockEnumeration
+( const Matrix<Real>& R,
+        Real radius,
+  const Matrix<Real>& coeffs,
+        Int numTrials,
+        Matrix<Real>& v );
+
+} // namespace bkz
+
 } // namespace El
 
 #endif // ifndef EL_LATTICE_HPP
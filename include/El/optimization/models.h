@@ -735,14 +735,26 @@ EL_EXPORT ElError ElNMFDist_d
   ElDistMatrix_d Y );
 
 /* Expert versions */
+typedef enum {
+  EL_NMF_NNLS,
+  EL_NMF_HALS,
+  EL_NMF_BPP
+} ElNMFApproach;
+
 typedef struct {
+  ElNMFApproach approach;
   ElNNLSCtrl_s nnlsCtrl;
   ElInt maxIter;
+  float tol;
+  bool progress;
 } ElNMFCtrl_s;
 
 typedef struct {
+  ElNMFApproach approach;
   ElNNLSCtrl_d nnlsCtrl;
   ElInt maxIter;
+  double tol;
+  bool progress;
 } ElNMFCtrl_d;
 
 EL_EXPORT ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl );
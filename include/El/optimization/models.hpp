@@ -215,6 +215,108 @@ Int LogisticRegression
   Real gamma, Regularization penalty=L1_PENALTY,
   const ModelFitCtrl<Real>& ctrl=ModelFitCtrl<Real>() );
 
+// Stochastic, out-of-core model fitting
+// =====================================
+// Minimizes
+//
+//   sum_i f_i(a_i^T w + beta) + r(w)
+//
+// while streaming the rows, a_i^T, of A from disk in blocks (see
+// RowChunkStream) and taking proximal variance-reduced stochastic gradient
+// steps over random mini-batches drawn from each block, using either 
+// Prox-SVRG [1] or SAGA [2]. Only O(n) memory is needed beyond the block
+// buffers for SVRG, while SAGA additionally stores one scalar per row.
+//
+// 'lossDeriv(rows,t)' should overwrite each entry t_k with f_{rows[k]}'(t_k),
+// 'lossCurvature' should bound the second derivative of each f_i, and
+// 'regProx(w,tau)' should overwrite w with the proximal map of tau r.
+// If 'intercept' is true, x is the concatenation [w; beta]; otherwise beta=0
+// and x = w.
+//
+// Nonsmooth losses (e.g., the hinge and absolute-value losses) are replaced
+// by their Moreau envelopes, whose derivatives follow from the corresponding
+// proximal maps.
+//
+// [1] Lin Xiao and Tong Zhang, "A proximal stochastic gradient method with
+//     progressive variance reduction", SIAM J. Optimization, Vol. 24, No. 4,
+//     pp. 2057--2075, 2014.
+//
+// [2] Aaron Defazio, Francis Bach, and Simon Lacoste-Julien, "SAGA: A fast
+//     incremental gradient method with support for non-strongly convex
+//     composite objectives", Advances in Neural Information Processing
+//     Systems, 2014.
+//
+
+template<typename T> class RowChunkStream;
+
+namespace StochasticMethodNS {
+enum StochasticMethod {
+  PROX_SVRG,
+  PROX_SAGA
+};
+}
+using namespace StochasticMethodNS;
+
+template<typename Real>
+struct StochasticCtrl
+{
+    StochasticMethod method=PROX_SVRG;
+    Int batchSize=32;
+    Int maxEpochs=50;
+    Real tol=1e-6;
+
+    // If nonpositive, the step size is set to 1/(3 L), where L bounds the
+    // Lipschitz constants of the gradients of the individual losses
+    Real stepSize=0;
+
+    // The parameter of the Moreau envelopes of nonsmooth losses
+    Real smoothing=Real(1)/Real(100);
+
+    bool progress=false;
+};
+
+template<typename Real>
+Int StochasticModelFit
+( function<void(const vector<Int>&,Matrix<Real>&)> lossDeriv,
+  Real lossCurvature,
+  function<void(Matrix<Real>&,Real)> regProx,
+  RowChunkStream<Real>& A,
+  bool intercept,
+  Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl=StochasticCtrl<Real>() );
+
+// Streaming variants of LAV, EN, SVM, and logistic regression
+// -----------------------------------------------------------
+// Only the design matrix is streamed; the right-hand sides/labels are
+// assumed to fit in memory.
+
+template<typename Real>
+Int LAV
+( RowChunkStream<Real>& A, const Matrix<Real>& b,
+        Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl=StochasticCtrl<Real>() );
+
+template<typename Real>
+Int EN
+( RowChunkStream<Real>& A, const Matrix<Real>& b,
+        Real lambda1,           Real lambda2,
+        Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl=StochasticCtrl<Real>() );
+
+// The hinge loss is scaled by lambda and w is penalized by (1/2) || w ||_2^2;
+// the output, x, is the concatenation [w; beta]
+template<typename Real>
+Int SVM
+( RowChunkStream<Real>& A, const Matrix<Real>& d,
+        Real lambda,            Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl=StochasticCtrl<Real>() );
+
+template<typename Real>
+Int LogisticRegression
+( RowChunkStream<Real>& G, const Matrix<Real>& q, Matrix<Real>& z,
+  Real gamma, Regularization penalty=L1_PENALTY,
+  const StochasticCtrl<Real>& ctrl=StochasticCtrl<Real>() );
+
 // Robust least squares
 // ====================
 // Given || [dA, db] ||_2 <= rho, minimize the worst-case error of
@@ -383,10 +485,46 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+// Computes nonnegative X and Y such that A ~= X Y^T.
+//
+// NMF_HALS and NMF_BPP only require the Gram matrices X^T X and Y^T Y and the
+// products A^T X and A Y in each iteration, as the factors are stored with
+// their rows distributed (i.e., as [VC,STAR]) so that the updates of
+// individual rows are entirely local:
+//
+//   * Hierarchical Alternating Least Squares (HALS) cyclically updates each
+//     column of one factor with the others held fixed, and
+//
+//   * Block Principal Pivoting (BPP) solves each of the row-wise NNLS 
+//     problems exactly with the active-set-like method of
+//
+//       Jingu Kim and Haesun Park,
+//       "Fast nonnegative matrix factorization: An active-set-like method
+//        and comparisons", SIAM J. Sci. Comput., Vol. 33, No. 6,
+//       pp. 3261--3281, 2011.
+//
+// Since || A - X Y^T ||_F^2 = || A ||_F^2 - 2 tr(Y^T A^T X) + tr(X^T X Y^T Y),
+// the residual is monitored from these same products without an additional
+// Gemm.
+
+namespace NMFApproachNS {
+enum NMFApproach {
+    NMF_NNLS, // Alternate full NNLS solves (see NNLSCtrl)
+    NMF_HALS,
+    NMF_BPP
+};
+} // namespace NMFApproachNS
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
+  NMFApproach approach=NMF_NNLS;
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+  // If positive, NMF_HALS and NMF_BPP stop once the relative residual,
+  // || A - X Y^T ||_F / || A ||_F, decreases by less than 'tol'
+  Real tol=0;
+  bool progress=false;
 };
 
 template<typename Real>
@@ -119,8 +119,10 @@ Int TSQR( ElementalMatrix<F>& A, Base<F> rho, bool relative=false );
 //     arg min || vec(A) ||_1 + rho/2 || A - A0 ||_F^2
 //        A 
 // where A0 is the input matrix.
-template<typename F>
-F SoftThreshold( F alpha, Base<F> rho );
+template<typename Real>
+Real SoftThreshold( Real alpha, Real rho );
+template<typename Real>
+Complex<Real> SoftThreshold( const Complex<Real>& alpha, Real rho );
 
 template<typename F>
 void SoftThreshold
@@ -129,6 +131,51 @@ template<typename F>
 void SoftThreshold
 ( AbstractDistMatrix<F>& A, Base<F> rho, bool relative=false );
 
+// Fused proximal updates
+// ----------------------
+// Many ADMM iterations end with the over-relaxed sequence
+//     xHat := alpha x + (1-alpha) z,
+//     z    := prox(xHat + u),
+//     u    := u + xHat - z,
+// followed by the Frobenius norms needed for the stopping criteria. The
+// following routine performs the entire sequence in a single pass over the
+// data, with 'prox' an entrywise functor which is inlined into the loop.
+// On entry, Z should contain the previous iterate, and, on exit, the
+// returned norms are of x, z, u, x-z, and z-zOld.
+template<typename Real>
+struct ProxUpdateNorms
+{
+    Real xNorm, zNorm, uNorm;
+    Real primalNorm, dualNorm;
+};
+
+template<typename F,typename ProxMap>
+ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const Matrix<F>& X,
+        Matrix<F>& Z,
+        Matrix<F>& U,
+        ProxMap prox );
+template<typename F,typename ProxMap>
+ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const ElementalMatrix<F>& X,
+        ElementalMatrix<F>& Z,
+        ElementalMatrix<F>& U,
+        ProxMap prox );
+template<typename F,typename ProxMap>
+ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const DistMultiVec<F>& X,
+        DistMultiVec<F>& Z,
+        DistMultiVec<F>& U,
+        ProxMap prox );
+
 } // namespace El
 
+#include "./prox/ProxUpdate.hpp"
+
 #endif // ifndef EL_OPTIMIZATION_PROX_HPP
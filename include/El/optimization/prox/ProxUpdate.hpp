@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_OPTIMIZATION_PROX_PROXUPDATE_HPP
+#define EL_OPTIMIZATION_PROX_PROXUPDATE_HPP
+
+namespace El {
+
+// NOTE: Since the scalar soft-thresholds are called within vectorized loops,
+//       the nonnegativity of tau is checked by the callers instead
+template<typename Real>
+inline Real SoftThreshold( Real alpha, Real tau )
+{
+    // Branch-free so that the entrywise loops may be vectorized
+    return Max(alpha-tau,Real(0)) + Min(alpha+tau,Real(0));
+}
+
+template<typename Real>
+inline Complex<Real> SoftThreshold( const Complex<Real>& alpha, Real tau )
+{
+    const Real scale = Abs(alpha);
+    return ( scale <= tau ? Complex<Real>(0) : alpha-(alpha/scale)*tau );
+}
+
+namespace prox {
+
+template<typename F>
+inline Base<F> AbsSq( const F& alpha )
+{ return RealPart(alpha)*RealPart(alpha) + ImagPart(alpha)*ImagPart(alpha); }
+
+template<typename F,typename ProxMap>
+inline void LocalProxUpdate
+( Base<F> alpha,
+  const Matrix<F>& X,
+        Matrix<F>& Z,
+        Matrix<F>& U,
+        ProxMap prox,
+        Base<F>* norms )
+{
+    typedef Base<F> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const F* XBuf = X.LockedBuffer();
+          F* ZBuf = Z.Buffer();
+          F* UBuf = U.Buffer();
+    const Int XLDim = X.LDim();
+    const Int ZLDim = Z.LDim();
+    const Int ULDim = U.LDim();
+    const Real beta = 1-alpha;
+
+    Real xNormSq=0, zNormSq=0, uNormSq=0, primalSq=0, dualSq=0;
+    for( Int j=0; j<n; ++j )
+    {
+        const F* EL_RESTRICT xCol = &XBuf[j*XLDim];
+              F* EL_RESTRICT zCol = &ZBuf[j*ZLDim];
+              F* EL_RESTRICT uCol = &UBuf[j*ULDim];
+        for( Int i=0; i<m; ++i )
+        {
+            const F chi = xCol[i];
+            const F zetaOld = zCol[i];
+            const F chiHat = alpha*chi + beta*zetaOld;
+            const F zeta = prox( chiHat + uCol[i] );
+            const F upsilon = uCol[i] + (chiHat-zeta);
+            zCol[i] = zeta;
+            uCol[i] = upsilon;
+
+            xNormSq += AbsSq(chi);
+            zNormSq += AbsSq(zeta);
+            uNormSq += AbsSq(upsilon);
+            primalSq += AbsSq(chi-zeta);
+            dualSq += AbsSq(zeta-zetaOld);
+        }
+    }
+    norms[0] = xNormSq;
+    norms[1] = zNormSq;
+    norms[2] = uNormSq;
+    norms[3] = primalSq;
+    norms[4] = dualSq;
+}
+
+template<typename Real>
+inline ProxUpdateNorms<Real> UnpackNorms( const Real* norms )
+{
+    ProxUpdateNorms<Real> result;
+    result.xNorm = Sqrt(norms[0]);
+    result.zNorm = Sqrt(norms[1]);
+    result.uNorm = Sqrt(norms[2]);
+    result.primalNorm = Sqrt(norms[3]);
+    result.dualNorm = Sqrt(norms[4]);
+    return result;
+}
+
+} // namespace prox
+
+template<typename F,typename ProxMap>
+inline ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const Matrix<F>& X,
+        Matrix<F>& Z,
+        Matrix<F>& U,
+        ProxMap prox )
+{
+    DEBUG_ONLY(
+      CSE cse("ProxUpdate");
+      if( X.Height() != Z.Height() || X.Width() != Z.Width() ||
+          X.Height() != U.Height() || X.Width() != U.Width() )
+          LogicError("X, Z, and U must be the same size");
+    )
+    Base<F> norms[5];
+    prox::LocalProxUpdate( alpha, X, Z, U, prox, norms );
+    return prox::UnpackNorms( norms );
+}
+
+template<typename F,typename ProxMap>
+inline ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const ElementalMatrix<F>& X,
+        ElementalMatrix<F>& Z,
+        ElementalMatrix<F>& U,
+        ProxMap prox )
+{
+    DEBUG_ONLY(
+      CSE cse("ProxUpdate");
+      if( X.Height() != Z.Height() || X.Width() != Z.Width() ||
+          X.Height() != U.Height() || X.Width() != U.Width() )
+          LogicError("X, Z, and U must be the same size");
+    )
+    if( !(X.DistData() == Z.DistData()) || !(X.DistData() == U.DistData()) )
+        LogicError("X, Z, and U must have the same distribution");
+    Base<F> norms[5];
+    prox::LocalProxUpdate
+    ( alpha, X.LockedMatrix(), Z.Matrix(), U.Matrix(), prox, norms );
+    // Redundant copies of the data are only summed within the owning team
+    mpi::AllReduce( norms, 5, mpi::SUM, X.DistComm() );
+    return prox::UnpackNorms( norms );
+}
+
+template<typename F,typename ProxMap>
+inline ProxUpdateNorms<Base<F>>
+ProxUpdate
+( Base<F> alpha,
+  const DistMultiVec<F>& X,
+        DistMultiVec<F>& Z,
+        DistMultiVec<F>& U,
+        ProxMap prox )
+{
+    DEBUG_ONLY(
+      CSE cse("ProxUpdate");
+      if( X.Height() != Z.Height() || X.Width() != Z.Width() ||
+          X.Height() != U.Height() || X.Width() != U.Width() )
+          LogicError("X, Z, and U must be the same size");
+      if( !mpi::Congruent( X.Comm(), Z.Comm() ) ||
+          !mpi::Congruent( X.Comm(), U.Comm() ) )
+          LogicError("X, Z, and U must have congruent communicators");
+    )
+    Base<F> norms[5];
+    prox::LocalProxUpdate
+    ( alpha, X.LockedMatrix(), Z.Matrix(), U.Matrix(), prox, norms );
+    mpi::AllReduce( norms, 5, mpi::SUM, X.Comm() );
+    return prox::UnpackNorms( norms );
+}
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_PROX_PROXUPDATE_HPP
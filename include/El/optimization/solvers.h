@@ -30,7 +30,17 @@ typedef struct {
   ElInt maxIts;
   float maxStepRatio;
   ElKKTSystem system;
+  bool denseCols;
+  float denseColRatio;
+  ElInt maxDenseCols;
+  ElInt denseColMaxRefineIts;
   bool mehrotra;
+  bool gondzio;
+  ElInt maxGondzioCorrectors;
+  float gondzioStepIncrease;
+  float gondzioMinImprovement;
+  float gondzioBetaMin;
+  float gondzioBetaMax;
   bool forceSameStep;
   ElRegSolveCtrl_s solveCtrl;
   bool resolveReg;
@@ -53,7 +63,17 @@ typedef struct {
   ElInt maxIts;
   double maxStepRatio;
   ElKKTSystem system;
+  bool denseCols;
+  double denseColRatio;
+  ElInt maxDenseCols;
+  ElInt denseColMaxRefineIts;
   bool mehrotra;
+  bool gondzio;
+  ElInt maxGondzioCorrectors;
+  double gondzioStepIncrease;
+  double gondzioMinImprovement;
+  double gondzioBetaMin;
+  double gondzioBetaMax;
   bool forceSameStep;
   ElRegSolveCtrl_d solveCtrl;
   bool resolveReg;
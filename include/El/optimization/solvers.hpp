@@ -73,10 +73,40 @@ struct MehrotraCtrl
     // (larger) augmented formulation.
     KKTSystem system=FULL_KKT;
 
+    // When sparse 'direct' LPs are solved via NORMAL_KKT, the columns of A
+    // with more than 'denseColRatio' times the average number of nonzeros per
+    // column (at most 'maxDenseCols' of the densest) are left out of the
+    // sparse normal matrix, and their contribution is instead handled as a
+    // low-rank (Sherman-Morrison-Woodbury) correction within each solve.
+    // Since the correction loses accuracy as the sparse normal matrix becomes
+    // ill-conditioned, such solves are allowed up to 'denseColMaxRefineIts'
+    // steps of iterative refinement (rather than solveCtrl.maxRefineIts).
+    bool denseCols=true;
+    Real denseColRatio=10;
+    Int maxDenseCols=50;
+    Int denseColMaxRefineIts=10;
+
     // Use Mehrotra's second-order corrector?
-    // TODO: Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // Use Gondzio's multiple centrality correctors?
+    // The number of correctors attempted per iteration is chosen from the
+    // ratio of the time spent forming and factoring the KKT system to the
+    // time of a single solve (and bounded by 'maxGondzioCorrectors'). Each
+    // corrector targets steps which are 'gondzioStepIncrease' longer than
+    // those of the current direction, pushes the targeted complementarity
+    // products into [gondzioBetaMin,gondzioBetaMax]*sigma*mu, and is only
+    // accepted if it lengthens the step by 'gondzioMinImprovement' times the
+    // targeted increase.
+    // NOTE: Since the number of correctors depends upon timings, the iterates
+    //       are not reproducible from run to run when this is enabled.
+    bool gondzio=false;
+    Int maxGondzioCorrectors=4;
+    Real gondzioStepIncrease=0.1;
+    Real gondzioMinImprovement=0.1;
+    Real gondzioBetaMin=0.1;
+    Real gondzioBetaMax=10;
+
     // Force the primal and dual step lengths to be the same size?
     bool forceSameStep=true;
 
@@ -153,6 +183,172 @@ struct ADMMCtrl
     bool print=true;
 };
 
+// Operator splitting for sparse conic quadratic programs
+// ======================================================
+namespace SplittingSolverNS {
+enum SplittingSolver {
+  // Factor the quasi-definite KKT system once with sparse-direct LDL
+  SPLITTING_DIRECT,
+  // Use Jacobi-preconditioned CG on the reduced positive-definite system
+  SPLITTING_INDIRECT,
+  // Factor unless the symbolic analysis predicts too much fill-in
+  SPLITTING_AUTO
+};
+} // namespace SplittingSolverNS
+using namespace SplittingSolverNS;
+
+template<typename Real>
+struct SplittingCtrl
+{
+    SplittingSolver solver=SPLITTING_AUTO;
+
+    // The automatic choice falls back to the indirect solver if the number of
+    // nonzeros in the LDL factorization is predicted to be larger than 
+    // maxFillRatio times the number of nonzeros in the KKT system
+    Real maxFillRatio=50;
+
+    // The step sizes for the conic constraints, the equality constraints, and
+    // the (proximal) primal variables
+    Real rho=Real(1)/Real(10);
+    Real equalityRhoScale=1000;
+    Real sigma=Real(1)/Real(1000000);
+
+    // The over-relaxation parameter (which should lie in (0,2))
+    Real alpha=Real(16)/Real(10);
+
+    Int maxIter=4000;
+    Real absTol=Real(1)/Real(1000);
+    Real relTol=Real(1)/Real(1000);
+
+    // The residuals are only formed every 'checkInterval' iterations since 
+    // doing so requires several additional sparse matrix-vector products
+    Int checkInterval=10;
+
+    // Every 'adaptiveRhoInterval' iterations, rho is rebalanced so that the
+    // relative primal and dual residuals are comparable, but the new value is
+    // only adopted (triggering a refactorization) if it differs from the 
+    // current value by more than a factor of 'adaptiveRhoTol'
+    bool adaptiveRho=true;
+    Int adaptiveRhoInterval=50;
+    Real adaptiveRhoTol=5;
+    Real minRho=Real(1)/Real(1000000);
+    Real maxRho=1000000;
+
+    // Type-II Anderson acceleration with 'andersonMemory' previous iterates.
+    // An accelerated iterate is rejected if its fixed-point residual is more
+    // than 'andersonSafeguard' times that of the previous iterate.
+    bool anderson=true;
+    Int andersonMemory=5;
+    Real andersonReg=Real(1)/Real(100000000);
+    Real andersonSafeguard=1;
+
+    // Parameters for the indirect solver. Once the ADMM residuals have been
+    // formed, each CG solve must also reduce its residual norm below
+    // 'cgResidualFactor' times the smaller of them, as otherwise the inexact
+    // solves would prevent ADMM from reaching its tolerances.
+    Int maxCGIts=100;
+    Real cgRelTol=Real(1)/Real(10000000);
+    Real cgResidualFactor=Real(1)/Real(10);
+
+    bool outerEquil=true;
+    bool primalInit=false;
+    bool dualInit=false;
+    bool print=false;
+    bool time=false;
+};
+
+// Presolve for sparse "direct" conic-form LPs and QPs
+// ===================================================
+// The following reductions are applied to
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, x >= 0,
+//
+// until either a pass makes no progress or maxPasses passes have been run:
+//
+//  - empty rows are removed (or the problem is declared infeasible),
+//  - singleton rows fix their variable to b_i / A(i,j),
+//  - forcing rows, whose coefficients share a sign s with s b_i <= 0, fix
+//    each of their variables to zero (this is the only form of bound
+//    tightening available when every variable lies in [0,infinity)),
+//  - duplicate rows are detected by hashing their sparsity patterns and
+//    removed after verifying that they are consistent multiples,
+//  - empty columns are fixed at zero (or the problem is declared unbounded),
+//  - implied-free column singletons, i.e., columns with a single nonzero,
+//    A(i,j), no quadratic coupling, and whose nonnegativity is implied by
+//    the signs of the remaining coefficients in row i and of b_i, are
+//    substituted out of the objective along with row i.
+//
+// Infeasibility and unboundedness are reported by throwing a RuntimeError.
+
+template<typename Real>
+struct PresolveCtrl
+{
+    bool emptyRows=true;
+    bool singletonRows=true;
+    bool forcingRows=true;
+    bool duplicateRows=true;
+    bool emptyCols=true;
+    bool freeColSingletons=true;
+
+    Int maxPasses=10;
+
+    // The absolute tolerance for deciding whether right-hand sides vanish,
+    // whether fixed variables are negative, and whether duplicate rows
+    // are consistent
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    bool progress=false;
+};
+
+namespace PresolveStepNS {
+enum PresolveStep {
+  PRESOLVE_EMPTY_ROW,
+  PRESOLVE_SINGLETON_ROW,
+  PRESOLVE_FORCING_ROW,
+  PRESOLVE_DUPLICATE_ROW,
+  PRESOLVE_EMPTY_COL,
+  PRESOLVE_FREE_COL_SINGLETON
+};
+} // namespace PresolveStepNS
+using namespace PresolveStepNS;
+
+// The information needed to map a solution of the reduced problem back to
+// the original problem. The steps are stored in the order in which they were
+// applied and are undone in the reverse order.
+template<typename Real>
+struct PresolveRecord
+{
+    // The original dimensions of A
+    Int height=0, width=0;
+
+    // The original indices of the rows and columns of the reduced problem
+    vector<Int> keptRows, keptCols;
+
+    struct Step
+    {
+        PresolveStep type;
+        Int row=-1, col=-1;
+
+        // The value of x(col) for singleton rows, the pivot A(row,col) for
+        // free column singletons, and the ratio to the retained row for
+        // duplicate rows
+        Real value=0;
+
+        // The right-hand side of the row when the step was applied
+        Real rhs=0;
+
+        // The entries of the row whose columns were still active when the
+        // step was applied, along with the (substituted) costs of said
+        // columns at that point
+        vector<Entry<Real>> activeEntries;
+        vector<Real> activeCosts;
+
+        // All of the original entries of the row (needed to update A^T y)
+        vector<Entry<Real>> entries;
+    };
+    vector<Step> steps;
+};
+
 // Linear program
 // ==============
 
@@ -186,10 +382,91 @@ struct Ctrl
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Run lp::direct::Presolve before, and lp::direct::Postsolve after, the
+    // solver? NOTE: This is only supported for sparse matrices
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl( bool isSparse ) 
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
 
+// Control structure for solving a batch of "direct" conic-form LPs which
+// share the same constraint matrix, A, but differ in (b,c)
+// ----------------------------------------------------------------------
+template<typename Real>
+struct BatchCtrl
+{
+    // NOTE: The outer equilibration is computed once for the entire batch
+    MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Warm-start each problem from the solution of the previous problem
+    // after shifting it back into the interior by 
+    // warmStartShift*Max(1,|| . ||_max)?
+    bool warmStart=true;
+    Real warmStartShift=Real(1)/Real(100);
+
+    // Also solve each problem from a cold start so that the iteration counts
+    // can be compared?
+    bool compareCold=false;
+
+    // Print the number of iterations required for each problem?
+    bool progress=false;
+
+    BatchCtrl( bool isSparse )
+    { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
+};
+
+// Presolve
+// --------
+// Form the reduced problem (ARed,bRed,cRed), whose rows and columns are
+// record.keptRows and record.keptCols of the original problem.
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+// Postsolve
+// ---------
+// Map a primal-dual solution (xRed,yRed) of the reduced problem to a
+// primal-dual solution (x,y,z) of the original problem.
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
 } // namespace direct
 
 namespace affine {
@@ -210,6 +487,8 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // NOTE: LP_ADMM is only supported for DistSparseMatrix
+    SplittingCtrl<Real> splittingCtrl;
 };
 
 } // namespace affine
@@ -255,6 +534,36 @@ void LP
         DistMultiVec<Real>& z,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
+// Batched direct conic form
+// -------------------------
+// Solve the LPs whose right-hand sides and cost vectors are the columns of 
+// B and C; the problems are split into chains which are solved concurrently 
+// by the processes in 'comm'. On exit, numIts(k,0) contains the number of 
+// iterations required for problem k and, if ctrl.compareCold is true, 
+// numIts(k,1) contains the number required from a cold start.
+template<typename Real>
+void LP
+( const Matrix<Real>& A, 
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const lp::direct::BatchCtrl<Real>& ctrl=lp::direct::BatchCtrl<Real>(false),
+        mpi::Comm comm=mpi::COMM_SELF );
+template<typename Real>
+void LP
+( const SparseMatrix<Real>& A, 
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const lp::direct::BatchCtrl<Real>& ctrl=lp::direct::BatchCtrl<Real>(true),
+        mpi::Comm comm=mpi::COMM_SELF );
+
 // Affine conic form
 // -----------------
 template<typename Real>
@@ -338,9 +647,92 @@ struct Ctrl
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Run qp::direct::Presolve before, and qp::direct::Postsolve after, the
+    // solver? NOTE: This is only supported for sparse matrices
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
+// Control structure for solving a batch of "direct" conic-form QPs which
+// share the same Q and A but differ in (b,c)
+// ----------------------------------------------------------------------
+template<typename Real>
+struct BatchCtrl
+{
+    // NOTE: The outer equilibration is computed once for the entire batch
+    MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Warm-start each problem from the solution of the previous problem
+    // after shifting it back into the interior by 
+    // warmStartShift*Max(1,|| . ||_max)?
+    bool warmStart=true;
+    Real warmStartShift=Real(1)/Real(100);
+
+    // Also solve each problem from a cold start so that the iteration counts
+    // can be compared?
+    bool compareCold=false;
+
+    // Print the number of iterations required for each problem?
+    bool progress=false;
+
+    BatchCtrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
+};
+
+// Presolve
+// --------
+// NOTE: Q is assumed to be explicitly symmetric
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+// Postsolve
+// ---------
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
 } // namespace direct
 
 namespace affine {
@@ -361,6 +753,8 @@ struct Ctrl
 {
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // NOTE: QP_ADMM is only supported for DistSparseMatrix
+    SplittingCtrl<Real> splittingCtrl;
 };
 
 } // namespace affine
@@ -437,6 +831,38 @@ void QP
         DistMultiVec<Real>& z,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 
+// Batched direct conic form
+// -------------------------
+// Solve the QPs whose right-hand sides and cost vectors are the columns of 
+// B and C; the problems are split into chains which are solved concurrently 
+// by the processes in 'comm'. On exit, numIts(k,0) contains the number of 
+// iterations required for problem k and, if ctrl.compareCold is true, 
+// numIts(k,1) contains the number required from a cold start.
+template<typename Real>
+void QP
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A, 
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const qp::direct::BatchCtrl<Real>& ctrl=qp::direct::BatchCtrl<Real>(),
+        mpi::Comm comm=mpi::COMM_SELF );
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const qp::direct::BatchCtrl<Real>& ctrl=qp::direct::BatchCtrl<Real>(),
+        mpi::Comm comm=mpi::COMM_SELF );
+
 // Affine conic form
 // -----------------
 template<typename Real>
@@ -496,7 +922,7 @@ void QP
 // =========================
 namespace SOCPApproachNS {
 enum SOCPApproach {
-  SOCP_ADMM,     // NOTE: Not yet supported
+  SOCP_ADMM,     // NOTE: Only supported in sparse affine form
   SOCP_MEHROTRA
 };
 } // namespace SOCPApproachNS
@@ -554,6 +980,8 @@ struct Ctrl
 {
     SOCPApproach approach=SOCP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // NOTE: SOCP_ADMM is only supported for DistSparseMatrix
+    SplittingCtrl<Real> splittingCtrl;
 
     Ctrl()
     {
@@ -671,6 +1099,113 @@ void SOCP
         DistMultiVec<Real>& s,
   const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
 
+// Operator splitting for sparse conic quadratic programs
+// ======================================================
+namespace splitting {
+
+// Attempt to solve the pair of conic Quadratic Programs
+//
+//   min (1/2) x^T Q x + c^T x, 
+//   s.t. A x = b, G x + s = h, s in K,
+//
+//   max (1/2) (A^T y + G^T z + c)^T pinv(Q) (A^T y + G^T z + c) - b^T y - h^T z
+//   s.t. A^T y + G^T z + c in range(Q), z in K,
+//
+// where K is a product of second-order cones (the positive orthant is the
+// special case where each cone has order one), to low accuracy using the
+// operator-splitting ADMM of OSQP. The quasi-definite KKT system
+//
+//   | Q + sigma I,      A^T,      G^T | 
+//   |     A,      -1/rho_A I,      0  |,
+//   |     G,           0,   -1/rho I  |
+//
+// is factored once (and only refactored when rho is adapted) so that each
+// iteration requires a single pair of sparse triangular solves; otherwise,
+// preconditioned CG is applied to its positive-definite Schur complement.
+// The number of iterations is returned.
+template<typename Real>
+Int ADMM
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+  const SplittingCtrl<Real>& ctrl=SplittingCtrl<Real>() );
+
+} // namespace splitting
+
+// Semidefinite Program
+// ====================
+namespace SDPApproachNS {
+enum SDPApproach {
+  SDP_MEHROTRA
+};
+} // namespace SDPApproachNS
+using namespace SDPApproachNS;
+
+namespace sdp {
+namespace direct {
+
+// Attempt to solve a pair of block-diagonal Semidefinite Programs in "direct"
+// conic form:
+//
+//   min <C,X>,
+//   s.t. <A_i,X> = b_i, i=0,...,m-1, X in K,
+//
+//   max -b^T y
+//   s.t. sum_i y_i A_i - Z + C = 0, Z in K,
+//
+// where the cone K is a product of cones of symmetric positive semi-definite
+// matrices. The j'th diagonal blocks of C, X, and Z are stored in C[j], X[j],
+// and Z[j], while the columns of the n_j^2 x m matrix A[j] are the
+// (column-major) vectorizations of the j'th diagonal blocks of the symmetric
+// matrices A_0, ..., A_{m-1}.
+//
+
+// Control structure for the high-level "direct" conic-form SDP solver
+// -------------------------------------------------------------------
+template<typename Real>
+struct Ctrl
+{
+    SDPApproach approach=SDP_MEHROTRA;
+    MehrotraCtrl<Real> mehrotraCtrl;
+
+    Ctrl()
+    {
+        mehrotraCtrl.minTol = Pow(limits::Epsilon<Real>(),Real(0.25));
+        mehrotraCtrl.targetTol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    }
+};
+
+} // namespace direct
+} // namespace sdp
+
+template<typename Real>
+void SDP
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& b,
+  const vector<Matrix<Real>>& C,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  const sdp::direct::Ctrl<Real>& ctrl=sdp::direct::Ctrl<Real>() );
+template<typename Real>
+void SDP
+( const vector<DistMatrix<Real>>& A,
+  const ElementalMatrix<Real>& b,
+  const vector<DistMatrix<Real>>& C,
+        vector<DistMatrix<Real>>& X,
+        ElementalMatrix<Real>& y,
+        vector<DistMatrix<Real>>& Z,
+  const sdp::direct::Ctrl<Real>& ctrl=sdp::direct::Ctrl<Real>() );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_HPP
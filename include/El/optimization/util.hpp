@@ -12,6 +12,7 @@
 
 #include "./util/cone.hpp"
 #include "./util/pos_orth.hpp"
+#include "./util/psd.hpp"
 #include "./util/soc.hpp"
 
 namespace El {
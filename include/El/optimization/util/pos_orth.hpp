@@ -13,6 +13,25 @@
 namespace El {
 namespace pos_orth {
 
+// Centrality correction
+// =====================
+// Overwrite each entry v_i of a vector of complementarity products with
+// v_i - t_i, where t_i is the projection of v_i onto [lowerBound,upperBound]
+// (with the decrease of large products, v_i - t_i, limited to upperBound),
+// as in Gondzio's multiple centrality correctors.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       Matrix<Real>& v,
+  Real lowerBound, Real upperBound );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       ElementalMatrix<Real>& v,
+  Real lowerBound, Real upperBound );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       DistMultiVec<Real>& v,
+  Real lowerBound, Real upperBound );
+
 // Compute the complementarity ratio
 // =================================
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
+#define EL_OPTIMIZATION_UTIL_PSD_HPP
+
+namespace El {
+namespace psd {
+
+// The following routines act upon a single (symmetric) block of a
+// block-diagonal member of the cone of positive semi-definite matrices.
+
+// Jordan product
+// ==============
+// Z := (X Y + Y X) / 2
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Apply
+( const Matrix<Real>& X,
+  const Matrix<Real>& Y,
+        Matrix<Real>& Z );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Apply
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& Y,
+        ElementalMatrix<Real>& Z );
+
+// Inverse of the Jordan product with a diagonal matrix
+// ====================================================
+// Overwrite Y with the matrix T satisfying (diag(lambda) T + T diag(lambda))/2
+// = Y, i.e., T(i,j) = 2 Y(i,j) / (lambda(i) + lambda(j)), where each entry of
+// lambda is assumed to be positive.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void ApplyInverse
+( const Matrix<Real>& lambda,
+        Matrix<Real>& Y );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void ApplyInverse
+( const ElementalMatrix<Real>& lambda,
+        ElementalMatrix<Real>& Y );
+
+// Maximum step
+// ============
+// The largest alpha in [0,upperBound] such that X + alpha dX is positive
+// semi-definite, where X is assumed to be positive-definite.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const Matrix<Real>& X,
+  const Matrix<Real>& dX,
+  Real upperBound=std::numeric_limits<Real>::max() );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& dX,
+  Real upperBound=std::numeric_limits<Real>::max() );
+
+// Compute a Nesterov-Todd scaling
+// ===============================
+// Given positive-definite X and Z, compute R and a positive vector lambda
+// such that W = R R^T is the Nesterov-Todd scaling point, W Z W = X, and
+//
+//   inv(R) X inv(R)^T = R^T Z R = diag(lambda).
+//
+// The construction follows Todd, Toh, and Tutuncu: if X = L_X L_X^T and
+// Z = L_Z L_Z^T, and L_Z^T L_X = U diag(lambda) V^T, then
+// R = L_X V diag(lambda)^{-1/2}.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const Matrix<Real>& X,
+  const Matrix<Real>& Z,
+        Matrix<Real>& R,
+        Matrix<Real>& lambda );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& Z,
+        ElementalMatrix<Real>& R,
+        ElementalMatrix<Real>& lambda );
+
+// Push a pair into the PSD cone
+// =============================
+// If the Nesterov-Todd scaling point, W, has an entry larger than
+// wMaxNormLimit, shift the diagonal of Z so that the pair is better
+// conditioned.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void PushPairInto
+(       Matrix<Real>& X,
+        Matrix<Real>& Z,
+  const Matrix<Real>& W,
+  Real wMaxNormLimit );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void PushPairInto
+(       ElementalMatrix<Real>& X,
+        ElementalMatrix<Real>& Z,
+  const ElementalMatrix<Real>& W,
+  Real wMaxNormLimit );
+
+} // namespace psd
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
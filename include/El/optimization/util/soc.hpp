@@ -113,6 +113,33 @@ void ApplyQuadratic
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
 
+// Centrality correction
+// =====================
+// The analogue of pos_orth::CentralityCorrection for a product of SOCs: the
+// eigenvalues, v_0 +- || v_1 ||_2, of each subcone of v are projected onto
+// [lowerBound,upperBound] and v is overwritten with the difference between
+// itself and the result of the projection.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       Matrix<Real>& v,
+  Real lowerBound, Real upperBound,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       ElementalMatrix<Real>& v,
+  Real lowerBound, Real upperBound,
+  const ElementalMatrix<Int>& orders,
+  const ElementalMatrix<Int>& firstInds,
+  Int cutoff=1000 );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+(       DistMultiVec<Real>& v,
+  Real lowerBound, Real upperBound,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff=1000 );
+
 // Degree
 // ======
 Int Degree( const Matrix<Int>& firstInds );
@@ -412,6 +439,28 @@ Int NumOutside
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
 
+// Projection onto SOC
+// ===================
+// Overwrite each member of x with its Euclidean projection onto the 
+// second-order cone it belongs to
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       ElementalMatrix<Real>& x,
+  const ElementalMatrix<Int>& orders,
+  const ElementalMatrix<Int>& firstInds,
+  Int cutoff=1000 );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       DistMultiVec<Real>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff=1000 );
+
 // Push into SOC
 // ==============
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -569,6 +569,16 @@ def HermitianSVD(uplo,A,vectors=True):
 # Polar decomposition
 # ===================
 
+lib.ElPolarCtrlDefault.argtypes = [c_void_p]
+class PolarCtrl(ctypes.Structure):
+  _fields_ = [("qdwh",bType),
+              ("colPiv",bType),
+              ("maxIts",iType),
+              ("numIts",iType),
+              ("qdwhCholThreshold",dType)]
+  def __init__(self):
+    lib.ElPolarCtrlDefault(pointer(self))
+
 lib.ElPolar_s.argtypes = \
 lib.ElPolar_d.argtypes = \
 lib.ElPolar_c.argtypes = \
@@ -693,7 +703,11 @@ class SignCtrl_s(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",sType),
               ("power",sType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("progress",bType),
+              ("newtonSchulz",bType),
+              ("newtonSchulzThresh",sType),
+              ("newtonSchulzDegree",iType)]
   def __init__(self):
     lib.ElSignCtrlDefault_s(pointer(self))
 
@@ -702,7 +716,11 @@ class SignCtrl_d(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",dType),
               ("power",dType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("progress",bType),
+              ("newtonSchulz",bType),
+              ("newtonSchulzThresh",dType),
+              ("newtonSchulzDegree",iType)]
   def __init__(self):
     lib.ElSignCtrlDefault_d(pointer(self))
 
@@ -885,22 +903,54 @@ def Eig(A):
 # Singular value decomposition
 # ============================
 
+lib.ElHermitianSDCCtrlDefault_s.argtypes = \
+lib.ElHermitianSDCCtrlDefault_d.argtypes = \
+  [c_void_p]
+class HermitianSDCCtrl_s(ctypes.Structure):
+  _fields_ = [("cutoff",iType),
+              ("maxInnerIts",iType),("maxOuterIts",iType),
+              ("tol",sType),
+              ("spreadFactor",sType),
+              ("progress",bType),
+              ("qdwh",bType),
+              ("polarCtrl",PolarCtrl)]
+  def __init__(self):
+    lib.ElHermitianSDCCtrlDefault_s(pointer(self))
+class HermitianSDCCtrl_d(ctypes.Structure):
+  _fields_ = [("cutoff",iType),
+              ("maxInnerIts",iType),("maxOuterIts",iType),
+              ("tol",dType),
+              ("spreadFactor",dType),
+              ("progress",bType),
+              ("qdwh",bType),
+              ("polarCtrl",PolarCtrl)]
+  def __init__(self):
+    lib.ElHermitianSDCCtrlDefault_d(pointer(self))
+
 class SVDCtrl_s(ctypes.Structure):
   _fields_ = [("seqQR",bType),
+              ("distDC",bType),
+              ("dcCutoff",iType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
               ("thesholded",bType),
               ("relative",bType),
-              ("tol",sType)]
+              ("tol",sType),
+              ("useQDWH",bType),
+              ("qdwhCtrl",HermitianSDCCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
 class SVDCtrl_d(ctypes.Structure):
   _fields_ = [("seqQR",bType),
+              ("distDC",bType),
+              ("dcCutoff",iType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
               ("thesholded",bType),
               ("relative",bType),
-              ("tol",dType)]
+              ("tol",dType),
+              ("useQDWH",bType),
+              ("qdwhCtrl",HermitianSDCCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
 
@@ -46,7 +46,11 @@ class LLLCtrl_s(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("blocksize",iType),
+              ("blockedCutoff",iType),
+              ("kernelBlocksize",iType),
+              ("kernelBlockedCutoff",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_s(pointer(self))
 class LLLCtrl_d(ctypes.Structure):
@@ -61,7 +65,11 @@ class LLLCtrl_d(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("blocksize",iType),
+              ("blockedCutoff",iType),
+              ("kernelBlocksize",iType),
+              ("kernelBlockedCutoff",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_d(pointer(self))
 
@@ -823,12 +823,15 @@ def NNLS(A,b,ctrl=None):
 lib.ElNMFCtrlDefault_s.argtypes = \
 lib.ElNMFCtrlDefault_d.argtypes = \
   [c_void_p]
+(NMF_NNLS,NMF_HALS,NMF_BPP)=(0,1,2)
 class NMFCtrl_s(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType)]
+  _fields_ = [("approach",c_uint),("nnlsCtrl",NNLSCtrl_s),("maxIter",iType),
+              ("tol",sType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_s(pointer(self))
 class NMFCtrl_d(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType)]
+  _fields_ = [("approach",c_uint),("nnlsCtrl",NNLSCtrl_d),("maxIter",iType),
+              ("tol",dType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_d(pointer(self))
 
@@ -22,7 +22,15 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",sType),
               ("system",c_uint),
+              ("denseCols",bType),("denseColRatio",sType),
+              ("maxDenseCols",iType),
+              ("denseColMaxRefineIts",iType),
               ("mehrotra",bType),
+              ("gondzio",bType),
+              ("maxGondzioCorrectors",iType),
+              ("gondzioStepIncrease",sType),
+              ("gondzioMinImprovement",sType),
+              ("gondzioBetaMin",sType),("gondzioBetaMax",sType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_s),
               ("resolveReg",bType),
@@ -44,7 +52,15 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",dType),
               ("system",c_uint),
+              ("denseCols",bType),("denseColRatio",dType),
+              ("maxDenseCols",iType),
+              ("denseColMaxRefineIts",iType),
               ("mehrotra",bType),
+              ("gondzio",bType),
+              ("maxGondzioCorrectors",iType),
+              ("gondzioStepIncrease",dType),
+              ("gondzioMinImprovement",dType),
+              ("gondzioBetaMin",dType),("gondzioBetaMax",dType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_d),
               ("resolveReg",bType),
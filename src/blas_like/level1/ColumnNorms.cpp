@@ -441,7 +441,14 @@ void ColumnTwoNorms
   PROTO_REAL_DIST(Real,VC,  STAR) \
   PROTO_REAL_DIST(Real,VR,  STAR)
 
+#define PROTO_DOUBLEDOUBLE \
+  template void ColumnTwoNorms \
+  ( const Matrix<DoubleDouble>& X, Matrix<DoubleDouble>& norms ); \
+  template void ColumnMaxNorms \
+  ( const Matrix<DoubleDouble>& X, Matrix<DoubleDouble>& norms );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
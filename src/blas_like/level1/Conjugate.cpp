@@ -58,6 +58,12 @@ void Conjugate( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
   template void Conjugate( AbstractDistMatrix<T>& A ); \
   template void Conjugate( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Conjugate( Matrix<DoubleDouble>& A ); \
+  template void Conjugate \
+  ( const Matrix<DoubleDouble>& A, Matrix<DoubleDouble>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
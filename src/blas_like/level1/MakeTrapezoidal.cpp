@@ -128,6 +128,11 @@ void MakeTrapezoidal( UpperOrLower uplo, DistSparseMatrix<T>& A, Int offset )
   template void MakeTrapezoidal \
   ( UpperOrLower uplo, DistSparseMatrix<T>& A, Int offset );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void MakeTrapezoidal \
+  ( UpperOrLower uplo, Matrix<DoubleDouble>& A, Int offset );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
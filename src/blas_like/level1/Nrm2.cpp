@@ -53,7 +53,11 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
   template Base<F> Nrm2( const AbstractDistMatrix<F>& x ); \
   template Base<F> Nrm2( const DistMultiVec<F>& x );
 
+#define PROTO_DOUBLEDOUBLE \
+  template DoubleDouble Nrm2( const Matrix<DoubleDouble>& x );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
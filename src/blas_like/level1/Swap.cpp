@@ -478,6 +478,19 @@ void HermitianSwap
   template void HermitianSwap \
   ( UpperOrLower uplo, AbstractDistMatrix<T>& A, Int to, Int from );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Swap \
+  ( Orientation orientation, \
+    Matrix<DoubleDouble>& X, Matrix<DoubleDouble>& Y ); \
+  template void RowSwap( Matrix<DoubleDouble>& A, Int to, Int from ); \
+  template void ColSwap( Matrix<DoubleDouble>& A, Int to, Int from ); \
+  template void SymmetricSwap \
+  ( UpperOrLower uplo, Matrix<DoubleDouble>& A, Int to, Int from, \
+    bool conjugate ); \
+  template void HermitianSwap \
+  ( UpperOrLower uplo, Matrix<DoubleDouble>& A, Int to, Int from );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -62,6 +62,10 @@ void Zero( DistMultiVec<T>& X )
   template void Zero( DistSparseMatrix<T>& A, bool clearMemory ); \
   template void Zero( DistMultiVec<T>& A );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Zero( Matrix<DoubleDouble>& A );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -268,6 +268,19 @@ void Gemv
              const ElementalMatrix<T>& x, \
     T beta,        ElementalMatrix<T>& y );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Gemv \
+  ( Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                        const Matrix<DoubleDouble>& x, \
+    DoubleDouble beta,        Matrix<DoubleDouble>& y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                        const Matrix<DoubleDouble>& x, \
+                              Matrix<DoubleDouble>& y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -148,6 +148,14 @@ void LocalGer
   ( T alpha, const ElementalMatrix<T>& x, const ElementalMatrix<T>& y, \
                    ElementalMatrix<T>& A );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Ger \
+  ( DoubleDouble alpha, \
+    const Matrix<DoubleDouble>& x, \
+    const Matrix<DoubleDouble>& y, \
+          Matrix<DoubleDouble>& A );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -286,6 +286,19 @@ void LocalGemm
              const ElementalMatrix<T>& B, \
                    ElementalMatrix<T>& C );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                        const Matrix<DoubleDouble>& B, \
+    DoubleDouble beta,        Matrix<DoubleDouble>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                        const Matrix<DoubleDouble>& B, \
+                              Matrix<DoubleDouble>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -123,8 +123,19 @@ void Herk
     Base<T> alpha, const DistSparseMatrix<T>& A, \
                          DistSparseMatrix<T>& C );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Herk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+    DoubleDouble beta,        Matrix<DoubleDouble>& C ); \
+  template void Herk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                              Matrix<DoubleDouble>& C );
+
 // blas::Herk not yet supported for Int
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -294,8 +294,19 @@ void Syrk
     T alpha, const DistSparseMatrix<T>& A, \
                    DistSparseMatrix<T>& C, bool conjugate );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Syrk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+    DoubleDouble beta,        Matrix<DoubleDouble>& C, bool conjugate ); \
+  template void Syrk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    DoubleDouble alpha, const Matrix<DoubleDouble>& A, \
+                              Matrix<DoubleDouble>& C, bool conjugate );
+
 // blas::Syrk is not yet supported for Int
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
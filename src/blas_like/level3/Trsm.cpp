@@ -425,7 +425,19 @@ void LocalTrsm
           AbstractDistMatrix<F>& X, \
     bool checkIfSingular );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    DoubleDouble alpha, \
+    const Matrix<DoubleDouble>& A, \
+          Matrix<DoubleDouble>& B, \
+    bool checkIfSingular );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
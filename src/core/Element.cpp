@@ -68,6 +68,9 @@ template<>
 string TypeName<BigFloat>()
 { return string("BigFloat"); }
 #endif
+template<>
+string TypeName<DoubleDouble>()
+{ return string("DoubleDouble"); }
 
 // Basic element manipulation and I/O
 // ==================================
@@ -94,6 +97,133 @@ istream& operator>>( istream& is, Quad& alpha )
 }
 #endif
 
+namespace {
+
+// log(2) and pi as unevaluated sums of two doubles
+const DoubleDouble ddLog2(6.931471805599452862e-01,2.319046813846299558e-17);
+const DoubleDouble ddPi(3.141592653589793116e+00,1.224646799147353207e-16);
+
+// Multiply alpha by 10^n, splitting the power in half so that neither
+// factor overflows for any exponent of a finite double
+DoubleDouble ScaleByPowerOfTen( DoubleDouble alpha, int n )
+{
+    for( int half : { n/2, n-n/2 } )
+    {
+        DoubleDouble power(1), base(10);
+        for( int k=std::abs(half); k>0; k>>=1 )
+        {
+            if( k & 1 )
+                power *= base;
+            base *= base;
+        }
+        if( half >= 0 )
+            alpha *= power;
+        else
+            alpha /= power;
+    }
+    return alpha;
+}
+
+} // anonymous namespace
+
+ostream& operator<<( ostream& os, const DoubleDouble& alpha )
+{
+    if( !std::isfinite(alpha.hi) || alpha.hi == 0 )
+    {
+        os << alpha.hi;
+        return os;
+    }
+
+    // Extract one more digit than is printed so that the result is rounded
+    const int numDigits = 32;
+    DoubleDouble r = ( alpha.hi < 0 ? -alpha : alpha );
+    int exponent = int(std::floor(std::log10(r.hi)));
+    r = ScaleByPowerOfTen( r, -exponent );
+    if( r >= DoubleDouble(10) )
+    {
+        r /= DoubleDouble(10);
+        ++exponent;
+    }
+    else if( r < DoubleDouble(1) )
+    {
+        r *= DoubleDouble(10);
+        --exponent;
+    }
+    vector<int> digits(numDigits+1);
+    for( int k=0; k<=numDigits; ++k )
+    {
+        const int d = Max(Min(int(std::floor(r.hi)),9),0);
+        digits[k] = d;
+        r = (r-DoubleDouble(d))*DoubleDouble(10);
+    }
+    if( digits[numDigits] >= 5 )
+    {
+        int k=numDigits-1;
+        for( ; k>=0 && digits[k]==9; --k )
+            digits[k] = 0;
+        if( k >= 0 )
+            ++digits[k];
+        else
+        {
+            digits[0] = 1;
+            ++exponent;
+        }
+    }
+
+    ostringstream str;
+    if( alpha.hi < 0 )
+        str << '-';
+    str << digits[0] << '.';
+    for( int k=1; k<numDigits; ++k )
+        str << digits[k];
+    str << 'e' << ( exponent < 0 ? '-' : '+' );
+    if( std::abs(exponent) < 10 )
+        str << '0';
+    str << std::abs(exponent);
+    os << str.str();
+    return os;
+}
+
+istream& operator>>( istream& is, DoubleDouble& alpha )
+{
+    string token;
+    is >> token;
+
+    size_t k=0;
+    bool negative = false;
+    if( k < token.size() && (token[k] == '-' || token[k] == '+') )
+        negative = ( token[k++] == '-' );
+    DoubleDouble value(0);
+    int exponent = 0;
+    bool sawDigit=false, sawPoint=false;
+    for( ; k<token.size(); ++k )
+    {
+        const char c = token[k];
+        if( c >= '0' && c <= '9' )
+        {
+            value = value*DoubleDouble(10) + DoubleDouble(int(c-'0'));
+            if( sawPoint )
+                --exponent;
+            sawDigit = true;
+        }
+        else if( c == '.' && !sawPoint )
+            sawPoint = true;
+        else
+            break;
+    }
+    if( !sawDigit )
+    {
+        // Fall back to the double parser for "inf", "nan", etc.
+        alpha = DoubleDouble(std::strtod( token.c_str(), NULL ));
+        return is;
+    }
+    if( k < token.size() && (token[k] == 'e' || token[k] == 'E') )
+        exponent += std::atoi( token.c_str()+k+1 );
+    value = ScaleByPowerOfTen( value, exponent );
+    alpha = ( negative ? -value : value );
+    return is;
+}
+
 // Return the complex argument
 // ---------------------------
 #ifdef EL_HAVE_QUADMATH
@@ -147,6 +277,10 @@ BigFloat Abs( const BigFloat& alpha ) EL_NO_EXCEPT
 }
 #endif
 
+template<>
+DoubleDouble Abs( const DoubleDouble& alpha ) EL_NO_EXCEPT
+{ return ( alpha.hi < 0 ? -alpha : alpha ); }
+
 #ifdef EL_HAVE_QUADMATH
 template<>
 Quad SafeAbs( const Complex<Quad>& alpha ) EL_NO_EXCEPT
@@ -203,6 +337,40 @@ BigFloat Exp( const BigFloat& alpha ) EL_NO_EXCEPT
 }
 #endif
 
+template<>
+DoubleDouble Exp( const DoubleDouble& alpha ) EL_NO_EXCEPT
+{
+    if( alpha.hi <= -709. )
+        return DoubleDouble(0);
+    if( alpha.hi >= 709.8 )
+        return DoubleDouble(std::numeric_limits<double>::infinity());
+    if( alpha.hi == 0 )
+        return DoubleDouble(1);
+
+    // Write alpha = m log(2) + r, with |r| <= log(2)/2, and then evaluate
+    // exp(r) = exp(r/512)^512 using a Taylor series for exp(r/512)-1 and
+    // nine squarings of the form (1+s)^2-1 = 2s+s^2 (which avoid the
+    // cancellation of explicitly forming 1+s)
+    const double m = std::floor( alpha.hi/ddLog2.hi + 0.5 );
+    DoubleDouble r = alpha - ddLog2*DoubleDouble(m);
+    const double scale = 512.;
+    r = DoubleDouble( r.hi/scale, r.lo/scale );
+
+    DoubleDouble term = r, s = r;
+    const double tol = 1e-33;
+    for( int k=2; k<30; ++k )
+    {
+        term = term*r/DoubleDouble(k);
+        s += term;
+        if( std::abs(term.hi) <= tol*std::abs(s.hi) )
+            break;
+    }
+    for( int k=0; k<9; ++k )
+        s = DoubleDouble(2*s.hi,2*s.lo) + s*s;
+    s += DoubleDouble(1);
+    return DoubleDouble( std::ldexp(s.hi,int(m)), std::ldexp(s.lo,int(m)) );
+}
+
 #ifdef EL_HAVE_QUADMATH
 template<>
 Quad Pow( const Quad& alpha, const Quad& beta ) EL_NO_EXCEPT
@@ -251,6 +419,29 @@ BigFloat Pow( const BigFloat& alpha, const BigFloat& beta ) EL_NO_EXCEPT
 }
 #endif
 
+template<>
+DoubleDouble Pow
+( const DoubleDouble& alpha, const DoubleDouble& beta ) EL_NO_EXCEPT
+{
+    // Use repeated squaring for (modest) integer powers, which also handles
+    // negative bases
+    if( Floor(beta) == beta && std::abs(beta.hi) < 1e9 )
+    {
+        DoubleDouble power(1), base(alpha);
+        for( long long k=std::llabs(static_cast<long long>(beta)); k>0; k>>=1 )
+        {
+            if( k & 1 )
+                power *= base;
+            base *= base;
+        }
+        return ( beta.hi < 0 ? DoubleDouble(1)/power : power );
+    }
+    if( alpha.hi == 0 )
+        return ( beta.hi > 0 ? DoubleDouble(0) :
+                 DoubleDouble(std::numeric_limits<double>::infinity()) );
+    return Exp( beta*Log(alpha) );
+}
+
 // Inverse exponentiation
 // ----------------------
 double Log( const Int& alpha ) { return std::log(alpha); }
@@ -282,6 +473,18 @@ BigFloat Log( const BigFloat& alpha )
 }
 #endif
 
+template<>
+DoubleDouble Log( const DoubleDouble& alpha )
+{
+    if( alpha.hi <= 0 || !std::isfinite(alpha.hi) )
+        return DoubleDouble(std::log(alpha.hi));
+    // A single Newton step, x := x + alpha exp(-x) - 1, doubles the
+    // accuracy of the double-precision estimate
+    DoubleDouble x( std::log(alpha.hi) );
+    x += alpha*Exp(-x) - DoubleDouble(1);
+    return x;
+}
+
 #ifdef EL_HAVE_QUAD
 template<> Quad Log2( const Quad& alpha )
 { return log2q(alpha); }
@@ -296,6 +499,8 @@ template<> BigFloat Log2( const BigFloat& alpha )
     return log2Alpha;
 }
 #endif
+template<> DoubleDouble Log2( const DoubleDouble& alpha )
+{ return Log(alpha) / ddLog2; }
 
 double Sqrt( const Int& alpha ) { return std::sqrt(alpha); }
 
@@ -326,6 +531,21 @@ BigFloat Sqrt( const BigFloat& alpha )
 }
 #endif
 
+template<>
+DoubleDouble Sqrt( const DoubleDouble& alpha )
+{
+    if( alpha.hi <= 0 || !std::isfinite(alpha.hi) )
+        return DoubleDouble(std::sqrt(alpha.hi));
+    // Karp and Markstein's trick: with x ~= 1/sqrt(alpha) and ax = alpha x,
+    // sqrt(alpha) ~= ax + (alpha - ax^2) x/2
+    const double x = 1/std::sqrt(alpha.hi);
+    const double ax = alpha.hi*x;
+    double e;
+    const double axSquared = dd::TwoProd( ax, ax, e );
+    const DoubleDouble residual = alpha - DoubleDouble(axSquared,e);
+    return DoubleDouble(ax) + DoubleDouble(residual.hi*(x/2));
+}
+
 // Trigonometric
 // =============
 double Cos( const Int& alpha ) { return std::cos(alpha); }
@@ -724,6 +944,18 @@ BigFloat Round( const BigFloat& alpha )
     return alphaRound;
 }
 #endif
+template<>
+DoubleDouble Round( const DoubleDouble& alpha )
+{
+    double hi = std::round(alpha.hi), lo = 0;
+    if( hi == alpha.hi )
+        hi = dd::QuickTwoSum( hi, std::round(alpha.lo), lo );
+    else if( hi-alpha.hi == 0.5 && alpha.lo < 0 )
+        hi -= 1;
+    else if( hi-alpha.hi == -0.5 && alpha.lo > 0 )
+        hi += 1;
+    return DoubleDouble(hi,lo);
+}
 
 // Ceiling
 // -------
@@ -741,6 +973,13 @@ BigFloat Ceil( const BigFloat& alpha )
     return alphaCeil;
 }
 #endif
+template<> DoubleDouble Ceil( const DoubleDouble& alpha )
+{
+    double hi = std::ceil(alpha.hi), lo = 0;
+    if( hi == alpha.hi )
+        hi = dd::QuickTwoSum( hi, std::ceil(alpha.lo), lo );
+    return DoubleDouble(hi,lo);
+}
 
 // Floor
 // -----
@@ -757,6 +996,13 @@ template<> BigFloat Floor( const BigFloat& alpha )
     return alphaFloor;
 }
 #endif
+template<> DoubleDouble Floor( const DoubleDouble& alpha )
+{
+    double hi = std::floor(alpha.hi), lo = 0;
+    if( hi == alpha.hi )
+        hi = dd::QuickTwoSum( hi, std::floor(alpha.lo), lo );
+    return DoubleDouble(hi,lo);
+}
 
 // Pi
 // ==
@@ -780,6 +1026,7 @@ BigFloat Pi( mpfr_prec_t prec )
     return pi;
 }
 #endif
+template<> DoubleDouble Pi<DoubleDouble>() { return ddPi; }
 
 // Gamma
 // =====
@@ -116,8 +116,113 @@ void Memory<G>::Empty()
     size_ = 0;
 }
 
+#ifdef EL_HAVE_MPC
+
+Memory<BigFloat>::Memory()
+: size_(0), buffer_(nullptr), rawLimbs_(nullptr), limbs_(nullptr),
+  numLimbs_(0)
+{ }
+
+Memory<BigFloat>::Memory( size_t size )
+: size_(0), buffer_(nullptr), rawLimbs_(nullptr), limbs_(nullptr),
+  numLimbs_(0)
+{ Require( size ); }
+
+Memory<BigFloat>::Memory( Memory<BigFloat>&& mem )
+: size_(0), buffer_(nullptr), rawLimbs_(nullptr), limbs_(nullptr),
+  numLimbs_(0)
+{ ShallowSwap(mem); }
+
+Memory<BigFloat>& Memory<BigFloat>::operator=( Memory<BigFloat>&& mem )
+{ ShallowSwap( mem ); return *this; }
+
+void Memory<BigFloat>::ShallowSwap( Memory<BigFloat>& mem )
+{
+    std::swap(size_,mem.size_);
+    std::swap(buffer_,mem.buffer_);
+    std::swap(rawLimbs_,mem.rawLimbs_);
+    std::swap(limbs_,mem.limbs_);
+    std::swap(numLimbs_,mem.numLimbs_);
+}
+
+Memory<BigFloat>::~Memory()
+{ Empty(); }
+
+BigFloat* Memory<BigFloat>::Buffer() const EL_NO_EXCEPT { return buffer_; }
+
+size_t Memory<BigFloat>::Size() const EL_NO_EXCEPT { return size_; }
+
+mp_limb_t* Memory<BigFloat>::Limbs() const EL_NO_EXCEPT { return limbs_; }
+
+size_t Memory<BigFloat>::NumLimbs() const EL_NO_EXCEPT { return numLimbs_; }
+
+BigFloat* Memory<BigFloat>::Require( size_t size )
+{
+    if( size > size_ )
+    {
+        Empty();
+
+        const mpfr_prec_t prec = mpc::Precision();
+        const size_t numLimbs = mpc::NumLimbs();
+        // Align the slab to a (typical) cache line
+        const size_t alignment = 64;
+        const size_t padding = alignment/sizeof(mp_limb_t);
+#ifndef EL_RELEASE
+        try {
+#endif
+            rawLimbs_ = New<mp_limb_t>( size*numLimbs+padding );
+            const size_t offset =
+              reinterpret_cast<std::uintptr_t>(rawLimbs_) % alignment;
+            limbs_ = ( offset == 0 ? rawLimbs_ :
+              rawLimbs_ + (alignment-offset)/sizeof(mp_limb_t) );
+
+            // Construct the entries in place over the slab
+            buffer_ = static_cast<BigFloat*>
+              (::operator new(size*sizeof(BigFloat)));
+            for( size_t k=0; k<size; ++k )
+                new (&buffer_[k]) BigFloat( &limbs_[k*numLimbs], prec );
+
+            size_ = size;
+            numLimbs_ = numLimbs;
+#ifndef EL_RELEASE
+        } 
+        catch( std::bad_alloc& e )
+        {
+            Delete( rawLimbs_ );
+            limbs_ = nullptr;
+            size_ = 0;
+            ostringstream os;
+            os << "Failed to allocate " 
+               << size*(sizeof(BigFloat)+numLimbs*sizeof(mp_limb_t))
+               << " bytes on process " << mpi::Rank() << endl;
+            cerr << os.str();
+            throw e;
+        }
+#endif
+    }
+    return buffer_;
+}
+
+void Memory<BigFloat>::Release()
+{ this->Empty(); }
+
+void Memory<BigFloat>::Empty()
+{
+    for( size_t k=0; k<size_; ++k )
+        buffer_[k].~BigFloat();
+    ::operator delete( buffer_ );
+    buffer_ = nullptr;
+    Delete( rawLimbs_ );
+    limbs_ = nullptr;
+    size_ = 0;
+    numLimbs_ = 0;
+}
+
+#endif // ifdef EL_HAVE_MPC
+
 #define PROTO(T) template class Memory<T>;
 
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -538,6 +538,70 @@ void EL_BLAS(ztrsm)
 namespace El {
 namespace blas {
 
+namespace {
+
+// Double-double kernels
+// =====================
+// Each double-double update is a chain of error-free transformations, so a
+// naive loop is latency-bound. The inner products below therefore split the
+// sum over four independent accumulators so that the fused multiply-adds of
+// consecutive terms may be pipelined, while the column updates are unit
+// stride and free of loop-carried dependencies, and may be vectorized.
+
+DoubleDouble DDDot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    DoubleDouble acc0(0), acc1(0), acc2(0), acc3(0);
+    BlasInt i=0;
+    for( ; i+3<n; i+=4 )
+    {
+        acc0 += x[ i   *incx]*y[ i   *incy];
+        acc1 += x[(i+1)*incx]*y[(i+1)*incy];
+        acc2 += x[(i+2)*incx]*y[(i+2)*incy];
+        acc3 += x[(i+3)*incx]*y[(i+3)*incy];
+    }
+    for( ; i<n; ++i )
+        acc0 += x[i*incx]*y[i*incy];
+    return (acc0+acc1) + (acc2+acc3);
+}
+
+void DDAxpy
+( BlasInt n, DoubleDouble alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy )
+{
+    if( incx == 1 && incy == 1 )
+    {
+        EL_SIMD
+        for( BlasInt i=0; i<n; ++i )
+            y[i] += alpha*x[i];
+    }
+    else
+    {
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] += alpha*x[i*incx];
+    }
+}
+
+// Overwrite y with beta y, treating beta=0 as a (NaN-clearing) zeroing
+void DDScal( BlasInt n, DoubleDouble beta, DoubleDouble* y, BlasInt incy )
+{
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] *= beta;
+    }
+}
+
+} // anonymous namespace
+
 // Level 1 BLAS
 // ============
 template<typename T>
@@ -581,6 +645,11 @@ void Axpy
         double* y, BlasInt incy )
 { EL_BLAS(daxpy)( &n, &alpha, x, &incx, y, &incy ); }
 void Axpy
+( BlasInt n, DoubleDouble alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy )
+{ DDAxpy( n, alpha, x, incx, y, incy ); }
+void Axpy
 ( BlasInt n, scomplex alpha,
   const scomplex* x, BlasInt incx, 
         scomplex* y, BlasInt incy )
@@ -604,6 +673,10 @@ template void Copy
 ( BlasInt n,
   const Int* x, BlasInt incx,
         Int* y, BlasInt incy );
+template void Copy
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy );
 #ifdef EL_HAVE_QUAD
 template void Copy
 ( BlasInt n,
@@ -693,6 +766,11 @@ double Dot
   const double* x, BlasInt incx,
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{ return DDDot( n, x, incx, y, incy ); }
 
 template<typename T>
 T Dotu
@@ -743,6 +821,11 @@ double Dotu
   const double* x, BlasInt incx,
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
+DoubleDouble Dotu
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{ return DDDot( n, x, incx, y, incy ); }
 
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx )
@@ -756,6 +839,7 @@ Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx )
 }
 template float Nrm2( BlasInt n, const float* x, BlasInt incx );
 template float Nrm2( BlasInt n, const scomplex* x, BlasInt incx );
+template DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template Quad Nrm2( BlasInt n, const Quad* x, BlasInt incx );
 template Quad Nrm2( BlasInt n, const Complex<Quad>* x, BlasInt incx );
@@ -787,6 +871,7 @@ BlasInt MaxInd( BlasInt n, const F* x, BlasInt incx )
     return maxAbsInd;
 }
 template BlasInt MaxInd( BlasInt n, const Int* x, BlasInt incx );
+template BlasInt MaxInd( BlasInt n, const DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template BlasInt MaxInd( BlasInt n, const Quad* x, BlasInt incx );
 template BlasInt MaxInd( BlasInt n, const Complex<Quad>* x, BlasInt incx );
@@ -859,6 +944,8 @@ Complex<Real> Givens
         return *c*phi + *s*gamma;
     }
 }
+template DoubleDouble Givens
+( DoubleDouble phi, DoubleDouble gamma, DoubleDouble* c, DoubleDouble* s );
 #ifdef EL_HAVE_QUAD
 template Quad Givens( Quad phi, Quad gamma, Quad* c, Quad* s );
 template Complex<Quad> Givens
@@ -913,6 +1000,11 @@ void Rot
         x[i*incx] = temp;
     }
 }
+template void Rot
+( BlasInt n,
+  DoubleDouble* x, BlasInt incx,
+  DoubleDouble* y, BlasInt incy,
+  DoubleDouble c, DoubleDouble s );
 #ifdef EL_HAVE_QUAD
 template void Rot
 ( BlasInt n,
@@ -965,6 +1057,8 @@ void Scal( BlasInt n, T alpha, T* x, BlasInt incx )
         x[j*incx] *= alpha;
 }
 template void Scal( BlasInt n, Int alpha, Int* x, BlasInt incx );
+template void Scal
+( BlasInt n, DoubleDouble alpha, DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template void Scal
 ( BlasInt n, Quad alpha, Quad* x, BlasInt incx );
@@ -1011,6 +1105,7 @@ Base<F> Nrm1( BlasInt n, const F* x, BlasInt incx )
 }
 template float Nrm1( BlasInt n, const float* x, BlasInt incx );
 template float Nrm1( BlasInt n, const scomplex* x, BlasInt incx );
+template DoubleDouble Nrm1( BlasInt n, const DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template Quad Nrm1( BlasInt n, const Quad* x, BlasInt incx );
 template Quad Nrm1( BlasInt n, const Complex<Quad>* x, BlasInt incx );
@@ -1035,6 +1130,8 @@ void Swap( BlasInt n, T* x, BlasInt incx, T* y, BlasInt incy )
     }
 }
 template void Swap( BlasInt n, Int* x, BlasInt incx, Int* y, BlasInt incy );
+template void Swap
+( BlasInt n, DoubleDouble* x, BlasInt incx, DoubleDouble* y, BlasInt incy );
 #ifdef EL_HAVE_QUAD
 template void Swap( BlasInt n, Quad* x, BlasInt incx, Quad* y, BlasInt incy );
 template void Swap
@@ -1150,6 +1247,28 @@ void Gemv
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
 
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* x, BlasInt incx,
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy )
+{
+    if( std::toupper(trans) == 'N' )
+    {
+        // y := beta y + alpha A x as a sequence of column updates
+        DDScal( m, beta, y, incy );
+        for( BlasInt j=0; j<n; ++j )
+            DDAxpy( m, alpha*x[j*incx], &A[j*ALDim], 1, y, incy );
+    }
+    else
+    {
+        // y := beta y + alpha A^T x as a sequence of inner products
+        DDScal( n, beta, y, incy );
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] += alpha*DDDot( m, &A[i*ALDim], 1, x, incx );
+    }
+}
+
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
   scomplex alpha, const scomplex* A, BlasInt ALDim, 
@@ -1182,6 +1301,11 @@ template void Ger
   Int alpha, const Int* x, BlasInt incx, 
              const Int* y, BlasInt incy, 
                    Int* A, BlasInt ALDim );
+template void Ger
+( BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                      const DoubleDouble* y, BlasInt incy,
+                            DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Ger
 ( BlasInt m, BlasInt n, 
@@ -1248,6 +1372,12 @@ template void Geru
   const Int* x, BlasInt incx, 
   const Int* y, BlasInt incy, 
         Int* A, BlasInt ALDim );
+template void Geru
+( BlasInt m, BlasInt n,
+  DoubleDouble alpha,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy,
+        DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Geru
 ( BlasInt m, BlasInt n, 
@@ -1323,7 +1453,7 @@ void Hemv
             y[i*incy] *= beta;
     }
 
-    if( uplo == LOWER )
+    if( std::toupper(uplo) == 'L' )
     {
         // Multiply with the lower triangle
         for( BlasInt j=0; j<m; ++j )
@@ -1354,6 +1484,11 @@ template void Hemv
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* x, BlasInt incx, 
   Int beta,        Int* y, BlasInt incy );
+template void Hemv
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* x, BlasInt incx,
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
 #ifdef EL_HAVE_QUAD
 template void Hemv
 ( char uplo, BlasInt m, 
@@ -1425,6 +1560,10 @@ template void Her
 ( char uplo, BlasInt m,
   Int alpha, const Int* x, BlasInt incx, 
                    Int* A, BlasInt ALDim );
+template void Her
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                            DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Her
 ( char uplo, BlasInt m, 
@@ -1488,6 +1627,11 @@ template void Her2
   Int alpha, const Int* x, BlasInt incx, 
              const Int* y, BlasInt incy, 
                    Int* A, BlasInt ALDim );
+template void Her2
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                      const DoubleDouble* y, BlasInt incy,
+                            DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Her2
 ( char uplo, BlasInt m, 
@@ -1556,7 +1700,7 @@ void Symv
             y[i*incy] *= beta;
     }
 
-    if( uplo == LOWER )
+    if( std::toupper(uplo) == 'L' )
     {
         // Multiply with the lower triangle
         for( BlasInt j=0; j<m; ++j )
@@ -1587,6 +1731,11 @@ template void Symv
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* x, BlasInt incx, 
   Int beta,        Int* y, BlasInt incy );
+template void Symv
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* x, BlasInt incx,
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
 #ifdef EL_HAVE_QUAD
 template void Symv
 ( char uplo, BlasInt m, 
@@ -1664,6 +1813,10 @@ template void Syr
 ( char uplo, BlasInt m,
   Int alpha, const Int* x, BlasInt incx, 
                    Int* A, BlasInt ALDim );
+template void Syr
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                            DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Syr
 ( char uplo, BlasInt m, 
@@ -1736,6 +1889,11 @@ template void Syr2
   Int alpha, const Int* x, BlasInt incx,
              const Int* y, BlasInt incy, 
                    Int* A, BlasInt ALDim );
+template void Syr2
+( char uplo, BlasInt m,
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                      const DoubleDouble* y, BlasInt incy,
+                            DoubleDouble* A, BlasInt ALDim );
 #ifdef EL_HAVE_QUAD
 template void Syr2
 ( char uplo, BlasInt m, 
@@ -1813,7 +1971,7 @@ void Trmv
 {
     const bool conj = ( std::toupper(trans) == 'C' );
     const bool unitDiag = ( std::toupper(diag) == 'U' );
-    if( uplo == LOWER )
+    if( std::toupper(uplo) == 'L' )
     {
         if( std::toupper(trans) == 'N' )
         {
@@ -1896,6 +2054,10 @@ template void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const Int* A, BlasInt ALDim,
         Int* x, BlasInt incx );
+template void Trmv
+( char uplo, char trans, char diag, BlasInt m,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
@@ -2019,6 +2181,10 @@ void Trsv
         }
     }
 }
+template void Trsv
+( char uplo, char trans, char diag, BlasInt m,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* x, BlasInt incx );
 #ifdef EL_HAVE_QUAD
 template void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
@@ -2315,6 +2481,47 @@ void Gemm
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim )
+{
+    for( BlasInt j=0; j<n; ++j )
+        DDScal( m, beta, &C[j*CLDim], 1 );
+
+    // Since the data is real, 'C' is equivalent to 'T'
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    if( normalA )
+    {
+        // C := alpha op(A) op(B) + C as a sequence of column updates
+        const BlasInt BRowStride = ( normalB ? 1 : BLDim );
+        const BlasInt BColStride = ( normalB ? BLDim : 1 );
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                const DoubleDouble gamma =
+                  alpha*B[l*BRowStride+j*BColStride];
+                DDAxpy( m, gamma, &A[l*ALDim], 1, &C[j*CLDim], 1 );
+            }
+        }
+    }
+    else
+    {
+        // C := alpha A^T op(B) + C as a sequence of inner products
+        const BlasInt BRowStride = ( normalB ? 1 : BLDim );
+        const BlasInt BColStride = ( normalB ? BLDim : 1 );
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] +=
+                  alpha*DDDot
+                  ( k, &A[i*ALDim], 1, &B[j*BColStride], BRowStride );
+    }
+}
+
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, 
   scomplex alpha, const scomplex* A, BlasInt ALDim, 
@@ -2481,6 +2688,11 @@ template void Hemm
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* B, BlasInt BLDim,
   Int beta,        Int* C, BlasInt CLDim );
+template void Hemm
+( char side, char uplo, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -2620,6 +2832,12 @@ template void Her2k
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* B, BlasInt BLDim,
   Int beta,        Int* C, BlasInt CLDim );
+template void Her2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Her2k
 ( char uplo, char trans,
@@ -2757,6 +2975,11 @@ template void Herk
   BlasInt n, BlasInt k, 
   Int alpha, const Int* A, BlasInt ALDim, 
   Int beta,        Int* C, BlasInt CLDim );
+template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Herk
 ( char uplo, char trans,
@@ -2906,6 +3129,11 @@ template void Symm
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* B, BlasInt BLDim,
   Int beta,        Int* C, BlasInt CLDim );
+template void Symm
+( char side, char uplo, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Symm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -3040,6 +3268,12 @@ template void Syr2k
   Int alpha, const Int* A, BlasInt ALDim, 
              const Int* B, BlasInt BLDim,
   Int beta,        Int* C, BlasInt CLDim );
+template void Syr2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                      const DoubleDouble* B, BlasInt BLDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Syr2k
 ( char uplo, char trans,
@@ -3171,6 +3405,11 @@ template void Syrk
   BlasInt n, BlasInt k, 
   Int alpha, const Int* A, BlasInt ALDim, 
   Int beta,        Int* C, BlasInt CLDim );
+template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt CLDim );
 #ifdef EL_HAVE_QUAD
 template void Syrk
 ( char uplo, char trans,
@@ -3310,6 +3549,11 @@ void Trmm
         }
     }
 }
+template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                            DoubleDouble* B, BlasInt BLDim );
 #ifdef EL_HAVE_QUAD
 template void Trmm
 ( char side, char uplo, char trans, char unit,
@@ -3621,6 +3865,11 @@ void Trsm
         }
     }
 }
+template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt ALDim,
+                            DoubleDouble* B, BlasInt BLDim );
 #ifdef EL_HAVE_QUAD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
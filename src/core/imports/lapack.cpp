@@ -455,6 +455,7 @@ Real SafeNorm( Real alpha, Real beta )
     return scale*Sqrt(scaledSquare);
 }
 template float SafeNorm( float alpha, float beta );
+template DoubleDouble SafeNorm( DoubleDouble alpha, DoubleDouble beta );
 #ifdef EL_HAVE_QUAD
 template Quad SafeNorm( Quad alpha, Quad beta );
 #endif
@@ -476,6 +477,8 @@ Real SafeNorm( Real alpha, Real beta, Real gamma )
     return scale*Sqrt(scaledSquare);
 }
 template float SafeNorm( float alpha, float beta, float gamma );
+template DoubleDouble SafeNorm
+( DoubleDouble alpha, DoubleDouble beta, DoubleDouble gamma );
 #ifdef EL_HAVE_QUAD
 template Quad SafeNorm( Quad alpha, Quad beta, Quad gamma );
 #endif
@@ -532,6 +535,9 @@ void Copy
 template void Copy
 ( char uplo, BlasInt m, BlasInt n, 
   const Int* A, BlasInt lda, Int* B, BlasInt ldb );
+template void Copy
+( char uplo, BlasInt m, BlasInt n, 
+  const DoubleDouble* A, BlasInt lda, DoubleDouble* B, BlasInt ldb );
 #ifdef EL_HAVE_QUAD
 template void Copy
 ( char uplo, BlasInt m, BlasInt n, 
@@ -593,6 +599,8 @@ Complex<Real> Givens
     //       zrotg-like implementation
     return blas::Givens( phi, gamma, c, s );
 }
+template DoubleDouble Givens
+( DoubleDouble phi, DoubleDouble gamma, DoubleDouble* c, DoubleDouble* s );
 #ifdef EL_HAVE_QUAD
 template Quad Givens( Quad phi, Quad gamma, Quad* c, Quad* s );
 template Complex<Quad> Givens
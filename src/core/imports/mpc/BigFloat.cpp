@@ -28,13 +28,32 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
-    numLimbs_ = (prec-1) / GMP_NUMB_BITS + 1;
+    const size_t numLimbs = (prec-1) / GMP_NUMB_BITS + 1;
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+    }
+    else if( numLimbs == numLimbs_ )
+    {
+        // Reuse our slot of the shared slab
+        mp_limb_t* limbs = mpfrFloat_->_mpfr_d;
+        mpfr_custom_init_set( mpfrFloat_, MPFR_NAN_KIND, 0, prec, limbs );
+    }
+    else
+    {
+        // Our slot of the shared slab is the wrong size, so detach from it
+        mpfr_init2( mpfrFloat_, prec );
+        ownsLimbs_ = true;
+    }
+    numLimbs_ = numLimbs;
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
 BigFloat::BigFloat()
 {
     DEBUG_ONLY(CSE cse("BigFloat::BigFloat [default]"))
@@ -43,6 +62,15 @@ BigFloat::BigFloat()
     numLimbs_ = (prec-1) / GMP_NUMB_BITS + 1;
 }
 
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+: ownsLimbs_(false)
+{
+    DEBUG_ONLY(CSE cse("BigFloat::BigFloat [custom limbs]"))
+    numLimbs_ = (prec-1) / GMP_NUMB_BITS + 1;
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_ZERO_KIND, 0, prec, limbs );
+}
+
 // Copy constructors
 // -----------------
 BigFloat::BigFloat( const BigFloat& a, mpfr_prec_t prec )
@@ -171,15 +199,25 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     DEBUG_ONLY(CSE cse("BigFloat::BigFloat [move]"))
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // The limbs of 'a' belong to a shared slab, so they must be copied
+        numLimbs_ = a.numLimbs_;
+        mpfr_init2( Pointer(), a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpc::RoundingMode() );
+    }
 }
 
 BigFloat::~BigFloat()
 {
     DEBUG_ONLY(CSE cse("BigFloat::~BigFloat"))
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -279,8 +317,18 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     DEBUG_ONLY(CSE cse("BigFloat::operator= [move]"))
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Limbs within a shared slab must stay in place
+        if( ownsLimbs_ )
+            SetPrecision( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpc::RoundingMode() );
+    }
     return *this;
 }
 
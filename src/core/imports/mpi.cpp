@@ -3604,6 +3604,9 @@ MPI_PROTO(ValueInt<double>)
 MPI_PROTO(ValueInt<Complex<double>>)
 MPI_PROTO(Entry<double>)
 MPI_PROTO(Entry<Complex<double>>)
+MPI_PROTO(DoubleDouble)
+MPI_PROTO(ValueInt<DoubleDouble>)
+MPI_PROTO(Entry<DoubleDouble>)
 #ifdef EL_HAVE_QUAD
 MPI_PROTO(Quad)
 MPI_PROTO(Complex<Quad>)
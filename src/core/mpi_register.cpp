@@ -15,6 +15,7 @@ using El::Int;
 using El::Quad;
 #endif
 using El::Complex;
+using El::DoubleDouble;
 #ifdef EL_HAVE_MPC
 using El::BigFloat;
 #endif
@@ -25,6 +26,7 @@ using std::function;
 
 // Scalar datatypes
 // ----------------
+El::mpi::Datatype DoubleDoubleType;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadType, QuadComplexType;
 #endif
@@ -35,7 +37,8 @@ El::mpi::Datatype BigFloatType;
 // (Int,Scalar) datatypes
 // ----------------------
 El::mpi::Datatype IntIntType, floatIntType, doubleIntType,
-                  floatComplexIntType, doubleComplexIntType;
+                  floatComplexIntType, doubleComplexIntType,
+                  DoubleDoubleIntType;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadIntType, QuadComplexIntType;
 #endif
@@ -46,7 +49,8 @@ El::mpi::Datatype BigFloatIntType;
 // (Int,Int,Scalar) datatypes
 // --------------------------
 El::mpi::Datatype IntEntryType, floatEntryType, doubleEntryType,
-                  floatComplexEntryType, doubleComplexEntryType;
+                  floatComplexEntryType, doubleComplexEntryType,
+                  DoubleDoubleEntryType;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadEntryType, QuadComplexEntryType;
 #endif
@@ -59,6 +63,7 @@ El::mpi::Datatype BigFloatEntryType;
 
 // Scalar datatype operations
 // --------------------------
+El::mpi::Op minDoubleDoubleOp, maxDoubleDoubleOp, sumDoubleDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op minQuadOp, maxQuadOp;
 El::mpi::Op sumQuadOp, sumQuadComplexOp;
@@ -72,7 +77,8 @@ El::mpi::Op sumBigFloatOp, sumMPComplexOp;
 // --------------------------------
 El::mpi::Op minLocIntOp,    maxLocIntOp,
             minLocFloatOp,  maxLocFloatOp,
-            minLocDoubleOp, maxLocDoubleOp;
+            minLocDoubleOp, maxLocDoubleOp,
+            minLocDoubleDoubleOp, maxLocDoubleDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op minLocQuadOp, maxLocQuadOp;
 #endif
@@ -84,7 +90,8 @@ El::mpi::Op minLocBigFloatOp, maxLocBigFloatOp;
 // ------------------------------------
 El::mpi::Op minLocPairIntOp,    maxLocPairIntOp,
             minLocPairFloatOp,  maxLocPairFloatOp,
-            minLocPairDoubleOp, maxLocPairDoubleOp;
+            minLocPairDoubleOp, maxLocPairDoubleOp,
+            minLocPairDoubleDoubleOp, maxLocPairDoubleDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op minLocPairQuadOp, maxLocPairQuadOp;
 #endif
@@ -112,6 +119,10 @@ function<Complex<double>(const Complex<double>&,const Complex<double>&)>
   userComplexDoubleFunc, userComplexDoubleCommFunc;
 El::mpi::Op userComplexDoubleOp, userComplexDoubleCommOp;
 
+function<DoubleDouble(const DoubleDouble&,const DoubleDouble&)>
+  userDoubleDoubleFunc, userDoubleDoubleCommFunc;
+El::mpi::Op userDoubleDoubleOp, userDoubleDoubleCommOp;
+
 #ifdef EL_HAVE_QUAD
 function<Quad(const Quad&,const Quad&)>
   userQuadFunc, userQuadCommFunc;
@@ -349,6 +360,81 @@ EL_NO_EXCEPT
         outData[j] = ::userComplexDoubleCommFunc(inData[j],outData[j]);
 }
 
+template<>
+void SetUserReduceFunc
+( function<DoubleDouble(const DoubleDouble&,const DoubleDouble&)> func,
+  bool commutative )
+{
+    if( commutative )
+        ::userDoubleDoubleCommFunc = func;
+    else
+        ::userDoubleDoubleFunc = func;
+}
+static void
+UserDoubleDoubleReduce
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userDoubleDoubleFunc(inData[j],outData[j]);
+}
+static void
+UserDoubleDoubleReduceComm
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userDoubleDoubleCommFunc(inData[j],outData[j]);
+}
+
+static void
+MaxDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] > outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+MinDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] < outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+SumDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] += inData[j];
+}
+
 #ifdef EL_HAVE_QUAD
 template<>
 void SetUserReduceFunc
@@ -624,6 +710,10 @@ EL_NO_EXCEPT;
 template void
 MaxLocFunc<double>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
+template void
+MaxLocFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype )
+EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void
 MaxLocFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
@@ -682,6 +772,10 @@ EL_NO_EXCEPT;
 template void
 MaxLocPairFunc<double>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
+template void
+MaxLocPairFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype )
+EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void
 MaxLocPairFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
@@ -739,6 +833,10 @@ EL_NO_EXCEPT;
 template void
 MinLocFunc<double>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
+template void
+MinLocFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype )
+EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void
 MinLocFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
@@ -797,6 +895,10 @@ EL_NO_EXCEPT;
 template void
 MinLocPairFunc<double>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
+template void
+MinLocPairFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype )
+EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void
 MinLocPairFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
@@ -816,6 +918,9 @@ Datatype& ValueIntType<double>() EL_NO_EXCEPT { return ::doubleIntType; }
 template<>
 Datatype& ValueIntType<Complex<double>>() EL_NO_EXCEPT
 { return ::doubleComplexIntType; }
+template<>
+Datatype& ValueIntType<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleIntType; }
 #ifdef EL_HAVE_QUAD
 template<>
 Datatype& ValueIntType<Quad>() EL_NO_EXCEPT { return ::QuadIntType; }
@@ -841,6 +946,9 @@ Datatype& EntryType<double>() EL_NO_EXCEPT { return ::doubleEntryType; }
 template<>
 Datatype& EntryType<Complex<double>>() EL_NO_EXCEPT
 { return ::doubleComplexEntryType; }
+template<>
+Datatype& EntryType<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleEntryType; }
 #ifdef EL_HAVE_QUAD
 template<>
 Datatype& EntryType<Quad>() EL_NO_EXCEPT { return ::QuadEntryType; }
@@ -875,6 +983,8 @@ template<> Datatype TypeMap<unsigned long long>() EL_NO_EXCEPT
 
 template<> Datatype TypeMap<float>() EL_NO_EXCEPT { return MPI_FLOAT; }
 template<> Datatype TypeMap<double>() EL_NO_EXCEPT{ return MPI_DOUBLE; }
+template<> Datatype TypeMap<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleType; }
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<Quad>() EL_NO_EXCEPT { return ::QuadType; }
 template<> Datatype TypeMap<Complex<Quad>>() EL_NO_EXCEPT 
@@ -921,6 +1031,8 @@ template<> Datatype TypeMap<ValueInt<double>>() EL_NO_EXCEPT
 { return ValueIntType<double>(); }
 template<> Datatype TypeMap<ValueInt<Complex<double>>>() EL_NO_EXCEPT
 { return ValueIntType<Complex<double>>(); }
+template<> Datatype TypeMap<ValueInt<DoubleDouble>>() EL_NO_EXCEPT
+{ return ValueIntType<DoubleDouble>(); }
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<ValueInt<Quad>>() EL_NO_EXCEPT
 { return ValueIntType<Quad>(); }
@@ -942,6 +1054,8 @@ template<> Datatype TypeMap<Entry<double>>() EL_NO_EXCEPT
 { return EntryType<double>(); }
 template<> Datatype TypeMap<Entry<Complex<double>>>() EL_NO_EXCEPT
 { return EntryType<Complex<double>>(); }
+template<> Datatype TypeMap<Entry<DoubleDouble>>() EL_NO_EXCEPT
+{ return EntryType<DoubleDouble>(); }
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<Entry<Quad>>() EL_NO_EXCEPT
 { return EntryType<Quad>(); }
@@ -1025,6 +1139,7 @@ void CreateValueIntType<BigFloat>() EL_NO_EXCEPT
 template void CreateValueIntType<Int>() EL_NO_EXCEPT;
 template void CreateValueIntType<float>() EL_NO_EXCEPT;
 template void CreateValueIntType<double>() EL_NO_EXCEPT;
+template void CreateValueIntType<DoubleDouble>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void CreateValueIntType<Quad>() EL_NO_EXCEPT;
 #endif
@@ -1113,6 +1228,7 @@ void CreateEntryType<BigFloat>() EL_NO_EXCEPT
 template void CreateEntryType<Int>() EL_NO_EXCEPT;
 template void CreateEntryType<float>() EL_NO_EXCEPT;
 template void CreateEntryType<double>() EL_NO_EXCEPT;
+template void CreateEntryType<DoubleDouble>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void CreateEntryType<Quad>() EL_NO_EXCEPT;
 #endif
@@ -1142,10 +1258,19 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 {
     // Create the necessary types
     // ==========================
+    // Create an MPI type for DoubleDouble
+    // -----------------------------------
+    int err;
+    err = MPI_Type_contiguous( 2, MPI_DOUBLE, &::DoubleDoubleType );
+    if( err != MPI_SUCCESS )
+        RuntimeError("MPI_Type_contiguous returned with err=",err);
+    err = MPI_Type_commit( &::DoubleDoubleType );
+    if( err != MPI_SUCCESS )
+        RuntimeError("MPI_Type_commit returned with err=",err);
+
 #ifdef EL_HAVE_QUAD
     // Create an MPI type for Quad
     // ---------------------------
-    int err;
     err = MPI_Type_contiguous( 2, MPI_DOUBLE, &::QuadType );
     if( err != MPI_SUCCESS )
         RuntimeError("MPI_Type_contiguous returned with err=",err);
@@ -1177,6 +1302,7 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     mpi::CreateValueIntType<Complex<float>>();
     mpi::CreateValueIntType<Complex<double>>();
+    mpi::CreateValueIntType<DoubleDouble>();
 #ifdef EL_HAVE_QUAD
     mpi::CreateValueIntType<Quad>();
     mpi::CreateValueIntType<Complex<Quad>>();
@@ -1189,6 +1315,7 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     mpi::CreateEntryType<double>();
     mpi::CreateEntryType<Complex<float>>();
     mpi::CreateEntryType<Complex<double>>();
+    mpi::CreateEntryType<DoubleDouble>();
 #ifdef EL_HAVE_QUAD
     mpi::CreateEntryType<Quad>();
     mpi::CreateEntryType<Complex<Quad>>();
@@ -1222,6 +1349,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create
     ( (UserFunction*)UserComplexDoubleReduceComm, true,
                    ::userComplexDoubleCommOp );
+    Create
+    ( (UserFunction*)UserDoubleDoubleReduce, false, ::userDoubleDoubleOp );
+    Create
+    ( (UserFunction*)UserDoubleDoubleReduceComm, true,
+                   ::userDoubleDoubleCommOp );
 #ifdef EL_HAVE_QUAD
     Create
     ( (UserFunction*)UserQuadReduce, false, ::userQuadOp );
@@ -1242,6 +1374,9 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
    
     // Functions for scalar types
     // --------------------------
+    Create( (UserFunction*)MaxDoubleDouble, true, ::maxDoubleDoubleOp );
+    Create( (UserFunction*)MinDoubleDouble, true, ::minDoubleDoubleOp );
+    Create( (UserFunction*)SumDoubleDouble, true, ::sumDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Create( (UserFunction*)MaxQuad, true, ::maxQuadOp );
     Create( (UserFunction*)MinQuad, true, ::minQuadOp );
@@ -1269,6 +1404,10 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     ::maxLocDoubleOp = MAXLOC;
     ::minLocDoubleOp = MINLOC;
 #endif
+    Create
+    ( (UserFunction*)MaxLocFunc<DoubleDouble>, true, ::maxLocDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MinLocFunc<DoubleDouble>, true, ::minLocDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Create( (UserFunction*)MaxLocFunc<Quad>, true, ::maxLocQuadOp );
     Create( (UserFunction*)MinLocFunc<Quad>, true, ::minLocQuadOp );
@@ -1286,6 +1425,12 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create( (UserFunction*)MinLocPairFunc<float>,  true, ::minLocPairFloatOp  );
     Create( (UserFunction*)MaxLocPairFunc<double>, true, ::maxLocPairDoubleOp );
     Create( (UserFunction*)MinLocPairFunc<double>, true, ::minLocPairDoubleOp );
+    Create
+    ( (UserFunction*)MaxLocPairFunc<DoubleDouble>, true,
+      ::maxLocPairDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MinLocPairFunc<DoubleDouble>, true,
+      ::minLocPairDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Create( (UserFunction*)MaxLocPairFunc<Quad>,   true, ::maxLocPairQuadOp );
     Create( (UserFunction*)MinLocPairFunc<Quad>,   true, ::minLocPairQuadOp );
@@ -1303,6 +1448,7 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
     // Destroy the created types
     // =========================
+    Free( ::DoubleDoubleType );
 #ifdef EL_HAVE_QUAD
     Free( ::QuadType );
     Free( ::QuadComplexType );
@@ -1318,6 +1464,7 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
 #endif
     Free( ValueIntType<Complex<float>>() );
     Free( ValueIntType<Complex<double>>() );
+    Free( ValueIntType<DoubleDouble>() );
 #ifdef EL_HAVE_QUAD
     Free( ValueIntType<Quad>() );
     Free( ValueIntType<Complex<Quad>>() );
@@ -1328,6 +1475,7 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( EntryType<double>() );
     Free( EntryType<Complex<float>>() );
     Free( EntryType<Complex<double>>() );
+    Free( EntryType<DoubleDouble>() );
 #ifdef EL_HAVE_QUAD
     Free( EntryType<Quad>() );
     Free( EntryType<Complex<Quad>>() );
@@ -1348,6 +1496,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::userComplexFloatCommOp );
     Free( ::userComplexDoubleOp );
     Free( ::userComplexDoubleCommOp );
+    Free( ::userDoubleDoubleOp );
+    Free( ::userDoubleDoubleCommOp );
 #ifdef EL_HAVE_QUAD
     Free( ::userQuadOp );
     Free( ::userQuadCommOp );
@@ -1359,6 +1509,9 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::userBigFloatCommOp );
 #endif
 
+    Free( ::maxDoubleDoubleOp );
+    Free( ::minDoubleDoubleOp );
+    Free( ::sumDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Free( ::maxQuadOp );
     Free( ::minQuadOp );
@@ -1379,6 +1532,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::maxLocDoubleOp );
     Free( ::minLocDoubleOp );
 #endif
+    Free( ::maxLocDoubleDoubleOp );
+    Free( ::minLocDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Free( ::maxLocQuadOp );
     Free( ::minLocQuadOp );
@@ -1394,6 +1549,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::minLocPairFloatOp );
     Free( ::maxLocPairDoubleOp );
     Free( ::minLocPairDoubleOp );
+    Free( ::maxLocPairDoubleDoubleOp );
+    Free( ::minLocPairDoubleDoubleOp );
 #ifdef EL_HAVE_QUAD
     Free( ::maxLocPairQuadOp );
     Free( ::minLocPairQuadOp );
@@ -1418,6 +1575,10 @@ template<> Op UserOp<Complex<double>>() EL_NO_EXCEPT
 { return ::userComplexDoubleOp; }
 template<> Op UserCommOp<Complex<double>>() EL_NO_EXCEPT
 { return ::userComplexDoubleCommOp; }
+template<> Op UserOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::userDoubleDoubleOp; }
+template<> Op UserCommOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::userDoubleDoubleCommOp; }
 #ifdef EL_HAVE_QUAD
 template<> Op UserOp<Quad>() EL_NO_EXCEPT
 { return ::userQuadOp; }
@@ -1435,6 +1596,14 @@ template<> Op UserCommOp<BigFloat>() EL_NO_EXCEPT
 { return ::userBigFloatCommOp; }
 #endif
 
+template<> Op MaxOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxDoubleDoubleOp; }
+template<> Op MinOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minDoubleDoubleOp; }
+
+template<> Op SumOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::sumDoubleDoubleOp; }
+
 #ifdef EL_HAVE_QUAD
 template<> Op MaxOp<Quad>() EL_NO_EXCEPT { return ::maxQuadOp; }
 template<> Op MinOp<Quad>() EL_NO_EXCEPT { return ::minQuadOp; }
@@ -1455,6 +1624,10 @@ template<> Op MaxLocOp<float>() EL_NO_EXCEPT { return ::maxLocFloatOp; }
 template<> Op MinLocOp<float>() EL_NO_EXCEPT { return ::minLocFloatOp; }
 template<> Op MaxLocOp<double>() EL_NO_EXCEPT { return ::maxLocDoubleOp; }
 template<> Op MinLocOp<double>() EL_NO_EXCEPT { return ::minLocDoubleOp; }
+template<> Op MaxLocOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxLocDoubleDoubleOp; }
+template<> Op MinLocOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minLocDoubleDoubleOp; }
 #ifdef EL_HAVE_QUAD
 template<> Op MaxLocOp<Quad>() EL_NO_EXCEPT { return ::maxLocQuadOp; }
 template<> Op MinLocOp<Quad>() EL_NO_EXCEPT { return ::minLocQuadOp; }
@@ -1476,6 +1649,10 @@ template<> Op MaxLocPairOp<double>() EL_NO_EXCEPT
 { return ::maxLocPairDoubleOp; }
 template<> Op MinLocPairOp<double>() EL_NO_EXCEPT
 { return ::minLocPairDoubleOp; }
+template<> Op MaxLocPairOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxLocPairDoubleDoubleOp; }
+template<> Op MinLocPairOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minLocPairDoubleDoubleOp; }
 #ifdef EL_HAVE_QUAD
 template<> Op MaxLocPairOp<Quad>() EL_NO_EXCEPT
 { return ::maxLocPairQuadOp; }
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <system_error>
+
+namespace El {
+
+template<typename T>
+RowChunkStream<T>::RowChunkStream
+( const string filename, Int chunkSize, FileFormat format,
+  Int height, Int width, bool prefetch )
+: filename_(filename), chunkSize_(chunkSize), prefetch_(prefetch),
+  nextChunk_(0), pendingChunk_(0)
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::RowChunkStream"))
+    if( chunkSize <= 0 )
+        LogicError("Chunk size must be positive");
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    file_.open( filename.c_str(), std::ios::binary );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int numBytes = FileSize( file_ );
+
+    Int metaBytes = 0;
+    if( format == BINARY )
+    {
+        file_.read( (char*)&height_, sizeof(Int) );
+        file_.read( (char*)&width_,  sizeof(Int) );
+        metaBytes = 2*sizeof(Int);
+    }
+    else if( format == BINARY_FLAT )
+    {
+        if( height < 0 || width < 0 )
+            LogicError("Dimensions must be specified for BINARY_FLAT streams");
+        height_ = height;
+        width_ = width;
+    }
+    else
+        LogicError("Format unsupported for streaming");
+    dataOffset_ = metaBytes;
+
+    const Int numBytesExp = metaBytes + height_*width_*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    if( prefetch_ )
+        Prefetch( 0 );
+}
+
+template<typename T>
+RowChunkStream<T>::~RowChunkStream()
+{
+    // Do not allow an outstanding read to outlive the buffer and file
+    if( pending_.valid() )
+        pending_.wait();
+}
+
+template<typename T>
+Int RowChunkStream<T>::Height() const { return height_; }
+template<typename T>
+Int RowChunkStream<T>::Width() const { return width_; }
+template<typename T>
+Int RowChunkStream<T>::ChunkSize() const { return chunkSize_; }
+template<typename T>
+Int RowChunkStream<T>::NumChunks() const
+{ return (height_+chunkSize_-1) / chunkSize_; }
+
+template<typename T>
+void RowChunkStream<T>::Rewind()
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::Rewind"))
+    Wait();
+    nextChunk_ = 0;
+    if( prefetch_ )
+        Prefetch( 0 );
+}
+
+template<typename T>
+bool RowChunkStream<T>::Next( Matrix<T>& chunk, Int& rowOffset )
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::Next"))
+    const Int numChunks = NumChunks();
+    if( nextChunk_ >= numChunks )
+        return false;
+
+    if( prefetch_ )
+    {
+        // Hand the prefetched block to the caller and recycle the caller's
+        // previous block as the buffer for the next read
+        Wait();
+        std::swap( chunk, buffer_ );
+    }
+    else
+        ReadChunk( nextChunk_, chunk );
+    rowOffset = nextChunk_*chunkSize_;
+    ++nextChunk_;
+
+    if( prefetch_ && nextChunk_ < numChunks )
+        Prefetch( nextChunk_ );
+    return true;
+}
+
+// NOTE: Since this routine is run by the prefetching thread, it is limited
+//       to raw reads into a buffer which was sized by the calling thread
+//       (neither the call stack nor any other Elemental state may be touched)
+//       and it reports failure through its return value
+template<typename T>
+bool RowChunkStream<T>::ReadRows( Int rowBeg, Int numRows, T* buffer, Int ldim )
+{
+    // Each column of the block is contiguous within the file
+    for( Int j=0; j<width_; ++j )
+    {
+        const std::streamoff pos = dataOffset_ + (rowBeg+j*height_)*sizeof(T);
+        file_.seekg( pos );
+        file_.read( (char*)&buffer[j*ldim], numRows*sizeof(T) );
+    }
+    return bool(file_);
+}
+
+template<typename T>
+void RowChunkStream<T>::ReadChunk( Int chunk, Matrix<T>& A )
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::ReadChunk"))
+    const Int rowBeg = chunk*chunkSize_;
+    const Int rowEnd = Min( rowBeg+chunkSize_, height_ );
+    A.Resize( rowEnd-rowBeg, width_ );
+    if( !ReadRows( rowBeg, rowEnd-rowBeg, A.Buffer(), A.LDim() ) )
+        RuntimeError("Could not read rows ",rowBeg,":",rowEnd," of ",filename_);
+}
+
+template<typename T>
+void RowChunkStream<T>::Prefetch( Int chunk )
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::Prefetch"))
+    const Int rowBeg = chunk*chunkSize_;
+    const Int numRows = Min( rowBeg+chunkSize_, height_ ) - rowBeg;
+    buffer_.Resize( numRows, width_ );
+    T* buffer = buffer_.Buffer();
+    const Int ldim = buffer_.LDim();
+    pendingChunk_ = chunk;
+    try
+    {
+        pending_ = 
+          std::async
+          ( std::launch::async,
+            [=]() { return ReadRows( rowBeg, numRows, buffer, ldim ); } );
+    }
+    catch( std::system_error& )
+    {
+        // Fall back to a synchronous read if no thread could be launched
+        ReadChunk( chunk, buffer_ );
+    }
+}
+
+template<typename T>
+void RowChunkStream<T>::Wait()
+{
+    DEBUG_ONLY(CSE cse("RowChunkStream::Wait"))
+    if( pending_.valid() && !pending_.get() )
+    {
+        const Int rowBeg = pendingChunk_*chunkSize_;
+        const Int rowEnd = Min( rowBeg+chunkSize_, height_ );
+        RuntimeError("Could not read rows ",rowBeg,":",rowEnd," of ",filename_);
+    }
+}
+
+#define PROTO(T) template class RowChunkStream<T>;
+
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
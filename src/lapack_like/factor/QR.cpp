@@ -208,8 +208,27 @@ void QR
 #define PROTO_QUAD PROTO_BASE(Quad)
 #define PROTO_COMPLEX_QUAD PROTO_BASE(Complex<Quad>)
 #define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
+#define PROTO_DOUBLEDOUBLE \
+  template void QR \
+  ( Matrix<DoubleDouble>& A, \
+    Matrix<DoubleDouble>& t, \
+    Matrix<DoubleDouble>& d ); \
+  template void QR \
+  ( Matrix<DoubleDouble>& A, \
+    Matrix<DoubleDouble>& t, \
+    Matrix<DoubleDouble>& d, \
+    Permutation& Omega, \
+    const QRCtrl<DoubleDouble>& ctrl ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const Matrix<DoubleDouble>& A, \
+    const Matrix<DoubleDouble>& t, \
+    const Matrix<DoubleDouble>& d, \
+          Matrix<DoubleDouble>& B );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
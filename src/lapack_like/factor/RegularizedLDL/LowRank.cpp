@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace reg_ldl {
+
+template<typename F>
+void FormLowRankCorrection
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        LowRankCorrection<F>& correction )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::FormLowRankCorrection"))
+    const Int k = correction.U.Width();
+
+    // W := inv(S) U
+    // =============
+    correction.W = correction.U;
+    if( k == 0 )
+    {
+        Zeros( correction.schur, 0, 0 );
+        return;
+    }
+    ldl::MatrixNode<F> WNodal( invMap, info, correction.W );
+    ldl::SolveAfter( info, front, WNodal );
+    WNodal.Push( invMap, info, correction.W );
+
+    // schur := chol(I + U^H W)
+    // ========================
+    Identity( correction.schur, k, k );
+    Gemm
+    ( ADJOINT, NORMAL,
+      F(1), correction.U, correction.W, F(1), correction.schur );
+    Cholesky( LOWER, correction.schur );
+}
+
+template<typename F>
+void FormLowRankCorrection
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistLowRankCorrection<F>& correction )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::FormLowRankCorrection"))
+    const Int k = correction.U.Width();
+    mpi::Comm comm = correction.U.Comm();
+
+    // W := inv(S) U
+    // =============
+    correction.W = correction.U;
+    if( k == 0 )
+    {
+        Zeros( correction.schur, 0, 0 );
+        return;
+    }
+    ldl::DistMultiVecNode<F> WNodal( invMap, info, correction.W );
+    ldl::SolveAfter( info, front, WNodal );
+    WNodal.Push( invMap, info, correction.W );
+
+    // schur := chol(I + U^H W)
+    // ========================
+    Zeros( correction.schur, k, k );
+    Gemm
+    ( ADJOINT, NORMAL,
+      F(1), correction.U.LockedMatrix(), correction.W.LockedMatrix(),
+      F(0), correction.schur );
+    mpi::AllReduce( correction.schur.Buffer(), k*k, mpi::SUM, comm );
+    ShiftDiagonal( correction.schur, F(1) );
+    Cholesky( LOWER, correction.schur );
+}
+
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const LowRankCorrection<F>& correction,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        Matrix<F>& B,
+        Base<F> relTol,
+        Int maxRefineIts,
+        bool progress,
+        bool time )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::RegularizedSolveAfter"))
+    const Int k = correction.U.Width();
+    const auto& U = correction.U;
+    const auto& W = correction.W;
+    const auto& schur = correction.schur;
+
+    // TODO: Use time in these lambdas
+    Matrix<F> T;
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+        if( k > 0 )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), U, X, T );
+            Gemm( NORMAL, NORMAL, F(1), U, T, F(1), Y );
+        }
+      };
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        ldl::MatrixNode<F> YNodal( invMap, info, Y );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, Y );
+        if( k > 0 )
+        {
+            // Y := Y - W inv(I + U^H W) U^H Y
+            Gemm( ADJOINT, NORMAL, F(1), U, Y, T );
+            cholesky::SolveAfter( LOWER, NORMAL, schur, T );
+            Gemm( NORMAL, NORMAL, F(-1), W, T, F(1), Y );
+        }
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistLowRankCorrection<F>& correction,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistMultiVec<F>& B,
+        Base<F> relTol,
+        Int maxRefineIts,
+        bool progress,
+        bool time )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::RegularizedSolveAfter"))
+    const Int k = correction.U.Width();
+    const auto& ULoc = correction.U.LockedMatrix();
+    const auto& WLoc = correction.W.LockedMatrix();
+    const auto& schur = correction.schur;
+    mpi::Comm comm = B.Comm();
+
+    // T := U^H X (redundantly)
+    Matrix<F> T;
+    auto applyUAdj =
+      [&]( const DistMultiVec<F>& X )
+      {
+        const Int width = X.Width();
+        Zeros( T, k, width );
+        Gemm( ADJOINT, NORMAL, F(1), ULoc, X.LockedMatrix(), F(0), T );
+        mpi::AllReduce( T.Buffer(), k*width, mpi::SUM, comm );
+      };
+
+    // TODO: Use time in these lambdas
+    ldl::DistMultiVecNodeMeta meta;
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+        if( k > 0 )
+        {
+            applyUAdj( X );
+            Gemm( NORMAL, NORMAL, F(1), ULoc, T, F(1), Y.Matrix() );
+        }
+      };
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        ldl::DistMultiVecNode<F> YNodal;
+        YNodal.Pull( invMap, info, Y, meta );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, Y, meta );
+        if( k > 0 )
+        {
+            // Y := Y - W inv(I + U^H W) U^H Y
+            applyUAdj( Y );
+            cholesky::SolveAfter( LOWER, NORMAL, schur, T );
+            Gemm( NORMAL, NORMAL, F(-1), WLoc, T, F(1), Y.Matrix() );
+        }
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+#define PROTO(F) \
+  template void FormLowRankCorrection \
+  ( const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<F>& front, \
+          LowRankCorrection<F>& correction ); \
+  template void FormLowRankCorrection \
+  ( const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<F>& front, \
+          DistLowRankCorrection<F>& correction ); \
+  template Int RegularizedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const LowRankCorrection<F>& correction, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<F>& front, \
+          Matrix<F>& B, \
+    Base<F> relTol, Int maxRefineIts, bool progress, bool time ); \
+  template Int RegularizedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistLowRankCorrection<F>& correction, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<F>& front, \
+          DistMultiVec<F>& B, \
+    Base<F> relTol, Int maxRefineIts, bool progress, bool time );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace reg_ldl
+} // namespace El
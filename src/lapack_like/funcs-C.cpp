@@ -19,6 +19,9 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzThresh = 0.5;
+    ctrl->newtonSchulzDegree = 1;
     return EL_SUCCESS;
 }
 ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
@@ -28,6 +31,9 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzThresh = 0.5;
+    ctrl->newtonSchulzDegree = 1;
     return EL_SUCCESS;
 }
 
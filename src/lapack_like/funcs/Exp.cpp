@@ -0,0 +1,451 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The dense routines follow Nicholas J. Higham's "The scaling and squaring
+// method for the matrix exponential revisited", SIAM J. Matrix Anal. Appl.,
+// Vol. 26, No. 4, pp. 1179--1193, 2005, while the action of the exponential
+// on a set of vectors follows Awad H. Al-Mohy and Nicholas J. Higham's
+// "Computing the action of the matrix exponential, with an application to
+// exponential integrators", SIAM J. Sci. Comput., Vol. 33, No. 2, 2011.
+//
+// NOTE: The theta_m switchpoints were derived for double-precision. They are
+//       (conservatively) reused for single-precision, whereas, for higher
+//       precisions, only the degree 13 Pade approximant is used and the
+//       switchpoints are reduced to account for the smaller unit roundoff.
+
+namespace El {
+
+namespace expm {
+
+// Return the coefficients of the numerator of the [m/m] Pade approximant to
+// exp(x), normalized so that b_0 = 1
+template<typename Real>
+inline vector<Real> PadeCoefficients( Int m )
+{
+    vector<Real> b(m+1);
+    b[0] = 1;
+    for( Int j=1; j<=m; ++j )
+        b[j] = b[j-1]*Real(m-j+1) / (Real(j)*Real(2*m-j+1));
+    return b;
+}
+
+template<typename Real>
+inline Real Theta( Int m )
+{
+    switch( m )
+    {
+    case 3:  return Real(1.495585217958292e-2);
+    case 5:  return Real(2.539398330063230e-1);
+    case 7:  return Real(9.504178996162932e-1);
+    case 9:  return Real(2.097847961257068e0);
+    case 13: return Real(5.371920351148152e0);
+    default: LogicError("Invalid Pade degree"); return Real(0);
+    }
+}
+
+// The degree 13 approximant has a truncation error of O(x^27), so shrink its
+// switchpoint accordingly for precisions beyond double
+template<typename Real>
+inline Real Theta13()
+{
+    const Real epsRatio =
+      limits::Epsilon<Real>() / Real(limits::Epsilon<double>());
+    if( epsRatio >= Real(1) )
+        return Theta<Real>(13);
+    else
+        return Theta<Real>(13)*Pow(epsRatio,Real(1)/Real(27));
+}
+
+template<typename Real>
+inline bool UseLowDegrees()
+{ return limits::Epsilon<Real>() >= Real(limits::Epsilon<double>()); }
+
+template<typename F>
+inline void
+Pade( Matrix<F>& A, Int m )
+{
+    DEBUG_ONLY(CSE cse("expm::Pade"))
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const auto b = PadeCoefficients<Real>( m );
+
+    Matrix<F> A2, U, V, W;
+    Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+    if( m == 13 )
+    {
+        Matrix<F> A4, A6;
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+        Gemm( NORMAL, NORMAL, F(1), A4, A2, A6 );
+
+        // U := A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I
+        W = A6;
+        W *= b[13];
+        Axpy( b[11], A4, W );
+        Axpy( b[9], A2, W );
+        Gemm( NORMAL, NORMAL, F(1), A6, W, U );
+        Axpy( b[7], A6, U );
+        Axpy( b[5], A4, U );
+        Axpy( b[3], A2, U );
+        ShiftDiagonal( U, F(b[1]) );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        W = A6;
+        W *= b[12];
+        Axpy( b[10], A4, W );
+        Axpy( b[8], A2, W );
+        Gemm( NORMAL, NORMAL, F(1), A6, W, V );
+        Axpy( b[6], A6, V );
+        Axpy( b[4], A4, V );
+        Axpy( b[2], A2, V );
+        ShiftDiagonal( V, F(b[0]) );
+    }
+    else
+    {
+        Identity( U, n, n );
+        U *= b[1];
+        Identity( V, n, n );
+        V *= b[0];
+        Matrix<F> P( A2 );
+        for( Int k=1; 2*k<=m; ++k )
+        {
+            // P := A^{2k}
+            if( k > 1 )
+            {
+                W = P;
+                Gemm( NORMAL, NORMAL, F(1), W, A2, P );
+            }
+            Axpy( b[2*k], P, V );
+            if( 2*k+1 <= m )
+                Axpy( b[2*k+1], P, U );
+        }
+    }
+
+    // U := A U
+    W = U;
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+
+    // A := inv(V-U) (V+U)
+    W = V;
+    W -= U;
+    A = V;
+    A += U;
+    Permutation P;
+    LU( W, P );
+    lu::SolveAfter( NORMAL, W, P, A );
+}
+
+template<typename F>
+inline void
+Pade( DistMatrix<F>& A, Int m )
+{
+    DEBUG_ONLY(CSE cse("expm::Pade"))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const auto b = PadeCoefficients<Real>( m );
+
+    DistMatrix<F> A2(g), U(g), V(g), W(g);
+    Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+    if( m == 13 )
+    {
+        DistMatrix<F> A4(g), A6(g);
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+        Gemm( NORMAL, NORMAL, F(1), A4, A2, A6 );
+
+        // U := A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I
+        W = A6;
+        W *= b[13];
+        Axpy( b[11], A4, W );
+        Axpy( b[9], A2, W );
+        Gemm( NORMAL, NORMAL, F(1), A6, W, U );
+        Axpy( b[7], A6, U );
+        Axpy( b[5], A4, U );
+        Axpy( b[3], A2, U );
+        ShiftDiagonal( U, F(b[1]) );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        W = A6;
+        W *= b[12];
+        Axpy( b[10], A4, W );
+        Axpy( b[8], A2, W );
+        Gemm( NORMAL, NORMAL, F(1), A6, W, V );
+        Axpy( b[6], A6, V );
+        Axpy( b[4], A4, V );
+        Axpy( b[2], A2, V );
+        ShiftDiagonal( V, F(b[0]) );
+    }
+    else
+    {
+        Identity( U, n, n );
+        U *= b[1];
+        Identity( V, n, n );
+        V *= b[0];
+        DistMatrix<F> P( A2 );
+        for( Int k=1; 2*k<=m; ++k )
+        {
+            // P := A^{2k}
+            if( k > 1 )
+            {
+                W = P;
+                Gemm( NORMAL, NORMAL, F(1), W, A2, P );
+            }
+            Axpy( b[2*k], P, V );
+            if( 2*k+1 <= m )
+                Axpy( b[2*k+1], P, U );
+        }
+    }
+
+    // U := A U
+    W = U;
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+
+    // A := inv(V-U) (V+U)
+    W = V;
+    W -= U;
+    A = V;
+    A += U;
+    DistPermutation P(g);
+    LU( W, P );
+    lu::SolveAfter( NORMAL, W, P, A );
+}
+
+template<typename F>
+inline void
+ScalingAndSquaring( Matrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("expm::ScalingAndSquaring"))
+    typedef Base<F> Real;
+    const Real oneNorm = OneNorm( A );
+    if( UseLowDegrees<Real>() )
+    {
+        for( Int m=3; m<=9; m+=2 )
+        {
+            if( oneNorm <= Theta<Real>(m) )
+            {
+                Pade( A, m );
+                return;
+            }
+        }
+    }
+
+    const Real theta13 = Theta13<Real>();
+    Int s = 0;
+    if( oneNorm > theta13 )
+        s = Int(Ceil(Log2(oneNorm/theta13)));
+    if( s > 0 )
+        A *= Pow(Real(2),Real(-s));
+    Pade( A, 13 );
+
+    Matrix<F> B;
+    for( Int j=0; j<s; ++j )
+    {
+        B = A;
+        Gemm( NORMAL, NORMAL, F(1), B, B, A );
+    }
+}
+
+template<typename F>
+inline void
+ScalingAndSquaring( DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("expm::ScalingAndSquaring"))
+    typedef Base<F> Real;
+    const Real oneNorm = OneNorm( A );
+    if( UseLowDegrees<Real>() )
+    {
+        for( Int m=3; m<=9; m+=2 )
+        {
+            if( oneNorm <= Theta<Real>(m) )
+            {
+                Pade( A, m );
+                return;
+            }
+        }
+    }
+
+    const Real theta13 = Theta13<Real>();
+    Int s = 0;
+    if( oneNorm > theta13 )
+        s = Int(Ceil(Log2(oneNorm/theta13)));
+    if( s > 0 )
+        A *= Pow(Real(2),Real(-s));
+    Pade( A, 13 );
+
+    DistMatrix<F> B(A.Grid());
+    for( Int j=0; j<s; ++j )
+    {
+        B = A;
+        Gemm( NORMAL, NORMAL, F(1), B, B, A );
+    }
+}
+
+// Choose the Taylor degree, m, and the number of steps, s, which minimize the
+// number of products, m s, subject to || t A ||_1 / s <= theta_m
+// (using the double-precision values from Table 3.1 of Al-Mohy and Higham).
+// Since the truncation error of the degree m approximant is O(x^(m+1)), the
+// switchpoints are shrunk accordingly for precisions beyond double.
+template<typename Real>
+inline pair<Int,Int> TaylorParameters( Real tANorm )
+{
+    static const Int numDegrees = 11;
+    static const Int degrees[numDegrees] =
+      { 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55 };
+    static const double thetas[numDegrees] =
+      { 2.4e-3, 1.4e-1, 6.4e-1, 1.4, 2.4, 3.5, 4.7, 6.0, 7.2, 8.5, 9.9 };
+    const Real epsRatio =
+      limits::Epsilon<Real>() / Real(limits::Epsilon<double>());
+
+    // Avoid overflowing the number of products
+    const Real maxProducts = Real(limits::Max<Int>()/2);
+
+    Int mBest=-1, sBest=-1;
+    for( Int k=0; k<numDegrees; ++k )
+    {
+        const Int m = degrees[k];
+        Real theta = Real(thetas[k]);
+        if( epsRatio < Real(1) )
+            theta *= Pow(epsRatio,Real(1)/Real(m+1));
+        const Real sReal = Max( Ceil(tANorm/theta), Real(1) );
+        if( Real(m)*sReal > maxProducts )
+            continue;
+        const Int s = Int(sReal);
+        if( sBest == -1 || m*s < mBest*sBest )
+        {
+            mBest = m;
+            sBest = s;
+        }
+    }
+    if( sBest == -1 )
+        RuntimeError
+        ("|| t A ||_1 = ",tANorm," requires too many Taylor steps");
+    return pair<Int,Int>(mBest,sBest);
+}
+
+} // namespace expm
+
+template<typename F>
+void MatrixExp( Matrix<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixExp");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    expm::ScalingAndSquaring( A );
+}
+
+template<typename F>
+void MatrixExp( ElementalMatrix<F>& APre )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixExp");
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    expm::ScalingAndSquaring( A );
+}
+
+template<typename F>
+void MatrixExpAction( const SparseMatrix<F>& A, Matrix<F>& B, Base<F> t )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixExpAction");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Width() != B.Height() )
+          LogicError("A and B do not conform");
+    )
+    typedef Base<F> Real;
+    const Real tANorm = Abs(t)*OneNorm( A );
+    if( tANorm == Real(0) )
+        return;
+    const auto params = expm::TaylorParameters( tANorm );
+    const Int m = params.first;
+    const Int s = params.second;
+    const Real tol = limits::Epsilon<Real>();
+
+    Matrix<F> Z, X;
+    for( Int i=0; i<s; ++i )
+    {
+        // Z := T_m(t A / s) B, where T_m is the degree m Taylor polynomial
+        Z = B;
+        Real c1 = MaxNorm( B );
+        for( Int j=1; j<=m; ++j )
+        {
+            Zeros( X, B.Height(), B.Width() );
+            Multiply( NORMAL, F(t/Real(s*j)), A, B, F(0), X );
+            std::swap( B, X );
+            const Real c2 = MaxNorm( B );
+            Z += B;
+            if( c1 + c2 <= tol*MaxNorm(Z) )
+                break;
+            c1 = c2;
+        }
+        std::swap( B, Z );
+    }
+}
+
+template<typename F>
+void MatrixExpAction
+( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, Base<F> t )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixExpAction");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Width() != B.Height() )
+          LogicError("A and B do not conform");
+    )
+    typedef Base<F> Real;
+    const Real tANorm = Abs(t)*OneNorm( A );
+    if( tANorm == Real(0) )
+        return;
+    const auto params = expm::TaylorParameters( tANorm );
+    const Int m = params.first;
+    const Int s = params.second;
+    const Real tol = limits::Epsilon<Real>();
+
+    DistMultiVec<F> Z(B.Comm()), X(B.Comm());
+    for( Int i=0; i<s; ++i )
+    {
+        // Z := T_m(t A / s) B, where T_m is the degree m Taylor polynomial
+        Z = B;
+        Real c1 = MaxNorm( B );
+        for( Int j=1; j<=m; ++j )
+        {
+            Zeros( X, B.Height(), B.Width() );
+            Multiply( NORMAL, F(t/Real(s*j)), A, B, F(0), X );
+            B = X;
+            const Real c2 = MaxNorm( B );
+            Z += B;
+            if( c1 + c2 <= tol*MaxNorm(Z) )
+                break;
+            c1 = c2;
+        }
+        B = Z;
+    }
+}
+
+#define PROTO(F) \
+  template void MatrixExp( Matrix<F>& A ); \
+  template void MatrixExp( ElementalMatrix<F>& A ); \
+  template void MatrixExpAction \
+  ( const SparseMatrix<F>& A, Matrix<F>& B, Base<F> t ); \
+  template void MatrixExpAction \
+  ( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, Base<F> t );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// An inverse scaling and squaring algorithm along the lines of Sheung Hun
+// Cheng, Nicholas J. Higham, Charles S. Kenney, and Alan J. Laub's
+// "Approximating the logarithm of a matrix to specified accuracy",
+// SIAM J. Matrix Anal. Appl., Vol. 22, No. 4, pp. 1112--1125, 2001:
+//
+//   log(A) = 2^k log(A^{1/2^k}),
+//
+// where the square roots are computed with the Newton iteration from
+// SquareRoot and log(I+X) is then approximated with the partial fraction
+// form of its [m/m] Pade approximant,
+//
+//   r_m(X) = sum_{j=1}^m w_j X inv(I + x_j X),
+//
+// where the x_j and w_j are the Gauss-Legendre nodes and weights on [0,1].
+//
+// NOTE: The matrix must not have any eigenvalues on the closed negative real
+//       axis.
+
+namespace El {
+
+namespace logm {
+
+// The switchpoints || X ||_1 <= theta_m for the [m/m] Pade approximant,
+// m=1,...,7, in double-precision (Table 2.1 of Higham's "Evaluating Pade
+// approximants of the matrix logarithm"). For higher precisions, the
+// switchpoints are shrunk since the truncation error is O(x^{2m+1}).
+template<typename Real>
+inline Real Theta( Int m )
+{
+    static const double thetas[7] =
+      { 1.10e-5, 1.82e-3, 1.62e-2, 5.39e-2, 1.14e-1, 1.87e-1, 2.64e-1 };
+    const Real theta = Real(thetas[m-1]);
+    const Real epsRatio =
+      limits::Epsilon<Real>() / Real(limits::Epsilon<double>());
+    if( epsRatio >= Real(1) )
+        return theta;
+    else
+        return theta*Pow(epsRatio,Real(1)/Real(2*m+1));
+}
+
+// Compute the Gauss-Legendre nodes and weights on [0,1] via Newton's method
+// on the Legendre polynomial of degree m
+template<typename Real>
+inline void GaussLegendre( Int m, vector<Real>& x, vector<Real>& w )
+{
+    DEBUG_ONLY(CSE cse("logm::GaussLegendre"))
+    const Real eps = limits::Epsilon<Real>();
+    const Real pi = Pi<Real>();
+    x.resize( m );
+    w.resize( m );
+    for( Int i=0; i<m; ++i )
+    {
+        Real z = Cos( pi*(Real(i)+Real(3)/Real(4))/(Real(m)+Real(1)/Real(2)) );
+        Real zOld, pDeriv;
+        Int numIts=0;
+        do
+        {
+            // Evaluate P_m(z) and P_{m-1}(z) with the three-term recurrence
+            Real p0=1, p1=0, p2;
+            for( Int j=1; j<=m; ++j )
+            {
+                p2 = p1;
+                p1 = p0;
+                p0 = ((2*j-1)*z*p1 - (j-1)*p2) / Real(j);
+            }
+            pDeriv = m*(z*p0-p1)/(z*z-1);
+            zOld = z;
+            z = zOld - p0/pDeriv;
+        } while( Abs(z-zOld) > 2*eps && ++numIts < 100 );
+        x[i] = (1-z)/2;
+        w[i] = 1/((1-z*z)*pDeriv*pDeriv);
+    }
+}
+
+template<typename F>
+inline void
+Pade( Matrix<F>& X, Int m )
+{
+    DEBUG_ONLY(CSE cse("logm::Pade"))
+    typedef Base<F> Real;
+    vector<Real> x, w;
+    GaussLegendre( m, x, w );
+
+    Matrix<F> M, Y, R;
+    Permutation P;
+    Zeros( R, X.Height(), X.Width() );
+    for( Int j=0; j<m; ++j )
+    {
+        // R += w_j inv(I + x_j X) X
+        M = X;
+        M *= x[j];
+        ShiftDiagonal( M, F(1) );
+        LU( M, P );
+        Y = X;
+        lu::SolveAfter( NORMAL, M, P, Y );
+        Axpy( w[j], Y, R );
+    }
+    X = R;
+}
+
+template<typename F>
+inline void
+Pade( DistMatrix<F>& X, Int m )
+{
+    DEBUG_ONLY(CSE cse("logm::Pade"))
+    typedef Base<F> Real;
+    vector<Real> x, w;
+    GaussLegendre( m, x, w );
+
+    const Grid& g = X.Grid();
+    DistMatrix<F> M(g), Y(g), R(g);
+    DistPermutation P(g);
+    Zeros( R, X.Height(), X.Width() );
+    for( Int j=0; j<m; ++j )
+    {
+        // R += w_j inv(I + x_j X) X
+        M = X;
+        M *= x[j];
+        ShiftDiagonal( M, F(1) );
+        LU( M, P );
+        Y = X;
+        lu::SolveAfter( NORMAL, M, P, Y );
+        Axpy( w[j], Y, R );
+    }
+    X = R;
+}
+
+template<typename F>
+inline Int
+InverseScalingAndSquaring( Matrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("logm::InverseScalingAndSquaring"))
+    typedef Base<F> Real;
+    const Real theta7 = Theta<Real>(7);
+
+    // A := A^{1/2^k} - I, with || A^{1/2^k} - I ||_1 <= theta_7
+    Int k=0;
+    Real oneNorm;
+    while( true )
+    {
+        ShiftDiagonal( A, F(-1) );
+        oneNorm = OneNorm( A );
+        if( ctrl.progress )
+            Output("|| A^{1/2^",k,"} - I ||_1 = ",oneNorm);
+        if( oneNorm <= theta7 )
+            break;
+        if( k == ctrl.maxSqrts )
+            RuntimeError("Exceeded maximum number of square roots");
+        ShiftDiagonal( A, F(1) );
+        SquareRoot( A, ctrl.sqrtCtrl );
+        ++k;
+    }
+
+    // Use the lowest degree approximant which is sufficiently accurate
+    Int m=1;
+    while( oneNorm > Theta<Real>(m) )
+        ++m;
+    Pade( A, m );
+
+    A *= Pow(Real(2),Real(k));
+    return k;
+}
+
+template<typename F>
+inline Int
+InverseScalingAndSquaring
+( DistMatrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("logm::InverseScalingAndSquaring"))
+    typedef Base<F> Real;
+    const Real theta7 = Theta<Real>(7);
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+
+    // A := A^{1/2^k} - I, with || A^{1/2^k} - I ||_1 <= theta_7
+    Int k=0;
+    Real oneNorm;
+    while( true )
+    {
+        ShiftDiagonal( A, F(-1) );
+        oneNorm = OneNorm( A );
+        if( progress )
+            Output("|| A^{1/2^",k,"} - I ||_1 = ",oneNorm);
+        if( oneNorm <= theta7 )
+            break;
+        if( k == ctrl.maxSqrts )
+            RuntimeError("Exceeded maximum number of square roots");
+        ShiftDiagonal( A, F(1) );
+        SquareRoot( A, ctrl.sqrtCtrl );
+        ++k;
+    }
+
+    // Use the lowest degree approximant which is sufficiently accurate
+    Int m=1;
+    while( oneNorm > Theta<Real>(m) )
+        ++m;
+    Pade( A, m );
+
+    A *= Pow(Real(2),Real(k));
+    return k;
+}
+
+} // namespace logm
+
+template<typename F>
+void MatrixLog( Matrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixLog");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    logm::InverseScalingAndSquaring( A, ctrl );
+}
+
+template<typename F>
+void MatrixLog( ElementalMatrix<F>& APre, const MatrixLogCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixLog");
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    logm::InverseScalingAndSquaring( A, ctrl );
+}
+
+#define PROTO(F) \
+  template void MatrixLog \
+  ( Matrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl ); \
+  template void MatrixLog \
+  ( ElementalMatrix<F>& A, const MatrixLogCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
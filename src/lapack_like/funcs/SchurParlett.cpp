@@ -0,0 +1,493 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// A blocked Schur-Parlett algorithm along the lines of Philip I. Davies and
+// Nicholas J. Higham's "A Schur-Parlett algorithm for computing matrix
+// functions", SIAM J. Matrix Anal. Appl., Vol. 25, No. 2, pp. 464--485, 2003.
+//
+// After computing the complex Schur decomposition A = Q T Q^H, the diagonal
+// of T is partitioned into clusters of (consecutive) eigenvalues, the
+// function is evaluated on each diagonal cluster with a Taylor series, and
+// the block Parlett recurrence,
+//
+//   T_ii F_ij - F_ij T_jj = F_ii T_ij - T_ij F_jj +
+//                           sum_{i<k<j} (F_ik T_kj - T_ik F_kj),
+//
+// is used for the off-diagonal blocks. As in Davies and Higham, the
+// eigenvalues are partitioned into sets whose members are (transitively)
+// within ctrl.blockTol of each other, and the Schur form is reordered with
+// swaps of adjacent diagonal entries so that each set forms a contiguous
+// cluster; the Sylvester equations then never couple nearly-equal
+// eigenvalues. Consecutive clusters are merged into blocks of roughly
+// ctrl.blockSize so that the recurrence is Gemm-dominated.
+
+namespace El {
+
+namespace schur_parlett {
+
+// Partition the eigenvalues into sets such that each eigenvalue is within tol
+// of another member of its set, but further than tol from the members of all
+// other sets. The sets are numbered in the order of the mean position of
+// their members along the diagonal, which tends to minimize the number of
+// swaps needed to make each set contiguous.
+template<typename Real>
+inline vector<Int>
+Blocking( const Matrix<Complex<Real>>& w, Real tol )
+{
+    const Int n = w.Height();
+    vector<Int> labels(n,-1);
+    Int numLabels = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        if( labels[i] == -1 )
+            labels[i] = numLabels++;
+        for( Int j=i+1; j<n; ++j )
+        {
+            if( labels[j] == labels[i] ||
+                Abs(w.Get(i,0)-w.Get(j,0)) > tol )
+                continue;
+            if( labels[j] == -1 )
+            {
+                labels[j] = labels[i];
+            }
+            else
+            {
+                // Merge the set containing j into that of i
+                const Int oldLabel = labels[j];
+                for( Int k=0; k<n; ++k )
+                    if( labels[k] == oldLabel )
+                        labels[k] = labels[i];
+            }
+        }
+    }
+
+    vector<double> meanPos(numLabels,0);
+    vector<Int> setSizes(numLabels,0);
+    for( Int i=0; i<n; ++i )
+    {
+        meanPos[labels[i]] += i;
+        ++setSizes[labels[i]];
+    }
+    vector<Int> order;
+    for( Int label=0; label<numLabels; ++label )
+        if( setSizes[label] > 0 )
+        {
+            meanPos[label] /= setSizes[label];
+            order.push_back( label );
+        }
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int a, Int b ) { return meanPos[a] < meanPos[b]; } );
+    vector<Int> ranks(numLabels,-1);
+    for( Int k=0; k<Int(order.size()); ++k )
+        ranks[order[k]] = k;
+
+    vector<Int> sets(n);
+    for( Int i=0; i<n; ++i )
+        sets[i] = ranks[labels[i]];
+    return sets;
+}
+
+// Swap the adjacent diagonal entries T(k,k) and T(k+1,k+1) of the Schur form
+// A = Q T Q^H with a Givens rotation (as in LAPACK's ztrexc)
+template<typename Real>
+inline void
+SwapAdjacent( Matrix<Complex<Real>>& T, Matrix<Complex<Real>>& Q, Int k )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::SwapAdjacent"))
+    typedef Complex<Real> C;
+    const Int n = T.Height();
+    const C tau11 = T.Get(k,k);
+    const C tau22 = T.Get(k+1,k+1);
+
+    // Find [c s; -conj(s) c] [tau12; tau22-tau11] = [rho; 0]
+    Real c;
+    C s;
+    lapack::Givens( T.Get(k,k+1), tau22-tau11, &c, &s );
+
+    auto t1R = T( IR(k), IR(k+2,n) );
+    auto t2R = T( IR(k+1), IR(k+2,n) );
+    Rotate( c, s, t1R, t2R );
+    auto t1T = T( IR(0,k), IR(k) );
+    auto t2T = T( IR(0,k), IR(k+1) );
+    Rotate( c, Conj(s), t1T, t2T );
+    T.Set( k, k, tau22 );
+    T.Set( k+1, k+1, tau11 );
+
+    auto q1 = Q( ALL, IR(k) );
+    auto q2 = Q( ALL, IR(k+1) );
+    Rotate( c, Conj(s), q1, q2 );
+}
+
+// Reorder the Schur form A = Q T Q^H (with an insertion sort of adjacent
+// swaps) so that the members of each set are contiguous
+template<typename Real>
+inline void
+Reorder
+( Matrix<Complex<Real>>& T, Matrix<Complex<Real>>& Q, vector<Int>& sets )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::Reorder"))
+    const Int n = T.Height();
+    for( Int i=1; i<n; ++i )
+        for( Int k=i; k>0 && sets[k-1] > sets[k]; --k )
+        {
+            SwapAdjacent( T, Q, k-1 );
+            std::swap( sets[k-1], sets[k] );
+        }
+}
+
+// Return the offsets of the clusters of a sorted list of set indices
+inline vector<Int>
+Clusters( const vector<Int>& sets )
+{
+    const Int n = sets.size();
+    vector<Int> offsets(1,0);
+    for( Int i=1; i<n; ++i )
+        if( sets[i] != sets[i-1] )
+            offsets.push_back( i );
+    offsets.push_back( n );
+    return offsets;
+}
+
+// Return the offsets of the clusters lying within [begin,end), relative to
+// begin (the blocks are unions of whole clusters)
+inline vector<Int>
+SubOffsets( const vector<Int>& clusterOffsets, Int begin, Int end )
+{
+    vector<Int> offsets;
+    for( const Int offset : clusterOffsets )
+        if( offset >= begin && offset <= end )
+            offsets.push_back( offset-begin );
+    return offsets;
+}
+
+// Merge consecutive clusters until each block is at least blockSize wide
+inline vector<Int>
+MergeClusters( const vector<Int>& clusterOffsets, Int blockSize )
+{
+    vector<Int> offsets(1,0);
+    const Int numClusters = clusterOffsets.size()-1;
+    for( Int c=0; c<numClusters; ++c )
+    {
+        const Int end = clusterOffsets[c+1];
+        if( end-offsets.back() >= blockSize || c == numClusters-1 )
+            offsets.push_back( end );
+    }
+    return offsets;
+}
+
+// Solve A X - X B = C, where A and B are upper-triangular, overwriting C
+template<typename F>
+inline void
+TriangularSylvester( Matrix<F>& A, Matrix<F>& B, Matrix<F>& C )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::TriangularSylvester"))
+    const Int n = B.Height();
+    Matrix<F> shift(1,1);
+    for( Int j=0; j<n; ++j )
+    {
+        auto xj = C( ALL, IR(j) );
+        auto XL = C( ALL, IR(0,j) );
+        auto bj = B( IR(0,j), IR(j) );
+
+        // (A - beta_jj I) x_j = c_j + X(:,0:j) B(0:j,j)
+        Gemv( NORMAL, F(1), XL, bj, F(1), xj );
+        shift.Set( 0, 0, B.Get(j,j) );
+        MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), A, shift, xj );
+    }
+}
+
+// Evaluate f on an upper-triangular block with clustered eigenvalues
+template<typename Real>
+inline void
+Taylor
+( const Matrix<Complex<Real>>& T,
+        Matrix<Complex<Real>>& FT,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::Taylor"))
+    typedef Complex<Real> C;
+    const Int n = T.Height();
+    if( n == 1 )
+    {
+        FT.Set( 0, 0, func(T.Get(0,0),0) );
+        return;
+    }
+
+    // Expand about the mean of the eigenvalues
+    C sigma = 0;
+    for( Int i=0; i<n; ++i )
+        sigma += T.Get(i,i);
+    sigma /= Real(n);
+    Matrix<C> M( T ), P, PTmp, term;
+    ShiftDiagonal( M, -sigma );
+
+    Identity( P, n, n );
+    Identity( FT, n, n );
+    FT *= func(sigma,0);
+
+    // Stop once two consecutive terms are negligible
+    const Real tol = limits::Epsilon<Real>();
+    Int numSmall=0, k=1;
+    for( ; k<=ctrl.maxTaylorTerms; ++k )
+    {
+        // P := P M / k
+        PTmp = P;
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, C(1)/C(Real(k)), M, PTmp );
+        P = PTmp;
+
+        term = P;
+        term *= func(sigma,k);
+        FT += term;
+        if( FrobeniusNorm(term) <= tol*FrobeniusNorm(FT) )
+        {
+            if( ++numSmall == 2 )
+                break;
+        }
+        else
+            numSmall = 0;
+    }
+    if( ctrl.progress )
+        Output("Taylor series of size ",n," cluster took ",k," terms");
+}
+
+// Evaluate f(T) for an upper-triangular T using the given block partition,
+// where the diagonal blocks are either evaluated with a Taylor series (if
+// no cluster offsets are given) or recursively with the cluster partition
+template<typename Real>
+inline void
+Recurrence
+(       Matrix<Complex<Real>>& T,
+        Matrix<Complex<Real>>& FT,
+  const vector<Int>& offsets,
+  const vector<Int>& clusterOffsets,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::Recurrence"))
+    typedef Complex<Real> C;
+    const Int n = T.Height();
+    const Int numBlocks = offsets.size()-1;
+    Zeros( FT, n, n );
+    for( Int jb=0; jb<numBlocks; ++jb )
+    {
+        const Range<Int> indj( offsets[jb], offsets[jb+1] );
+        auto Tjj = T( indj, indj );
+        auto Fjj = FT( indj, indj );
+        if( clusterOffsets.empty() )
+        {
+            Taylor( Tjj, Fjj, func, ctrl );
+        }
+        else
+        {
+            auto subOffsets =
+              SubOffsets( clusterOffsets, offsets[jb], offsets[jb+1] );
+            Matrix<C> FjjTmp;
+            Recurrence( Tjj, FjjTmp, subOffsets, vector<Int>(), func, ctrl );
+            Fjj = FjjTmp;
+        }
+
+        for( Int ib=jb-1; ib>=0; --ib )
+        {
+            const Range<Int> indi( offsets[ib], offsets[ib+1] );
+            auto Tii = T( indi, indi );
+            auto Fii = FT( indi, indi );
+            auto Tij = T( indi, indj );
+            auto Fij = FT( indi, indj );
+
+            // F_ij := F_ii T_ij - T_ij F_jj +
+            //         F(i,i+1:j-1) T(i+1:j-1,j) - T(i,i+1:j-1) F(i+1:j-1,j)
+            Gemm( NORMAL, NORMAL, C(1), Fii, Tij, C(0), Fij );
+            Gemm( NORMAL, NORMAL, C(-1), Tij, Fjj, C(1), Fij );
+            if( ib+1 < jb )
+            {
+                const Range<Int> indk( offsets[ib+1], offsets[jb] );
+                auto Fik = FT( indi, indk );
+                auto Tkj = T( indk, indj );
+                auto Tik = T( indi, indk );
+                auto Fkj = FT( indk, indj );
+                Gemm( NORMAL, NORMAL, C(1), Fik, Tkj, C(1), Fij );
+                Gemm( NORMAL, NORMAL, C(-1), Tik, Fkj, C(1), Fij );
+            }
+
+            // Solve T_ii F_ij - F_ij T_jj = F_ij
+            TriangularSylvester( Tii, Tjj, Fij );
+        }
+    }
+}
+
+template<typename Real>
+inline void
+Recurrence
+(       DistMatrix<Complex<Real>>& T,
+        DistMatrix<Complex<Real>>& FT,
+  const vector<Int>& offsets,
+  const vector<Int>& clusterOffsets,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur_parlett::Recurrence"))
+    typedef Complex<Real> C;
+    const Grid& g = T.Grid();
+    const Int n = T.Height();
+    const Int numBlocks = offsets.size()-1;
+    Zeros( FT, n, n );
+
+    // The diagonal blocks are (redundantly) evaluated with the sequential
+    // algorithm and the Sylvester equations are (redundantly) solved after
+    // forming their right-hand sides with distributed Gemm's
+    DistMatrix<C,STAR,STAR> Tjj_STAR_STAR(g), Fjj_STAR_STAR(g),
+                            Tii_STAR_STAR(g), Fij_STAR_STAR(g);
+    for( Int jb=0; jb<numBlocks; ++jb )
+    {
+        const Range<Int> indj( offsets[jb], offsets[jb+1] );
+        auto Tjj = T( indj, indj );
+        auto Fjj = FT( indj, indj );
+
+        Tjj_STAR_STAR = Tjj;
+        auto subOffsets =
+          SubOffsets( clusterOffsets, offsets[jb], offsets[jb+1] );
+        Fjj_STAR_STAR.Resize( Tjj.Height(), Tjj.Width() );
+        Recurrence
+        ( Tjj_STAR_STAR.Matrix(), Fjj_STAR_STAR.Matrix(), subOffsets,
+          vector<Int>(), func, ctrl );
+        Fjj = Fjj_STAR_STAR;
+
+        for( Int ib=jb-1; ib>=0; --ib )
+        {
+            const Range<Int> indi( offsets[ib], offsets[ib+1] );
+            auto Tii = T( indi, indi );
+            auto Fii = FT( indi, indi );
+            auto Tij = T( indi, indj );
+            auto Fij = FT( indi, indj );
+
+            // F_ij := F_ii T_ij - T_ij F_jj +
+            //         F(i,i+1:j-1) T(i+1:j-1,j) - T(i,i+1:j-1) F(i+1:j-1,j)
+            Gemm( NORMAL, NORMAL, C(1), Fii, Tij, C(0), Fij );
+            Gemm( NORMAL, NORMAL, C(-1), Tij, Fjj, C(1), Fij );
+            if( ib+1 < jb )
+            {
+                const Range<Int> indk( offsets[ib+1], offsets[jb] );
+                auto Fik = FT( indi, indk );
+                auto Tkj = T( indk, indj );
+                auto Tik = T( indi, indk );
+                auto Fkj = FT( indk, indj );
+                Gemm( NORMAL, NORMAL, C(1), Fik, Tkj, C(1), Fij );
+                Gemm( NORMAL, NORMAL, C(-1), Tik, Fkj, C(1), Fij );
+            }
+
+            // Solve T_ii F_ij - F_ij T_jj = F_ij
+            Tii_STAR_STAR = Tii;
+            Fij_STAR_STAR = Fij;
+            TriangularSylvester
+            ( Tii_STAR_STAR.Matrix(), Tjj_STAR_STAR.Matrix(),
+              Fij_STAR_STAR.Matrix() );
+            Fij = Fij_STAR_STAR;
+        }
+    }
+}
+
+} // namespace schur_parlett
+
+template<typename Real>
+void MatrixFunction
+( Matrix<Complex<Real>>& A,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixFunction");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    typedef Complex<Real> C;
+
+    // A := T, where A = Q T Q^H
+    Matrix<C> w, Q;
+    Schur( A, w, Q, true, ctrl.schurCtrl );
+
+    // Make each set of nearby eigenvalues contiguous
+    auto sets = schur_parlett::Blocking( w, ctrl.blockTol );
+    schur_parlett::Reorder( A, Q, sets );
+    auto clusterOffsets = schur_parlett::Clusters( sets );
+    auto offsets =
+      schur_parlett::MergeClusters( clusterOffsets, ctrl.blockSize );
+    Matrix<C> FT;
+    schur_parlett::Recurrence( A, FT, offsets, clusterOffsets, func, ctrl );
+
+    // A := Q f(T) Q^H
+    Matrix<C> B;
+    Gemm( NORMAL, NORMAL, C(1), Q, FT, B );
+    Gemm( NORMAL, ADJOINT, C(1), B, Q, A );
+}
+
+template<typename Real>
+void MatrixFunction
+( ElementalMatrix<Complex<Real>>& APre,
+  function<Complex<Real>(Complex<Real>,Int)> func,
+  const SchurParlettCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("MatrixFunction");
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    typedef Complex<Real> C;
+
+    DistMatrixReadWriteProxy<C,C,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+
+    // A := T, where A = Q T Q^H
+    DistMatrix<C> Q(g);
+    DistMatrix<C,VR,STAR> w(g);
+    Schur( A, w, Q, true, ctrl.schurCtrl );
+
+    // Make each set of nearby eigenvalues contiguous, (redundantly)
+    // reordering the Schur form only if it is necessary
+    DistMatrix<C,STAR,STAR> w_STAR_STAR( w );
+    auto sets =
+      schur_parlett::Blocking( w_STAR_STAR.Matrix(), ctrl.blockTol );
+    if( !std::is_sorted( sets.begin(), sets.end() ) )
+    {
+        DistMatrix<C,STAR,STAR> A_STAR_STAR( A ), Q_STAR_STAR( Q );
+        schur_parlett::Reorder
+        ( A_STAR_STAR.Matrix(), Q_STAR_STAR.Matrix(), sets );
+        A = A_STAR_STAR;
+        Q = Q_STAR_STAR;
+    }
+    auto clusterOffsets = schur_parlett::Clusters( sets );
+    auto offsets =
+      schur_parlett::MergeClusters( clusterOffsets, ctrl.blockSize );
+    DistMatrix<C> FT(g);
+    schur_parlett::Recurrence( A, FT, offsets, clusterOffsets, func, ctrl );
+
+    // A := Q f(T) Q^H
+    DistMatrix<C> B(g);
+    Gemm( NORMAL, NORMAL, C(1), Q, FT, B );
+    Gemm( NORMAL, ADJOINT, C(1), B, Q, A );
+}
+
+#define PROTO_REAL(Real) \
+  template void MatrixFunction \
+  ( Matrix<Complex<Real>>& A, \
+    function<Complex<Real>(Complex<Real>,Int)> func, \
+    const SchurParlettCtrl<Real>& ctrl ); \
+  template void MatrixFunction \
+  ( ElementalMatrix<Complex<Real>>& A, \
+    function<Complex<Real>(Complex<Real>,Int)> func, \
+    const SchurParlettCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
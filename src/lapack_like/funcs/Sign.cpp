@@ -78,47 +78,119 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+// Form Z := I - X^2 and return || Z ||_1, which both monitors the convergence
+// of the inverse-free iterations and determines whether they are convergent
+template<typename F>
+inline Base<F>
+Residual( const Matrix<F>& X, Matrix<F>& Z )
+{
+    DEBUG_ONLY(CSE cse("sign::Residual"))
+    const Int n = X.Height();
+    Identity( Z, n, n );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), Z );
+    return OneNorm( Z );
+}
+
+template<typename F>
+inline Base<F>
+Residual( const DistMatrix<F>& X, DistMatrix<F>& Z )
+{
+    DEBUG_ONLY(CSE cse("sign::Residual"))
+    const Int n = X.Height();
+    Identity( Z, n, n );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), Z );
+    return OneNorm( Z );
+}
+
+// The coefficients of the degree k truncation of the binomial series
+// (1-z)^{-1/2} = sum_j c_j z^j, with c_j = (2j choose j) / 4^j
+template<typename Real>
+inline vector<Real> PadeCoefficients( Int k )
+{
+    if( k < 1 )
+        LogicError("Invalid Pade degree: ",k);
+    vector<Real> c(k+1);
+    c[0] = 1;
+    for( Int j=1; j<=k; ++j )
+        c[j] = c[j-1]*Real(2*j-1)/Real(2*j);
+    return c;
+}
+
+// Overwrite XNew with the [k/0] Pade iterate X (sum_{j=0}^k c_j Z^j), where
+// Z = I - X^2. The iteration converges with order k+1 when || Z || < 1 and
+// requires k+1 Gemm's in addition to the one used to form Z. The k=1 case is
+// the Newton-Schulz iteration, XNew := X (3I - X^2) / 2.
 template<typename F>
 inline void
-NewtonSchulzStep
+PadeStep
 ( const Matrix<F>& X,
-        Matrix<F>& XTmp,
-        Matrix<F>& XNew )
+  const Matrix<F>& Z,
+        Matrix<F>& P,
+        Matrix<F>& XNew,
+  Int degree=1 )
 {
-    DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
+    DEBUG_ONLY(CSE cse("sign::PadeStep"))
     typedef Base<F> Real;
-    const Int n = X.Height();
- 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    const auto c = PadeCoefficients<Real>( degree );
+
+    // P := sum_{j=0}^k c_j Z^j via Horner's rule
+    P = Z;
+    P *= c[degree];
+    ShiftDiagonal( P, F(c[degree-1]) );
+    Matrix<F> PTmp;
+    for( Int j=degree-2; j>=0; --j )
+    {
+        Gemm( NORMAL, NORMAL, F(1), P, Z, PTmp );
+        ShiftDiagonal( PTmp, F(c[j]) );
+        P = PTmp;
+    }
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    // XNew := X P
+    Gemm( NORMAL, NORMAL, F(1), X, P, XNew );
 }
 
 template<typename F>
 inline void
-NewtonSchulzStep
+PadeStep
 ( const DistMatrix<F>& X,
-        DistMatrix<F>& XTmp,
-        DistMatrix<F>& XNew )
+  const DistMatrix<F>& Z,
+        DistMatrix<F>& P,
+        DistMatrix<F>& XNew,
+  Int degree=1 )
 {
-    DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
+    DEBUG_ONLY(CSE cse("sign::PadeStep"))
     typedef Base<F> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    const auto c = PadeCoefficients<Real>( degree );
+
+    // P := sum_{j=0}^k c_j Z^j via Horner's rule
+    P = Z;
+    P *= c[degree];
+    ShiftDiagonal( P, F(c[degree-1]) );
+    DistMatrix<F> PTmp( X.Grid() );
+    for( Int j=degree-2; j>=0; --j )
+    {
+        Gemm( NORMAL, NORMAL, F(1), P, Z, PTmp );
+        ShiftDiagonal( PTmp, F(c[j]) );
+        P = PTmp;
+    }
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    // XNew := X P
+    Gemm( NORMAL, NORMAL, F(1), X, P, XNew );
 }
 
 // Please see Chapter 5 of Higham's 
 // "Functions of Matrices: Theory and Computation" for motivation behind
 // the different choices of p, which are usually in {0,1,2}
+//
+// The (scaled) Newton iteration is used until the iterates are close enough
+// to convergence for the inverse-free Pade iterations to be safe, which is
+// cheaply estimated from the identity
+//
+//   X_{k+1}^2 - I = (X_k - X_{k+1})^2
+//
+// for unscaled Newton iterates. Since the estimate ignores the scaling, the
+// first inverse-free step verifies that || I - X^2 ||_1 is small enough and
+// otherwise falls back to Newton.
 template<typename F>
 inline Int
 Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
@@ -130,17 +202,46 @@ Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
-    Matrix<F> B;
+    Matrix<F> B, Z, P;
     Matrix<F> *X=&A, *XNew=&B;
+    bool tryNewtonSchulz = false;
+    Real switchThresh = ctrl.newtonSchulzThresh;
+    Real oneNew = OneNorm( A );
     while( numIts < ctrl.maxIts )
     {
+        if( tryNewtonSchulz )
+        {
+            const Real oneResid = Residual( *X, Z );
+            if( oneResid <= ctrl.newtonSchulzThresh )
+            {
+                // The next update is roughly of relative size || Z ||_1 / 2
+                // (and || X ||_1 is refreshed since the previous step may
+                // have been inverse-free)
+                oneNew = OneNorm( *X );
+                if( ctrl.progress )
+                    cout << "after " << numIts << " iter's: "
+                         << "|| I - X^2 ||_1=" << oneResid << ", tol="
+                         << tol << endl;
+                if( oneResid/2 <= Pow(oneNew,ctrl.power)*tol )
+                    break;
+                PadeStep( *X, Z, P, *XNew, ctrl.newtonSchulzDegree );
+                ++numIts;
+                std::swap( X, XNew );
+                continue;
+            }
+            // The estimate was too optimistic, so fall back to Newton and
+            // require a smaller estimate before trying again
+            tryNewtonSchulz = false;
+            switchThresh /= 4;
+        }
+
         // Overwrite XNew with the new iterate
         NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
-        const Real oneNew = OneNorm( *XNew );
+        oneNew = OneNorm( *XNew );
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
@@ -152,6 +253,8 @@ Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+        if( ctrl.newtonSchulz && oneDiff*oneDiff <= switchThresh )
+            tryNewtonSchulz = true;
     }
     if( X != &A )
         A = *X;
@@ -167,72 +270,103 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
     Real tol = ctrl.tol;
     if( tol == Real(0) )
         tol = A.Height()*limits::Epsilon<Real>();
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
 
     Int numIts=0;
-    DistMatrix<F> B( A.Grid() );
+    const Grid& g = A.Grid();
+    DistMatrix<F> B(g), Z(g), P(g);
     DistMatrix<F> *X=&A, *XNew=&B;
+    bool tryNewtonSchulz = false;
+    Real switchThresh = ctrl.newtonSchulzThresh;
+    Real oneNew = OneNorm( A );
     while( numIts < ctrl.maxIts )
     {
+        if( tryNewtonSchulz )
+        {
+            const Real oneResid = Residual( *X, Z );
+            if( oneResid <= ctrl.newtonSchulzThresh )
+            {
+                // The next update is roughly of relative size || Z ||_1 / 2
+                // (and || X ||_1 is refreshed since the previous step may
+                // have been inverse-free)
+                oneNew = OneNorm( *X );
+                if( progress )
+                    cout << "after " << numIts << " iter's: "
+                         << "|| I - X^2 ||_1=" << oneResid << ", tol="
+                         << tol << endl;
+                if( oneResid/2 <= Pow(oneNew,ctrl.power)*tol )
+                    break;
+                PadeStep( *X, Z, P, *XNew, ctrl.newtonSchulzDegree );
+                ++numIts;
+                std::swap( X, XNew );
+                continue;
+            }
+            // The estimate was too optimistic, so fall back to Newton and
+            // require a smaller estimate before trying again
+            tryNewtonSchulz = false;
+            switchThresh /= 4;
+        }
+
         // Overwrite XNew with the new iterate
         NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
-        const Real oneNew = OneNorm( *XNew );
+        oneNew = OneNorm( *XNew );
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
-        if( ctrl.progress && A.Grid().Rank() == 0 )
+        if( progress )
             cout << "after " << numIts << " Newton iter's: "
                  << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
                  << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+        if( ctrl.newtonSchulz && oneDiff*oneDiff <= switchThresh )
+            tryNewtonSchulz = true;
     }
     if( X != &A )
         A = *X;
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
-
 } // namespace sign
 
 template<typename F>
-void Sign( Matrix<F>& A, const SignCtrl<Base<F>> ctrl )
+void Sign( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
-    sign::Newton( A, ctrl );
+    ctrl.numIts = sign::Newton( A, ctrl );
 }
 
 template<typename F>
-void Sign( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>> ctrl )
+void Sign( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
     Matrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    ctrl.numIts = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
 template<typename F>
-void Sign( ElementalMatrix<F>& APre, const SignCtrl<Base<F>> ctrl )
+void Sign( ElementalMatrix<F>& APre, const SignCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    ctrl.numIts = sign::Newton( A, ctrl );
 }
 
 template<typename F>
 void Sign
 ( ElementalMatrix<F>& APre,
   ElementalMatrix<F>& NPre, 
-  const SignCtrl<Base<F>> ctrl )
+  const SignCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
 
@@ -242,7 +376,7 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    ctrl.numIts = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
@@ -403,14 +537,14 @@ void HermitianSign
 
 #define PROTO_BASE(F) \
   template void Sign \
-  ( Matrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
+  ( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl ); \
   template void Sign \
-  ( ElementalMatrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
+  ( ElementalMatrix<F>& A, const SignCtrl<Base<F>>& ctrl ); \
   template void Sign \
-  ( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>> ctrl ); \
+  ( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>>& ctrl ); \
   template void Sign \
   ( ElementalMatrix<F>& A, ElementalMatrix<F>& N, \
-    const SignCtrl<Base<F>> ctrl );
+    const SignCtrl<Base<F>>& ctrl );
 
 #define PROTO(F) \
   PROTO_BASE(F) \
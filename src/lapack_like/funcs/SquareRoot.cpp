@@ -37,7 +37,8 @@ NewtonStep
 
     // XNew := 1/2 ( X + XNew )
     typedef Base<F> Real;
-    Axpy( Real(1)/Real(2), X, XNew );
+    XNew += X;
+    XNew *= Real(1)/Real(2);
 }
 
 template<typename F>
@@ -58,7 +59,8 @@ NewtonStep
 
     // XNew := 1/2 ( X + XNew )
     typedef Base<F> Real;
-    Axpy( Real(1)/Real(2), X, XNew );
+    XNew += X;
+    XNew *= Real(1)/Real(2);
 }
 
 template<typename F>
@@ -781,6 +781,7 @@ void Permutation::ExplicitMatrix( Matrix<Int>& P ) const
     bool conjugate, \
     Int offset ) const;
 
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -383,7 +383,11 @@ Base<F> FrobeniusNorm( const DistMultiVec<F>& A )
   template Base<F> SymmetricFrobeniusNorm \
   ( UpperOrLower uplo, const DistSparseMatrix<F>& A );
 
+#define PROTO_DOUBLEDOUBLE \
+  template DoubleDouble FrobeniusNorm( const Matrix<DoubleDouble>& A );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -249,6 +249,10 @@ Base<T> SymmetricMaxNorm( UpperOrLower uplo, const DistSparseMatrix<T>& A )
   template Base<T> SymmetricMaxNorm \
   ( UpperOrLower uplo, const DistSparseMatrix<T>& A );
 
+#define PROTO_DOUBLEDOUBLE \
+  template DoubleDouble MaxNorm( const Matrix<DoubleDouble>& A );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
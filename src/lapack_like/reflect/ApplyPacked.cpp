@@ -164,7 +164,16 @@ void ApplyPackedReflectors
     const ElementalMatrix<F>& H, const ElementalMatrix<F>& t, \
           ElementalMatrix<F>& A );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void ApplyPackedReflectors \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    VerticalOrHorizontal dir, ForwardOrBackward order, \
+    Conjugation conjugation, Int offset, \
+    const Matrix<DoubleDouble>& H, const Matrix<DoubleDouble>& t, \
+          Matrix<DoubleDouble>& A );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
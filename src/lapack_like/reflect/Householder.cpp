@@ -251,7 +251,18 @@ F RightReflector( F& chi, ElementalMatrix<F>& x )
   template F reflector::Row \
   ( ElementalMatrix<F>& chi, ElementalMatrix<F>& x );
 
+#define PROTO_DOUBLEDOUBLE \
+  template DoubleDouble LeftReflector \
+  ( DoubleDouble& chi, Matrix<DoubleDouble>& x ); \
+  template DoubleDouble LeftReflector \
+  ( Matrix<DoubleDouble>& chi, Matrix<DoubleDouble>& x ); \
+  template DoubleDouble RightReflector \
+  ( DoubleDouble& chi, Matrix<DoubleDouble>& x ); \
+  template DoubleDouble RightReflector \
+  ( Matrix<DoubleDouble>& chi, Matrix<DoubleDouble>& x );
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -21,6 +21,8 @@ ElError ElHermitianSDCCtrlDefault_s( ElHermitianSDCCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->spreadFactor = 1e-6f;
     ctrl->progress = false;
+    ctrl->qdwh = false;
+    ElPolarCtrlDefault( &ctrl->polarCtrl );
     return EL_SUCCESS;
 }
 ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
@@ -31,6 +33,8 @@ ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->spreadFactor = 1e-6;
     ctrl->progress = false;
+    ctrl->qdwh = false;
+    ElPolarCtrlDefault( &ctrl->polarCtrl );
     return EL_SUCCESS;
 }
 
@@ -93,6 +97,7 @@ ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl )
     ctrl->colPiv = false;
     ctrl->maxIts = 20;
     ctrl->numIts = 0;
+    ctrl->qdwhCholThreshold = 100;
     return EL_SUCCESS;
 }
 
@@ -100,21 +105,29 @@ ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl )
 ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
 {
     ctrl->seqQR = false;
+    ctrl->distDC = false;
+    ctrl->dcCutoff = 64;
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
     ctrl->thresholded = false;
     ctrl->relative = true;
     ctrl->tol = 0;
+    ctrl->useQDWH = false;
+    ElHermitianSDCCtrlDefault_s( &ctrl->qdwhCtrl );
     return EL_SUCCESS;
 }
 ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
 {
     ctrl->seqQR = false;
+    ctrl->distDC = false;
+    ctrl->dcCutoff = 64;
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
     ctrl->thresholded = false;
     ctrl->relative = true;
     ctrl->tol = 0;
+    ctrl->useQDWH = false;
+    ElHermitianSDCCtrlDefault_d( &ctrl->qdwhCtrl );
     return EL_SUCCESS;
 }
 
@@ -108,8 +108,8 @@ bool CheckScale( UpperOrLower uplo, DistMatrix<F>& A, Base<F>& scale )
 
     scale = 1;
     const Real maxNormOfA = HermitianMaxNorm( uplo, A );
-    const Real underflowThreshold = lapack::MachineUnderflowThreshold<Real>();
-    const Real overflowThreshold = lapack::MachineOverflowThreshold<Real>();
+    const Real underflowThreshold = limits::Min<Real>();
+    const Real overflowThreshold = limits::Max<Real>();
     if( maxNormOfA > 0 && maxNormOfA < underflowThreshold )
     {
         scale = underflowThreshold / maxNormOfA;
@@ -124,6 +124,189 @@ bool CheckScale( UpperOrLower uplo, DistMatrix<F>& A, Base<F>& scale )
         return false;
 }
 
+// Sequential eigensolvers
+// -----------------------
+// LAPACK is used for BLAS scalars, while other types are tridiagonalized and
+// handed to the templated tridiagonal eigensolver (which is then followed by
+// a backtransformation when eigenvectors are requested)
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SequentialHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    const Int n = A.Height();
+    const char uploChar = UpperOrLowerToChar( uplo );
+    w.Resize( n, 1 );
+    if( subset.rangeSubset )
+    {
+        const Int numEigs = lapack::HermitianEig
+          ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
+            subset.lowerBound, subset.upperBound );
+        w.Resize( numEigs, 1 );
+    }
+    else if( subset.indexSubset )
+    {
+        lapack::HermitianEig
+        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
+          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
+        w.Resize( subset.upperIndex-subset.lowerIndex+1, 1 );
+    }
+    else
+        lapack::HermitianEig
+        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer() );
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SequentialHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    Matrix<F> t;
+    HermitianTridiag( uplo, A, t );
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,subdiagonal);
+    HermitianTridiagEig( d, e, w, UNSORTED, subset );
+}
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SequentialHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Z,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    const Int n = A.Height();
+    const char uploChar = UpperOrLowerToChar( uplo );
+    w.Resize( n, 1 );
+    if( subset.indexSubset )
+    {
+        const Int numEigs = subset.upperIndex-subset.lowerIndex+1;
+        Z.Resize( n, numEigs );
+        lapack::HermitianEig
+        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
+          Z.Buffer(), BlasInt(Z.LDim()),
+          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
+        w.Resize( numEigs, 1 );
+    }
+    else if( subset.rangeSubset )
+    {
+        Z.Resize( n, n );
+        const Int numEigs = lapack::HermitianEig
+          ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
+            Z.Buffer(), BlasInt(Z.LDim()),
+            subset.lowerBound, subset.upperBound );
+        w.Resize( numEigs, 1 );
+        Z.Resize( n, numEigs );
+    }
+    else
+    {
+        Z.Resize( n, n );
+        lapack::HermitianEig
+        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
+          Z.Buffer(), BlasInt(Z.LDim()) );
+    }
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SequentialHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Z,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    typedef Base<F> Real;
+    Matrix<F> t;
+    HermitianTridiag( uplo, A, t );
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,subdiagonal);
+    Matrix<Real> ZReal;
+    HermitianTridiagEig( d, e, w, ZReal, UNSORTED, subset );
+    Copy( ZReal, Z );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
+}
+
+// Spectral divide and conquer
+// ---------------------------
+// The polar decompositions and matrix sign functions which SDC is built on
+// are only instantiated for BLAS scalars
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SDCHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ SDC( uplo, A, w, ctrl ); }
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SDCHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ LogicError("SDC is not yet supported for this datatype"); }
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SDCHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ SDC( uplo, A, w, Q, ctrl ); }
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SDCHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ LogicError("SDC is not yet supported for this datatype"); }
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SDCHelper
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<Base<F>>& w,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ SDC( uplo, A, w, ctrl ); }
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SDCHelper
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<Base<F>>& w,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ LogicError("SDC is not yet supported for this datatype"); }
+
+template<typename F,typename=EnableIf<IsBlasScalar<Base<F>>>>
+void SDCHelper
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<Base<F>>& w,
+  ElementalMatrix<F>& Q,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ SDC( uplo, A, w, Q, ctrl ); }
+
+template<typename F,typename=DisableIf<IsBlasScalar<Base<F>>>,typename=void>
+void SDCHelper
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<Base<F>>& w,
+  ElementalMatrix<F>& Q,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{ LogicError("SDC is not yet supported for this datatype"); }
+
 } // namespace herm_eig
 
 // Compute eigenvalues
@@ -143,7 +326,7 @@ void HermitianEig
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
     {
-        herm_eig::SDC( uplo, A, w, ctrl.sdcCtrl );
+        herm_eig::SDCHelper( uplo, A, w, ctrl.sdcCtrl );
         return;
     }
 
@@ -156,26 +339,7 @@ void HermitianEig
         return;
     }
 
-    const Int n = A.Height();
-    const char uploChar = UpperOrLowerToChar( uplo );
-    w.Resize( n, 1 );
-    if( subset.rangeSubset )
-    {
-        const Int numEigs = lapack::HermitianEig
-          ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-            subset.lowerBound, subset.upperBound );
-        w.Resize( numEigs, 1 );
-    }
-    else if( subset.indexSubset )
-    {
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
-        w.Resize( subset.upperIndex-subset.lowerIndex+1, 1 );
-    }
-    else
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer() );
+    herm_eig::SequentialHelper( uplo, A, w, subset );
     Sort( w, sort );
 }
 
@@ -196,7 +360,7 @@ void HermitianEig
     {
         w.SetGrid( A.Grid() );
         w.Resize( n, 1 );
-        herm_eig::SDC( uplo, A.Matrix(), w.Matrix(), ctrl.sdcCtrl );
+        herm_eig::SDCHelper( uplo, A.Matrix(), w.Matrix(), ctrl.sdcCtrl );
         return;
     }
 
@@ -209,25 +373,8 @@ void HermitianEig
         return;
     }
 
-    const char uploChar = UpperOrLowerToChar( uplo );
     w.Resize( n, 1 );
-    if( subset.rangeSubset )
-    {
-        const Int numEigs = lapack::HermitianEig
-          ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-            subset.lowerBound, subset.upperBound );
-        w.Resize( numEigs, 1 );
-    }
-    else if( subset.indexSubset )
-    {
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
-        w.Resize( subset.upperIndex-subset.lowerIndex+1, 1 );
-    }
-    else
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer() );
+    herm_eig::SequentialHelper( uplo, A.Matrix(), w.Matrix(), subset );
     Sort( w, sort );
 }
 
@@ -246,7 +393,7 @@ void HermitianEig
 
     if( ctrl.useSDC )
     {
-        herm_eig::SDC( uplo, APre, w, ctrl.sdcCtrl );
+        herm_eig::SDCHelper( uplo, APre, w, ctrl.sdcCtrl );
         return;
     }
 
@@ -307,26 +454,15 @@ void HermitianEig
         w *= 1/scale;
 }
 
-template<typename F>
-void HermitianEig
+namespace herm_eig {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void ScaLAPACKHelper
 ( UpperOrLower uplo,
   DistMatrix<F,MC,MR,BLOCK>& A,
   Matrix<Base<F>>& w,
-  const HermitianEigSubset<Base<F>> subset )
+  const HermitianEigSubset<Base<F>>& subset )
 {
-    DEBUG_ONLY(CSE cse("HermitianEig"))
-    if( A.Height() != A.Width() )
-        LogicError("Hermitian matrices must be square");
-
-    if( subset.indexSubset && subset.rangeSubset )
-        LogicError("Cannot mix index and range subsets");
-    if( (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
-        (subset.indexSubset && (subset.lowerIndex > subset.upperIndex)) )
-    {
-        w.Resize(0,1);
-        return;
-    }
-
     AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
@@ -353,6 +489,41 @@ void HermitianEig
 #endif
 }
 
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void ScaLAPACKHelper
+( UpperOrLower uplo,
+  DistMatrix<F,MC,MR,BLOCK>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    RuntimeError("There is no ScaLAPACK support for this datatype");
+}
+
+} // namespace herm_eig
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  DistMatrix<F,MC,MR,BLOCK>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigSubset<Base<F>> subset )
+{
+    DEBUG_ONLY(CSE cse("HermitianEig"))
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    if( (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
+        (subset.indexSubset && (subset.lowerIndex > subset.upperIndex)) )
+    {
+        w.Resize(0,1);
+        return;
+    }
+
+    herm_eig::ScaLAPACKHelper( uplo, A, w, subset );
+}
+
 // Compute eigenpairs
 // ==================
 
@@ -371,7 +542,7 @@ void HermitianEig
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
     {
-        herm_eig::SDC( uplo, A, w, Z, ctrl.sdcCtrl );
+        herm_eig::SDCHelper( uplo, A, w, Z, ctrl.sdcCtrl );
         herm_eig::Sort( w, Z, sort );
         return;
     }
@@ -387,35 +558,7 @@ void HermitianEig
         return; 
     }
 
-    const char uploChar = UpperOrLowerToChar( uplo );
-    w.Resize( n, 1 );
-    if( subset.indexSubset )
-    {
-        const Int numEigs = subset.upperIndex-subset.lowerIndex+1;
-        Z.Resize( n, numEigs );
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-          Z.Buffer(), BlasInt(Z.LDim()),
-          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
-        w.Resize( numEigs, 1 );
-    }
-    else if( subset.rangeSubset )
-    {
-        Z.Resize( n, n );
-        const Int numEigs = lapack::HermitianEig
-          ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-            Z.Buffer(), BlasInt(Z.LDim()),
-            subset.lowerBound, subset.upperBound );
-        w.Resize( numEigs, 1 );
-        Z.Resize( n, numEigs );
-    }
-    else
-    {
-        Z.Resize( n, n );
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-          Z.Buffer(), BlasInt(Z.LDim()) );
-    }
+    herm_eig::SequentialHelper( uplo, A, w, Z, subset );
     herm_eig::Sort( w, Z, sort );
 }
 
@@ -437,7 +580,8 @@ void HermitianEig
     {
         w.Resize(n,1);
         Z.Resize(n,n);
-        herm_eig::SDC( uplo, A.Matrix(), w.Matrix(), Z.Matrix(), ctrl.sdcCtrl );
+        herm_eig::SDCHelper
+        ( uplo, A.Matrix(), w.Matrix(), Z.Matrix(), ctrl.sdcCtrl );
         herm_eig::Sort( w.Matrix(), Z.Matrix(), sort );
         return;
     }
@@ -452,35 +596,9 @@ void HermitianEig
         return; 
     }
 
-    const char uploChar = UpperOrLowerToChar( uplo );
     w.Resize( n, 1 );
-    if( subset.indexSubset )
-    {
-        const Int numEigs = subset.upperIndex-subset.lowerIndex+1;
-        Z.Resize( n, numEigs );
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), A.LDim(), w.Buffer(), 
-          Z.Buffer(), BlasInt(Z.LDim()),
-          BlasInt(subset.lowerIndex), BlasInt(subset.upperIndex) );
-        w.Resize( numEigs, 1 );
-    }
-    else if( subset.rangeSubset )
-    {
-        Z.Resize( n, n );
-        const Int numEigs = lapack::HermitianEig
-          ( uploChar, BlasInt(n), A.Buffer(), A.LDim(), w.Buffer(), 
-            Z.Buffer(), BlasInt(Z.LDim()),
-            subset.lowerBound, subset.upperBound );
-        w.Resize( numEigs, 1 );
-        Z.Resize( n, numEigs );
-    }
-    else
-    {
-        Z.Resize( n, n );
-        lapack::HermitianEig
-        ( uploChar, BlasInt(n), A.Buffer(), BlasInt(A.LDim()), w.Buffer(), 
-          Z.Buffer(), BlasInt(Z.LDim()) );
-    }
+    herm_eig::SequentialHelper
+    ( uplo, A.Matrix(), w.Matrix(), Z.Matrix(), subset );
     herm_eig::Sort( w.Matrix(), Z.Matrix(), sort );
 }
 
@@ -502,7 +620,7 @@ void HermitianEig
 
     if( ctrl.useSDC )
     {
-        herm_eig::SDC( uplo, APre, w, ZPre, ctrl.sdcCtrl );
+        herm_eig::SDCHelper( uplo, APre, w, ZPre, ctrl.sdcCtrl );
         herm_eig::Sort( w, ZPre, sort );
         return;
     }
@@ -685,31 +803,19 @@ void HermitianEig
     }
 }
 
-template<typename F>
-void HermitianEig
+namespace herm_eig {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void ScaLAPACKHelper
 ( UpperOrLower uplo,
   DistMatrix<F,MC,MR,BLOCK>& A,
   Matrix<Base<F>>& w,
   DistMatrix<F,MC,MR,BLOCK>& Z,
-  const HermitianEigSubset<Base<F>> subset )
+  const HermitianEigSubset<Base<F>>& subset )
 {
-    DEBUG_ONLY(CSE cse("HermitianEig"))
-    if( A.Height() != A.Width() )
-        LogicError("Hermitian matrices must be square");
-
-    const Int n = A.Height();
-    if( subset.indexSubset && subset.rangeSubset )
-        LogicError("Cannot mix index and range subsets");
-    if( (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
-        (subset.indexSubset && (subset.lowerIndex > subset.upperIndex)) )
-    {
-        w.Resize(0,1);
-        Z.Resize(n,0);
-        return;
-    }
-
     AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
+    const Int n = A.Height();
     w.Resize( n, 1 );
     Z.SetGrid( A.Grid() );
     Z.AlignWith( A );
@@ -740,6 +846,45 @@ void HermitianEig
 #endif
 }
 
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void ScaLAPACKHelper
+( UpperOrLower uplo,
+  DistMatrix<F,MC,MR,BLOCK>& A,
+  Matrix<Base<F>>& w,
+  DistMatrix<F,MC,MR,BLOCK>& Z,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    RuntimeError("There is no ScaLAPACK support for this datatype");
+}
+
+} // namespace herm_eig
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  DistMatrix<F,MC,MR,BLOCK>& A,
+  Matrix<Base<F>>& w,
+  DistMatrix<F,MC,MR,BLOCK>& Z,
+  const HermitianEigSubset<Base<F>> subset )
+{
+    DEBUG_ONLY(CSE cse("HermitianEig"))
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+
+    const Int n = A.Height();
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    if( (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
+        (subset.indexSubset && (subset.lowerIndex > subset.upperIndex)) )
+    {
+        w.Resize(0,1);
+        Z.Resize(n,0);
+        return;
+    }
+
+    herm_eig::ScaLAPACKHelper( uplo, A, w, Z, subset );
+}
+
 #define EIGVAL_PROTO(F) \
   template void HermitianEig\
   ( UpperOrLower uplo, \
@@ -825,12 +970,21 @@ void HermitianEig
     ElementalMatrix<F>& Q, \
     const HermitianSDCCtrl<Base<F>> ctrl );
 
-#define PROTO(F) \
+#define PROTO_BASE(F) \
   EIGVAL_PROTO(F) \
-  EIGPAIR_PROTO(F) \
+  EIGPAIR_PROTO(F)
+
+#define PROTO(F) \
+  PROTO_BASE(F) \
   SDC_PROTO(F)
 
+#define PROTO_QUAD PROTO_BASE(Quad)
+#define PROTO_COMPLEX_QUAD PROTO_BASE(Complex<Quad>)
+#define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
 
 } // namespace El
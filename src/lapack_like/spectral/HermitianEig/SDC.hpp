@@ -29,13 +29,18 @@ using El::schur::PullSubproblems;
 // the computed unitary matrix upon exit.
 template<typename F>
 inline ValueInt<Base<F>>
-QDWHDivide( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
+QDWHDivide
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& G,
+  bool returnQ=false,
+  const PolarCtrl& polarCtrl=PolarCtrl() )
 {
     DEBUG_ONLY(CSE cse("herm_eig::QDWHDivide"))
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    PolarCtrl ctrl;
+    PolarCtrl ctrl( polarCtrl );
     ctrl.qdwh = true;
     HermitianPolar( uplo, G, ctrl );
     ShiftDiagonal( G, F(1) );
@@ -44,8 +49,8 @@ QDWHDivide( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
     // Compute the pivoted QR decomposition of the spectral projection 
     Matrix<F> t;
     Matrix<Base<F>> d;
-    Matrix<Int> p;
-    El::QR( G, t, d, p );
+    Permutation Omega;
+    El::QR( G, t, d, Omega );
 
     // A := Q^H A Q
     MakeHermitian( uplo, A );
@@ -76,13 +81,14 @@ QDWHDivide
 ( UpperOrLower uplo,
   DistMatrix<F>& A,
   DistMatrix<F>& G,
-  bool returnQ=false )
+  bool returnQ=false,
+  const PolarCtrl& polarCtrl=PolarCtrl() )
 {
     DEBUG_ONLY(CSE cse("herm_eig::QDWHDivide"))
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    PolarCtrl ctrl;
+    PolarCtrl ctrl( polarCtrl );
     ctrl.qdwh = true;
     HermitianPolar( uplo, G, ctrl );
     ShiftDiagonal( G, F(1) );
@@ -92,8 +98,8 @@ QDWHDivide
     const Grid& g = A.Grid();
     DistMatrix<F,MD,STAR> t(g);
     DistMatrix<Base<F>,MD,STAR> d(g);
-    DistMatrix<Int,VR,STAR> p(g);
-    El::QR( G, t, d, p );
+    DistPermutation Omega(g);
+    El::QR( G, t, d, Omega );
 
     // A := Q^H A Q
     MakeHermitian( uplo, A );
@@ -140,7 +146,7 @@ RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    PolarCtrl polarCtrl;
+    PolarCtrl polarCtrl( ctrl.polarCtrl );
     polarCtrl.qdwh = true;
     HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
@@ -210,9 +216,9 @@ RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    PolarCtrl polarCtrl;
+    PolarCtrl polarCtrl( ctrl.polarCtrl );
     polarCtrl.qdwh = true;
-    HermitianPolar( uplo, G, polarCtrl );
+    HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -281,8 +287,19 @@ SpectralDivide
     Int it=0;
     ValueInt<Real> part;
     Matrix<F> G, ACopy;
-    if( ctrl.maxOuterIts > 1 )
+    if( ctrl.maxOuterIts > 1 || ctrl.qdwh )
         ACopy = A;
+    if( ctrl.qdwh )
+    {
+        // Attempt a deterministic QDWH-based split about the median of the
+        // diagonal before falling back to randomized shifts
+        G = A;
+        ShiftDiagonal( G, F(-median.value) );
+        part = QDWHDivide( uplo, A, G, false, ctrl.polarCtrl );
+        if( part.value <= tol )
+            return part;
+        A = ACopy;
+    }
     while( it < ctrl.maxOuterIts )
     {
         const Real shift = SampleBall<Real>(-median.value,spread);
@@ -330,8 +347,19 @@ SpectralDivide
     Int it=0;
     ValueInt<Real> part;
     Matrix<F> ACopy;
-    if( ctrl.maxOuterIts > 1 )
+    if( ctrl.maxOuterIts > 1 || ctrl.qdwh )
         ACopy = A;
+    if( ctrl.qdwh )
+    {
+        // Attempt a deterministic QDWH-based split about the median of the
+        // diagonal before falling back to randomized shifts
+        Q = A;
+        ShiftDiagonal( Q, F(-median.value) );
+        part = QDWHDivide( uplo, A, Q, true, ctrl.polarCtrl );
+        if( part.value <= tol )
+            return part;
+        A = ACopy;
+    }
     while( it < ctrl.maxOuterIts )
     {
         const Real shift = SampleBall<Real>(-median.value,spread);
@@ -378,8 +406,19 @@ SpectralDivide
     Int it=0;
     ValueInt<Real> part;
     DistMatrix<F> ACopy(A.Grid()), G(A.Grid());
-    if( ctrl.maxOuterIts > 1 )
+    if( ctrl.maxOuterIts > 1 || ctrl.qdwh )
         ACopy = A;
+    if( ctrl.qdwh )
+    {
+        // Attempt a deterministic QDWH-based split about the median of the
+        // diagonal before falling back to randomized shifts
+        G = A;
+        ShiftDiagonal( G, F(-median.value) );
+        part = QDWHDivide( uplo, A, G, false, ctrl.polarCtrl );
+        if( part.value <= tol )
+            return part;
+        A = ACopy;
+    }
     while( it < ctrl.maxOuterIts )
     {
         Real shift = SampleBall<Real>(-median.value,spread);
@@ -428,8 +467,19 @@ SpectralDivide
     Int it=0;
     ValueInt<Real> part;
     DistMatrix<F> ACopy(A.Grid());
-    if( ctrl.maxOuterIts > 1 )
+    if( ctrl.maxOuterIts > 1 || ctrl.qdwh )
         ACopy = A;
+    if( ctrl.qdwh )
+    {
+        // Attempt a deterministic QDWH-based split about the median of the
+        // diagonal before falling back to randomized shifts
+        Q = A;
+        ShiftDiagonal( Q, F(-median.value) );
+        part = QDWHDivide( uplo, A, Q, true, ctrl.polarCtrl );
+        if( part.value <= tol )
+            return part;
+        A = ACopy;
+    }
     while( it < ctrl.maxOuterIts )
     {
         Real shift = SampleBall<Real>(-median.value,spread);
@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./HermitianTridiagEig/Sort.hpp"
+#include "./HermitianTridiagEig/Bisect.hpp"
 
 // NOTE: dSubReal and ZReal could be packed into their complex counterparts
 
@@ -19,7 +20,7 @@ namespace El {
 
 namespace herm_tridiag_eig {
 
-template<typename Real>
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 (       Matrix<Real>& d,
         Matrix<Real>& dSub,
@@ -50,6 +51,24 @@ inline void Helper
     Sort( w, sort );
 }
 
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+(       Matrix<Real>& d,
+        Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    const Int n = d.Height();
+    auto T = bisect::Split( d.LockedBuffer(), dSub.LockedBuffer(), n );
+    auto eigs = bisect::Eigenvalues( T, subset );
+    const Int k = eigs.size();
+    w.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+        w.Set( j, 0, eigs[j].value );
+    Sort( w, sort );
+}
+
 template<typename Real>
 inline void Helper
 (       Matrix<Real>& d,
@@ -91,7 +110,7 @@ void HermitianTridiagEig
 
 namespace herm_tridiag_eig {
 
-template<typename Real>
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 ( const ElementalMatrix<Real>& d,
   const ElementalMatrix<Real>& dSub,
@@ -137,7 +156,39 @@ inline void Helper
     Sort( w, sort );
 }
 
-template<typename Real>
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        ElementalMatrix<Real>& wPre,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    ElementalProxyCtrl wCtrl;
+    wCtrl.colConstrain = true;
+    wCtrl.colAlign = 0;
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre, wCtrl );
+    auto& w = wProx.Get();
+
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(g), dSub_STAR_STAR(g);
+    Copy( d, d_STAR_STAR );
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+
+    // Split the bisections over the processes
+    auto T = bisect::Split
+      ( d_STAR_STAR.LockedBuffer(), dSub_STAR_STAR.LockedBuffer(), n );
+    auto eigs = bisect::Eigenvalues( T, subset, w.ColComm() );
+    w.Resize( eigs.size(), 1 );
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        w.SetLocal( iLoc, 0, eigs[w.GlobalRow(iLoc)].value );
+    Sort( w, sort );
+}
+
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 ( const ElementalMatrix<Real         >& d,
   const ElementalMatrix<Complex<Real>>& dSub,
@@ -206,6 +257,27 @@ inline void Helper
     Sort( w, sort );
 }
 
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+( const ElementalMatrix<Real         >& d,
+  const ElementalMatrix<Complex<Real>>& dSub,
+        ElementalMatrix<Real         >& w,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    DistMatrix<Complex<Real>,STAR,STAR> dSub_STAR_STAR(g);
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    dSubReal.Resize( n-1, 1, n );
+    for( Int j=0; j<n-1; ++j )
+        dSubReal.SetLocal( j, 0, Abs(dSub_STAR_STAR.GetLocal(j,0)) );
+    HermitianTridiagEig( d, dSubReal, w, sort, subset );
+}
+
 } // namespace herm_tridiag_eig
 
 template<typename F>
@@ -225,7 +297,7 @@ void HermitianTridiagEig
 
 namespace herm_tridiag_eig {
 
-template<typename Real>
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 (       Matrix<Real>& d,
         Matrix<Real>& dSub,
@@ -266,6 +338,31 @@ inline void Helper
     herm_eig::Sort( w, Z, sort );
 }
 
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+(       Matrix<Real>& d,
+        Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        Matrix<Real>& Z,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    const Int n = d.Height();
+    auto T = bisect::Split( d.LockedBuffer(), dSub.LockedBuffer(), n );
+    auto eigs = bisect::Eigenvalues( T, subset );
+    const Int k = eigs.size();
+    w.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+        w.Set( j, 0, eigs[j].value );
+
+    vector<Int> localCols( k );
+    for( Int j=0; j<k; ++j )
+        localCols[j] = j;
+    Zeros( Z, n, k );
+    bisect::Eigenvectors( T, eigs, localCols, Z );
+    herm_eig::Sort( w, Z, sort );
+}
+
 // (Y^H T Y) ZHat = ZHat Lambda
 // T (Y ZHat) = (Y ZHat) Lambda
 template<typename Real>
@@ -317,7 +414,7 @@ void HermitianTridiagEig
 
 namespace herm_tridiag_eig {
 
-template<typename Real>
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 ( const ElementalMatrix<Real>& d,
   const ElementalMatrix<Real>& dSub,
@@ -391,7 +488,54 @@ inline void Helper
     herm_eig::Sort( w, Z, sort );
 }
 
-template<typename Real>
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        ElementalMatrix<Real>& wPre,
+        ElementalMatrix<Real>& ZPre,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+
+    ElementalProxyCtrl wCtrl, ZCtrl;
+    wCtrl.colConstrain = true;
+    wCtrl.colAlign = 0;
+    ZCtrl.rowConstrain = true;
+    ZCtrl.rowAlign = 0;
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre, wCtrl );
+    DistMatrixWriteProxy<Real,Real,STAR,VR> ZProx( ZPre, ZCtrl );
+    auto& w = wProx.Get();
+    auto& Z = ZProx.Get();
+
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(g), dSub_STAR_STAR(g);
+    Copy( d, d_STAR_STAR );
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+
+    // Split the bisections over the processes
+    auto T = bisect::Split
+      ( d_STAR_STAR.LockedBuffer(), dSub_STAR_STAR.LockedBuffer(), n );
+    auto eigs = bisect::Eigenvalues( T, subset, w.ColComm() );
+    const Int k = eigs.size();
+    w.Resize( k, 1 );
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        w.SetLocal( iLoc, 0, eigs[w.GlobalRow(iLoc)].value );
+
+    // Each process computes the clusters which contain one of its columns
+    Zeros( Z, n, k );
+    vector<Int> localCols( k, -1 );
+    for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+        localCols[Z.GlobalCol(jLoc)] = jLoc;
+    bisect::Eigenvectors( T, eigs, localCols, Z.Matrix() );
+
+    herm_eig::Sort( w, Z, sort );
+}
+
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
 inline void Helper
 ( const ElementalMatrix<Real         >& d,
   const ElementalMatrix<Complex<Real>>& dSub,
@@ -490,6 +634,55 @@ inline void Helper
             Z.SetLocal( i, jLoc, C(y.GetLocal(i,0)*ZReal.GetLocal(i,jLoc)) );
 }
 
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void Helper
+( const ElementalMatrix<Real         >& d,
+  const ElementalMatrix<Complex<Real>>& dSub,
+        ElementalMatrix<Real         >& w,
+        ElementalMatrix<Complex<Real>>& ZPre,
+        SortType sort,
+  const HermitianEigSubset<Real>& subset )
+{
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    typedef Complex<Real> C;
+
+    DistMatrix<C,STAR,STAR> dSub_STAR_STAR(g);
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+
+    DistMatrix<C,STAR,STAR> y(n,1,g);
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    dSubReal.Resize( n-1, 1, n );
+    y.SetLocal(0,0,1);
+    for( Int j=0; j<n-1; ++j )
+    {
+        const C psi = dSub_STAR_STAR.GetLocal(j,0);
+        const Real psiAbs = Abs(psi);
+        if( psiAbs == Real(0) )
+            y.SetLocal( j+1, 0, 1 );
+        else
+            y.SetLocal
+            ( j+1, 0, ComplexFromPolar(Real(1),Arg(psi*y.GetLocal(j,0))) );
+        dSubReal.SetLocal( j, 0, psiAbs );
+    }
+
+    ElementalProxyCtrl ZCtrl;
+    ZCtrl.rowConstrain = true;
+    ZCtrl.rowAlign = 0;
+    DistMatrixWriteProxy<C,C,STAR,VR> ZProx( ZPre, ZCtrl );
+    auto& Z = ZProx.Get();
+
+    DistMatrix<Real,STAR,VR> ZReal(g);
+    ZReal.AlignWith( Z );
+    HermitianTridiagEig( d, dSubReal, w, ZReal, sort, subset );
+
+    Z.Resize( n, ZReal.Width() );
+    for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+        for( Int i=0; i<n; ++i )
+            Z.SetLocal( i, jLoc, y.GetLocal(i,0)*ZReal.GetLocal(i,jLoc) );
+}
+
 } // namespace herm_tridiag_eig
 
 template<typename F>
@@ -505,15 +698,16 @@ void HermitianTridiagEig
     herm_tridiag_eig::Helper( d, dSub, w, Z, sort, subset );
 }
 
-template<typename Real>
-Int HermitianTridiagEigEstimate
+namespace herm_tridiag_eig {
+
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
+inline Int EstimateHelper
 ( const ElementalMatrix<Real>& d,
   const ElementalMatrix<Real>& dSub,
         mpi::Comm wColComm,
         Real vl,
         Real vu )
 {
-    DEBUG_ONLY(CSE cse("HermitianTridiagEigEstimate"))
     const Int n = d.Height();
     DistMatrix<double,STAR,STAR> d_STAR_STAR( d.Grid() );
     DistMatrix<double,STAR,STAR> dSub_STAR_STAR( d.Grid() );
@@ -529,9 +723,30 @@ Int HermitianTridiagEigEstimate
     return estimate.numGlobalEigenvalues;
 }
 
-// Z is assumed to be sufficiently large and properly aligned
-template<typename Real>
-void HermitianTridiagEigPostEstimate
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline Int EstimateHelper
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        mpi::Comm wColComm,
+        Real vl,
+        Real vu )
+{
+    // The Sturm counts yield the exact number of eigenvalues
+    const Int n = d.Height();
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d.Grid() );
+    DistMatrix<Real,STAR,STAR> dSub_STAR_STAR( d.Grid() );
+    Copy( d, d_STAR_STAR );
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+    if( n == 0 )
+        return 0;
+    auto T = bisect::Split
+      ( d_STAR_STAR.LockedBuffer(), dSub_STAR_STAR.LockedBuffer(), n );
+    return bisect::NumLess( T, vu ) - bisect::NumLess( T, vl );
+}
+
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
+inline void PostEstimateHelper
 ( const ElementalMatrix<Real>& d,
   const ElementalMatrix<Real>& dSub,
         ElementalMatrix<Real>& wPre,
@@ -540,8 +755,6 @@ void HermitianTridiagEigPostEstimate
         Real vl,
         Real vu )
 {
-    DEBUG_ONLY(CSE cse("HermitianTridiagEigPostEstimate"))
-
     ElementalProxyCtrl wCtrl, ZCtrl;
     wCtrl.colConstrain = true;
     wCtrl.colAlign = 0;
@@ -576,6 +789,52 @@ void HermitianTridiagEigPostEstimate
     herm_eig::Sort( w, Z, sort );
 }
 
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+inline void PostEstimateHelper
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        ElementalMatrix<Real>& w,
+        ElementalMatrix<Real>& Z,
+        SortType sort,
+        Real vl,
+        Real vu )
+{
+    HermitianEigSubset<Real> subset;
+    subset.rangeSubset = true;
+    subset.lowerBound = vl;
+    subset.upperBound = vu;
+    Helper( d, dSub, w, Z, sort, subset );
+}
+
+} // namespace herm_tridiag_eig
+
+template<typename Real>
+Int HermitianTridiagEigEstimate
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        mpi::Comm wColComm,
+        Real vl,
+        Real vu )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiagEigEstimate"))
+    return herm_tridiag_eig::EstimateHelper( d, dSub, wColComm, vl, vu );
+}
+
+// Z is assumed to be sufficiently large and properly aligned
+template<typename Real>
+void HermitianTridiagEigPostEstimate
+( const ElementalMatrix<Real>& d,
+  const ElementalMatrix<Real>& dSub,
+        ElementalMatrix<Real>& w,
+        ElementalMatrix<Real>& Z,
+        SortType sort,
+        Real vl,
+        Real vu )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiagEigPostEstimate"))
+    herm_tridiag_eig::PostEstimateHelper( d, dSub, w, Z, sort, vl, vu );
+}
+
 #define PROTO(F) \
   template void herm_eig::Sort \
   ( Matrix<Base<F>>& w, \
@@ -642,6 +901,8 @@ void HermitianTridiagEigPostEstimate
     SortType sort );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -0,0 +1,560 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAGEIG_BISECT_HPP
+#define EL_HERMITIANTRIDIAGEIG_BISECT_HPP
+
+// A symmetric tridiagonal eigensolver which is templated over the real
+// datatype so that the tridiagonal stage of the Hermitian eigensolvers is
+// available for precisions which are not supported by LAPACK and PMRRR.
+//
+// After splitting the matrix at negligible off-diagonal entries, each
+// requested eigenvalue is computed independently with bisection on Sturm
+// counts. Eigenvectors of isolated eigenvalues are then computed with a
+// single solve with a twisted factorization, T - lambda I = N_r D_r N_r^T, as
+// in the final stage of the MRRR algorithm of Dhillon and Parlett, while
+// clusters of eigenvalues are handled with inverse iteration and modified
+// Gram-Schmidt as in LAPACK's xSTEIN.
+//
+// Both stages are embarrassingly parallel: the eigenvalues are split between
+// the processes (and threads), while each cluster of eigenvectors is computed
+// independently by each process which owns one of its members. The
+// computation is fully deterministic so that the redundantly computed members
+// of a cluster are identical on every process.
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace bisect {
+
+// A symmetric tridiagonal matrix split into unreduced blocks
+template<typename Real>
+struct Tridiag
+{
+    Int n;
+    vector<Real> d, e;
+
+    // The first index of each block (with n appended)
+    vector<Int> offsets;
+
+    // The one norms of the blocks
+    vector<Real> norms;
+
+    // The minimum pivot magnitude allowed in the Sturm sequences
+    Real pivMin;
+};
+
+template<typename Real>
+inline Tridiag<Real> Split( const Real* d, const Real* e, Int n )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::bisect::Split"))
+    Tridiag<Real> T;
+    T.n = n;
+    T.d.resize( n );
+    T.e.resize( Max(n-1,Int(0)) );
+    for( Int i=0; i<n; ++i )
+        T.d[i] = d[i];
+    for( Int i=0; i<n-1; ++i )
+        T.e[i] = e[i];
+
+    Real norm=0, eMaxSquared=0;
+    for( Int i=0; i<n; ++i )
+    {
+        Real rowNorm = Abs(T.d[i]);
+        if( i > 0 )
+            rowNorm += Abs(T.e[i-1]);
+        if( i < n-1 )
+        {
+            rowNorm += Abs(T.e[i]);
+            eMaxSquared = Max( eMaxSquared, T.e[i]*T.e[i] );
+        }
+        norm = Max( norm, rowNorm );
+    }
+    T.pivMin = limits::SafeMin<Real>()*Max( Real(1), eMaxSquared );
+
+    // Zero the off-diagonal entries which are negligible relative to the
+    // norm of the matrix
+    const Real eps = limits::Epsilon<Real>();
+    T.offsets.assign( 1, 0 );
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(T.e[i]) <= eps*norm )
+        {
+            T.e[i] = 0;
+            T.offsets.push_back( i+1 );
+        }
+    }
+    T.offsets.push_back( n );
+
+    const Int numBlocks = T.offsets.size()-1;
+    T.norms.resize( numBlocks );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        Real blockNorm = 0;
+        for( Int i=T.offsets[b]; i<T.offsets[b+1]; ++i )
+        {
+            Real rowNorm = Abs(T.d[i]);
+            if( i > T.offsets[b] )
+                rowNorm += Abs(T.e[i-1]);
+            if( i < T.offsets[b+1]-1 )
+                rowNorm += Abs(T.e[i]);
+            blockNorm = Max( blockNorm, rowNorm );
+        }
+        T.norms[b] = blockNorm;
+    }
+    return T;
+}
+
+// Return the number of eigenvalues of the given block which are less than x
+template<typename Real>
+inline Int NumLess( const Tridiag<Real>& T, Int b, const Real& x )
+{
+    const Int off = T.offsets[b];
+    const Int nb = T.offsets[b+1] - off;
+    const Real* d = &T.d[off];
+    const Real* e = &T.e[off];
+    Int numLess = 0;
+    Real q = d[0] - x;
+    if( Abs(q) < T.pivMin )
+        q = -T.pivMin;
+    if( q < Real(0) )
+        ++numLess;
+    for( Int i=1; i<nb; ++i )
+    {
+        q = d[i] - x - e[i-1]*(e[i-1]/q);
+        if( Abs(q) < T.pivMin )
+            q = -T.pivMin;
+        if( q < Real(0) )
+            ++numLess;
+    }
+    return numLess;
+}
+
+template<typename Real>
+inline Int NumLess( const Tridiag<Real>& T, const Real& x )
+{
+    const Int numBlocks = T.offsets.size()-1;
+    Int numLess = 0;
+    for( Int b=0; b<numBlocks; ++b )
+        numLess += NumLess( T, b, x );
+    return numLess;
+}
+
+// Return the Gershgorin interval of the given block, padded so that the
+// endpoints may be safely used for bisection
+template<typename Real>
+inline void GershgorinInterval
+( const Tridiag<Real>& T, Int b, Real& lower, Real& upper )
+{
+    const Int off = T.offsets[b];
+    const Int nb = T.offsets[b+1] - off;
+    lower = upper = T.d[off];
+    for( Int i=off; i<off+nb; ++i )
+    {
+        Real radius = 0;
+        if( i > off )
+            radius += Abs(T.e[i-1]);
+        if( i < off+nb-1 )
+            radius += Abs(T.e[i]);
+        lower = Min( lower, T.d[i]-radius );
+        upper = Max( upper, T.d[i]+radius );
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real pad =
+      2*eps*Max(Abs(lower),Abs(upper)) + eps*T.norms[b] + 2*T.pivMin;
+    lower -= pad;
+    upper += pad;
+}
+
+// Compute the k'th smallest eigenvalue of block b (if b >= 0) or of the
+// entire matrix (if b < 0) to within an absolute accuracy of about
+// epsilon || T || via bisection within [lower,upper)
+template<typename Real>
+inline Real KthEigenvalue
+( const Tridiag<Real>& T, Int b, Int k, Real lower, Real upper )
+{
+    const Real eps = limits::Epsilon<Real>();
+    const Real normT = ( b >= 0 ? T.norms[b] :
+      *std::max_element(T.norms.begin(),T.norms.end()) );
+    const Real absTol = eps*normT;
+    while( true )
+    {
+        const Real mid = (lower+upper)/2;
+        const Real width = upper - lower;
+        if( width <= Max(absTol,2*eps*Max(Abs(lower),Abs(upper))) ||
+            mid <= lower || mid >= upper )
+            return mid;
+        const Int numLess = ( b >= 0 ? NumLess(T,b,mid) : NumLess(T,mid) );
+        if( numLess > k )
+            upper = mid;
+        else
+            lower = mid;
+    }
+}
+
+template<typename Real>
+struct Eigenvalue
+{
+    Real value;
+    Int block, index;
+};
+
+// Compute the requested eigenvalues in ascending order, splitting the
+// bisections over the processes in the communicator
+template<typename Real>
+inline vector<Eigenvalue<Real>>
+Eigenvalues
+( const Tridiag<Real>& T,
+  const HermitianEigSubset<Real>& subset,
+  mpi::Comm comm=mpi::COMM_SELF )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::bisect::Eigenvalues"))
+    const Int n = T.n;
+    vector<Eigenvalue<Real>> eigs;
+    if( n == 0 )
+        return eigs;
+    const Int numBlocks = T.offsets.size()-1;
+    vector<Real> lowers(numBlocks), uppers(numBlocks);
+    for( Int b=0; b<numBlocks; ++b )
+        GershgorinInterval( T, b, lowers[b], uppers[b] );
+
+    // Determine the candidate eigenvalues of each block
+    Real lowerBound, upperBound;
+    Int numLessLower=0;
+    bool trim = false;
+    if( subset.rangeSubset )
+    {
+        lowerBound = subset.lowerBound;
+        upperBound = subset.upperBound;
+    }
+    else if( subset.indexSubset )
+    {
+        // Bracket the requested eigenvalues and then trim the candidates
+        // which were only included due to ties between the blocks
+        const Real lower = *std::min_element(lowers.begin(),lowers.end());
+        const Real upper = *std::max_element(uppers.begin(),uppers.end());
+        const Real eps = limits::Epsilon<Real>();
+        const Real normT = *std::max_element(T.norms.begin(),T.norms.end());
+        const Real tol = 4*eps*normT + 4*T.pivMin;
+        lowerBound =
+          KthEigenvalue( T, -1, subset.lowerIndex, lower, upper ) - tol;
+        upperBound =
+          KthEigenvalue( T, -1, subset.upperIndex, lower, upper ) + tol;
+        trim = true;
+    }
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        Int first, last;
+        if( subset.rangeSubset || subset.indexSubset )
+        {
+            first = NumLess( T, b, lowerBound );
+            last = NumLess( T, b, upperBound );
+            numLessLower += first;
+        }
+        else
+        {
+            first = 0;
+            last = T.offsets[b+1]-T.offsets[b];
+        }
+        for( Int k=first; k<last; ++k )
+            eigs.push_back( Eigenvalue<Real>{Real(0),b,k} );
+    }
+
+    // Compute our share of the candidates and then combine the results
+    const Int numCands = eigs.size();
+    const Int commSize = mpi::Size( comm );
+    const Int commRank = mpi::Rank( comm );
+    const Int candBeg = (numCands*commRank)/commSize;
+    const Int candEnd = (numCands*(commRank+1))/commSize;
+    vector<Real> values( numCands, Real(0) );
+    EL_PARALLEL_FOR
+    for( Int c=candBeg; c<candEnd; ++c )
+    {
+        const Int b = eigs[c].block;
+        values[c] =
+          KthEigenvalue( T, b, eigs[c].index, lowers[b], uppers[b] );
+    }
+    if( commSize > 1 )
+        mpi::AllReduce( values.data(), numCands, comm );
+    for( Int c=0; c<numCands; ++c )
+        eigs[c].value = values[c];
+    std::stable_sort
+    ( eigs.begin(), eigs.end(),
+      []( const Eigenvalue<Real>& alpha, const Eigenvalue<Real>& beta )
+      { return alpha.value < beta.value; } );
+
+    if( trim )
+    {
+        const Int first = subset.lowerIndex - numLessLower;
+        const Int numEig = subset.upperIndex-subset.lowerIndex+1;
+        eigs.erase( eigs.begin(), eigs.begin()+Max(first,Int(0)) );
+        eigs.resize( Min(Int(eigs.size()),numEig) );
+    }
+    return eigs;
+}
+
+// Overwrite z with the eigenvector of block b corresponding to the
+// eigenvalue lambda by solving with the twisted factorization which
+// minimizes |gamma_r| in
+//
+//   (T - lambda I) z = gamma_r e_r
+//
+template<typename Real>
+inline void TwistedSolve
+( const Tridiag<Real>& T, Int b, const Real& lambda, Real* z )
+{
+    const Int off = T.offsets[b];
+    const Int nb = T.offsets[b+1] - off;
+    const Real* d = &T.d[off];
+    const Real* e = &T.e[off];
+    if( nb == 1 )
+    {
+        z[0] = 1;
+        return;
+    }
+
+    // Form the diagonals of the forward and backward factorizations
+    vector<Real> dPlus(nb), dMinus(nb);
+    dPlus[0] = d[0] - lambda;
+    if( Abs(dPlus[0]) < T.pivMin )
+        dPlus[0] = -T.pivMin;
+    for( Int i=1; i<nb; ++i )
+    {
+        dPlus[i] = d[i] - lambda - e[i-1]*(e[i-1]/dPlus[i-1]);
+        if( Abs(dPlus[i]) < T.pivMin )
+            dPlus[i] = -T.pivMin;
+    }
+    dMinus[nb-1] = d[nb-1] - lambda;
+    if( Abs(dMinus[nb-1]) < T.pivMin )
+        dMinus[nb-1] = -T.pivMin;
+    for( Int i=nb-2; i>=0; --i )
+    {
+        dMinus[i] = d[i] - lambda - e[i]*(e[i]/dMinus[i+1]);
+        if( Abs(dMinus[i]) < T.pivMin )
+            dMinus[i] = -T.pivMin;
+    }
+
+    // Find the twist index
+    Int r = 0;
+    Real gammaMin = 0;
+    for( Int i=0; i<nb; ++i )
+    {
+        const Real gamma = Abs(dPlus[i] + dMinus[i] - (d[i]-lambda));
+        if( i == 0 || gamma < gammaMin )
+        {
+            r = i;
+            gammaMin = gamma;
+        }
+    }
+
+    z[r] = 1;
+    for( Int i=r-1; i>=0; --i )
+        z[i] = -(e[i]/dPlus[i])*z[i+1];
+    for( Int i=r+1; i<nb; ++i )
+        z[i] = -(e[i-1]/dMinus[i])*z[i-1];
+}
+
+// Overwrite x with inv(T - lambda I) x for block b using Gaussian elimination
+// with partial pivoting, where tiny pivots are replaced with +-pert
+template<typename Real>
+inline void ShiftedSolve
+( const Tridiag<Real>& T, Int b, const Real& lambda, const Real& pert,
+  Real* x )
+{
+    const Int off = T.offsets[b];
+    const Int nb = T.offsets[b+1] - off;
+    auto safePivot = [&]( const Real& alpha )
+      { return ( Abs(alpha) >= pert ? alpha :
+                 (alpha < Real(0) ? -pert : pert) ); };
+    if( nb == 1 )
+    {
+        x[0] /= safePivot( T.d[off]-lambda );
+        return;
+    }
+
+    vector<Real> diag(nb), sub(nb-1), super(nb-1), super2(nb-1,Real(0));
+    for( Int i=0; i<nb; ++i )
+        diag[i] = T.d[off+i] - lambda;
+    for( Int i=0; i<nb-1; ++i )
+        sub[i] = super[i] = T.e[off+i];
+
+    for( Int i=0; i<nb-1; ++i )
+    {
+        if( Abs(diag[i]) >= Abs(sub[i]) )
+        {
+            diag[i] = safePivot( diag[i] );
+            const Real fact = sub[i]/diag[i];
+            diag[i+1] -= fact*super[i];
+            x[i+1] -= fact*x[i];
+        }
+        else
+        {
+            // Interchange rows i and i+1
+            const Real fact = diag[i]/sub[i];
+            diag[i] = sub[i];
+            const Real tmp = diag[i+1];
+            diag[i+1] = super[i] - fact*tmp;
+            if( i < nb-2 )
+            {
+                super2[i] = super[i+1];
+                super[i+1] = -fact*super2[i];
+            }
+            super[i] = tmp;
+            const Real xTmp = x[i];
+            x[i] = x[i+1];
+            x[i+1] = xTmp - fact*x[i+1];
+        }
+    }
+    diag[nb-1] = safePivot( diag[nb-1] );
+
+    x[nb-1] /= diag[nb-1];
+    x[nb-2] = (x[nb-2]-super[nb-2]*x[nb-1])/diag[nb-2];
+    for( Int i=nb-3; i>=0; --i )
+        x[i] = (x[i]-super[i]*x[i+1]-super2[i]*x[i+2])/diag[i];
+}
+
+template<typename Real>
+inline void Normalize( Int n, Real* x )
+{
+    Real norm = 0;
+    for( Int i=0; i<n; ++i )
+        norm = lapack::SafeNorm( norm, x[i] );
+    for( Int i=0; i<n; ++i )
+        x[i] /= norm;
+}
+
+// Compute the eigenvectors of the given eigenvalues (in the order returned
+// by Eigenvalues). Column j is stored in column localCols[j] of ZLoc unless
+// localCols[j] < 0, in which case it is only computed if it is needed for
+// orthogonalizing a later member of its cluster. The locally owned columns
+// of ZLoc are assumed to be zero on entry.
+template<typename Real>
+inline void
+Eigenvectors
+( const Tridiag<Real>& T,
+  const vector<Eigenvalue<Real>>& eigs,
+  const vector<Int>& localCols,
+        Matrix<Real>& ZLoc )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::bisect::Eigenvectors"))
+    const Real eps = limits::Epsilon<Real>();
+    const Int numEig = eigs.size();
+    const Int numBlocks = T.offsets.size()-1;
+
+    // Group the eigenvalues of each block into clusters using the
+    // orthogonalization threshold from xSTEIN
+    vector<vector<Int>> blockCols( numBlocks );
+    for( Int j=0; j<numEig; ++j )
+        blockCols[eigs[j].block].push_back( j );
+    vector<vector<Int>> clusters;
+    // As in LAPACK's stein, eigenvalues whose absolute gap is at most
+    // || T ||/1000 are grouped so that their vectors are computed in order by
+    // a single thread. Such groups can chain across far more of the spectrum
+    // than any one eigenvalue's neighbourhood, so each vector is only
+    // reorthogonalized against the preceding members of its group which lie
+    // within that gap of it: the vectors of more distant eigenvalues are
+    // already orthogonal to working precision.
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Real orthTol = T.norms[b]/Real(1000);
+        const auto& cols = blockCols[b];
+        const Int numCols = cols.size();
+        for( Int k=0; k<numCols; )
+        {
+            Int kEnd = k+1;
+            while( kEnd < numCols &&
+                   eigs[cols[kEnd]].value-eigs[cols[kEnd-1]].value <= orthTol )
+                ++kEnd;
+            clusters.push_back
+            ( vector<Int>(cols.begin()+k,cols.begin()+kEnd) );
+            k = kEnd;
+        }
+    }
+
+    const Int numClusters = clusters.size();
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numClusters; ++c )
+    {
+        const auto& cluster = clusters[c];
+        const Int clusterSize = cluster.size();
+        Int numNeeded = 0;
+        for( Int t=0; t<clusterSize; ++t )
+            if( localCols[cluster[t]] >= 0 )
+                numNeeded = t+1;
+        if( numNeeded == 0 )
+            continue;
+
+        const Int b = eigs[cluster[0]].block;
+        const Int off = T.offsets[b];
+        const Int nb = T.offsets[b+1] - off;
+        const Real pert = eps*T.norms[b];
+        const Real pertTol = 10*eps*T.norms[b];
+        const Real orthTol = T.norms[b]/Real(1000);
+        Matrix<Real> X( nb, numNeeded );
+        Real lambdaLast = 0;
+        Int sBeg = 0;
+        for( Int t=0; t<numNeeded; ++t )
+        {
+            Real* x = X.Buffer(0,t);
+            Real lambda = eigs[cluster[t]].value;
+            while( lambda-eigs[cluster[sBeg]].value > orthTol )
+                ++sBeg;
+            if( t == 0 )
+            {
+                TwistedSolve( T, b, lambda, x );
+                Normalize( nb, x );
+            }
+            else
+            {
+                // Perturb coincident eigenvalues and start from a
+                // deterministic pseudo-random vector so that the subspace
+                // is fully explored
+                if( lambda < lambdaLast + pertTol )
+                    lambda = lambdaLast + pertTol;
+                unsigned long long state = 1 + cluster[t];
+                for( Int i=0; i<nb; ++i )
+                {
+                    state = 6364136223846793005ULL*state +
+                            1442695040888963407ULL;
+                    x[i] = Real(double(state>>11)/9007199254740992.) -
+                           Real(1)/Real(2);
+                }
+            }
+            lambdaLast = lambda;
+
+            if( clusterSize > 1 )
+            {
+                const Int numIts = 3;
+                for( Int it=0; it<numIts; ++it )
+                {
+                    ShiftedSolve( T, b, lambda, pert, x );
+                    for( Int s=sBeg; s<t; ++s )
+                    {
+                        const Real* y = X.LockedBuffer(0,s);
+                        Real gamma = 0;
+                        for( Int i=0; i<nb; ++i )
+                            gamma += y[i]*x[i];
+                        for( Int i=0; i<nb; ++i )
+                            x[i] -= gamma*y[i];
+                    }
+                    Normalize( nb, x );
+                }
+            }
+
+            const Int jLoc = localCols[cluster[t]];
+            if( jLoc >= 0 )
+                MemCopy( ZLoc.Buffer(off,jLoc), x, nb );
+        }
+    }
+}
+
+} // namespace bisect
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAGEIG_BISECT_HPP
@@ -25,6 +25,56 @@ namespace El {
 
 namespace polar {
 
+// Bound the smallest singular value of A using the upper-triangular factor, R,
+// from its QR decomposition. Since || inv(R) ||_2 <= sqrt(n) || inv(R) ||_1,
+// the returned value divided by sqrt(n) (as in QDWHInner) is a guaranteed 
+// lower bound on sigma_min(A), which the dynamic weights require.
+//
+// The one-norm of the inverse can be replaced with an estimate which is
+// a few times cheaper, e.g., via Higham and Tisseur's block algorithm
+// from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
+// to 1-Norm Pseudospectra", but only if the estimate provably does not
+// underestimate the norm.
+template<typename F>
+inline Base<F> 
+SMinLowerBound( const Matrix<F>& R )
+{
+    DEBUG_ONLY(CSE cse("polar::SMinLowerBound"))
+    typedef Base<F> Real;
+    if( R.Height() == 0 )
+        return 0;
+    Matrix<F> RInv( R );
+    try 
+    {
+        TriangularInverse( UPPER, NON_UNIT, RInv );
+    }
+    catch( SingularMatrixException& e ) { return 0; }
+    const Real invNorm = OneNorm( RInv );
+    if( !(invNorm <= limits::Max<Real>()) )
+        return 0;
+    return Real(1)/invNorm;
+}
+
+template<typename F>
+inline Base<F> 
+SMinLowerBound( const DistMatrix<F>& R )
+{
+    DEBUG_ONLY(CSE cse("polar::SMinLowerBound"))
+    typedef Base<F> Real;
+    if( R.Height() == 0 )
+        return 0;
+    DistMatrix<F> RInv( R );
+    try 
+    {
+        TriangularInverse( UPPER, NON_UNIT, RInv );
+    }
+    catch( SingularMatrixException& e ) { return 0; }
+    const Real invNorm = OneNorm( RInv );
+    if( !(invNorm <= limits::Max<Real>()) )
+        return 0;
+    return Real(1)/invNorm;
+}
+
 template<typename F>
 inline Int 
 QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
@@ -54,8 +104,6 @@ QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
     Int numIts=0;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
         Real L2;
         Cpx dd, sqd;
         if( Abs(1-L) < tol )
@@ -79,7 +127,13 @@ QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        // Convergence requires |1-L| <= tol, so there is no need to back up
+        // A (and later reduce the norm of the update) until then
+        const bool checkConv = ( Abs(1-L) <= tol );
+        if( checkConv )
+            ALast = A;
+
+        if( c > ctrl.qdwhCholThreshold )
         {
             //
             // The standard QR-based algorithm
@@ -106,10 +160,13 @@ QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
         }
 
         ++numIts;
-        ALast -= A;
-        frobNormADiff = FrobeniusNorm( ALast );
-        if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
-            break;
+        if( checkConv )
+        {
+            ALast -= A;
+            frobNormADiff = FrobeniusNorm( ALast );
+            if( frobNormADiff <= cubeRootTol )
+                break;
+        }
     }
     return numIts;
 }
@@ -123,29 +180,11 @@ QDWH( Matrix<F>& A, const PolarCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Bound the smallest singular value using the triangular factor from a
+    // QR decomposition (which is cheaper to invert than A itself)
     Matrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try 
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try 
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    } 
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = SMinLowerBound( Y );
 
     return QDWHInner( A, sMinUpper, ctrl );
 }
@@ -157,8 +196,8 @@ QDWH( Matrix<F>& A, Matrix<F>& P, const PolarCtrl& ctrl )
     DEBUG_ONLY(CSE cse("polar::QDWH"))
     Matrix<F> ACopy( A );
     const Int numIts = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return numIts;
 }
@@ -199,8 +238,6 @@ QDWHInner
     Real frobNormADiff;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
         Real L2;
         Cpx dd, sqd;
         if( Abs(1-L) < tol )
@@ -224,7 +261,13 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        // Convergence requires |1-L| <= tol, so there is no need to back up
+        // A (and later reduce the norm of the update) until then
+        const bool checkConv = ( Abs(1-L) <= tol );
+        if( checkConv )
+            ALast = A;
+
+        if( c > ctrl.qdwhCholThreshold )
         {
             //
             // The standard QR-based algorithm
@@ -251,10 +294,13 @@ QDWHInner
         }
 
         ++numIts;
-        ALast -= A;
-        frobNormADiff = FrobeniusNorm( ALast );
-        if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
-            break;
+        if( checkConv )
+        {
+            ALast -= A;
+            frobNormADiff = FrobeniusNorm( ALast );
+            if( frobNormADiff <= cubeRootTol )
+                break;
+        }
     }
     return numIts;
 }
@@ -272,29 +318,11 @@ QDWH( ElementalMatrix<F>& APre, const PolarCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Bound the smallest singular value using the triangular factor from a
+    // QR decomposition (which is cheaper to invert than A itself)
     DistMatrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = SMinLowerBound( Y );
 
     return QDWHInner( A, sMinUpper, ctrl );
 }
@@ -314,8 +342,8 @@ QDWH
 
     DistMatrix<F> ACopy( A );
     const Int numIts = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return numIts;
 }
@@ -355,8 +383,6 @@ QDWHInner
     Int numIts=0;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
         Real L2;
         Cpx dd, sqd;
         if( Abs(1-L) < tol )
@@ -380,7 +406,13 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        // Convergence requires |1-L| <= tol, so there is no need to back up
+        // A (and later reduce the norm of the update) until then
+        const bool checkConv = ( Abs(1-L) <= tol );
+        if( checkConv )
+            ALast = A;
+
+        if( c > ctrl.qdwhCholThreshold )
         {
             //
             // The standard QR-based algorithm
@@ -411,12 +443,14 @@ QDWHInner
             Axpy( alpha, ATemp, A );
         }
 
-        ALast -= A;
-        frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
-
         ++numIts;
-        if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
-            break;
+        if( checkConv )
+        {
+            ALast -= A;
+            frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
+            if( frobNormADiff <= cubeRootTol )
+                break;
+        }
     }
 
     MakeHermitian( uplo, A );
@@ -433,17 +467,11 @@ QDWH( UpperOrLower uplo, Matrix<F>& A, const PolarCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Bound the smallest singular value using the triangular factor from a
+    // QR decomposition (which is cheaper to invert than A itself)
     Matrix<F> Y( A );
-    try
-    {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = polar::SMinLowerBound( Y );
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
@@ -499,8 +527,6 @@ QDWHInner
     Int numIts=0;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
         Real L2;
         Cpx dd, sqd;
         if( Abs(1-L) < tol )
@@ -524,7 +550,13 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        // Convergence requires |1-L| <= tol, so there is no need to back up
+        // A (and later reduce the norm of the update) until then
+        const bool checkConv = ( Abs(1-L) <= tol );
+        if( checkConv )
+            ALast = A;
+
+        if( c > ctrl.qdwhCholThreshold )
         {
             //
             // The standard QR-based algorithm
@@ -556,10 +588,13 @@ QDWHInner
         }
 
         ++numIts;
-        ALast -= A;
-        frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
-        if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
-            break;
+        if( checkConv )
+        {
+            ALast -= A;
+            frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
+            if( frobNormADiff <= cubeRootTol )
+                break;
+        }
     }
     MakeHermitian( uplo, A );
     return numIts;
@@ -579,17 +614,11 @@ QDWH( UpperOrLower uplo, ElementalMatrix<F>& APre, const PolarCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Bound the smallest singular value using the triangular factor from a
+    // QR decomposition (which is cheaper to invert than A itself)
     DistMatrix<F> Y( A );
-    try 
-    {   
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = polar::SMinLowerBound( Y );
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./SVD/Chan.hpp"
+#include "./SVD/QDWH.hpp"
 #include "./SVD/Thresholded.hpp"
 
 namespace El {
@@ -29,6 +30,10 @@ void SVD
     {
         svd::Thresholded( A, s, V, ctrl.tol, ctrl.relative );
     }
+    else if( ctrl.useQDWH )
+    {
+        svd::QDWH( A, s, V, ctrl );
+    }
     else
     {
         if( ctrl.seqQR )
@@ -56,8 +61,11 @@ void SVD
         else
             svd::Thresholded( A, s, V, ctrl.tol, ctrl.relative );
     }
+    else if( ctrl.useQDWH )
+        svd::QDWH( A, s, V, ctrl );
     else
-        svd::Chan( A, s, V, ctrl.fullChanRatio );
+        svd::Chan
+        ( A, s, V, ctrl.fullChanRatio, ctrl.distDC, ctrl.dcCutoff );
 }
 
 // Return the singular values
@@ -0,0 +1,1044 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVD_BIDIAGDC_HPP
+#define EL_SVD_BIDIAGDC_HPP
+
+#include "./Util.hpp"
+
+// A divide-and-conquer algorithm for the SVD of an upper bidiagonal matrix
+// along the lines of Ming Gu and Stanley C. Eisenstat's "A divide-and-conquer
+// algorithm for the bidiagonal SVD", SIAM J. Matrix Anal. Appl., Vol. 16,
+// No. 1, pp. 79--92, 1995.
+//
+// An n x m upper bidiagonal matrix, with m in {n,n+1}, is split about row r,
+//
+//   B = | B1,             0       |,
+//       | alpha e_r^T,    beta e_1^T |
+//       | 0,              B2      |
+//
+// where B1 is r x (r+1) and B2 has the same shape as B. Given the SVD's of
+// B1 and B2, the SVD of B follows from that of a matrix of the form
+//
+//   M = | z_0, z_1, ..., z_{n-1} |,
+//       |      d_1               |
+//       |           ...          |
+//       |                d_{n-1} |
+//
+// whose squared singular values are the roots of the secular equation
+//
+//   1 + sum_i z_i^2 / (d_i^2 - sigma^2) = 0.
+//
+// The singular vectors of B are then formed by multiplying the block-diagonal
+// matrices of the singular vectors of B1 and B2 by those of M, which is a
+// Gemm. The Lowner-based recomputation of z from the computed singular values
+// guarantees the numerical orthogonality of the singular vectors.
+//
+// In the distributed implementation, the subtrees of the recursion below
+// (roughly) n/p are assigned to individual processes and solved sequentially,
+// while the remaining merges distribute the secular equation solves over the
+// processes and form the singular vectors with distributed Gemm's.
+
+namespace El {
+namespace svd {
+namespace bidiag_dc {
+
+// Solve for the t'th root of the secular equation
+//
+//   f(sigma) = 1 + sum_{i=0}^{K-1} z_i^2 / (d_i^2 - sigma^2) = 0,
+//
+// where 0 = d_0 < d_1 < ... < d_{K-1}. The root lies in (d_t,d_{t+1}), or
+// in (d_{K-1},sqrt(d_{K-1}^2+|| z ||_2^2)] if t=K-1, and it is returned as
+// sigma^2 = d_{origin}^2 + eta, where d_{origin} is the nearest pole, so that
+// the differences d_i^2 - sigma^2 can be computed to high relative accuracy.
+//
+// The iteration interpolates f with a rational function with poles at the
+// two neighboring poles (the "middle way" of Ren-Cang Li) and is safeguarded
+// with bisection.
+template<typename Real>
+inline void
+SecularRoot
+( const vector<Real>& d,
+  const vector<Real>& z,
+  Int t,
+  Int& origin,
+  Real& eta,
+  Int maxIts=400 )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::SecularRoot"))
+    const Int K = d.size();
+    const Real eps = limits::Epsilon<Real>();
+
+    // D_i := d_i^2 - d_origin^2
+    vector<Real> D(K);
+    auto shift = [&]( Int o )
+      { for( Int i=0; i<K; ++i ) D[i] = (d[i]-d[o])*(d[i]+d[o]); };
+
+    Real lo, hi;
+    if( t < K-1 )
+    {
+        // Since f is increasing, the sign of f at the midpoint determines
+        // which of the two poles is closer to the root
+        shift( t );
+        const Real mid = D[t+1]/2;
+        Real f = 1;
+        for( Int i=0; i<K; ++i )
+            f += z[i]*z[i]/(D[i]-mid);
+        if( f >= Real(0) )
+        {
+            origin = t;
+            lo = 0;
+            hi = mid;
+        }
+        else
+        {
+            origin = t+1;
+            shift( t+1 );
+            lo = D[t]/2;
+            hi = 0;
+        }
+    }
+    else
+    {
+        origin = t;
+        shift( t );
+        Real zNormSq = 0;
+        for( Int i=0; i<K; ++i )
+            zNormSq += z[i]*z[i];
+        lo = 0;
+        hi = zNormSq;
+    }
+
+    eta = (lo+hi)/2;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // Split f = 1 + psi + phi into the terms with poles to the left and
+        // right of the root
+        Real psi=0, psiDeriv=0, phi=0, phiDeriv=0;
+        for( Int i=0; i<=t; ++i )
+        {
+            const Real tmp = z[i]/(D[i]-eta);
+            psi += z[i]*tmp;
+            psiDeriv += tmp*tmp;
+        }
+        for( Int i=t+1; i<K; ++i )
+        {
+            const Real tmp = z[i]/(D[i]-eta);
+            phi += z[i]*tmp;
+            phiDeriv += tmp*tmp;
+        }
+        const Real f = 1 + psi + phi;
+        if( f < Real(0) )
+            lo = eta;
+        else
+            hi = eta;
+        if( Abs(f) <= 8*eps*K*(1-psi+phi) )
+            break;
+        if( hi-lo <= 2*eps*Max(Abs(lo),Abs(hi)) )
+            break;
+
+        // Find the root of the interpolant
+        //   a + A/(D_t-x) + B/(D_{t+1}-x),
+        // which matches f and f' at x=eta
+        Real etaNew;
+        const Real deltaL = D[t]-eta;
+        if( t < K-1 )
+        {
+            const Real deltaR = D[t+1]-eta;
+            const Real a = f - psiDeriv*deltaL - phiDeriv*deltaR;
+            const Real A = psiDeriv*deltaL*deltaL;
+            const Real B = phiDeriv*deltaR*deltaR;
+            const Real b = a*(deltaL+deltaR) + A + B;
+            const Real c = deltaL*deltaR*f;
+            const Real root = Sqrt( Max(b*b-4*a*c,Real(0)) );
+            // Use the smaller root of a step^2 - b step + c = 0
+            if( b >= Real(0) )
+                etaNew = eta + 2*c/(b+root);
+            else
+                etaNew = eta + 2*c/(b-root);
+        }
+        else
+        {
+            const Real a = f - psiDeriv*deltaL;
+            const Real A = psiDeriv*deltaL*deltaL;
+            etaNew = ( a > Real(0) ? D[t] + A/a : (lo+hi)/2 );
+        }
+        if( !(etaNew > lo && etaNew < hi) )
+            etaNew = (lo+hi)/2;
+        eta = etaNew;
+    }
+}
+
+// The data for merging the SVD's of two subproblems
+template<typename Real>
+struct Merge
+{
+    // The node is n x m and split about row r
+    Int n, m, r;
+
+    // The norm used to scale the problem and the Givens rotation which
+    // combined the null vectors of the two children
+    Real scale, c, s;
+
+    // The position of each item's singular vectors within the children's
+    // singular vector matrices, as well as their (scaled) d and z values
+    vector<Int> pos;
+    vector<Real> d, z;
+
+    // The items deflated due to a small z component
+    vector<Int> deflated;
+
+    // Clusters of nearly equal d values are deflated with a Householder
+    // reflector, I - tau v v^T, which zeroes all but the last z component
+    vector<vector<Int>> clusters;
+    vector<vector<Real>> houseVecs;
+    vector<Real> houseTaus;
+    vector<Int> clusterOf;
+
+    // The secular equation for the remaining items
+    vector<Int> active;
+    vector<Real> dAct, zAct, zHat;
+    vector<Int> origins;
+    vector<Real> etas;
+
+    // The resulting singular values (in descending order) and, for each,
+    // whether it is a root of the secular equation (0), a deflated item (1),
+    // or a deflated member of a cluster (2), along with the relevant index
+    vector<Real> sigma;
+    vector<Int> kind, index;
+};
+
+template<typename Real>
+inline Real HouseEntry( const Merge<Real>& info, Int c, Int a, Int b )
+{
+    const auto& v = info.houseVecs[c];
+    return ( a==b ? Real(1) : Real(0) ) - info.houseTaus[c]*v[a]*v[b];
+}
+
+// d_i^2 - sigma_t^2 for the secular equation
+template<typename Real>
+inline Real DiffSq( const Merge<Real>& info, Int i, Int t )
+{
+    const Real dOrig = info.dAct[info.origins[t]];
+    return (info.dAct[i]-dOrig)*(info.dAct[i]+dOrig) - info.etas[t];
+}
+
+// Form the deflated secular problem from the singular values of the children,
+// the last row of the right singular vectors of the left child, and the first
+// row of the right singular vectors of the right child
+template<typename Real>
+inline void
+Deflate
+( Merge<Real>& info,
+  const Real* sLeft,
+  const Real* sRight,
+  const vector<Real>& wLeft,
+  const vector<Real>& wRight,
+  Real alpha,
+  Real beta )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::Deflate"))
+    const Int n = info.n;
+    const Int m = info.m;
+    const Int r = info.r;
+    const Int n2 = n-r-1;
+    const bool sqre = ( m > n );
+
+    // Combine the null vectors of the children with a Givens rotation
+    const Real phi1 = wLeft[r];
+    const Real phi2 = ( sqre ? wRight[n2] : Real(0) );
+    Real z0;
+    if( sqre )
+    {
+        z0 = lapack::SafeNorm( alpha*phi1, beta*phi2 );
+        if( z0 == Real(0) )
+        {
+            info.c = 1;
+            info.s = 0;
+        }
+        else
+        {
+            info.c = alpha*phi1/z0;
+            info.s = beta*phi2/z0;
+        }
+    }
+    else
+    {
+        z0 = alpha*phi1;
+        info.c = 1;
+        info.s = 0;
+    }
+
+    info.pos.resize( n );
+    info.d.resize( n );
+    info.z.resize( n );
+    info.pos[0] = r;
+    info.d[0] = 0;
+    info.z[0] = z0;
+    for( Int i=0; i<r; ++i )
+    {
+        info.pos[i+1] = i;
+        info.d[i+1] = sLeft[i];
+        info.z[i+1] = alpha*wLeft[i];
+    }
+    for( Int i=0; i<n2; ++i )
+    {
+        info.pos[r+1+i] = r+1+i;
+        info.d[r+1+i] = sRight[i];
+        info.z[r+1+i] = beta*wRight[i];
+    }
+
+    // Scale to avoid overflow
+    Real scale = Max( Abs(alpha), Abs(beta) );
+    for( Int i=1; i<n; ++i )
+        scale = Max( scale, info.d[i] );
+    if( scale == Real(0) )
+        scale = 1;
+    info.scale = scale;
+    for( Int i=0; i<n; ++i )
+    {
+        info.d[i] /= scale;
+        info.z[i] /= scale;
+    }
+
+    // Deflate the items with small z components and push the remaining d's
+    // away from d_0 = 0
+    const Real tol = 8*limits::Epsilon<Real>();
+    if( Abs(info.z[0]) < tol )
+        info.z[0] = ( info.z[0] < Real(0) ? -tol : tol );
+    info.deflated.resize( 0 );
+    vector<Int> candidates;
+    for( Int i=1; i<n; ++i )
+    {
+        if( Abs(info.z[i]) <= tol )
+        {
+            info.deflated.push_back( i );
+        }
+        else
+        {
+            if( info.d[i] < tol )
+                info.d[i] = tol;
+            candidates.push_back( i );
+        }
+    }
+    std::sort
+    ( candidates.begin(), candidates.end(),
+      [&]( Int a, Int b ) { return info.d[a] < info.d[b]; } );
+
+    // Deflate clusters of nearly equal d's by concentrating their z
+    // components into the last member with a Householder reflector
+    info.clusters.resize( 0 );
+    info.houseVecs.resize( 0 );
+    info.houseTaus.resize( 0 );
+    info.clusterOf.assign( n, -1 );
+    info.active.assign( 1, 0 );
+    const Int numCandidates = candidates.size();
+    for( Int k=0; k<numCandidates; )
+    {
+        Int kEnd = k+1;
+        while( kEnd < numCandidates &&
+               info.d[candidates[kEnd]]-info.d[candidates[kEnd-1]] <= tol )
+            ++kEnd;
+        if( kEnd-k > 1 )
+        {
+            const Int c = info.clusters.size();
+            vector<Int> members( candidates.begin()+k, candidates.begin()+kEnd );
+            const Int L = members.size();
+            vector<Real> v( L );
+            Real norm = 0;
+            for( Int j=0; j<L; ++j )
+            {
+                v[j] = info.z[members[j]];
+                norm = lapack::SafeNorm( norm, v[j] );
+            }
+            const Real gamma = -Sgn(v[L-1],false)*norm;
+            v[L-1] -= gamma;
+            Real vNormSq = 0;
+            for( Int j=0; j<L; ++j )
+                vNormSq += v[j]*v[j];
+            for( Int j=0; j<L; ++j )
+                info.clusterOf[members[j]] = c;
+            info.z[members[L-1]] = gamma;
+            info.active.push_back( members[L-1] );
+            info.clusters.push_back( members );
+            info.houseVecs.push_back( v );
+            info.houseTaus.push_back( 2/vNormSq );
+        }
+        else
+            info.active.push_back( candidates[k] );
+        k = kEnd;
+    }
+
+    const Int K = info.active.size();
+    info.dAct.resize( K );
+    info.zAct.resize( K );
+    for( Int i=0; i<K; ++i )
+    {
+        info.dAct[i] = info.d[info.active[i]];
+        info.zAct[i] = info.z[info.active[i]];
+    }
+    info.origins.assign( K, 0 );
+    info.etas.assign( K, 0 );
+    info.zHat.assign( K, 0 );
+}
+
+template<typename Real>
+inline void
+SolveSecular( Merge<Real>& info, Int tBeg, Int tEnd )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::SolveSecular"))
+    for( Int t=tBeg; t<tEnd; ++t )
+        SecularRoot( info.dAct, info.zAct, t, info.origins[t], info.etas[t] );
+}
+
+// Recompute z from the computed singular values using Lowner's formula so
+// that the singular vectors are numerically orthogonal
+template<typename Real>
+inline void
+RecomputeZ( Merge<Real>& info, Int iBeg, Int iEnd )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::RecomputeZ"))
+    const Int K = info.dAct.size();
+    const auto& d = info.dAct;
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        Real prod = -DiffSq(info,i,K-1);
+        for( Int t=0; t<i; ++t )
+            prod *= DiffSq(info,i,t)/((d[i]-d[t])*(d[i]+d[t]));
+        for( Int t=i; t<K-1; ++t )
+            prod *= DiffSq(info,i,t)/((d[i]-d[t+1])*(d[i]+d[t+1]));
+        info.zHat[i] = Sgn(info.zAct[i],false)*Sqrt(Abs(prod));
+    }
+}
+
+template<typename Real>
+inline void
+SortSingularValues( Merge<Real>& info )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::SortSingularValues"))
+    const Int n = info.n;
+    const Int K = info.dAct.size();
+    vector<Real> sigma;
+    vector<Int> kind, index;
+    sigma.reserve( n );
+    kind.reserve( n );
+    index.reserve( n );
+    for( Int t=0; t<K; ++t )
+    {
+        const Real dOrig = info.dAct[info.origins[t]];
+        const Real eta = info.etas[t];
+        const Real tau = eta/(dOrig+Sqrt(dOrig*dOrig+eta));
+        sigma.push_back( (dOrig+tau)*info.scale );
+        kind.push_back( 0 );
+        index.push_back( t );
+    }
+    for( auto b : info.deflated )
+    {
+        sigma.push_back( info.d[b]*info.scale );
+        kind.push_back( 1 );
+        index.push_back( b );
+    }
+    for( const auto& members : info.clusters )
+    {
+        const Int L = members.size();
+        for( Int j=0; j<L-1; ++j )
+        {
+            sigma.push_back( info.d[members[j]]*info.scale );
+            kind.push_back( 2 );
+            index.push_back( members[j] );
+        }
+    }
+
+    vector<Int> perm( n );
+    for( Int j=0; j<n; ++j )
+        perm[j] = j;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int a, Int b ) { return sigma[a] > sigma[b]; } );
+    info.sigma.resize( n );
+    info.kind.resize( n );
+    info.index.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        info.sigma[j] = sigma[perm[j]];
+        info.kind[j] = kind[perm[j]];
+        info.index[j] = index[perm[j]];
+    }
+}
+
+// Form column j of either the left (n x n) or right (m x m) orthogonal
+// transformation which maps the children's singular vectors to those of the
+// node. Column n of the right transformation is the null vector.
+template<typename Real>
+inline void
+FormColumn( const Merge<Real>& info, Int j, Real* q, bool left )
+{
+    const Int n = info.n;
+    const Int m = info.m;
+    const Int r = info.r;
+    const Int height = ( left ? n : m );
+    for( Int i=0; i<height; ++i )
+        q[i] = 0;
+    if( j == n )
+    {
+        q[r] = -info.s;
+        q[m-1] = info.c;
+        return;
+    }
+
+    const Int kind = info.kind[j];
+    const Int index = info.index[j];
+    if( kind == 0 )
+    {
+        // The singular vectors of M are proportional to
+        //   v_i = zHat_i / (d_i^2 - sigma^2),
+        //   u_0 = -1, u_i = d_i v_i
+        const Int K = info.dAct.size();
+        vector<Real> x( K );
+        Real xNorm = 0;
+        for( Int i=0; i<K; ++i )
+        {
+            const Real v = info.zHat[i]/DiffSq(info,i,index);
+            if( !left )
+                x[i] = v;
+            else if( i == 0 )
+                x[i] = -1;
+            else
+                x[i] = info.dAct[i]*v;
+            xNorm = lapack::SafeNorm( xNorm, x[i] );
+        }
+        for( Int i=0; i<K; ++i )
+        {
+            const Real value = x[i]/xNorm;
+            const Int a = info.active[i];
+            if( a == 0 )
+            {
+                if( left )
+                {
+                    q[r] = value;
+                }
+                else
+                {
+                    q[r] = info.c*value;
+                    if( m > n )
+                        q[m-1] = info.s*value;
+                }
+                continue;
+            }
+            const Int c = info.clusterOf[a];
+            if( c < 0 )
+            {
+                q[info.pos[a]] = value;
+                continue;
+            }
+            const auto& members = info.clusters[c];
+            const Int L = members.size();
+            for( Int k=0; k<L; ++k )
+                q[info.pos[members[k]]] = HouseEntry(info,c,k,L-1)*value;
+        }
+    }
+    else if( kind == 1 )
+    {
+        q[info.pos[index]] = 1;
+    }
+    else
+    {
+        const Int c = info.clusterOf[index];
+        const auto& members = info.clusters[c];
+        const Int L = members.size();
+        Int b = 0;
+        while( members[b] != index )
+            ++b;
+        for( Int k=0; k<L; ++k )
+            q[info.pos[members[k]]] = HouseEntry(info,c,k,b);
+    }
+}
+
+// Compute the SVD of an n x m upper bidiagonal matrix, with m in {n,n+1},
+// using the QR algorithm. U and W are assumed to be zero on entry.
+template<typename Real>
+inline void
+Leaf
+( const Real* d,
+  const Real* e,
+  bool sqre,
+  Matrix<Real>& U,
+  Matrix<Real>& W,
+  Real* s )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::Leaf"))
+    const Int n = U.Height();
+    const Int m = W.Height();
+    if( n == 0 )
+    {
+        if( m == 1 )
+            W.Set( 0, 0, Real(1) );
+        return;
+    }
+
+    // NOTE: lapack::BidiagQRAlg expects e to be of length n
+    vector<Real> dWork( d, d+n ), eWork( n, Real(0) ), cs( n ), sn( n );
+    if( sqre )
+    {
+        // Rotate B G = [L, 0], with L lower bidiagonal, using Givens
+        // rotations on columns (i,i+1) which annihilate the superdiagonal
+        for( Int i=0; i<n; ++i )
+        {
+            const Real rho = lapack::SafeNorm( dWork[i], e[i] );
+            if( rho == Real(0) )
+            {
+                cs[i] = 1;
+                sn[i] = 0;
+            }
+            else
+            {
+                cs[i] = dWork[i]/rho;
+                sn[i] = e[i]/rho;
+            }
+            dWork[i] = rho;
+            if( i < n-1 )
+            {
+                eWork[i] = sn[i]*dWork[i+1];
+                dWork[i+1] *= cs[i];
+            }
+        }
+    }
+    else
+    {
+        for( Int i=0; i<n-1; ++i )
+            eWork[i] = e[i];
+    }
+
+    Matrix<Real> VTrans;
+    Identity( U, n, n );
+    Identity( VTrans, n, n );
+    lapack::BidiagQRAlg
+    ( ( sqre ? 'L' : 'U' ), n, n, n, dWork.data(), eWork.data(),
+      VTrans.Buffer(), VTrans.LDim(), U.Buffer(), U.LDim() );
+    for( Int j=0; j<n; ++j )
+        s[j] = dWork[j];
+
+    auto WTL = W( IR(0,n), IR(0,n) );
+    Transpose( VTrans, WTL );
+    if( sqre )
+    {
+        // W := G [V, 0; 0, 1]
+        W.Set( n, n, Real(1) );
+        for( Int i=n-1; i>=0; --i )
+        {
+            for( Int j=0; j<m; ++j )
+            {
+                const Real x = W.Get(i,j);
+                const Real y = W.Get(i+1,j);
+                W.Set( i,   j, cs[i]*x - sn[i]*y );
+                W.Set( i+1, j, sn[i]*x + cs[i]*y );
+            }
+        }
+    }
+}
+
+template<typename Real>
+inline void
+MergeSubproblems
+( const Real* d,
+  const Real* e,
+  Matrix<Real>& U,
+  Matrix<Real>& W,
+  Real* s )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::MergeSubproblems"))
+    Merge<Real> info;
+    const Int n = info.n = U.Height();
+    const Int m = info.m = W.Height();
+    const Int r = info.r = n/2;
+    const Int m2 = m-r-1;
+
+    vector<Real> wLeft( r+1 ), wRight( m2 );
+    for( Int j=0; j<r+1; ++j )
+        wLeft[j] = W.Get( r, j );
+    for( Int j=0; j<m2; ++j )
+        wRight[j] = W.Get( r+1, r+1+j );
+    const Real alpha = d[r];
+    const Real beta = ( m2 > 0 ? e[r] : Real(0) );
+    Deflate( info, s, &s[r+1], wLeft, wRight, alpha, beta );
+    const Int K = info.dAct.size();
+    SolveSecular( info, 0, K );
+    RecomputeZ( info, 0, K );
+    SortSingularValues( info );
+
+    Matrix<Real> QU( n, n ), QV( m, m );
+    for( Int j=0; j<n; ++j )
+        FormColumn( info, j, QU.Buffer(0,j), true );
+    for( Int j=0; j<m; ++j )
+        FormColumn( info, j, QV.Buffer(0,j), false );
+
+    // U := diag(U1,1,U2) QU
+    Matrix<Real> UT, UB;
+    auto U1 = U( IR(0,r), IR(0,r) );
+    auto U2 = U( IR(r+1,n), IR(r+1,n) );
+    auto QUT = QU( IR(0,r), ALL );
+    auto QUB = QU( IR(r+1,n), ALL );
+    Gemm( NORMAL, NORMAL, Real(1), U1, QUT, UT );
+    Gemm( NORMAL, NORMAL, Real(1), U2, QUB, UB );
+    auto UTNew = U( IR(0,r), ALL );
+    auto uMidNew = U( IR(r), ALL );
+    auto UBNew = U( IR(r+1,n), ALL );
+    UTNew = UT;
+    uMidNew = QU( IR(r), ALL );
+    UBNew = UB;
+
+    // W := diag(W1,W2) QV
+    Matrix<Real> WT, WB;
+    auto W1 = W( IR(0,r+1), IR(0,r+1) );
+    auto W2 = W( IR(r+1,m), IR(r+1,m) );
+    auto QVT = QV( IR(0,r+1), ALL );
+    auto QVB = QV( IR(r+1,m), ALL );
+    Gemm( NORMAL, NORMAL, Real(1), W1, QVT, WT );
+    Gemm( NORMAL, NORMAL, Real(1), W2, QVB, WB );
+    auto WTNew = W( IR(0,r+1), ALL );
+    auto WBNew = W( IR(r+1,m), ALL );
+    WTNew = WT;
+    WBNew = WB;
+
+    for( Int j=0; j<n; ++j )
+        s[j] = info.sigma[j];
+}
+
+// Sequentially compute the SVD of the n x m upper bidiagonal matrix with
+// diagonal d and superdiagonal e, where U and W are zero on entry
+template<typename Real>
+inline void
+Sequential
+( const Real* d,
+  const Real* e,
+  Matrix<Real>& U,
+  Matrix<Real>& W,
+  Real* s,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::Sequential"))
+    const Int n = U.Height();
+    const Int m = W.Height();
+    if( n <= cutoff )
+    {
+        Leaf( d, e, m>n, U, W, s );
+        return;
+    }
+    const Int r = n/2;
+
+    auto U1 = U( IR(0,r), IR(0,r) );
+    auto W1 = W( IR(0,r+1), IR(0,r+1) );
+    Sequential( d, e, U1, W1, s, cutoff );
+
+    auto U2 = U( IR(r+1,n), IR(r+1,n) );
+    auto W2 = W( IR(r+1,m), IR(r+1,m) );
+    Sequential( &d[r+1], &e[r+1], U2, W2, &s[r+1], cutoff );
+
+    MergeSubproblems( d, e, U, W, s );
+}
+
+template<typename Real>
+inline void
+MergeSubproblems
+( const vector<Real>& d,
+  const vector<Real>& e,
+  Int off,
+  Int n,
+  bool sqre,
+  DistMatrix<Real>& U,
+  DistMatrix<Real>& W,
+  vector<Real>& s )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::MergeSubproblems"))
+    const Grid& g = U.Grid();
+    Merge<Real> info;
+    const Int m = n + sqre;
+    const Int r = n/2;
+    const Int m2 = m-r-1;
+    info.n = n;
+    info.m = m;
+    info.r = r;
+
+    DistMatrix<Real,STAR,STAR> wLeft_STAR_STAR( W(IR(off+r),IR(off,off+r+1)) );
+    vector<Real> wLeft( r+1 ), wRight( m2 );
+    for( Int j=0; j<r+1; ++j )
+        wLeft[j] = wLeft_STAR_STAR.GetLocal( 0, j );
+    if( m2 > 0 )
+    {
+        DistMatrix<Real,STAR,STAR>
+          wRight_STAR_STAR( W(IR(off+r+1),IR(off+r+1,off+m)) );
+        for( Int j=0; j<m2; ++j )
+            wRight[j] = wRight_STAR_STAR.GetLocal( 0, j );
+    }
+    const Real alpha = d[off+r];
+    const Real beta = ( m2 > 0 ? e[off+r] : Real(0) );
+    Deflate( info, &s[off], &s[off+r+1], wLeft, wRight, alpha, beta );
+
+    // Spread the secular equation solves and the recomputation of z over
+    // the processes
+    const Int K = info.dAct.size();
+    const Int p = g.Size();
+    const Int rank = g.VCRank();
+    const Int kBeg = (K*rank)/p;
+    const Int kEnd = (K*(rank+1))/p;
+    SolveSecular( info, kBeg, kEnd );
+    mpi::AllReduce( info.origins.data(), K, g.VCComm() );
+    mpi::AllReduce( info.etas.data(), K, g.VCComm() );
+    RecomputeZ( info, kBeg, kEnd );
+    mpi::AllReduce( info.zHat.data(), K, g.VCComm() );
+    SortSingularValues( info );
+
+    // Each process forms its columns of the transformations
+    DistMatrix<Real,STAR,VR> QU_STAR_VR( n, n, g ), QV_STAR_VR( m, m, g );
+    for( Int jLoc=0; jLoc<QU_STAR_VR.LocalWidth(); ++jLoc )
+        FormColumn
+        ( info, QU_STAR_VR.GlobalCol(jLoc), QU_STAR_VR.Buffer(0,jLoc), true );
+    for( Int jLoc=0; jLoc<QV_STAR_VR.LocalWidth(); ++jLoc )
+        FormColumn
+        ( info, QV_STAR_VR.GlobalCol(jLoc), QV_STAR_VR.Buffer(0,jLoc), false );
+    DistMatrix<Real> QU( QU_STAR_VR ), QV( QV_STAR_VR );
+
+    // U := diag(U1,1,U2) QU
+    DistMatrix<Real> UT(g), UB(g);
+    auto U1 = U( IR(off,off+r), IR(off,off+r) );
+    auto U2 = U( IR(off+r+1,off+n), IR(off+r+1,off+n) );
+    auto QUT = QU( IR(0,r), ALL );
+    auto QUB = QU( IR(r+1,n), ALL );
+    Gemm( NORMAL, NORMAL, Real(1), U1, QUT, UT );
+    Gemm( NORMAL, NORMAL, Real(1), U2, QUB, UB );
+    auto UTNew = U( IR(off,off+r), IR(off,off+n) );
+    auto uMidNew = U( IR(off+r), IR(off,off+n) );
+    auto UBNew = U( IR(off+r+1,off+n), IR(off,off+n) );
+    UTNew = UT;
+    uMidNew = QU( IR(r), ALL );
+    UBNew = UB;
+
+    // W := diag(W1,W2) QV
+    DistMatrix<Real> WT(g), WB(g);
+    auto W1 = W( IR(off,off+r+1), IR(off,off+r+1) );
+    auto W2 = W( IR(off+r+1,off+m), IR(off+r+1,off+m) );
+    auto QVT = QV( IR(0,r+1), ALL );
+    auto QVB = QV( IR(r+1,m), ALL );
+    Gemm( NORMAL, NORMAL, Real(1), W1, QVT, WT );
+    Gemm( NORMAL, NORMAL, Real(1), W2, QVB, WB );
+    auto WTNew = W( IR(off,off+r+1), IR(off,off+m) );
+    auto WBNew = W( IR(off+r+1,off+m), IR(off,off+m) );
+    WTNew = WT;
+    WBNew = WB;
+
+    for( Int j=0; j<n; ++j )
+        s[off+j] = info.sigma[j];
+}
+
+// A node of the recursion tree, which is an n x (n+sqre) upper bidiagonal
+// submatrix starting at the given diagonal offset
+struct Node
+{
+    Int off, n;
+    bool sqre;
+};
+
+inline void
+Subtrees( Int off, Int n, bool sqre, Int subtreeSize, vector<Node>& subtrees )
+{
+    if( n <= subtreeSize )
+    {
+        subtrees.push_back( Node{off,n,sqre} );
+        return;
+    }
+    const Int r = n/2;
+    Subtrees( off, r, true, subtreeSize, subtrees );
+    Subtrees( off+r+1, n-r-1, sqre, subtreeSize, subtrees );
+}
+
+template<typename Real>
+inline void
+Distributed
+( const vector<Real>& d,
+  const vector<Real>& e,
+  Int off,
+  Int n,
+  bool sqre,
+  Int subtreeSize,
+  DistMatrix<Real>& U,
+  DistMatrix<Real>& W,
+  vector<Real>& s )
+{
+    if( n <= subtreeSize )
+        return;
+    const Int r = n/2;
+    Distributed( d, e, off, r, true, subtreeSize, U, W, s );
+    Distributed( d, e, off+r+1, n-r-1, sqre, subtreeSize, U, W, s );
+    MergeSubproblems( d, e, off, n, sqre, U, W, s );
+}
+
+// Compute the SVD B = U diag(s) W^T of a k x k upper bidiagonal matrix
+template<typename Real>
+inline void
+BidiagSVD
+( const vector<Real>& d,
+  const vector<Real>& e,
+  DistMatrix<Real>& U,
+  DistMatrix<Real>& W,
+  vector<Real>& s,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("svd::bidiag_dc::BidiagSVD"))
+    const Grid& g = U.Grid();
+    const Int k = d.size();
+    const Int p = g.Size();
+    const Int rank = g.VCRank();
+    cutoff = Max( cutoff, Int(2) );
+    Zeros( U, k, k );
+    Zeros( W, k, k );
+    s.assign( k, Real(0) );
+
+    // Solve the subtrees of size roughly k/p sequentially, cycling them
+    // through the processes, and then combine the results with a single
+    // summation
+    vector<Node> subtrees;
+    const Int subtreeSize = Max( cutoff, (k+p-1)/p );
+    Subtrees( 0, k, false, subtreeSize, subtrees );
+    const Int numSubtrees = subtrees.size();
+    vector<Int> bufOffsets( numSubtrees+1, 0 );
+    for( Int q=0; q<numSubtrees; ++q )
+    {
+        const Int n = subtrees[q].n;
+        const Int m = n + subtrees[q].sqre;
+        bufOffsets[q+1] = bufOffsets[q] + n*n + m*m + n;
+    }
+    vector<Real> buf( bufOffsets[numSubtrees], Real(0) );
+    for( Int q=rank; q<numSubtrees; q+=p )
+    {
+        const Node& node = subtrees[q];
+        const Int n = node.n;
+        const Int m = n + node.sqre;
+        Real* UBuf = &buf[bufOffsets[q]];
+        Real* WBuf = &UBuf[n*n];
+        Real* sBuf = &WBuf[m*m];
+        Matrix<Real> USub, WSub;
+        USub.Attach( n, n, UBuf, Max(n,Int(1)) );
+        WSub.Attach( m, m, WBuf, Max(m,Int(1)) );
+        Sequential( &d[node.off], &e[node.off], USub, WSub, sBuf, cutoff );
+    }
+    mpi::AllReduce( buf.data(), buf.size(), g.VCComm() );
+    for( Int q=0; q<numSubtrees; ++q )
+    {
+        const Node& node = subtrees[q];
+        const Int off = node.off;
+        const Int n = node.n;
+        const Int m = n + node.sqre;
+        const Real* UBuf = &buf[bufOffsets[q]];
+        const Real* WBuf = &UBuf[n*n];
+        const Real* sBuf = &WBuf[m*m];
+
+        auto USub = U( IR(off,off+n), IR(off,off+n) );
+        for( Int jLoc=0; jLoc<USub.LocalWidth(); ++jLoc )
+        {
+            const Int j = USub.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<USub.LocalHeight(); ++iLoc )
+                USub.SetLocal( iLoc, jLoc, UBuf[USub.GlobalRow(iLoc)+j*n] );
+        }
+        auto WSub = W( IR(off,off+m), IR(off,off+m) );
+        for( Int jLoc=0; jLoc<WSub.LocalWidth(); ++jLoc )
+        {
+            const Int j = WSub.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<WSub.LocalHeight(); ++iLoc )
+                WSub.SetLocal( iLoc, jLoc, WBuf[WSub.GlobalRow(iLoc)+j*m] );
+        }
+        for( Int j=0; j<n; ++j )
+            s[off+j] = sBuf[j];
+    }
+
+    // Perform the remaining merges with distributed Gemm's
+    Distributed( d, e, 0, k, false, subtreeSize, U, W, s );
+}
+
+} // namespace bidiag_dc
+
+//----------------------------------------------------------------------------//
+// Grab the full SVD of the general matrix A, A = U diag(s) V^H, using a      //
+// distributed bidiagonal divide-and-conquer algorithm. On exit, A is         //
+// overwritten with U.                                                        //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+BidiagDC
+( DistMatrix<F>& A,
+  ElementalMatrix<Base<F>>& s,
+  DistMatrix<F>& V,
+  Int cutoff=64 )
+{
+    DEBUG_ONLY(
+      CSE cse("svd::BidiagDC");
+      if( A.Height() < A.Width() )
+          LogicError("A must be at least as tall as it is wide");
+    )
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+
+    // Bidiagonalize A
+    DistMatrix<F,STAR,STAR> tP(g), tQ(g);
+    Bidiag( A, tP, tQ );
+
+    // Grab copies of the diagonal and superdiagonal of A
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( GetRealPartOfDiagonal(A) ),
+                               e_STAR_STAR( GetRealPartOfDiagonal(A,1) );
+    vector<Real> d( n ), e( Max(n-1,Int(0)) );
+    for( Int j=0; j<n; ++j )
+        d[j] = d_STAR_STAR.GetLocal( j, 0 );
+    for( Int j=0; j<n-1; ++j )
+        e[j] = e_STAR_STAR.GetLocal( j, 0 );
+
+    // Compute the SVD of the bidiagonal matrix
+    DistMatrix<Real> UBidiag(g), VBidiag(g);
+    vector<Real> sVec;
+    bidiag_dc::BidiagSVD( d, e, UBidiag, VBidiag, sVec, cutoff );
+
+    // Make a copy of A (for the Householder vectors) and pull the singular
+    // vectors of the bidiagonal matrix into A and V
+    auto B( A );
+    auto AT = A( IR(0,n  ), ALL );
+    auto AB = A( IR(n,END), ALL );
+    Copy( UBidiag, AT );
+    Zero( AB );
+    Copy( VBidiag, V );
+
+    // Backtransform U and V
+    bidiag::ApplyQ( LEFT, NORMAL, B, tQ, A );
+    bidiag::ApplyP( LEFT, NORMAL, B, tP, V );
+
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( n, 1, g );
+    for( Int j=0; j<n; ++j )
+        s_STAR_STAR.SetLocal( j, 0, sVec[j] );
+    Copy( s_STAR_STAR, s );
+}
+
+template<typename F>
+inline void
+BidiagDC
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<Base<F>>& s,
+  ElementalMatrix<F>& VPre,
+  Int cutoff=64 )
+{
+    DEBUG_ONLY(CSE cse("svd::BidiagDC"))
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+    BidiagDC( A, s, V, cutoff );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_BIDIAGDC_HPP
@@ -11,6 +11,7 @@
 #define EL_SVD_CHAN_HPP
 
 #include "./GolubReinsch.hpp"
+#include "./BidiagDC.hpp"
 
 namespace El {
 namespace svd {
@@ -21,7 +22,9 @@ ChanUpper
 ( DistMatrix<F>& A,
   ElementalMatrix<Base<F>>& s, 
   DistMatrix<F>& V,
-  double heightRatio=1.5 )
+  double heightRatio=1.5,
+  bool distDC=false,
+  Int dcCutoff=64 )
 {
     DEBUG_ONLY(
       CSE cse("svd::ChanUpper");
@@ -38,7 +41,10 @@ ChanUpper
     {
         DistMatrix<F> R(g);
         qr::Explicit( A, R );
-        svd::GolubReinsch( R, s, V );
+        if( distDC )
+            svd::BidiagDC( R, s, V, dcCutoff );
+        else
+            svd::GolubReinsch( R, s, V );
         // Unfortunately, extra memory is used in forming A := A R,
         // where A has been overwritten with the Q from the QR factorization
         // of the original state of A, and R has been overwritten with the U 
@@ -48,6 +54,10 @@ ChanUpper
         auto ACopy( A );
         Gemm( NORMAL, NORMAL, F(1), ACopy, R, F(0), A );
     }
+    else if( distDC )
+    {
+        svd::BidiagDC( A, s, V, dcCutoff );
+    }
     else
     {
         svd::GolubReinsch( A, s, V );
@@ -60,14 +70,16 @@ ChanUpper
 ( ElementalMatrix<F>& APre,
   ElementalMatrix<Base<F>>& s, 
   ElementalMatrix<F>& VPre,
-  double heightRatio=1.5 )
+  double heightRatio=1.5,
+  bool distDC=false,
+  Int dcCutoff=64 )
 {
     DEBUG_ONLY(CSE cse("svd::ChanUpper"))
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,MC,MR> VProx( VPre );
     auto& A = AProx.Get();
     auto& V = VProx.Get();
-    ChanUpper( A, s, V, heightRatio );
+    ChanUpper( A, s, V, heightRatio, distDC, dcCutoff );
 }
 
 template<typename F>
@@ -118,7 +130,9 @@ Chan
 ( DistMatrix<F>& A,
   ElementalMatrix<Base<F>>& s, 
   DistMatrix<F>& V,
-  double heightRatio=1.5 )
+  double heightRatio=1.5,
+  bool distDC=false,
+  Int dcCutoff=64 )
 {
     DEBUG_ONLY(
       CSE cse("svd::Chan");
@@ -136,14 +150,14 @@ Chan
     //       with a QR decomposition of tall-skinny matrices.
     if( A.Height() >= A.Width() )
     {
-        svd::ChanUpper( A, s, V, heightRatio );
+        svd::ChanUpper( A, s, V, heightRatio, distDC, dcCutoff );
     }
     else
     {
         // Explicit formation of the Q from an LQ factorization is not yet
         // optimized
         Adjoint( A, V );
-        svd::ChanUpper( V, s, A, heightRatio );
+        svd::ChanUpper( V, s, A, heightRatio, distDC, dcCutoff );
     }
 
     // Rescale the singular values if necessary
@@ -157,14 +171,16 @@ Chan
 ( ElementalMatrix<F>& APre,
   ElementalMatrix<Base<F>>& s, 
   ElementalMatrix<F>& VPre,
-  double heightRatio=1.5 )
+  double heightRatio=1.5,
+  bool distDC=false,
+  Int dcCutoff=64 )
 {
     DEBUG_ONLY(CSE cse("svd::Chan"))
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,MC,MR> VProx( VPre );
     auto& A = AProx.Get();
     auto& V = VProx.Get();
-    Chan( A, s, V, heightRatio );
+    Chan( A, s, V, heightRatio, distDC, dcCutoff );
 }
 
 //----------------------------------------------------------------------------//
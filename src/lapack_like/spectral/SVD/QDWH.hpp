@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+// Based upon Nakatsukasa and Higham's "Stable and efficient spectral divide 
+// and conquer algorithms for the symmetric eigenvalue decomposition and the 
+// SVD", where the polar decomposition A = Q H is followed by the QDWH-based
+// eigenvalue decomposition H = V Sigma V^H, so that A = (Q V) Sigma V^H.
+
+namespace El {
+namespace svd {
+
+template<typename F>
+inline void
+QDWH
+( Matrix<F>& A,
+  Matrix<Base<F>>& s,
+  Matrix<F>& V,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svd::QDWH"))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+    {
+        // A^H = U' Sigma V'^H implies A = V' Sigma U'^H
+        Matrix<F> AAdj, U;
+        Adjoint( A, AAdj );
+        QDWH( AAdj, s, U, ctrl );
+        A = U;
+        V = AAdj;
+        return;
+    }
+
+    // A := Q, where A = Q H
+    Matrix<F> ACopy( A );
+    PolarCtrl polarCtrl( ctrl.qdwhCtrl.polarCtrl );
+    polarCtrl.qdwh = true;
+    Polar( A, polarCtrl );
+
+    // H := Q^H A
+    Matrix<F> H;
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), H );
+
+    // H = V Sigma V^H
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.useSDC = true;
+    eigCtrl.sdcCtrl = ctrl.qdwhCtrl;
+    eigCtrl.sdcCtrl.qdwh = true;
+    HermitianEig
+    ( LOWER, H, s, V, DESCENDING, HermitianEigSubset<Real>(), eigCtrl );
+
+    // U := Q V
+    ACopy = A;
+    Gemm( NORMAL, NORMAL, F(1), ACopy, V, F(0), A );
+
+    // Rounding errors can lead to slightly negative eigenvalues of H 
+    Matrix<Real> sgn;
+    EntrywiseMap
+    ( s, sgn, function<Real(Real)>
+      ( []( Real sigma ) { return sigma < Real(0) ? Real(-1) : Real(1); } ) );
+    DiagonalScale( RIGHT, NORMAL, sgn, A );
+    EntrywiseMap( s, function<Real(Real)>( []( Real sigma ) 
+      { return Abs(sigma); } ) );
+
+    // Taking absolute values can break the descending order, so re-sort the
+    // singular values and apply the same (deterministic) permutation to the
+    // columns of both U and V
+    Matrix<Real> sCopy( s );
+    herm_eig::Sort( s, A, DESCENDING );
+    herm_eig::Sort( sCopy, V, DESCENDING );
+}
+
+template<typename F>
+inline void
+QDWH
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<Base<F>>& s,
+  ElementalMatrix<F>& VPre,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("svd::QDWH");
+      AssertSameGrids( APre, s, VPre );
+    )
+    typedef Base<F> Real;
+    const Grid& g = APre.Grid();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+    {
+        // A^H = U' Sigma V'^H implies A = V' Sigma U'^H
+        DistMatrix<F> AAdj(g), U(g);
+        Adjoint( APre, AAdj );
+        QDWH( AAdj, s, U, ctrl );
+        Copy( U, APre );
+        Copy( AAdj, VPre );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+
+    // A := Q, where A = Q H
+    DistMatrix<F> ACopy( A );
+    PolarCtrl polarCtrl( ctrl.qdwhCtrl.polarCtrl );
+    polarCtrl.qdwh = true;
+    Polar( A, polarCtrl );
+
+    // H := Q^H A
+    DistMatrix<F> H(g);
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), H );
+
+    // H = V Sigma V^H
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.useSDC = true;
+    eigCtrl.sdcCtrl = ctrl.qdwhCtrl;
+    eigCtrl.sdcCtrl.qdwh = true;
+    HermitianEig
+    ( LOWER, H, s, V, DESCENDING, HermitianEigSubset<Real>(), eigCtrl );
+
+    // U := Q V
+    ACopy = A;
+    Gemm( NORMAL, NORMAL, F(1), ACopy, V, F(0), A );
+
+    // Rounding errors can lead to slightly negative eigenvalues of H 
+    DistMatrix<Real,VR,STAR> sgn(g);
+    EntrywiseMap
+    ( s, sgn, function<Real(Real)>
+      ( []( Real sigma ) { return sigma < Real(0) ? Real(-1) : Real(1); } ) );
+    DiagonalScale( RIGHT, NORMAL, sgn, A );
+    EntrywiseMap( s, function<Real(Real)>( []( Real sigma ) 
+      { return Abs(sigma); } ) );
+
+    // Taking absolute values can break the descending order, so re-sort the
+    // singular values and apply the same (deterministic) permutation to the
+    // columns of both U and V
+    DistMatrix<Real,VR,STAR> sCopy( s );
+    herm_eig::Sort( s, A, DESCENDING );
+    herm_eig::Sort( sCopy, V, DESCENDING );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
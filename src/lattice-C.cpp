@@ -28,6 +28,10 @@ ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl )
     ctrl->time = false;
     ctrl->jumpstart = false;
     ctrl->startCol = 0;
+    ctrl->blocksize = 32;
+    ctrl->blockedCutoff = 200;
+    ctrl->kernelBlocksize = 32;
+    ctrl->kernelBlockedCutoff = 200;
     return EL_SUCCESS;
 }
 
@@ -47,6 +51,10 @@ ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl )
     ctrl->time = false;
     ctrl->jumpstart = false;
     ctrl->startCol = 0;
+    ctrl->blocksize = 32;
+    ctrl->blockedCutoff = 200;
+    ctrl->kernelBlocksize = 32;
+    ctrl->kernelBlockedCutoff = 200;
     return EL_SUCCESS;
 }
 
@@ -38,6 +38,22 @@ Int AlgebraicRelationSearch
     return info.nullity;
 }
 
+template<typename Real>
+Int AlgebraicRelationSearch
+( Real alpha,
+  Int n,
+  Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AlgebraicRelationSearch"))
+    Matrix<Real> x;
+    Zeros( x, n, 1 );
+    for( Int j=0; j<n; ++j )
+        x.Set( j, 0, Pow(alpha,Real(j)) );
+    auto info = PSLQ( x, U, ctrl );
+    return info.nullity;
+}
+
 #define PROTO(F) \
   template Int AlgebraicRelationSearch \
   ( F alpha, \
@@ -47,6 +63,14 @@ Int AlgebraicRelationSearch
     Matrix<F>& U, \
     const LLLCtrl<Base<F>>& ctrl );
 
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template Int AlgebraicRelationSearch \
+  ( Real alpha, \
+    Int n, \
+    Matrix<Real>& U, \
+    const PSLQCtrl<Real>& ctrl );
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
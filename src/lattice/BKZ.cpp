@@ -0,0 +1,442 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The block reduction implemented here is the classical BKZ of
+//
+//   Claus-Peter Schnorr and M. Euchner,
+//   "Lattice Basis Reduction: Improved Practical Algorithms and Solving
+//    Subset Sum Problems", Mathematical Programming, 1994,
+//
+// augmented with the pruning, radius, and early-abort modifications from
+//
+//   Yuanmi Chen and Phong Q. Nguyen,
+//   "BKZ 2.0: Better Lattice Security Estimates", Asiacrypt 2011.
+//
+// The Householder QR factorization maintained by LLLWithQ is reused so that
+// each insertion only requires the columns from the start of the block
+// onward to be revisited.
+//
+// NOTE: The blocks are only preprocessed with LLL rather than recursively
+//       with a smaller-blocksize BKZ, so this is not a full BKZ 2.0.
+
+namespace El {
+
+namespace bkz {
+
+// Fill 'coeffs' with the squared-norm pruning coefficients for a block of
+// size k. The last coefficient is always one so that any returned vector
+// satisfies the full radius bound.
+template<typename Real>
+void PruningCoefficients
+( Int k, const BKZCtrl<Real>& ctrl, Matrix<Real>& coeffs )
+{
+    DEBUG_ONLY(CSE cse("bkz::PruningCoefficients"))
+    Zeros( coeffs, k, 1 );
+    const Int numCoeffs = ctrl.pruningCoeffs.size();
+    for( Int i=0; i<k; ++i )
+    {
+        if( !ctrl.prune )
+            coeffs.Set( i, 0, Real(1) );
+        else if( numCoeffs == 0 )
+            coeffs.Set( i, 0, Real(i+1)/Real(k) );
+        else
+        {
+            const Int iSub = Min( ((i+1)*numCoeffs)/k, numCoeffs ) - 1;
+            coeffs.Set( i, 0, Min(ctrl.pruningCoeffs[Max(iSub,0)],Real(1)) );
+        }
+    }
+    coeffs.Set( k-1, 0, Real(1) );
+}
+
+// Search for the shortest vector (with a norm strictly less than 'radius')
+// in the lattice generated by the columns of the upper-triangular matrix R
+// which lies within the pruned region. If such a vector was found, its
+// coordinates are returned in 'v' and its norm is returned; otherwise,
+// a value of at least 'radius' is returned.
+template<typename Real>
+Real BlockEnumeration
+( const Matrix<Real>& R,
+        Real radius,
+  const Matrix<Real>& coeffs,
+        Int numTrials,
+        Matrix<Real>& v )
+{
+    DEBUG_ONLY(CSE cse("bkz::BlockEnumeration"))
+    const Int k = R.Width();
+
+    // The (extreme) pruning of later trials is rerandomized by running LLL
+    // on a random unimodular transformation of the block, so the coordinates
+    // must be mapped back through said transformation
+    LLLCtrl<Real> randCtrl;
+    randCtrl.jumpstart = true;
+    randCtrl.startCol = 0;
+    Matrix<Real> BRand, RRand, U, UInv, vCand;
+
+    Real bestNorm = radius;
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        if( trial > 0 )
+        {
+            BRand = R;
+            Identity( U, k, k );
+            Identity( UInv, k, k );
+            for( Int j=0; j<k; ++j )
+            {
+                const Int c = SampleUniform<Int>( 0, k );
+                const Int scale = SampleUniform<Int>( -2, 3 );
+                if( c == j || scale == 0 )
+                    continue;
+                auto bj = BRand( ALL, IR(j) );
+                auto bc = BRand( ALL, IR(c) );
+                Axpy( Real(scale), bc, bj );
+                auto uj = U( ALL, IR(j) );
+                auto uc = U( ALL, IR(c) );
+                Axpy( Real(scale), uc, uj );
+                // The inverse of the column update is the row update
+                // UInv(c,:) -= scale UInv(j,:)
+                auto uInvj = UInv( IR(j), ALL );
+                auto uInvc = UInv( IR(c), ALL );
+                Axpy( -Real(scale), uInvj, uInvc );
+            }
+            LLL( BRand, U, UInv, RRand, randCtrl );
+        }
+        const Matrix<Real>& REnum = ( trial > 0 ? RRand : R );
+
+        // The radius is tightened within the enumeration
+        const Real result =
+          svp::ParallelEnumeration( REnum, coeffs, bestNorm, vCand );
+        if( result < bestNorm )
+        {
+            bestNorm = result;
+            if( trial > 0 )
+                Gemv( NORMAL, Real(1), U, vCand, v );
+            else
+                v = vCand;
+        }
+        if( bestNorm < radius )
+            break;
+    }
+    return bestNorm;
+}
+
+// Since the entries of R are only approximations to begin with, drop to
+// double-precision for the enumeration when the block is small enough
+template<typename Real>
+Real AdaptiveBlockEnumeration
+( const Matrix<Real>& R,
+        Real radius,
+  const Matrix<Real>& coeffs,
+        Int numTrials,
+        Matrix<Real>& v )
+{
+    DEBUG_ONLY(CSE cse("bkz::AdaptiveBlockEnumeration"))
+    const Real ROneNorm = OneNorm( R );
+    const Real fudge = 1.5; // TODO: Make tunable
+    const Int neededPrec = Int(Ceil(Log2(ROneNorm)*fudge));
+    if( PrecisionIsGreater<Real,double>::value && neededPrec <= 53 )
+    {
+        Matrix<double> RLower, coeffsLower, vLower;
+        Copy( R, RLower );
+        Copy( coeffs, coeffsLower );
+        const double result =
+          BlockEnumeration
+          ( RLower, double(radius), coeffsLower, numTrials, vLower );
+        if( result < double(radius) )
+            Copy( vLower, v );
+        return Real(result);
+    }
+    return BlockEnumeration( R, radius, coeffs, numTrials, v );
+}
+
+// Insert the lattice vector B(:,j:j+k-1) v at position j and update the
+// LLL reduction (and the Householder QR factorization) from column j onward
+template<typename F>
+Int Insert
+( Int j,
+  const Matrix<F>& v,
+        Matrix<F>& B,
+        Matrix<F>& QR,
+        Matrix<F>& t,
+        Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("bkz::Insert"))
+    typedef Base<F> Real;
+    const Int k = v.Height();
+
+    LLLCtrl<Real> localCtrl( ctrl );
+    localCtrl.presort = false;
+    localCtrl.jumpstart = ( j > 0 );
+    localCtrl.startCol = j;
+
+    // If some coordinate of v is +-1, then replacing the corresponding
+    // basis vector with the new vector is a unimodular transformation, and
+    // the first j columns of the QR factorization remain valid
+    Int l = -1;
+    for( Int i=k-1; i>=0; --i )
+    {
+        if( Abs(v.Get(i,0)) == Real(1) )
+        {
+            l = i;
+            break;
+        }
+    }
+    if( l >= 0 )
+    {
+        Matrix<F> bNew;
+        Zeros( bNew, B.Height(), 1 );
+        Gemv( NORMAL, F(1), B(ALL,IR(j,j+k)), v, F(0), bNew );
+        auto bl = B( ALL, IR(j+l) );
+        bl = bNew;
+        DeepColSwap( B, j, j+l );
+        auto info = LLLWithQ( B, QR, t, d, localCtrl );
+        return info.numSwaps;
+    }
+
+    // Otherwise, run MLLL on the projections of the k+1 generators
+    // [bNew, B(:,j:j+k-1)] onto the orthogonal complement of the first j
+    // columns, which are the columns of RBlock [v, I]. Since RBlock is
+    // nonsingular, the generator which MLLL reduces to zero has zero
+    // coordinates, and the remaining k columns of [v, I] U form a unimodular
+    // transformation of the block. Only the (k+1) x (k+1) transformation is
+    // computed this way, and the first j columns of the QR factorization
+    // remain valid.
+    Matrix<F> RBlock, C, BLoc, U, UInv, RLoc;
+    RBlock = QR( IR(j,j+k), IR(j,j+k) );
+    MakeTrapezoidal( UPPER, RBlock );
+    Zeros( C, k, k+1 );
+    auto cL = C( ALL, IR(0) );
+    auto CR = C( ALL, IR(1,k+1) );
+    cL = v;
+    FillDiagonal( CR, F(1) );
+    Zeros( BLoc, k, k+1 );
+    Gemm( NORMAL, NORMAL, F(1), RBlock, C, F(0), BLoc );
+
+    LLLCtrl<Real> blockCtrl( ctrl );
+    blockCtrl.presort = false;
+    blockCtrl.jumpstart = false;
+    blockCtrl.startCol = 0;
+    auto blockInfo = LLL( BLoc, U, UInv, RLoc, blockCtrl );
+    if( blockInfo.nullity != 1 )
+        RuntimeError("Inserted vector was not detected as linearly dependent");
+
+    Matrix<F> W, BBlock;
+    Zeros( W, k, k );
+    Gemm( NORMAL, NORMAL, F(1), C, U(ALL,IR(1,k+1)), F(0), W );
+    BBlock = B( ALL, IR(j,j+k) );
+    auto BBlockNew = B( ALL, IR(j,j+k) );
+    Gemm( NORMAL, NORMAL, F(1), BBlock, W, F(0), BBlockNew );
+
+    auto info = LLLWithQ( B, QR, t, d, localCtrl );
+    return blockInfo.numSwaps + info.numSwaps;
+}
+
+template<typename Real>
+Real LogVolume( const Matrix<Real>& QR, Int j, Int k )
+{
+    Real logVol = 0;
+    for( Int i=j; i<j+k; ++i )
+    {
+        const Real rho_i_i = QR.Get(i,i);
+        if( rho_i_i > Real(0) )
+            logVol += Log(rho_i_i);
+    }
+    return logVol;
+}
+
+// Return the achieved (non-weak) delta and eta reduction properties
+template<typename Real>
+void Achieved
+( const Matrix<Real>& R, Real zeroTol, Real& delta, Real& eta )
+{
+    DEBUG_ONLY(CSE cse("bkz::Achieved"))
+    const Int n = R.Width();
+    delta = limits::Max<Real>();
+    eta = 0;
+    for( Int i=0; i<n-1; ++i )
+    {
+        const Real rho_i_i = R.Get(i,i);
+        if( Abs(rho_i_i) <= zeroTol )
+            continue;
+        const Real rho_i_ip1 = R.Get(i,i+1);
+        const Real rho_ip1_ip1 = R.Get(i+1,i+1);
+        delta =
+          Min
+          (delta,
+           (rho_ip1_ip1*rho_ip1_ip1+rho_i_ip1*rho_i_ip1)/(rho_i_i*rho_i_i));
+        for( Int j=i+1; j<n; ++j )
+            eta = Max(eta,Abs(R.Get(i,j)/rho_i_i));
+    }
+}
+
+} // namespace bkz
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("BKZ"))
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    if( m < n )
+        LogicError("BKZ currently assumes that height(B) >= width(B)");
+    if( ctrl.blocksize < 2 )
+        LogicError("The BKZ blocksize should be at least two");
+    if( ctrl.numTrials < 1 )
+        LogicError("At least one enumeration trial is required per block");
+    Timer timer, enumTimer, insertTimer;
+
+    // Start with a (jumpstart-compatible) LLL reduction
+    // =================================================
+    LLLCtrl<Real> lllCtrl( ctrl.lllCtrl );
+    lllCtrl.jumpstart = false;
+    lllCtrl.startCol = 0;
+    Matrix<F> QR, t;
+    Matrix<Real> d;
+    if( ctrl.time )
+        timer.Start();
+    auto lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
+    if( ctrl.time )
+        Output("  Initial LLL: ",timer.Stop()," seconds");
+    lllCtrl.presort = false;
+
+    BKZInfo<Real> info;
+    info.numSwaps = lllInfo.numSwaps;
+    info.numTours = 0;
+    info.numInsertions = 0;
+
+    // Precompute the pruning coefficients for each block size
+    const Int blocksize = Min(ctrl.blocksize,n);
+    vector<Matrix<Real>> pruningCoeffs(blocksize+1);
+    for( Int k=2; k<=blocksize; ++k )
+        bkz::PruningCoefficients( k, ctrl, pruningCoeffs[k] );
+
+    const Real sqrtDelta = Sqrt(lllCtrl.delta);
+    Matrix<F> RBlock, v;
+    while( ctrl.maxTours <= 0 || info.numTours < ctrl.maxTours )
+    {
+        if( ctrl.time )
+        {
+            timer.Start();
+            enumTimer.Reset();
+            insertTimer.Reset();
+        }
+
+        // The zero columns (if any) are kept at the front by MLLL
+        const Int start = lllInfo.nullity;
+        Int numTourInsertions = 0;
+        for( Int j=start; j<n-1; ++j )
+        {
+            const Int k = Min(blocksize,n-j);
+            RBlock = QR( IR(j,j+k), IR(j,j+k) );
+            MakeTrapezoidal( UPPER, RBlock );
+
+            Real radius = sqrtDelta*RBlock.Get(0,0);
+            if( ctrl.ghFactor > Real(0) )
+            {
+                const Real GH =
+                  LatticeGaussianHeuristic( k, bkz::LogVolume(QR,j,k) );
+                radius = Min( radius, Sqrt(ctrl.ghFactor)*GH );
+            }
+
+            if( ctrl.time )
+                enumTimer.Start();
+            const Real result =
+              bkz::AdaptiveBlockEnumeration
+              ( RBlock, radius, pruningCoeffs[k], ctrl.numTrials, v );
+            if( ctrl.time )
+                enumTimer.Stop();
+
+            if( result < radius )
+            {
+                if( ctrl.time )
+                    insertTimer.Start();
+                info.numSwaps += bkz::Insert( j, v, B, QR, t, d, lllCtrl );
+                if( ctrl.time )
+                    insertTimer.Stop();
+                ++numTourInsertions;
+            }
+        }
+        ++info.numTours;
+        info.numInsertions += numTourInsertions;
+
+        const Real logVol = bkz::LogVolume( QR, start, n-start );
+        const Real GH = LatticeGaussianHeuristic( n-start, logVol );
+        const Real b0Norm = FrobeniusNorm( B(ALL,IR(start)) );
+        if( ctrl.progress )
+            Output
+            ("BKZ tour ",info.numTours,": ",numTourInsertions,
+             " insertions, || b_0 ||_2 = ",b0Norm,", GH(L) = ",GH,
+             ", || b_0 ||_2 / GH(L) = ",b0Norm/GH);
+        if( ctrl.time )
+        {
+            Output("  Tour time:        ",timer.Stop()," seconds");
+            Output("  Enumeration time: ",enumTimer.Total()," seconds");
+            Output("  Insertion time:   ",insertTimer.Total()," seconds");
+        }
+
+        if( numTourInsertions == 0 )
+            break;
+        if( ctrl.targetRatio > Real(0) && b0Norm <= ctrl.targetRatio*GH )
+            break;
+    }
+
+    R = QR;
+    MakeTrapezoidal( UPPER, R );
+
+    bkz::Achieved( R, lllCtrl.zeroTol, info.delta, info.eta );
+    info.nullity = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( Abs(R.Get(j,j)) <= lllCtrl.zeroTol )
+            ++info.nullity;
+        else
+            break;
+    }
+    info.rank = n-info.nullity;
+    info.logVol = bkz::LogVolume( R, 0, n );
+    return info;
+}
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( Matrix<F>& B,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("BKZ"))
+    Matrix<F> R;
+    return BKZ( B, R, ctrl );
+}
+
+#define PROTO(F) \
+  template BKZInfo<Base<F>> BKZ \
+  ( Matrix<F>& B, \
+    const BKZCtrl<Base<F>>& ctrl ); \
+  template BKZInfo<Base<F>> BKZ \
+  ( Matrix<F>& B, \
+    Matrix<F>& R, \
+    const BKZCtrl<Base<F>>& ctrl ); \
+  template F bkz::BlockEnumeration \
+  ( const Matrix<F>& R, \
+          F radius, \
+    const Matrix<F>& coeffs, \
+          Int numTrials, \
+          Matrix<F>& v );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
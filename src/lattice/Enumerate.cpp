@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./Enumerate/Parallel.hpp"
 
 namespace El {
 
@@ -39,7 +40,7 @@ Real Helper
     if( m < n )
         LogicError("Expected height(R) >= width(R)");
 
-    const bool progress = true;
+    const bool progress = false;
     const bool track = false;
 
     Matrix<Real> S;
@@ -245,74 +246,108 @@ Base<F> ShortVectorEnumeration
         for( Int j=0; j<n; ++j )
             upperBounds.Set( j, 0, Sqrt(Real(n)/Real(j+1))*normUpperBound );
 
-        // Since we will manually build up a (weakly) pseudorandom
-        // unimodular matrix so that the probabalistic enumerations traverse
-        // different paths, we must keep track of the unimodular matrix so that
-        //  'v' can be returned relative to the original lattice basis
-        auto BNew( B );
-        auto RNew( R );
-        Matrix<F> U, UInv;
-        Identity( U, n, n );
-        Identity( UInv, n, n );
-
-        Int numTrials = 10*n; // TODO: Make this tunable; probability is 1/n
-        for( Int trial=0; trial<numTrials; ++trial )
+        // Every trial after the first enumerates the LLL reduction of an
+        // independent (weakly) pseudorandom unimodular transformation of B,
+        // so that the probabalistic enumerations traverse different paths.
+        // The transformations are drawn up front (the random number
+        // generator is not thread-safe) and batches of trials are run
+        // concurrently. Since the call stack maintained by CSE is not
+        // thread-safe, the trials are run serially in non-release builds.
+        const Int numTrials = 10*n; // TODO: Make this tunable; prob. is 1/n
+        const Int numCombines = n;
+        vector<Int> combineCols(numTrials*numCombines),
+                    combineScales(numTrials*numCombines);
+        for( Int k=0; k<numTrials*numCombines; ++k )
+        {
+            combineCols[k] = SampleUniform( 0, n );
+            combineScales[k] = SampleUniform( -5, 5 );
+        }
+
+        Int numThreads = 1;
+#if defined(EL_HYBRID) && defined(EL_RELEASE)
+        numThreads = omp_get_max_threads();
+#endif
+        for( Int batchBeg=0; batchBeg<numTrials; batchBeg+=numThreads )
         {
+            const Int batchEnd = Min(batchBeg+numThreads,numTrials);
             if( progress )
-                Output("Starting trial ",trial);
+                Output("Starting trials ",batchBeg," through ",batchEnd-1);
             if( time )
                 timer.Start();
-            Real result = svp::BoundedEnumeration( RNew, upperBounds, v );
-            if( time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
-            if( result < normUpperBound )
+            vector<Real> results(batchEnd-batchBeg);
+            vector<Matrix<F>> vTrials(batchEnd-batchBeg);
+            vector<std::exception_ptr> errors(batchEnd-batchBeg);
+#ifdef EL_RELEASE
+            EL_PARALLEL_FOR
+#endif
+            for( Int trial=batchBeg; trial<batchEnd; ++trial )
             {
-                if( trial > 0 )
+                Real& result = results[trial-batchBeg];
+                Matrix<F>& vTrial = vTrials[trial-batchBeg];
+                result = 2*normUpperBound+1;
+                try
                 {
-                    auto vCopy( v );
-                    Gemv( NORMAL, F(1), U, vCopy, F(0), v );
+                    if( trial == 0 )
+                    {
+                        result =
+                          svp::BoundedEnumeration( R, upperBounds, vTrial );
+                        continue;
+                    }
+
+                    auto BNew( B );
+                    Matrix<F> RNew, U, UInv, vNew;
+                    Identity( U, n, n );
+                    Identity( UInv, n, n );
+                    for( Int j=0; j<numCombines; ++j )
+                    {
+                        const Int c = combineCols[trial*numCombines+j];
+                        const Int scale = combineScales[trial*numCombines+j];
+                        if( c == j || scale == 0 )
+                            continue; // if scale=-1, we could have singularity
+
+                        auto bj = BNew( ALL, j );
+                        auto bc = BNew( ALL, c );
+                        Axpy( scale, bc, bj );
+
+                        auto uj = U(ALL,j);
+                        auto uc = U(ALL,c);
+                        Axpy( scale, uc, uj );
+                    }
+
+                    // TODO: Provide a way to avoid computing U
+                    // NOTE: The LLL does not need to be particularly powerful
+                    LLLCtrl<Real> ctrl;
+                    ctrl.jumpstart = true;
+                    ctrl.startCol = 0;
+                    LLL( BNew, U, UInv, RNew, ctrl );
+
+                    result = svp::BoundedEnumeration( RNew, upperBounds, vNew );
+                    if( result < normUpperBound )
+                    {
+                        Zeros( vTrial, n, 1 );
+                        Gemv( NORMAL, F(1), U, vNew, F(0), vTrial );
+                    }
+                }
+                catch( ... )
+                {
+                    errors[trial-batchBeg] = std::current_exception();
                 }
-                return result;
             }
-            else
+            // Exceptions cannot propagate out of a parallel region
+            for( const auto& error : errors )
+                if( error )
+                    std::rethrow_exception( error );
+            if( time )
+                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
+
+            // Return the first successful trial of the batch
+            for( Int trial=batchBeg; trial<batchEnd; ++trial )
             {
-                // Apply a small random unimodular transformation to B
-                const Int numCombines = n;
-                for( Int j=0; j<numCombines; ++j )
+                if( results[trial-batchBeg] < normUpperBound )
                 {
-                    const Int c = SampleUniform( 0, n );
-                    const Int scale = SampleUniform( -5, 5 );
-                    if( c == j || scale == 0 )
-                        continue; // if scale=-1, we could have singularity
-                    if( progress )
-                        Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
-
-                    auto bj = BNew( ALL, j );
-                    auto bc = BNew( ALL, c );
-                    Axpy( scale, bc, bj );
-
-                    auto uj = U(ALL,j);
-                    auto uc = U(ALL,c);
-                    Axpy( scale, uc, uj );
- 
-                    auto uinvj = UInv(j,ALL);
-                    auto uinvc = UInv(c,ALL);
-                    Axpy( -scale, uj, uc );
+                    v = vTrials[trial-batchBeg];
+                    return results[trial-batchBeg];
                 }
-
-                // TODO: Extend LLLCtrl to support accumulating into the
-                //       unimodular matrices (e.g., bool accumulateUnimodular).
-                //       Until then, we explicitly accumulate here.
-                // TODO: Provide a way to avoid computing U 
-                // NOTE: The LLL does not need to be particularly powerful
-                LLLCtrl<Real> ctrl;
-                ctrl.jumpstart = true; 
-                ctrl.startCol = 0;
-                if( time )
-                    timer.Start();
-                LLL( BNew, U, UInv, RNew, ctrl );
-                if( time )
-                    Output("  Fix-up LLL: ",timer.Stop()," seconds");
             }
         }
         return 2*normUpperBound+1; // return a value above the upper bound
@@ -417,6 +452,25 @@ Base<F> ShortestVectorEnumeration
     bool satisfiedBound = ( b0Norm <= normUpperBound ? true : false );
     Real targetNorm = Min(normUpperBound,b0Norm);
 
+    if( !probabalistic )
+    {
+        // A single enumeration which tightens its radius as shorter vectors
+        // are found (and shares the radius between threads) suffices
+        Matrix<Real> noPruning;
+        Matrix<F> vCand;
+        const Real result =
+          svp::ParallelEnumeration( R, noPruning, targetNorm, vCand );
+        if( result < targetNorm )
+        {
+            v = vCand;
+            return result;
+        }
+        else if( satisfiedBound )
+            return targetNorm;
+        else
+            RuntimeError("Could not satisfy (inclusive) norm upper bound");
+    }
+
     while( true )
     {
         Matrix<F> vCand;
@@ -440,6 +494,19 @@ Base<F> ShortestVectorEnumeration
   ( const Matrix<F>& R, \
     const Matrix<Base<F>>& u, \
           Matrix<F>& v ); \
+  template Base<F> svp::ParallelEnumeration \
+  ( const Matrix<F>& R, \
+    const Matrix<Base<F>>& coeffs, \
+          Base<F> normUpperBound, \
+          Matrix<F>& v, \
+    const svp::ParallelEnumCtrl& ctrl ); \
+  template Base<F> svp::ParallelEnumeration \
+  ( const Matrix<F>& R, \
+    const Matrix<Base<F>>& coeffs, \
+          Base<F> normUpperBound, \
+          Matrix<F>& v, \
+          mpi::Comm comm, \
+    const svp::ParallelEnumCtrl& ctrl ); \
   template Base<F> ShortVectorEnumeration \
   ( const Matrix<F>& B, \
     const Matrix<F>& R, \
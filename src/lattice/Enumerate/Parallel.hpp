@@ -0,0 +1,435 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_ENUMERATE_PARALLEL_HPP
+#define EL_LATTICE_ENUMERATE_PARALLEL_HPP
+
+#include <atomic>
+
+namespace El {
+namespace svp {
+namespace parallel_enum {
+
+// A depth-first Schnorr-Euchner enumerator over the subtree lying beneath
+// a fixed set of trailing coordinates. The partial sums of the centers are
+// cached in the manner of fplll (the 'hi' array tracks the highest
+// coordinate which has changed since each row of partial sums was formed),
+// and the norms are all squared.
+//
+// Only one of each pair {v,-v} is visited by requiring the last nonzero
+// coordinate to be positive.
+template<typename Real>
+class SubtreeEnumerator
+{
+public:
+    SubtreeEnumerator
+    ( const vector<Real>& mu,
+      const vector<Real>& rr,
+      const vector<Real>& coeffs )
+    : n_(rr.size()), mu_(mu), rr_(rr), coeffs_(coeffs),
+      bound_(n_), x_(n_), c_(n_), dx_(n_), ddx_(n_), l_(n_+1),
+      partSums_(n_*(n_+1),Real(0)), hi_(n_+1)
+    { }
+
+    void SetRadiusSq( Real radiusSq )
+    {
+        for( Int k=0; k<n_; ++k )
+            bound_[k] = coeffs_[(n_-1)-k]*radiusSq;
+    }
+
+    // Enumerate all coordinates x(0:kRoot) beneath the fixed coordinates
+    // x(kRoot+1:n-1) (whose partial squared norm is 'lRoot'), calling
+    // visitor.Leaf for each accepted node at level 'leafLevel' and
+    // periodically allowing visitor.Refresh to tighten the radius.
+    // The number of visited nodes is returned.
+    template<class Visitor>
+    Int Run
+    ( Int kRoot,
+      const vector<Real>& prefix,
+      Real lRoot,
+      Int leafLevel,
+      Visitor& visitor )
+    {
+        const Int n = n_;
+        for( Int j=kRoot+1; j<n; ++j )
+            x_[j] = prefix[j];
+        l_[kRoot+1] = lRoot;
+        for( Int k=0; k<=n; ++k )
+            hi_[k] = n-1;
+
+        Int k = kRoot;
+        Real* psRow = &partSums_[k*(n+1)];
+        psRow[n] = 0;
+        for( Int j=n-1; j>k; --j )
+            psRow[j] = psRow[j+1] - x_[j]*mu_[k*n+j];
+        InitLevel( k );
+
+        Int numNodes = 0;
+        while( true )
+        {
+            if( (++numNodes & 1023) == 0 )
+                visitor.Refresh( *this );
+
+            const Real alpha = x_[k] - c_[k];
+            const Real lNew = l_[k+1] + alpha*alpha*rr_[k];
+            if( lNew < bound_[k] )
+            {
+                if( k == leafLevel )
+                {
+                    // Subtree roots may have zero partial norms, but the
+                    // zero vector is not a solution
+                    if( k > 0 || lNew > Real(0) )
+                        visitor.Leaf( k, x_, lNew, *this );
+                    NextSibling( k );
+                }
+                else
+                {
+                    // Move down the tree
+                    l_[k] = lNew;
+                    Real* psBelow = &partSums_[(k-1)*(n+1)];
+                    for( Int j=hi_[k]; j>=k; --j )
+                        psBelow[j] = psBelow[j+1] - x_[j]*mu_[(k-1)*n+j];
+                    hi_[k-1] = Max(hi_[k-1],hi_[k]);
+                    hi_[k] = k;
+                    --k;
+                    InitLevel( k );
+                }
+            }
+            else
+            {
+                // Move up the tree
+                ++k;
+                if( k > kRoot )
+                    break;
+                NextSibling( k );
+            }
+        }
+        return numNodes;
+    }
+
+private:
+    Int n_;
+    const vector<Real>& mu_;
+    const vector<Real>& rr_;
+    const vector<Real>& coeffs_;
+    vector<Real> bound_, x_, c_, dx_, ddx_, l_, partSums_;
+    vector<Int> hi_;
+
+    void InitLevel( Int k )
+    {
+        c_[k] = partSums_[k*(n_+1)+(k+1)];
+        x_[k] = Round(c_[k]);
+        dx_[k] = ddx_[k] = ( c_[k] >= x_[k] ? Real(1) : Real(-1) );
+    }
+
+    void NextSibling( Int k )
+    {
+        if( l_[k+1] == Real(0) )
+        {
+            // All of the trailing coordinates are zero, so only traverse
+            // the nonnegative half of this level
+            x_[k] += Real(1);
+        }
+        else
+        {
+            // Zig-zag around the center
+            x_[k] += dx_[k];
+            ddx_[k] = -ddx_[k];
+            dx_[k] = ddx_[k] - dx_[k];
+        }
+    }
+};
+
+// Record each node at the cut depth as the root of a subtree
+template<typename Real>
+struct FrontierVisitor
+{
+    vector<vector<Real>> prefixes;
+    vector<Real> partialNormsSq;
+
+    void Leaf
+    ( Int k, const vector<Real>& x, Real l, SubtreeEnumerator<Real>& )
+    {
+        vector<Real> prefix( x.size(), Real(0) );
+        for( Int j=k; j<Int(x.size()); ++j )
+            prefix[j] = x[j];
+        prefixes.push_back( prefix );
+        partialNormsSq.push_back( l );
+    }
+    void Refresh( SubtreeEnumerator<Real>& ) { }
+};
+
+template<typename Real>
+struct SharedBest
+{
+    Real radiusSq;
+    vector<Real> x;
+    bool found=false;
+    // The squared norm of 'x' (the radius may have since been tightened by
+    // another process)
+    Real xNormSq;
+    // Incremented each time the radius is tightened so that the workers can
+    // cheaply poll for improvements
+    std::atomic<Int> version;
+};
+
+// Publish each improved solution and pull the improvements of other threads
+template<typename Real>
+struct SolutionVisitor
+{
+    SharedBest<Real>& best;
+    Int seenVersion;
+
+    SolutionVisitor( SharedBest<Real>& sharedBest )
+    : best(sharedBest), seenVersion(-1) { }
+
+    void Leaf
+    ( Int k, const vector<Real>& x, Real l,
+      SubtreeEnumerator<Real>& enumerator )
+    {
+        Real radiusSq;
+#ifdef EL_HYBRID
+        #pragma omp critical(El_svp_parallel_enum)
+#endif
+        {
+            if( l < best.radiusSq )
+            {
+                best.radiusSq = l;
+                best.x = x;
+                best.xNormSq = l;
+                best.found = true;
+                ++best.version;
+            }
+            radiusSq = best.radiusSq;
+            seenVersion = best.version;
+        }
+        enumerator.SetRadiusSq( radiusSq );
+    }
+
+    void Refresh( SubtreeEnumerator<Real>& enumerator )
+    {
+        if( best.version.load() == seenVersion )
+            return;
+        Real radiusSq;
+#ifdef EL_HYBRID
+        #pragma omp critical(El_svp_parallel_enum)
+#endif
+        {
+            radiusSq = best.radiusSq;
+            seenVersion = best.version;
+        }
+        enumerator.SetRadiusSq( radiusSq );
+    }
+};
+
+template<typename Real>
+Real Helper
+( const Matrix<Real>& R,
+  const Matrix<Real>& coeffs,
+        Real normUpperBound,
+        Matrix<Real>& v,
+        bool distributed,
+        mpi::Comm comm,
+  const ParallelEnumCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svp::parallel_enum::Helper"))
+    const Int m = R.Height();
+    const Int n = R.Width();
+    if( m < n )
+        LogicError("Expected height(R) >= width(R)");
+    if( coeffs.Height() != 0 && coeffs.Height() != n )
+        LogicError("Expected either zero or n pruning coefficients");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+
+    const int commRank = ( distributed ? mpi::Rank(comm) : 0 );
+    const int commSize = ( distributed ? mpi::Size(comm) : 1 );
+    const bool progress = ctrl.progress && commRank == 0;
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads = omp_get_max_threads();
+#endif
+    Timer timer;
+
+    // Form the scaled Gram-Schmidt coefficients (stored by rows)
+    vector<Real> mu(n*n,Real(0)), rr(n), pruning(n,Real(1));
+    for( Int k=0; k<n; ++k )
+    {
+        const Real rho_kk = R.Get(k,k);
+        rr[k] = rho_kk*rho_kk;
+        for( Int j=k+1; j<n; ++j )
+            mu[k*n+j] = R.Get(k,j)/rho_kk;
+    }
+    if( coeffs.Height() == n )
+        for( Int i=0; i<n; ++i )
+            pruning[i] = coeffs.Get(i,0);
+
+    // Expand the top levels of the tree into a frontier of subtrees
+    // =============================================================
+    const Real initialRadiusSq = normUpperBound*normUpperBound;
+    const Int minSubtrees = ctrl.subtreesPerWorker*numThreads*commSize;
+    const Int maxDepth = n-1;
+    Int depth = ( ctrl.cutDepth > 0 ? Min(ctrl.cutDepth,maxDepth) :
+                                      Min(Int(1),maxDepth) );
+    FrontierVisitor<Real> frontier;
+    if( ctrl.time )
+        timer.Start();
+    if( depth == 0 )
+    {
+        // A one-dimensional lattice is a single subtree
+        frontier.prefixes.push_back( vector<Real>(n,Real(0)) );
+        frontier.partialNormsSq.push_back( Real(0) );
+    }
+    while( depth > 0 )
+    {
+        frontier.prefixes.clear();
+        frontier.partialNormsSq.clear();
+        SubtreeEnumerator<Real> enumerator( mu, rr, pruning );
+        enumerator.SetRadiusSq( initialRadiusSq );
+        vector<Real> empty(n,Real(0));
+        enumerator.Run( n-1, empty, Real(0), n-depth, frontier );
+        if( ctrl.cutDepth > 0 || depth == maxDepth ||
+            Int(frontier.prefixes.size()) >= minSubtrees )
+            break;
+        ++depth;
+    }
+    const Int numSubtrees = frontier.prefixes.size();
+    if( ctrl.time && commRank == 0 )
+        Output("  Frontier formation: ",timer.Stop()," seconds");
+    if( progress )
+        Output
+        ("  Enumerating ",numSubtrees," subtrees of depth ",depth," with ",
+         numThreads," threads on each of ",commSize," processes");
+
+    // Subtrees with smaller partial norms tend to be both larger and more
+    // likely to contain short vectors, so start with them
+    vector<Int> order(numSubtrees);
+    for( Int s=0; s<numSubtrees; ++s )
+        order[s] = s;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int s, Int t )
+      { return frontier.partialNormsSq[s] < frontier.partialNormsSq[t]; } );
+
+    vector<Int> localSubtrees;
+    for( Int s=commRank; s<numSubtrees; s+=commSize )
+        localSubtrees.push_back( order[s] );
+    const Int maxLocalSubtrees = (numSubtrees+commSize-1)/commSize;
+    const Int chunkSize =
+      ( distributed ? Max(ctrl.syncInterval,Int(1)) :
+                      Max(maxLocalSubtrees,Int(1)) );
+
+    SharedBest<Real> best;
+    best.radiusSq = initialRadiusSq;
+    best.version = 0;
+
+    // Search the subtrees
+    // ===================
+    // The root of each subtree is at level n-depth-1 (when depth=n-1, this
+    // is level zero)
+    const Int kRoot = n-depth-1;
+    if( ctrl.time )
+        timer.Start();
+    for( Int chunkBeg=0; chunkBeg<maxLocalSubtrees; chunkBeg+=chunkSize )
+    {
+        const Int chunkEnd =
+          Min( chunkBeg+chunkSize, Int(localSubtrees.size()) );
+        std::atomic<Int> next( chunkBeg );
+#ifdef EL_HYBRID
+        #pragma omp parallel
+#endif
+        {
+            SubtreeEnumerator<Real> enumerator( mu, rr, pruning );
+            SolutionVisitor<Real> visitor( best );
+            visitor.Refresh( enumerator );
+            while( true )
+            {
+                const Int s = next++;
+                if( s >= chunkEnd )
+                    break;
+                const Int subtree = localSubtrees[s];
+                enumerator.Run
+                ( kRoot, frontier.prefixes[subtree],
+                  frontier.partialNormsSq[subtree], 0, visitor );
+            }
+        }
+
+        if( distributed )
+        {
+            const Real radiusSq =
+              mpi::AllReduce( best.radiusSq, mpi::MIN, comm );
+            if( radiusSq < best.radiusSq )
+            {
+                best.radiusSq = radiusSq;
+                ++best.version;
+            }
+        }
+    }
+    if( ctrl.time && commRank == 0 )
+        Output("  Subtree enumeration: ",timer.Stop()," seconds");
+
+    // Determine which process (if any) owns the shortest vector
+    bool found = best.found;
+    if( distributed )
+    {
+        // Only the processes whose own vector achieves the final radius may
+        // own the solution
+        const Real radiusSq = mpi::AllReduce( best.radiusSq, mpi::MIN, comm );
+        const int candidate =
+          ( found && best.xNormSq <= radiusSq ? commRank : commSize );
+        const int owner = mpi::AllReduce( candidate, mpi::MIN, comm );
+        found = ( owner < commSize );
+        if( found )
+        {
+            best.x.resize( n );
+            mpi::Broadcast( best.x.data(), n, owner, comm );
+            best.xNormSq = radiusSq;
+        }
+    }
+    if( !found )
+        return 2*normUpperBound+1;
+
+    for( Int j=0; j<n; ++j )
+        v.Set( j, 0, best.x[j] );
+    return Sqrt(best.xNormSq);
+}
+
+} // namespace parallel_enum
+
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<F>& R,
+  const Matrix<Base<F>>& coeffs,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const ParallelEnumCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svp::ParallelEnumeration"))
+    return parallel_enum::Helper
+      ( R, coeffs, normUpperBound, v, false, mpi::COMM_SELF, ctrl );
+}
+
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<F>& R,
+  const Matrix<Base<F>>& coeffs,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+        mpi::Comm comm,
+  const ParallelEnumCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svp::ParallelEnumeration"))
+    return parallel_enum::Helper
+      ( R, coeffs, normUpperBound, v, true, comm, ctrl );
+}
+
+} // namespace svp
+} // namespace El
+
+#endif // ifndef EL_LATTICE_ENUMERATE_PARALLEL_HPP
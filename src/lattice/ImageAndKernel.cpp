@@ -10,6 +10,132 @@
 
 namespace El {
 
+namespace lll {
+
+template<typename F>
+bool UseStreamed( const Matrix<F>& B, const LLLCtrl<Base<F>>& ctrl )
+{
+    const Int m = B.Height();
+    const Int n = B.Width();
+    return !ctrl.jumpstart && n >= ctrl.kernelBlockedCutoff && n > m;
+}
+
+// The LLL implementations assign a Householder reflector, and hence a row,
+// to each column, including the zero columns, which are moved to the front.
+// The rows claimed by the zero columns are never orthogonalized against, so
+// n zero rows are placed on top of the basis (which changes neither its Gram
+// matrix nor its kernel) for the zero columns to claim.
+template<typename F>
+LLLInfo<Base<F>> PaddedLLL
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& UInv,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::PaddedLLL"))
+    const Int m = B.Height();
+    const Int n = B.Width();
+    Matrix<F> BPad;
+    Zeros( BPad, n+m, n );
+    auto BPadB = BPad( IR(n,n+m), ALL );
+    BPadB = B;
+    auto info = LLL( BPad, U, UInv, R, ctrl );
+    B = BPad( IR(n,n+m), ALL );
+    return info;
+}
+
+} // namespace lll
+
+// The image of the columns processed so far is maintained as an LLL-reduced
+// basis M, along with the integer coefficients C which express it in terms
+// of said columns (B(:,0:j) C = M). When the next block, B1, is streamed in,
+// LLL is applied to [M, B1], which has at most rank(B)+nb columns, and
+// each of the z leading (zero) columns of its unimodular transformation,
+//
+//   [M, B1] [u0; u1] = 0,
+//
+// lifts to the kernel vector [C u0; u1] of B(:,0:j+nb). Every kernel
+// vector of the extended matrix is a combination of these and the (padded)
+// previous kernel vectors, since B(:,0:j) x0 lies in the span of M.
+template<typename F>
+void BlockedLatticeImageAndKernel
+( const Matrix<F>& B,
+        Matrix<F>& M,
+        Matrix<F>& K,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("BlockedLatticeImageAndKernel"))
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int blocksize = Max( ctrl.kernelBlocksize, Int(1) );
+    const Real maxExact = Real(1)/limits::Epsilon<Real>();
+
+    LLLCtrl<Real> blockCtrl( ctrl );
+    blockCtrl.jumpstart = false;
+    blockCtrl.startCol = 0;
+    blockCtrl.progress = false;
+    blockCtrl.time = false;
+
+    Matrix<F> C;
+    Zeros( M, m, 0 );
+    Zeros( C, 0, 0 );
+    Zeros( K, 0, 0 );
+    Matrix<F> A, U, UInv, R, CU, KNew, CNew;
+    for( Int j=0; j<n; j+=blocksize )
+    {
+        const Int nb = Min(blocksize,n-j);
+        const Int r = M.Width();
+        const Int k = K.Width();
+
+        Zeros( A, m, r+nb );
+        auto AL = A( ALL, IR(0,r) );
+        auto AR = A( ALL, IR(r,r+nb) );
+        AL = M;
+        AR = B( ALL, IR(j,j+nb) );
+        auto info = lll::PaddedLLL( A, U, UInv, R, blockCtrl );
+        const Int z = info.nullity;
+
+        auto U0 = U( IR(0,r), ALL );
+        auto U1 = U( IR(r,r+nb), ALL );
+        Zeros( CU, j, r+nb );
+        if( r > 0 )
+            Gemm( NORMAL, NORMAL, F(1), C, U0, F(0), CU );
+
+        Zeros( KNew, j+nb, k+z );
+        auto KNewOld = KNew( IR(0,j), IR(0,k) );
+        auto KNew0 = KNew( IR(0,j), IR(k,k+z) );
+        auto KNew1 = KNew( IR(j,j+nb), IR(k,k+z) );
+        KNewOld = K;
+        KNew0 = CU( ALL, IR(0,z) );
+        KNew1 = U1( ALL, IR(0,z) );
+
+        Zeros( CNew, j+nb, r+nb-z );
+        auto CNew0 = CNew( IR(0,j), ALL );
+        auto CNew1 = CNew( IR(j,j+nb), ALL );
+        CNew0 = CU( ALL, IR(z,END) );
+        CNew1 = U1( ALL, IR(z,END) );
+
+        // The coefficients must remain exactly representable
+        if( MaxNorm(CNew) >= maxExact || MaxNorm(KNew) >= maxExact )
+            RuntimeError
+            ("Coefficients exceeded ",maxExact," after ",j+nb," columns");
+
+        M = A( ALL, IR(z,END) );
+        C = CNew;
+        K = KNew;
+        if( ctrl.progress )
+            Output
+            ("  ",j+nb," of ",n," columns: rank=",M.Width(),
+             ", nullity=",K.Width());
+    }
+
+    // The kernel basis is only reduced once all of the columns are processed
+    if( K.Width() > 0 )
+        LLL( K, blockCtrl );
+}
+
 template<typename F>
 void LatticeImageAndKernel
 ( Matrix<F>& B,
@@ -18,11 +144,23 @@ void LatticeImageAndKernel
   const LLLCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LatticeImageAndKernel"))
+    if( lll::UseStreamed( B, ctrl ) )
+    {
+        // NOTE: The least-squares reduction of M against K below is skipped,
+        //       and B is not the LLL reduction of the original B
+        BlockedLatticeImageAndKernel( B, M, K, ctrl );
+        // Mimic the output of LLL, which places the zero columns first
+        const Int nullity = B.Width() - M.Width();
+        Zeros( B, B.Height(), B.Width() );
+        auto BR = B( ALL, IR(nullity,END) );
+        BR = M;
+        return;
+    }
 
     // NOTE: UInv and R don't actually need to be formed...but deciding on 
     //       the best interface is somewhat tricky
     Matrix<F> U, UInv, R;
-    auto info = LLL( B, U, UInv, R, ctrl );
+    auto info = lll::PaddedLLL( B, U, UInv, R, ctrl );
     const Int nullity = info.nullity;
     K = U(ALL,IR(0,nullity));
     M = B(ALL,IR(nullity,END));
@@ -53,6 +191,11 @@ void LatticeKernel
 }
 
 #define PROTO(F) \
+  template void BlockedLatticeImageAndKernel \
+  ( const Matrix<F>& B, \
+          Matrix<F>& M, \
+          Matrix<F>& K, \
+    const LLLCtrl<Base<F>>& ctrl ); \
   template void LatticeImageAndKernel \
   ( Matrix<F>& B, \
     Matrix<F>& M, \
@@ -90,7 +90,7 @@
 
 namespace El {
 
-static Timer applyHouseTimer, roundTimer, formSInvTimer;
+static Timer applyHouseTimer, roundTimer;
 
 namespace lll {
 
@@ -197,6 +197,8 @@ inline Base<F> LogVolume( const Matrix<F>& R )
 
 #include "./LLL/Unblocked.hpp"
 #include "./LLL/Blocked.hpp"
+#include "./LLL/AllSwaps.hpp"
+#include "./LLL/Adaptive.hpp"
 
 namespace El {
 
@@ -249,7 +251,7 @@ LLLInfo<Base<F>> LLLWithQ
         Omega.PermuteRows( UInv );
     }
 
-    const bool useBlocked = false;
+    const bool useBlocked = lll::UseBlocked( B, ctrl );
     const bool formU = true;
     const bool formUInv = true;
     if( useBlocked )
@@ -322,7 +324,7 @@ LLLWithQ
         Omega.PermuteCols( B );
     }
 
-    const bool useBlocked = false;
+    const bool useBlocked = lll::UseBlocked( B, ctrl );
     const bool formU = false;
     const bool formUInv = false;
     Matrix<F> U, UInv;
@@ -425,6 +427,10 @@ LowerPrecisionMerge
     ctrlLower.smallestFirst = ctrl.smallestFirst;
     ctrlLower.reorthogTol = RealLower(ctrl.reorthogTol);
     ctrlLower.numOrthog = ctrl.numOrthog;
+    ctrlLower.blocksize = ctrl.blocksize;
+    ctrlLower.blockedCutoff = ctrl.blockedCutoff;
+    ctrlLower.kernelBlocksize = ctrl.kernelBlocksize;
+    ctrlLower.kernelBlockedCutoff = ctrl.kernelBlockedCutoff;
     ctrlLower.progress = ctrl.progress;
     ctrlLower.time = ctrl.time;
 
@@ -806,6 +812,114 @@ RecursiveLLL
     return lll::RecursiveHelper( B, R, numShuffles, cutoff, ctrl );
 }
 
+template<typename F>
+LLLInfo<Base<F>>
+AdaptiveLLL
+( Matrix<F>& B,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AdaptiveLLL"))
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart LLL from this interface");
+    Matrix<F> R;
+    return AdaptiveLLL( B, R, ctrl );
+}
+
+template<typename F>
+LLLInfo<Base<F>>
+AdaptiveLLL
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AdaptiveLLL"))
+    typedef Base<F> Real;
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart LLL from this interface");
+    const Int n = B.Width();
+    const Int segSize = Max(ctrl.blocksize,Int(1));
+
+    LLLInfo<Real> info;
+    info.delta = ctrl.delta;
+    info.eta = Real(1)/Real(2);
+    info.rank = 0;
+    info.nullity = 0;
+    info.numSwaps = 0;
+    info.logVol = 0;
+    if( n == 0 )
+    {
+        R.Resize( B.Height(), 0 );
+        return info;
+    }
+
+    // When there is no lower precision to drop to, the segments would only
+    // add overhead
+    if( !PrecisionIsGreater<Real,double>::value )
+        return LLL( B, R, ctrl );
+
+    // Each pass reduces the leading k1 columns, the first k0 of which are
+    // already reduced
+    Matrix<F> BSeg, RSeg, U;
+    for( Int k1=Min(segSize,n); ; k1=Min(k1+segSize,n) )
+    {
+        Int k0 = Max(k1-segSize,Int(0));
+        BSeg = B( ALL, IR(0,k1) );
+
+        const Real oneNorm = Max( OneNorm(BSeg), Real(1) );
+        const Real fudge = 1.5; // TODO: Make tunable
+        const Int neededPrec = Int(Ceil(Log2(oneNorm)*fudge));
+        if( ctrl.progress || ctrl.time )
+            Output
+            ("AdaptiveLLL on columns [",k0,",",k1,"): needed precision is ",
+             neededPrec);
+
+        LLLInfo<Real> segInfo;
+        segInfo.numSwaps = 0;
+        bool reduced = false;
+        if( neededPrec <= 53 )
+            reduced =
+              lll::AdaptiveStep<F,double>( BSeg, RSeg, k0, segInfo, ctrl );
+        if( !reduced &&
+            PrecisionIsGreater<Real,DoubleDouble>::value && neededPrec <= 106 )
+            reduced =
+              lll::AdaptiveDoubleDoubleStep( BSeg, RSeg, k0, segInfo, ctrl );
+#ifdef EL_HAVE_QUAD
+        if( !reduced &&
+            PrecisionIsGreater<Real,Quad>::value && neededPrec <= 113 )
+            reduced =
+              lll::AdaptiveStep<F,Quad>( BSeg, RSeg, k0, segInfo, ctrl );
+#endif
+        if( !reduced )
+            reduced =
+              lll::AdaptiveBigFloatStep
+              ( BSeg, RSeg, k0, neededPrec, segInfo, ctrl );
+        if( !reduced )
+        {
+            // Fall back to the full precision, starting from whatever
+            // progress the lower-precision attempts made
+            if( ctrl.progress || ctrl.time )
+                Output("  Falling back to ",TypeName<Real>());
+            const Int numLowerSwaps = segInfo.numSwaps;
+            segInfo = lll::JumpstartedLLL( BSeg, U, RSeg, k0, ctrl );
+            segInfo.numSwaps += numLowerSwaps;
+            MakeTrapezoidal( UPPER, RSeg );
+        }
+
+        auto BSegView = B( ALL, IR(0,k1) );
+        BSegView = BSeg;
+        info.delta = segInfo.delta;
+        info.eta = segInfo.eta;
+        info.rank = segInfo.rank;
+        info.nullity = segInfo.nullity;
+        info.logVol = segInfo.logVol;
+        info.numSwaps += segInfo.numSwaps;
+        if( k1 == n )
+            break;
+    }
+    R = RSeg;
+    return info;
+}
+
 template<typename F>
 LLLInfo<Base<F>>
 LLL
@@ -819,6 +933,61 @@ LLL
     return LLL( B, R, ctrl );
 }
 
+template<typename F>
+LLLInfo<Base<F>>
+AllSwapsLLL
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AllSwapsLLL"))
+    typedef Base<F> Real;
+    if( ctrl.delta < Real(1)/Real(2) )
+        LogicError("delta is assumed to be at least 1/2");
+    if( ctrl.jumpstart )
+        LogicError("All-swaps LLL does not support jumpstarting");
+    if( ctrl.variant == LLL_DEEP || ctrl.variant == LLL_DEEP_REDUCE )
+        LogicError("All-swaps LLL does not support deep insertion");
+    return lll::AllSwapsAlg<F>( B, R, ctrl );
+}
+
+template<typename F>
+LLLInfo<Base<F>>
+AllSwapsLLL
+( Matrix<F>& B,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AllSwapsLLL"))
+    Matrix<F> R;
+    return AllSwapsLLL( B, R, ctrl );
+}
+
+template<typename F>
+LLLInfo<Base<F>>
+AllSwapsLLL
+( ElementalMatrix<F>& BPre,
+  ElementalMatrix<F>& RPre,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("AllSwapsLLL");
+      AssertSameGrids( BPre, RPre );
+    )
+    typedef Base<F> Real;
+    if( ctrl.delta < Real(1)/Real(2) )
+        LogicError("delta is assumed to be at least 1/2");
+    if( ctrl.jumpstart )
+        LogicError("All-swaps LLL does not support jumpstarting");
+    if( ctrl.variant == LLL_DEEP || ctrl.variant == LLL_DEEP_REDUCE )
+        LogicError("All-swaps LLL does not support deep insertion");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> RProx( RPre );
+    auto& B = BProx.Get();
+    auto& R = RProx.Get();
+    return lll::AllSwapsAlg<F>( B, R, ctrl );
+}
+
 template<typename F>
 void DeepColSwap( Matrix<F>& B, Int i, Int k )
 {
@@ -888,6 +1057,24 @@ void DeepRowSwap( Matrix<F>& B, Int i, Int k )
     Matrix<F>& R, \
     Int cutoff, \
     const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> AdaptiveLLL \
+  ( Matrix<F>& B, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> AdaptiveLLL \
+  ( Matrix<F>& B, \
+    Matrix<F>& R, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> AllSwapsLLL \
+  ( Matrix<F>& B, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> AllSwapsLLL \
+  ( Matrix<F>& B, \
+    Matrix<F>& R, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> AllSwapsLLL \
+  ( ElementalMatrix<F>& B, \
+    ElementalMatrix<F>& R, \
+    const LLLCtrl<Base<F>>& ctrl ); \
   template void DeepColSwap( Matrix<F>& B, Int i, Int k ); \
   template void DeepRowSwap( Matrix<F>& B, Int i, Int k );
 
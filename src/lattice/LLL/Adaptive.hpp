@@ -0,0 +1,314 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
+#define EL_LATTICE_LLL_ADAPTIVE_HPP
+
+// An adaptive-precision LLL in the spirit of the L^2 algorithm of Nguyen
+// and Stehle: the basis (which is always stored in the caller's precision)
+// is extended by a segment of columns at a time, and each new segment is
+// reduced in the lowest precision (double, then DoubleDouble, then Quad, then
+// increasingly precise BigFloat) which the size of its entries suggests
+// might suffice. The already-reduced prefix is only refactored (not reduced
+// again), so that each reduction is jumpstarted at the start of the new
+// segment. The reduction only returns the unimodular transformation, which
+// is applied to the basis in the original precision, and the result is then
+// verified by a fresh QR factorization in the original precision. When the
+// low-precision reduction breaks down (an unbounded norm, a transformation
+// which is not exactly representable, or a failure to achieve the requested
+// delta and eta), the segment is escalated to the next precision. The next
+// segment again starts from the lowest precision.
+//
+// Loss of precision within the low-precision reductions is mitigated by
+// reorthogonalizing whenever a size reduction cancels at least half of the
+// available digits (via 'reorthogTol').
+
+namespace El {
+namespace lll {
+
+// Form the Householder QR factorization of the first k0 columns of B in
+// the format expected by LLLWithQ so that the reduction of B can be
+// jumpstarted at column k0
+template<typename F>
+void PrefixQR
+( const Matrix<F>& B,
+        Int k0,
+        Matrix<F>& QR,
+        Matrix<F>& t,
+        Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::PrefixQR"))
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    Zeros( QR, m, n );
+    Zeros( t, minDim, 1 );
+    Zeros( d, minDim, 1 );
+    for( Int j=0; j<k0; ++j )
+    {
+        ExpandQR( j, B, QR, t, d, ctrl.numOrthog, false );
+        HouseholderStep( j, QR, t, d, false );
+
+        // MLLL keeps any zero columns at the front of the basis
+        if( FrobeniusNorm(B(ALL,IR(j))) <= ctrl.zeroTol )
+        {
+            auto QRj = QR( ALL, IR(j) );
+            Zero( QRj );
+        }
+    }
+}
+
+// Reduce B, whose first k0 columns are assumed to already be reduced, with
+// a reduction jumpstarted at column k0
+template<typename F>
+LLLInfo<Base<F>> JumpstartedLLL
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Int k0,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::JumpstartedLLL"))
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    Matrix<F> UInv, t;
+    Matrix<Real> d;
+    PrefixQR( B, k0, QR, t, d, ctrl );
+    Identity( U, n, n );
+    Identity( UInv, n, n );
+
+    LLLCtrl<Real> jumpCtrl( ctrl );
+    jumpCtrl.jumpstart = ( k0 > 0 );
+    jumpCtrl.startCol = k0;
+    if( k0 > 0 )
+        jumpCtrl.presort = false;
+    return LLLWithQ( B, U, UInv, QR, t, d, jumpCtrl );
+}
+
+// Attempt to reduce B (whose first k0 columns are already reduced) in the
+// precision of RealLower, returning the resulting unimodular transformation
+// in the original precision
+template<typename F,typename RealLower>
+bool LowerPrecisionTransform
+( const Matrix<F>& B,
+        Int k0,
+        Matrix<F>& U,
+        Int& numSwaps,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::LowerPrecisionTransform"))
+    typedef ConvertBase<F,RealLower> FLower;
+    const RealLower epsLower = limits::Epsilon<RealLower>();
+
+    LLLCtrl<RealLower> ctrlLower;
+    ctrlLower.delta = RealLower(ctrl.delta);
+    ctrlLower.eta = RealLower(ctrl.eta);
+    ctrlLower.variant = ctrl.variant;
+    ctrlLower.presort = ctrl.presort;
+    ctrlLower.smallestFirst = ctrl.smallestFirst;
+    ctrlLower.reorthogTol = Max(RealLower(ctrl.reorthogTol),Sqrt(epsLower));
+    ctrlLower.numOrthog = ctrl.numOrthog;
+    ctrlLower.zeroTol =
+      Max(RealLower(ctrl.zeroTol),Pow(epsLower,RealLower(0.9)));
+    ctrlLower.blocksize = ctrl.blocksize;
+    ctrlLower.blockedCutoff = ctrl.blockedCutoff;
+    ctrlLower.kernelBlocksize = ctrl.kernelBlocksize;
+    ctrlLower.kernelBlockedCutoff = ctrl.kernelBlockedCutoff;
+    if( ctrlLower.eta <= RealLower(1)/RealLower(2) )
+        ctrlLower.eta =
+          RealLower(1)/RealLower(2) + Pow(epsLower,RealLower(0.9));
+
+    Matrix<FLower> BLower, ULower, QRLower;
+    Copy( B, BLower );
+    try
+    {
+        auto infoLower =
+          JumpstartedLLL( BLower, ULower, QRLower, k0, ctrlLower );
+        numSwaps = infoLower.numSwaps;
+    }
+    catch( std::exception& e )
+    {
+        if( ctrl.progress )
+            Output("  ",TypeName<RealLower>()," LLL failed: ",e.what());
+        return false;
+    }
+
+    // The transformation must be exactly representable in order to be
+    // (provably) unimodular
+    const RealLower UMax = MaxNorm( ULower );
+    if( !limits::IsFinite(UMax) || UMax >= RealLower(1)/epsLower )
+    {
+        if( ctrl.progress )
+            Output("  ",TypeName<RealLower>()," transformation was inexact");
+        return false;
+    }
+    Copy( ULower, U );
+    return true;
+}
+
+// Apply the unimodular transformation U to B and accept the result if it
+// is verified to be reduced in the original precision. Even if the
+// verification fails, B is overwritten with the transformed basis, as it
+// still generates the same lattice.
+template<typename F>
+bool ApplyAndVerify
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const Matrix<F>& U,
+  Base<F> slack,
+  LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::ApplyAndVerify"))
+    typedef Base<F> Real;
+    const Int n = B.Width();
+
+    Matrix<F> BNew;
+    Gemm( NORMAL, NORMAL, F(1), B, U, BNew );
+    B = BNew;
+
+    R = B;
+    qr::ExplicitTriang( R );
+    auto achieved = Achieved( R, ctrl );
+    const Real deltaBound = ctrl.delta - slack;
+    const Real etaBound = ctrl.eta + slack;
+    if( achieved.first < deltaBound || achieved.second > etaBound )
+    {
+        if( ctrl.progress )
+            Output
+            ("  Verification failed: achieved (delta,eta)=(",
+             achieved.first,",",achieved.second,")");
+        return false;
+    }
+
+    Int nullity = 0;
+    const Int minDim = Min(R.Height(),n);
+    for( Int j=0; j<minDim; ++j )
+        if( R.GetRealPart(j,j) <= ctrl.zeroTol )
+            ++nullity;
+    nullity += n-minDim;
+
+    info.delta = achieved.first;
+    info.eta = achieved.second;
+    info.rank = n-nullity;
+    info.nullity = nullity;
+    info.logVol = LogVolume( R );
+    return true;
+}
+
+// If the verification of a transformed basis fails, its leading k0 columns
+// are no longer known to be reduced, and so k0 is reset to zero
+template<typename F,typename RealLower>
+bool AdaptiveStep
+( Matrix<F>& B,
+  Matrix<F>& R,
+  Int& k0,
+  LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::AdaptiveStep"))
+    typedef Base<F> Real;
+    if( ctrl.progress || ctrl.time )
+        Output("  Attempting reduction in ",TypeName<RealLower>());
+    Matrix<F> U;
+    Int numSwaps=0;
+    if( !LowerPrecisionTransform<F,RealLower>( B, k0, U, numSwaps, ctrl ) )
+        return false;
+    info.numSwaps += numSwaps;
+    const Real slack = Real(Sqrt(limits::Epsilon<RealLower>()));
+    if( ApplyAndVerify( B, R, U, slack, info, ctrl ) )
+        return true;
+    k0 = 0;
+    return false;
+}
+
+// DoubleDouble is real-only, so complex bases skip its step
+template<typename F,typename=EnableIf<IsComplex<F>>>
+bool AdaptiveDoubleDoubleStep
+( Matrix<F>& B,
+  Matrix<F>& R,
+  Int& k0,
+  LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{ return false; }
+
+template<typename F,typename=DisableIf<IsComplex<F>>,typename=void>
+bool AdaptiveDoubleDoubleStep
+( Matrix<F>& B,
+  Matrix<F>& R,
+  Int& k0,
+  LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{ return AdaptiveStep<F,DoubleDouble>( B, R, k0, info, ctrl ); }
+
+#ifdef EL_HAVE_MPC
+// There are not (yet) conversions between BigFloat and DoubleDouble
+inline bool AdaptiveDoubleDoubleStep
+( Matrix<BigFloat>& B,
+  Matrix<BigFloat>& R,
+  Int& k0,
+  LLLInfo<BigFloat>& info,
+  const LLLCtrl<BigFloat>& ctrl )
+{ return false; }
+#endif
+
+// Only a BigFloat basis can benefit from lowering the MPFR precision
+template<typename F>
+bool AdaptiveBigFloatStep
+( Matrix<F>& B,
+  Matrix<F>& R,
+  Int& k0,
+  Int neededPrec,
+  LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{ return false; }
+
+#ifdef EL_HAVE_MPC
+inline bool AdaptiveBigFloatStep
+( Matrix<BigFloat>& B,
+  Matrix<BigFloat>& R,
+  Int& k0,
+  Int neededPrec,
+  LLLInfo<BigFloat>& info,
+  const LLLCtrl<BigFloat>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::AdaptiveBigFloatStep"))
+    // Only move down to a lower-precision MPFR type if the jump is
+    // substantial (as in RecursiveLLL), and double the precision after
+    // each failure
+    const mpfr_prec_t minPrecDiff = 32;
+    const mpfr_prec_t inputPrec = mpc::Precision();
+    mpfr_prec_t prec = Max(mpfr_prec_t(neededPrec),mpfr_prec_t(128));
+    for( ; prec<=inputPrec-minPrecDiff; prec*=2 )
+    {
+        if( ctrl.progress || ctrl.time )
+            Output("  Attempting reduction with ",prec," bits");
+        Matrix<BigFloat> U;
+        Int numSwaps=0;
+        mpc::SetPrecision( prec );
+        const bool reduced =
+          LowerPrecisionTransform<BigFloat,BigFloat>
+          ( B, k0, U, numSwaps, ctrl );
+        mpc::SetPrecision( inputPrec );
+        if( !reduced )
+            continue;
+        info.numSwaps += numSwaps;
+        const BigFloat slack = Pow(BigFloat(2),-BigFloat(prec)/BigFloat(2));
+        if( ApplyAndVerify( B, R, U, slack, info, ctrl ) )
+            return true;
+        k0 = 0;
+    }
+    return false;
+}
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace lll
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
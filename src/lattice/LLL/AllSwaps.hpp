@@ -0,0 +1,438 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_ALLSWAPS_HPP
+#define EL_LATTICE_LLL_ALLSWAPS_HPP
+
+// An implementation of Villard's "all swaps" LLL (see the discussion at the
+// top of LLL.cpp). Each phase first size-reduces the entire basis using a
+// blocked algorithm, where the rounding is confined to a panel of rows of R
+// and the remainder of R and B are updated with Gemm, and then swaps every
+// pair (b_i,b_{i+1}), with i of the phase's parity, which violates the Lovasz
+// condition. Since these pairs are disjoint, the upper-triangular factor R
+// can be patched with independent Givens rotations. The phases alternate
+// between even and odd parities until neither performs a swap.
+//
+// Since R is updated rather than recomputed, it is periodically refactored
+// from the (exactly updated) basis B, and the reduction is only declared
+// converged when a fresh factorization requires no swaps.
+
+namespace El {
+namespace lll {
+
+template<typename F>
+inline F UnitPhase( const F& alpha )
+{
+    const Base<F> alphaAbs = Abs(alpha);
+    return ( alphaAbs == Base<F>(0) ? F(1) : alpha/alphaAbs );
+}
+
+// Size-reduce a panel of rows, say I=[i0,i1), of an upper-triangular matrix
+// against itself and all subsequent columns. On entry, RPanel should be the
+// |I| x (n-i0) matrix R(I,i0:n). On exit, it is overwritten with the reduced
+// panel and TDelta holds the (negated) integer multipliers, so that the
+// reduced columns i0:n of any matrix X with X(:,I) in its original state are
+// given by X(:,i0:n) + X(:,I) TDelta. The return value is true if any of the
+// multipliers were nonzero.
+template<typename F>
+bool ReducePanel
+( Matrix<F>& RPanel,
+  Matrix<F>& TDelta,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::ReducePanel"))
+    typedef Base<F> Real;
+    const Int nb = RPanel.Height();
+    const Int nPanel = RPanel.Width();
+    Zeros( TDelta, nb, nPanel );
+
+    F* RBuf = RPanel.Buffer();
+    F* TBuf = TDelta.Buffer();
+    const Int RLDim = RPanel.LDim();
+    const Int TLDim = TDelta.LDim();
+
+    // Column r is only modified by rows above r, so, when row r is processed,
+    // column r is still in its original state. Thus the multipliers of each
+    // row are independent and the columns may be processed in parallel.
+    bool modified = false;
+    for( Int r=nb-1; r>=0; --r )
+    {
+        const Real rho_r_r = RealPart(RBuf[r+r*RLDim]);
+        if( rho_r_r <= ctrl.zeroTol )
+            RuntimeError
+            ("All-swaps LLL requires linearly independent columns");
+        const F* EL_RESTRICT rCol = &RBuf[r*RLDim];
+
+        EL_PARALLEL_FOR
+        for( Int c=r+1; c<nPanel; ++c )
+        {
+            F* EL_RESTRICT cCol = &RBuf[c*RLDim];
+            const F chi = Round(cCol[r]/rho_r_r);
+            if( chi == F(0) )
+                continue;
+            for( Int i=0; i<=r; ++i )
+                cCol[i] -= chi*rCol[i];
+            TBuf[r+c*TLDim] = -chi;
+        }
+        for( Int c=r+1; c<nPanel && !modified; ++c )
+            modified = ( TBuf[r+c*TLDim] != F(0) );
+    }
+    return modified;
+}
+
+template<typename F>
+void SizeReduce
+( Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::SizeReduce"))
+    const Int n = R.Width();
+    const Int bsize = Blocksize();
+
+    // Proceed from the bottom panel upwards so that the columns which a panel
+    // combines have already been reduced against all of the rows below it
+    Matrix<F> TDelta, RTopI, BI;
+    for( Int i1=n; i1>0; i1-=bsize )
+    {
+        const Int i0 = Max(i1-bsize,0);
+        const Range<Int> ind1(i0,i1), ind2(i0,n), indT(0,i0);
+
+        auto RPanel = R( ind1, ind2 );
+        if( !ReducePanel( RPanel, TDelta, ctrl ) )
+            continue;
+
+        if( i0 > 0 )
+        {
+            RTopI = R( indT, ind1 );
+            auto RTop = R( indT, ind2 );
+            Gemm( NORMAL, NORMAL, F(1), RTopI, TDelta, F(1), RTop );
+        }
+        BI = B( ALL, ind1 );
+        auto BPanel = B( ALL, ind2 );
+        Gemm( NORMAL, NORMAL, F(1), BI, TDelta, F(1), BPanel );
+    }
+}
+
+template<typename F>
+void SizeReduce
+( DistMatrix<F>& B,
+  DistMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::SizeReduce"))
+    const Int n = R.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = B.Grid();
+
+    // The rounding of each (short) panel is performed redundantly so that
+    // every process agrees upon the multipliers
+    DistMatrix<F,STAR,STAR> RPanel_STAR_STAR(g), TDelta_STAR_STAR(g);
+    DistMatrix<F> TDelta(g), RTopI(g), BI(g);
+    for( Int i1=n; i1>0; i1-=bsize )
+    {
+        const Int i0 = Max(i1-bsize,0);
+        const Range<Int> ind1(i0,i1), ind2(i0,n), indT(0,i0);
+
+        // ReducePanel only sees the local matrices, so TDelta_STAR_STAR must
+        // be given its global size here
+        auto RPanel = R( ind1, ind2 );
+        RPanel_STAR_STAR = RPanel;
+        TDelta_STAR_STAR.Resize( RPanel.Height(), RPanel.Width() );
+        if( !ReducePanel
+             ( RPanel_STAR_STAR.Matrix(), TDelta_STAR_STAR.Matrix(), ctrl ) )
+            continue;
+        RPanel = RPanel_STAR_STAR;
+        TDelta = TDelta_STAR_STAR;
+
+        if( i0 > 0 )
+        {
+            RTopI = R( indT, ind1 );
+            auto RTop = R( indT, ind2 );
+            Gemm( NORMAL, NORMAL, F(1), RTopI, TDelta, F(1), RTop );
+        }
+        BI = B( ALL, ind1 );
+        auto BPanel = B( ALL, ind2 );
+        Gemm( NORMAL, NORMAL, F(1), BI, TDelta, F(1), BPanel );
+    }
+}
+
+// The 2x2 unitary transformation of rows i and i+1 of R which restores its
+// upper-triangular structure (with a positive diagonal) after swapping
+// columns i and i+1
+template<typename F>
+struct SwapRotation
+{
+    Int i;
+    F gamma00, gamma01, gamma10, gamma11;
+};
+
+// Determine the swaps of the given parity and their rotations from the
+// diagonal and superdiagonal of the size-reduced R
+template<typename F>
+void PhaseSwaps
+( Int parity,
+  const Matrix<F>& diag,
+  const Matrix<F>& superDiag,
+  vector<SwapRotation<F>>& swaps,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::PhaseSwaps"))
+    typedef Base<F> Real;
+    const Int n = diag.Height();
+    const Real sqrtDelta = Sqrt(ctrl.delta);
+
+    swaps.resize( 0 );
+    for( Int i=parity; i<n-1; i+=2 )
+    {
+        const Real rho_i_i = RealPart(diag.Get(i,0));
+        const F rho_i_ip1 = superDiag.Get(i,0);
+        const Real rho_ip1_ip1 = RealPart(diag.Get(i+1,0));
+
+        const Real leftTerm = sqrtDelta*rho_i_i;
+        const Real rightTerm = lapack::SafeNorm(rho_ip1_ip1,rho_i_ip1);
+        if( leftTerm <= rightTerm )
+            continue;
+
+        // After the swap, the leading 2x2 block is [rho_i_ip1, rho_i_i;
+        // rho_ip1_ip1, 0], so a rotation zeroing rho_ip1_ip1 is needed
+        Real c;
+        F s;
+        const F rho =
+          lapack::Givens( rho_i_ip1, F(rho_ip1_ip1), &c, &s );
+        const F phase0 = Conj(UnitPhase(rho));
+        const F phase1 = Conj(UnitPhase(-Conj(s)*rho_i_i));
+
+        SwapRotation<F> swap;
+        swap.i = i;
+        swap.gamma00 = phase0*c;
+        swap.gamma01 = phase0*s;
+        swap.gamma10 = -phase1*Conj(s);
+        swap.gamma11 = phase1*c;
+        swaps.push_back( swap );
+    }
+}
+
+// Apply the rotations to the locally-owned (full) columns of R, where
+// columnIndices maps the local column indices to global ones
+template<typename F>
+void ApplySwapRotations
+( const vector<SwapRotation<F>>& swaps,
+        Matrix<F>& RLoc,
+  const vector<Int>& columnIndices )
+{
+    DEBUG_ONLY(CSE cse("lll::ApplySwapRotations"))
+    const Int numSwaps = swaps.size();
+    const Int localWidth = RLoc.Width();
+    F* RBuf = RLoc.Buffer();
+    const Int RLDim = RLoc.LDim();
+
+    // The row pairs are disjoint
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSwaps; ++k )
+    {
+        const SwapRotation<F>& swap = swaps[k];
+        const Int i = swap.i;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = columnIndices[jLoc];
+            if( j < i )
+                continue;
+            F* rCol = &RBuf[jLoc*RLDim];
+            const F rho0 = rCol[i];
+            const F rho1 = rCol[i+1];
+            rCol[i] = swap.gamma00*rho0 + swap.gamma01*rho1;
+            rCol[i+1] = ( j == i ? F(0) :
+                          swap.gamma10*rho0 + swap.gamma11*rho1 );
+        }
+    }
+}
+
+template<typename F>
+Int SwapPhase
+( Int parity,
+  Matrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::SwapPhase"))
+    const Int m = B.Height();
+    const Int n = R.Width();
+
+    Matrix<F> diag, superDiag;
+    GetDiagonal( R, diag, 0 );
+    GetDiagonal( R, superDiag, 1 );
+    vector<SwapRotation<F>> swaps;
+    PhaseSwaps( parity, diag, superDiag, swaps, ctrl );
+    const Int numSwaps = swaps.size();
+    if( numSwaps == 0 )
+        return 0;
+
+    // The column swaps must be completed before the row rotations since the
+    // latter touch the columns of the neighboring swaps
+    F* BBuf = B.Buffer();
+    F* RBuf = R.Buffer();
+    const Int BLDim = B.LDim();
+    const Int RLDim = R.LDim();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSwaps; ++k )
+    {
+        const Int i = swaps[k].i;
+        blas::Swap( m, &BBuf[i*BLDim], 1, &BBuf[(i+1)*BLDim], 1 );
+        blas::Swap( i+2, &RBuf[i*RLDim], 1, &RBuf[(i+1)*RLDim], 1 );
+    }
+
+    vector<Int> columnIndices(n);
+    for( Int j=0; j<n; ++j )
+        columnIndices[j] = j;
+    ApplySwapRotations( swaps, R, columnIndices );
+    return numSwaps;
+}
+
+template<typename F>
+Int SwapPhase
+( Int parity,
+  DistMatrix<F>& B,
+  DistMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::SwapPhase"))
+    const Int n = R.Width();
+    const Grid& g = B.Grid();
+
+    DistMatrix<F,STAR,STAR> diag(g), superDiag(g);
+    GetDiagonal( R, diag, 0 );
+    GetDiagonal( R, superDiag, 1 );
+    vector<SwapRotation<F>> swaps;
+    PhaseSwaps( parity, diag.Matrix(), superDiag.Matrix(), swaps, ctrl );
+    const Int numSwaps = swaps.size();
+    if( numSwaps == 0 )
+        return 0;
+
+    DistPermutation P(g);
+    P.MakeIdentity( n );
+    P.ReserveSwaps( numSwaps );
+    for( Int k=0; k<numSwaps; ++k )
+        P.RowSwap( swaps[k].i, swaps[k].i+1 );
+    P.PermuteCols( B );
+    P.PermuteCols( R );
+
+    // Each process applies the rotations to the full columns that it owns
+    DistMatrix<F,STAR,VR> R_STAR_VR( R );
+    const Int localWidth = R_STAR_VR.LocalWidth();
+    vector<Int> columnIndices(localWidth);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        columnIndices[jLoc] = R_STAR_VR.GlobalCol(jLoc);
+    ApplySwapRotations( swaps, R_STAR_VR.Matrix(), columnIndices );
+    R = R_STAR_VR;
+    return numSwaps;
+}
+
+template<typename F>
+std::pair<Base<F>,Base<F>>
+AchievedAndLogVolume
+( const Matrix<F>& R,
+  Base<F>& logVol,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    logVol = LogVolume( R );
+    return Achieved( R, ctrl );
+}
+
+template<typename F>
+std::pair<Base<F>,Base<F>>
+AchievedAndLogVolume
+( const DistMatrix<F>& R,
+  Base<F>& logVol,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( R );
+    logVol = LogVolume( R_STAR_STAR.Matrix() );
+    return Achieved( R_STAR_STAR.Matrix(), ctrl );
+}
+
+// MatrixType should be either Matrix<F> or DistMatrix<F>
+template<typename F,typename MatrixType>
+LLLInfo<Base<F>>
+AllSwapsAlg
+( MatrixType& B,
+  MatrixType& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::AllSwapsAlg"))
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    if( n > m )
+        LogicError("All-swaps LLL requires linearly independent columns");
+
+    // Refactor R from B after this many rounds (of an even and an odd phase)
+    const Int maxStaleRounds = Max(n,Int(1));
+
+    Timer timer;
+    double reduceTime=0, swapTime=0;
+    Int numSwaps=0, numRefactorizations=0;
+    bool converged = false;
+    while( !converged )
+    {
+        R = B;
+        qr::ExplicitTriang( R );
+        ++numRefactorizations;
+
+        for( Int round=0; round<maxStaleRounds; ++round )
+        {
+            Int roundSwaps=0;
+            for( Int parity=0; parity<2; ++parity )
+            {
+                if( ctrl.time )
+                    timer.Start();
+                SizeReduce( B, R, ctrl );
+                if( ctrl.time )
+                {
+                    reduceTime += timer.Stop();
+                    timer.Start();
+                }
+                roundSwaps += SwapPhase( parity, B, R, ctrl );
+                if( ctrl.time )
+                    swapTime += timer.Stop();
+            }
+            numSwaps += roundSwaps;
+            if( ctrl.progress )
+                Output("  round ",round," performed ",roundSwaps," swaps");
+            if( roundSwaps == 0 )
+            {
+                converged = ( round == 0 );
+                break;
+            }
+        }
+    }
+    if( ctrl.time )
+    {
+        Output("  Size reduction time: ",reduceTime);
+        Output("  Swap time:           ",swapTime);
+    }
+    if( ctrl.progress )
+        Output("  ",numRefactorizations," factorizations of B");
+
+    Real logVol;
+    auto achieved = AchievedAndLogVolume( R, logVol, ctrl );
+
+    LLLInfo<Real> info;
+    info.delta = achieved.first;
+    info.eta = achieved.second;
+    info.rank = n;
+    info.nullity = 0;
+    info.numSwaps = numSwaps;
+    info.logVol = logVol;
+    return info;
+}
+
+} // namespace lll
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_ALLSWAPS_HPP
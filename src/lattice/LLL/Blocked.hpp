@@ -2,302 +2,291 @@
    Copyright (c) 2009-2015, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #ifndef EL_LATTICE_LLL_BLOCKED_HPP
 #define EL_LATTICE_LLL_BLOCKED_HPP
 
+// A blocked LLL in the spirit of segment reduction: the basis is processed
+// in overlapping windows of 'blocksize' columns. Each window is
+//
+//  1. projected with the (accumulated) Householder transforms of all of the
+//     previous columns via a single compact-WY application,
+//  2. size-reduced against said columns using blocks of rows, so that the
+//     updates of R, B, U, and UInv are all Gemm's, and
+//  3. LLL-reduced in its projected form (an O(blocksize^3) problem which is
+//     independent of the height of B), with the unimodular transformation
+//     then applied to B, U, and UInv via Gemm.
+//
+// Consecutive windows overlap by a column so that every adjacent pair of
+// columns is checked for the Lovasz condition. If the local reduction of a
+// window modifies its first column, the Lovasz condition with the preceding
+// column may no longer hold, and so the reduction backs up by half a window.
+//
+// The Householder vectors, t, and d are stored in the same format as in the
+// unblocked algorithms, so that jumpstarting is supported.
+
 namespace El {
 namespace lll {
 
-// Assume that V is m x n and SInv is n x n with, the first k columns of V
-// and the first k rows and columns of SInv, up to date. 
+// Size-reduce the columns in the window [s,k1) of QR against the first s
+// columns, returning the integer multipliers in X. Rows are processed in
+// blocks from the bottom up so that the remaining rows are updated via Gemm.
+// The return value is true if any of the multipliers were nonzero.
 template<typename F>
-void ExpandBlockQR
-( Int k,
-  const Matrix<F>& B,
-        Matrix<F>& QR,
-        Matrix<F>& V,
-        Matrix<F>& SInv,
-  const Matrix<Base<F>>& d,
-  bool time )
-{
-    DEBUG_ONLY(CSE cse("lll::ExpandBlockQR"))
-    const Int m = B.Height();
-    const F* BBuf = B.LockedBuffer();
-          F* QRBuf = QR.Buffer();
-    const Base<F>* dBuf = d.LockedBuffer();
-    const Int BLDim = B.LDim();
-    const Int QRLDim = QR.LDim();
-
-    // Copy in the k'th column of B
-    for( Int i=0; i<m; ++i )
-        QRBuf[i+k*QRLDim] = BBuf[i+k*BLDim];
-
-    // Apply the first k Householder reflectors
-    Matrix<F> z;
-
-    if( time )
-        applyHouseTimer.Start();
-    // Exploit zeros in upper triangle of V
-    /*
-    Zeros( z, k, 1 );
-    blas::Gemv
-    ( 'C', m, k,
-      F(1), V.Buffer(), V.LDim(),
-            B.LockedBuffer(0,k), 1,
-      F(1), z.Buffer(), 1 );
-    */
-    z.Resize( k, 1 );
-    F* zBuf = z.Buffer();
-    for( Int i=0; i<k; ++i )
-        zBuf[i] = BBuf[i+k*BLDim];
-    blas::Trmv( 'L', 'C', 'N', k, V.Buffer(), V.LDim(), z.Buffer(), 1 );
-    blas::Gemv
-    ( 'C', m-k, k,
-      F(1), V.Buffer(k,0), V.LDim(),
-            B.LockedBuffer(k,k), 1,
-      F(1), z.Buffer(), 1 );
-
-    blas::Trsv
-    ( 'L', 'N', 'N', k, SInv.LockedBuffer(), SInv.LDim(), z.Buffer(), 1 );
-
-    // Exploit zeros in upper triangle of V
-    /*
-    blas::Gemv
-    ( 'N', m, k,
-      F(-1), V.Buffer(), V.LDim(),
-             z.LockedBuffer(), 1,
-      F(1), QR.Buffer(0,k), 1 );
-    */
-    blas::Gemv
-    ( 'N', m-k, k,
-      F(-1), V.Buffer(k,0), V.LDim(),
-             z.LockedBuffer(), 1,
-      F(1), &QRBuf[k+k*QRLDim], 1 );
-    blas::Trmv( 'L', 'N', 'N', k, V.Buffer(), V.LDim(), zBuf, 1 );
-    for( Int i=0; i<k; ++i )
-        QRBuf[i+k*QRLDim] -= zBuf[i];
-
-    if( time )
-        applyHouseTimer.Stop();
-
-    // Fix the scaling
-    for( Int i=0; i<k; ++i )
-        QRBuf[i+k*QRLDim] *= dBuf[i];
-}
-
-// Thus, only V(:,k) and SInv(0:k,k) needs to be computed in order to 
-// apply the block Householder transform I - V inv(S) V^H
-template<typename F>
-void BlockHouseholderStep
-( Int k,
+bool ReduceWindowAgainstPrefix
+( Int s,
+  Int k1,
   Matrix<F>& QR,
-  Matrix<F>& V,
-  Matrix<F>& SInv,
-  Matrix<F>& t,
-  Matrix<Base<F>>& d,
-  bool time )
+  Matrix<F>& X,
+  const LLLCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("lll::BlockHouseholderStep"))
+    DEBUG_ONLY(CSE cse("lll::ReduceWindowAgainstPrefix"))
     typedef Base<F> Real;
-    const Int m = QR.Height();
+    const Int width = k1-s;
+    const Int bsize = Max(ctrl.blocksize,Int(1));
+    Zeros( X, s, width );
 
     F* QRBuf = QR.Buffer();
-    F* VBuf = V.Buffer();
-    F* SInvBuf = SInv.Buffer();
+    F* XBuf = X.Buffer();
     const Int QRLDim = QR.LDim();
-    const Int VLDim = V.LDim();
-    const Int SInvLDim = SInv.LDim();
+    const Int XLDim = X.LDim();
 
-    // Perform the next step of Householder reduction
-    F& rhokk = QRBuf[k+k*QRLDim]; 
-    auto qr21 = QR( IR(k+1,END), IR(k) );
-    F tau = LeftReflector( rhokk, qr21 );
-    t.Set( k, 0, tau );
-    if( RealPart(rhokk) < Real(0) )
+    bool modified = false;
+    for( Int i1=s; i1>0; i1-=bsize )
     {
-        d.Set( k, 0, -1 );
-        rhokk *= -1;
-    }
-    else
-        d.Set( k, 0, +1 );
-
-    // Form the k'th column of V 
-    for( Int i=0; i<k; ++i )
-        VBuf[i+k*VLDim] = 0;
-    VBuf[k+k*VLDim] = 1;
-    for( Int i=k+1; i<m; ++i )
-        VBuf[i+k*VLDim] = QRBuf[i+k*QRLDim];
+        const Int i0 = Max(i1-bsize,0);
+        for( Int i=i1-1; i>=i0; --i )
+        {
+            const Real rho_i_i = RealPart(QRBuf[i+i*QRLDim]);
+            if( rho_i_i <= ctrl.zeroTol )
+                continue;
+            // Each column of the window is independent
+            EL_PARALLEL_FOR
+            for( Int c=0; c<width; ++c )
+            {
+                F* EL_RESTRICT qrCol = &QRBuf[(s+c)*QRLDim];
+                F chi = qrCol[i]/rho_i_i;
+                if( Abs(RealPart(chi)) > ctrl.eta ||
+                    Abs(ImagPart(chi)) > ctrl.eta )
+                {
+                    chi = Round(chi);
+                    const F* EL_RESTRICT qrPiv = &QRBuf[i*QRLDim];
+                    for( Int l=i0; l<=i; ++l )
+                        qrCol[l] -= chi*qrPiv[l];
+                    XBuf[i+c*XLDim] = chi;
+                }
+            }
+        }
 
-    // Form the k'th row of SInv
-    if( time )
-        formSInvTimer.Start();
-    /*
-    blas::Gemv
-    ( 'C', m, k,
-      F(1), VBuf, VLDim, &VBuf[k*VLDim], 1,
-      F(0), &SInvBuf[k], SInvLDim );
-    */
-    blas::Gemv
-    ( 'C', m-k, k,
-      F(1), &VBuf[k], VLDim, &VBuf[k+k*VLDim], 1,
-      F(0), &SInvBuf[k], SInvLDim );
-    SInvBuf[k+k*SInvLDim] = F(1)/t.Get(k,0);
-    if( time )
-        formSInvTimer.Stop();
+        // Update the rows above this block with a single Gemm
+        auto XBlock = X( IR(i0,i1), ALL );
+        if( MaxNorm(XBlock) == Real(0) )
+            continue;
+        modified = true;
+        if( i0 > 0 )
+        {
+            auto RAbove = QR( IR(0,i0), IR(i0,i1) );
+            auto QRAbove = QR( IR(0,i0), IR(s,k1) );
+            Gemm( NORMAL, NORMAL, F(-1), RAbove, XBlock, F(1), QRAbove );
+        }
+    }
+    return modified;
 }
 
-// Return true if the new vector is a zero vector
+// Size-reduce the window [s,k1) against the first s (already factored)
+// columns and then factor its projection. The return value is false if a
+// (numerically) zero column was encountered.
 template<typename F>
-bool BlockStep
-( Int k,
+bool PrepareWindow
+( Int s,
+  Int k1,
   Matrix<F>& B,
   Matrix<F>& U,
   Matrix<F>& UInv,
   Matrix<F>& QR,
-  Matrix<F>& V,
-  Matrix<F>& SInv,
   Matrix<F>& t,
   Matrix<Base<F>>& d,
   bool formU,
   bool formUInv,
   const LLLCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("lll::BlockStep"))
+    DEBUG_ONLY(CSE cse("lll::PrepareWindow"))
     typedef Base<F> Real;
-    const Int m = B.Height();
-    const Int n = B.Width();
     const Real eps = limits::Epsilon<Real>();
-
-    F* BBuf = B.Buffer();
-    F* UBuf = U.Buffer();
-    F* UInvBuf = UInv.Buffer();
-    F* QRBuf = QR.Buffer();
-    const Int BLDim = B.LDim();
-    const Int ULDim = U.LDim();
-    const Int UInvLDim = UInv.LDim();
-    const Int QRLDim = QR.LDim();
-
-    while( true ) 
+    const Int width = k1-s;
+    const Range<Int> prefixInd(0,s), windowInd(s,k1);
+
+    auto BWindow = B( ALL, windowInd );
+    auto QRWindow = QR( ALL, windowInd );
+    Matrix<F> X;
+    Matrix<Real> oldNorms, newNorms;
+    while( true )
     {
-        lll::ExpandBlockQR( k, B, QR, V, SInv, d, ctrl.time );
-
-        const Real oldNorm = blas::Nrm2( m, &BBuf[k*BLDim], 1 );
-        if( !limits::IsFinite(oldNorm) )
-            RuntimeError("Encountered an unbounded norm; increase precision");
-        if( oldNorm > Real(1)/eps )
-            RuntimeError("Encountered norm greater than 1/eps, where eps=",eps);
-        if( oldNorm <= ctrl.zeroTol )
+        QRWindow = BWindow;
+        if( s > 0 )
         {
-            for( Int i=0; i<m; ++i )
-                BBuf[i+k*BLDim] = 0;
-            for( Int i=0; i<m; ++i )
-                QRBuf[i+k*QRLDim] = 0;
-            t.Set( k, 0, Real(1)/Real(2) );
-            d.Set( k, 0, Real(1) );
-            return true;
+            if( ctrl.time )
+                applyHouseTimer.Start();
+            auto QRPrefix = QR( ALL, prefixInd );
+            auto tPrefix = t( prefixInd, ALL );
+            auto dPrefix = d( prefixInd, ALL );
+            qr::ApplyQ( LEFT, ADJOINT, QRPrefix, tPrefix, dPrefix, QRWindow );
+            if( ctrl.time )
+                applyHouseTimer.Stop();
         }
 
+        ColumnTwoNorms( BWindow, oldNorms );
         if( ctrl.time )
             roundTimer.Start();
-        if( ctrl.variant == LLL_WEAK )
+        const bool modified =
+          s > 0 && ReduceWindowAgainstPrefix( s, k1, QR, X, ctrl );
+        if( modified )
         {
-            if( Abs(QRBuf[(k-1)+(k-1)*QRLDim]) > ctrl.zeroTol )
+            auto BPrefix = B( ALL, prefixInd );
+            Gemm( NORMAL, NORMAL, F(-1), BPrefix, X, F(1), BWindow );
+            if( formU )
             {
-                F chi = QRBuf[(k-1)+k*QRLDim]/QRBuf[(k-1)+(k-1)*QRLDim];
-                if( Abs(RealPart(chi)) > ctrl.eta ||
-                    Abs(ImagPart(chi)) > ctrl.eta )
-                {
-                    chi = Round(chi);
-                    blas::Axpy
-                    ( k, -chi,
-                      &QRBuf[(k-1)*QRLDim], 1,
-                      &QRBuf[k*QRLDim], 1 );
-                    blas::Axpy
-                    ( m, -chi,
-                      &BBuf[(k-1)*BLDim], 1,
-                      &BBuf[k*BLDim], 1 );
-                    if( formU )
-                        blas::Axpy
-                        ( n, -chi,
-                          &UBuf[(k-1)*ULDim], 1,
-                          &UBuf[k*ULDim], 1 );
-                    if( formUInv )
-                        blas::Axpy
-                        ( n, chi,
-                          &UInvBuf[k], UInvLDim,
-                          &UInvBuf[k-1], UInvLDim );
-                }
-                else
-                    chi = 0;
+                auto UPrefix = U( ALL, prefixInd );
+                auto UWindow = U( ALL, windowInd );
+                Gemm( NORMAL, NORMAL, F(-1), UPrefix, X, F(1), UWindow );
             }
-        }
-        else
-        {
-            vector<F> xBuf(k);
-            for( Int i=k-1; i>=0; --i )
+            if( formUInv )
             {
-                if( Abs(QRBuf[i+i*QRLDim]) <= ctrl.zeroTol )
-                {
-                    xBuf[i] = 0;
-                    continue;
-                }
-                F chi = QRBuf[i+k*QRLDim]/QRBuf[i+i*QRLDim];
-                if( Abs(RealPart(chi)) > ctrl.eta ||
-                    Abs(ImagPart(chi)) > ctrl.eta )
-                {
-                    chi = Round(chi);
-                    blas::Axpy
-                    ( i+1, -chi,
-                      &QRBuf[i*QRLDim], 1,
-                      &QRBuf[k*QRLDim], 1 );
-                }
-                else
-                    chi = 0;
-                xBuf[i] = chi;
+                auto UInvPrefix = UInv( prefixInd, ALL );
+                auto UInvWindow = UInv( windowInd, ALL );
+                Gemm
+                ( NORMAL, NORMAL, F(1), X, UInvWindow, F(1), UInvPrefix );
             }
-            blas::Gemv
-            ( 'N', m, k,
-              F(-1), BBuf, BLDim, &xBuf[0], 1,
-              F(+1), &BBuf[k*BLDim], 1 );
-            if( formU )
-                blas::Gemv
-                ( 'N', n, k,
-                  F(-1), UBuf, ULDim, &xBuf[0], 1,
-                  F(+1), &UBuf[k*ULDim], 1 );
-            if( formUInv )
-                blas::Geru
-                ( k, n,
-                  F(1), &xBuf[0],    1,
-                        &UInvBuf[k], UInvLDim,
-                        &UInvBuf[0], UInvLDim );
         }
-        const Real newNorm = blas::Nrm2( m, &BBuf[k*BLDim], 1 );
         if( ctrl.time )
             roundTimer.Stop();
-        if( !limits::IsFinite(newNorm) )
-            RuntimeError("Encountered an unbounded norm; increase precision");
-        if( newNorm > Real(1)/eps )
-            RuntimeError("Encountered norm greater than 1/eps, where eps=",eps);
+        if( !modified )
+            break;
 
-        if( newNorm > ctrl.reorthogTol*oldNorm )
+        // Check for cancellation in the same manner as lll::Step
+        ColumnTwoNorms( BWindow, newNorms );
+        bool reorthog = false;
+        for( Int c=0; c<width; ++c )
         {
-            break;
+            const Real oldNorm = oldNorms.Get(c,0);
+            const Real newNorm = newNorms.Get(c,0);
+            if( !limits::IsFinite(newNorm) )
+                RuntimeError
+                ("Encountered an unbounded norm; increase precision");
+            if( newNorm > Real(1)/eps )
+                RuntimeError
+                ("Encountered norm greater than 1/eps, where eps=",eps);
+            if( newNorm <= ctrl.reorthogTol*oldNorm )
+                reorthog = true;
         }
-        else if( ctrl.progress )
-            Output
-            ("  Reorthogonalizing with k=",k,
-             " since oldNorm=",oldNorm," and newNorm=",newNorm);
+        if( !reorthog )
+            break;
+        if( ctrl.progress )
+            Output("  Reorthogonalizing window [",s,",",k1,")");
     }
 
-    lll::BlockHouseholderStep( k, QR, V, SInv, t, d, ctrl.time );
-    return false;
+    // Factor the projection of the window
+    auto QRBottom = QR( IR(s,END), windowInd );
+    Matrix<F> tWindow;
+    Matrix<Real> dWindow;
+    El::QR( QRBottom, tWindow, dWindow );
+    for( Int c=0; c<width; ++c )
+    {
+        t.Set( s+c, 0, tWindow.Get(c,0) );
+        d.Set( s+c, 0, dWindow.Get(c,0) );
+        if( QR.GetRealPart(s+c,s+c) <= ctrl.zeroTol )
+            return false;
+    }
+    return true;
+}
+
+// LLL-reduce the projection of the window [s,k1) and apply the resulting
+// unimodular transformation to B, U, and UInv. The return value is false if
+// the window was found to be linearly dependent.
+template<typename F>
+bool ReduceWindow
+( Int s,
+  Int k1,
+  Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& UInv,
+  const Matrix<F>& QR,
+  bool formU,
+  bool formUInv,
+  Int& numSwaps,
+  bool& modified,
+  bool& firstModified,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lll::ReduceWindow"))
+    typedef Base<F> Real;
+    const Int width = k1-s;
+    const Range<Int> windowInd(s,k1);
+
+    // Constructing from the (temporary) view would move it, and RWindow
+    // would then overwrite the window's Householder vectors in QR
+    Matrix<F> RWindow;
+    Copy( QR(windowInd,windowInd), RWindow );
+    MakeTrapezoidal( UPPER, RWindow );
+
+    LLLCtrl<Real> windowCtrl( ctrl );
+    windowCtrl.jumpstart = false;
+    windowCtrl.startCol = 0;
+    windowCtrl.presort = false;
+    windowCtrl.progress = false;
+    windowCtrl.time = false;
+    Matrix<F> UWindow, UInvWindow, QRWindow, tWindow;
+    Matrix<Real> dWindow;
+    Identity( UWindow, width, width );
+    Identity( UInvWindow, width, width );
+    auto info =
+      UnblockedAlg
+      ( RWindow, UWindow, UInvWindow, QRWindow, tWindow, dWindow,
+        true, true, windowCtrl );
+    numSwaps = info.numSwaps;
+    if( info.nullity > 0 )
+        return false;
+
+    // Size reduction within the window never modifies its first column
+    firstModified = false;
+    modified = false;
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<width; ++i )
+        {
+            if( UWindow.Get(i,j) != ( i==j ? F(1) : F(0) ) )
+            {
+                modified = true;
+                if( j == 0 )
+                    firstModified = true;
+            }
+        }
+    }
+    if( !modified )
+        return true;
+
+    Matrix<F> Z;
+    auto BWindow = B( ALL, windowInd );
+    Gemm( NORMAL, NORMAL, F(1), BWindow, UWindow, Z );
+    BWindow = Z;
+    if( formU )
+    {
+        auto UWin = U( ALL, windowInd );
+        Gemm( NORMAL, NORMAL, F(1), UWin, UWindow, Z );
+        UWin = Z;
+    }
+    if( formUInv )
+    {
+        auto UInvWin = UInv( windowInd, ALL );
+        Gemm( NORMAL, NORMAL, F(1), UInvWindow, UInvWin, Z );
+        UInvWin = Z;
+    }
+    return true;
 }
 
-// Consider explicitly returning both Q and R rather than just R (in 'QR')
 template<typename F>
 LLLInfo<Base<F>> BlockedAlg
 ( Matrix<F>& B,
@@ -311,103 +300,105 @@ LLLInfo<Base<F>> BlockedAlg
   const LLLCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lll::BlockedAlg"))
-    if( ctrl.jumpstart )
-        LogicError("The blocked LLL algorithm does not support jumpstarting");
     typedef Base<F> Real;
     if( ctrl.time )
     {
         applyHouseTimer.Reset();
         roundTimer.Reset();
-        formSInvTimer.Reset();
     }
 
     const Int m = B.Height();
     const Int n = B.Width();
-    const Int minDim = Min(m,n);
-    Matrix<F> V, SInv;
-    Zeros( QR, m, n );
-    Zeros( V, m, minDim );
-    Zeros( SInv, minDim, minDim );
-    Zeros( d, minDim, 1 );
-    Zeros( t, minDim, 1 );
+    if( n > m )
+        LogicError("The blocked LLL requires at least as many rows as columns");
+    // Backing up by half a window must retain the pair being checked
+    const Int bsize = Max(ctrl.blocksize,Int(4));
 
-    // Perform the first step of Householder reduction
-    lll::ExpandBlockQR( 0, B, QR, V, SInv, d, ctrl.time );
-    lll::BlockHouseholderStep( 0, QR, V, SInv, t, d, ctrl.time );
-    Int nullity = 0;
+    Int k0 = 0;
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
     {
-        auto b0 = B(ALL,IR(0));
-        if( FrobeniusNorm(b0) <= ctrl.zeroTol )
-        {
-            auto QR0 = QR(ALL,IR(0));
-            Zero( b0 );
-            Zero( QR0 );
-            nullity = 1;
-        }
+        if( QR.Height() != m || QR.Width() != n )
+            LogicError("QR should have been m x n");
+        if( t.Height() != n || t.Width() != 1 )
+            LogicError("t should have been n x 1");
+        if( d.Height() != n || d.Width() != 1 )
+            LogicError("d should have been n x 1");
+        k0 = ctrl.startCol;
+    }
+    else
+    {
+        Zeros( QR, m, n );
+        Zeros( t, n, 1 );
+        Zeros( d, n, 1 );
     }
 
-    Int k=1, numSwaps=0;
-    while( k < n )
+    Int numSwaps=0, numWindows=0;
+    bool dependent = false;
+    while( k0 < n )
     {
-        bool zeroVector =
-          lll::BlockStep
-          ( k, B, U, UInv, QR, V, SInv, t, d, formU, formUInv, ctrl );
-        if( zeroVector )
-            nullity = k+1;
-        else
-            nullity = Min(nullity,k);
+        const Int s = Max(k0-1,0);
+        const Int k1 = Min(s+bsize,n);
+        ++numWindows;
 
-        const Real rho_km1_km1 = QR.GetRealPart(k-1,k-1);
-        const F rho_km1_k = QR.Get(k-1,k);
-        const Real rho_k_k = QR.GetRealPart(k,k); 
+        if( !PrepareWindow
+             ( s, k1, B, U, UInv, QR, t, d, formU, formUInv, ctrl ) )
+        {
+            dependent = true;
+            break;
+        }
 
-        const Real leftTerm = Sqrt(ctrl.delta)*rho_km1_km1;
-        const Real rightTerm = lapack::SafeNorm(rho_k_k,rho_km1_k);
-        if( leftTerm <= rightTerm )
+        Int windowSwaps;
+        bool modified, firstModified;
+        if( !ReduceWindow
+             ( s, k1, B, U, UInv, QR, formU, formUInv,
+               windowSwaps, modified, firstModified, ctrl ) )
         {
-            ++k;
+            dependent = true;
+            break;
         }
-        else
+        numSwaps += windowSwaps;
+        if( modified &&
+            !PrepareWindow
+             ( s, k1, B, U, UInv, QR, t, d, formU, formUInv, ctrl ) )
+        {
+            dependent = true;
+            break;
+        }
+
+        if( firstModified && s > 0 )
         {
-            ++numSwaps;
             if( ctrl.progress )
-                Output("Dropping from k=",k," to ",Max(k-1,1)," since sqrt(delta)*R(k-1,k-1)=",leftTerm," > ",rightTerm);
-            ColSwap( B, k-1, k );
-            if( formU )
-                ColSwap( U, k-1, k );
-            if( formUInv )
-                RowSwap( UInv, k-1, k );
-            if( k == 1 )
-            {
-                // We must reinitialize since we keep k=1
-                lll::ExpandBlockQR( 0, B, QR, V, SInv, d, ctrl.time );
-                lll::BlockHouseholderStep( 0, QR, V, SInv, t, d, ctrl.time );
-                {
-                    auto b0 = B(ALL,IR(0));
-                    if( FrobeniusNorm(b0) <= ctrl.zeroTol )
-                    {
-                        auto QR0 = QR(ALL,IR(0));
-                        Zero( b0 );
-                        Zero( QR0 );
-                        nullity = 1;
-                    }
-                    else
-                        nullity = 0;
-                }
-            }
-            else
-            {
-                k = k-1; 
-            }
+                Output
+                ("  Window [",s,",",k1,") modified its first column, so "
+                 "backing up from k=",k0," to ",Max(s-bsize/2,0));
+            k0 = Max(s-bsize/2,0);
         }
+        else
+            k0 = k1;
+    }
+
+    if( dependent )
+    {
+        // The windows assume full column rank, so fall back to the unblocked
+        // algorithm (which continues to accumulate into U and UInv)
+        if( ctrl.progress )
+            Output("  Falling back to unblocked LLL due to dependence");
+        LLLCtrl<Real> unblockedCtrl( ctrl );
+        unblockedCtrl.jumpstart = false;
+        unblockedCtrl.startCol = 0;
+        auto info =
+          UnblockedAlg( B, U, UInv, QR, t, d, formU, formUInv, unblockedCtrl );
+        info.numSwaps += numSwaps;
+        return info;
     }
 
     if( ctrl.time )
     {
         Output("  Apply Householder time: ",applyHouseTimer.Total());
-        Output("  Form SInv time:         ",formSInvTimer.Total());
         Output("  Round time:             ",roundTimer.Total());
     }
+    if( ctrl.progress )
+        Output("  Processed ",numWindows," windows");
 
     std::pair<Real,Real> achieved = lll::Achieved(QR,ctrl);
     Real logVol = lll::LogVolume(QR);
@@ -415,13 +406,24 @@ LLLInfo<Base<F>> BlockedAlg
     LLLInfo<Base<F>> info;
     info.delta = achieved.first;
     info.eta = achieved.second;
-    info.rank = n-nullity;
-    info.nullity = nullity;
+    info.rank = n;
+    info.nullity = 0;
     info.numSwaps = numSwaps;
     info.logVol = logVol;
     return info;
 }
 
+// The blocked algorithm only pays off for large bases and does not support
+// deep insertion (or the weaker size reduction of LLL_WEAK)
+template<typename F>
+bool UseBlocked( const Matrix<F>& B, const LLLCtrl<Base<F>>& ctrl )
+{
+    const Int m = B.Height();
+    const Int n = B.Width();
+    return ctrl.variant == LLL_NORMAL && !ctrl.presort &&
+           n >= ctrl.blockedCutoff && n > ctrl.blocksize && n <= m;
+}
+
 } // namespace lll
 } // namespace El
 
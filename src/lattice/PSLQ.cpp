@@ -0,0 +1,447 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The multi-pair PSLQ algorithm of Bailey and Broadhurst maintains an integer
+// matrix B (and its inverse, A) such that y^T = x^T B, along with a lower
+// trapezoidal n x (n-1) matrix H whose columns span the orthogonal complement
+// of x. Each iteration exchanges up to beta n disjoint pairs of adjacent rows
+// of H (and the corresponding entries of y and rows of A), chosen so as to
+// maximize gamma^(i+1) |H(i,i)|, restores the trapezoidal structure with an
+// independent rotation per pair, and then performs a full (Hermite) reduction
+// of H. A relation is exposed as column j of B once y(j) becomes negligible.
+//
+// Since the row pairs are disjoint, the exchanges and rotations are performed
+// in parallel, as are the reductions of the rows of H. For the sake of
+// unit-stride access, H and A are stored in their transposed forms, G = H^T
+// and AT = A^T, so that the row operations become column operations.
+//
+// Rather than performing each iteration in the precision of x, scaled copies
+// of y and H are iterated in double (or, failing that, Quad) precision while
+// accumulating the integer transformation from the identity. Once either the
+// accumulated transformation threatens to become inexact or the smallest
+// entry of y can no longer be resolved, the transformation is applied in the
+// original precision, where H is re-triangularized with a QR factorization
+// and reduced.
+
+namespace El {
+namespace pslq {
+
+// Reduce each row of H = G^T against the rows above it and apply the implied
+// unimodular transformation to y, A, and B. The return value is true if any
+// of the multipliers were nonzero.
+template<typename Real>
+bool Reduce
+( Matrix<Real>& y,
+  Matrix<Real>& G,
+  Matrix<Real>& AT,
+  Matrix<Real>& B )
+{
+    DEBUG_ONLY(CSE cse("pslq::Reduce"))
+    const Int n = G.Width();
+    const Int nm1 = G.Height();
+    Matrix<Real> T;
+    Identity( T, n, n );
+
+    Real* GBuf = G.Buffer();
+    Real* TBuf = T.Buffer();
+    const Int GLDim = G.LDim();
+    const Int TLDim = T.LDim();
+
+    // Column j of G is only modified by the rows above j, so, when row j is
+    // processed, column j is still in its original state. Thus the columns
+    // to its right may be reduced in parallel.
+    bool modified = false;
+    for( Int j=nm1-1; j>=0; --j )
+    {
+        const Real eta = GBuf[j+j*GLDim];
+        if( eta == Real(0) )
+            continue;
+        const Real* EL_RESTRICT jCol = &GBuf[j*GLDim];
+
+        EL_PARALLEL_FOR
+        for( Int i=j+1; i<n; ++i )
+        {
+            Real* EL_RESTRICT iCol = &GBuf[i*GLDim];
+            const Real tau = Round(iCol[j]/eta);
+            if( tau == Real(0) )
+                continue;
+            for( Int k=0; k<=j; ++k )
+                iCol[k] -= tau*jCol[k];
+            TBuf[j+i*TLDim] = -tau;
+        }
+        for( Int i=j+1; i<n && !modified; ++i )
+            modified = ( TBuf[j+i*TLDim] != Real(0) );
+    }
+    if( !modified )
+        return false;
+
+    // Since H := D H for the unit lower-triangular matrix D = T^T,
+    //
+    //   A := D A,  B := B inv(D),  and  y := inv(D)^T y.
+    //
+    // (T is stored explicitly, and the fallback Trmm does not yet support
+    // the extended-precision types, so A^T T is formed with Gemm)
+    Matrix<Real> ATOld( AT );
+    Gemm( NORMAL, NORMAL, Real(1), ATOld, T, AT );
+    Trsm( RIGHT, UPPER, TRANSPOSE, UNIT, Real(1), T, B );
+    Trsv( UPPER, NORMAL, UNIT, T, y );
+    return true;
+}
+
+// Perform a single multi-pair iteration, returning the number of exchanges
+template<typename Real>
+Int Iterate
+( Matrix<Real>& y,
+  Matrix<Real>& G,
+  Matrix<Real>& AT,
+  Matrix<Real>& B,
+  const vector<Real>& gammaPowers,
+  Int maxPairs )
+{
+    DEBUG_ONLY(CSE cse("pslq::Iterate"))
+    const Int n = G.Width();
+    const Int nm1 = G.Height();
+
+    // Greedily select the disjoint pairs with the largest weights
+    vector<std::pair<Real,Int>> weights(nm1);
+    for( Int i=0; i<nm1; ++i )
+        weights[i] = std::make_pair( gammaPowers[i]*Abs(G.Get(i,i)), i );
+    std::sort
+    ( weights.begin(), weights.end(),
+      []( const std::pair<Real,Int>& a, const std::pair<Real,Int>& b )
+      { return a.first > b.first; } );
+    vector<bool> used(n,false);
+    vector<Int> pairs;
+    for( const auto& weight : weights )
+    {
+        const Int i = weight.second;
+        if( used[i] || used[i+1] )
+            continue;
+        used[i] = used[i+1] = true;
+        pairs.push_back( i );
+        if( Int(pairs.size()) == maxPairs )
+            break;
+    }
+    const Int numPairs = pairs.size();
+
+    Real* yBuf = y.Buffer();
+    Real* GBuf = G.Buffer();
+    Real* ATBuf = AT.Buffer();
+    Real* BBuf = B.Buffer();
+    const Int GLDim = G.LDim();
+    const Int ATLDim = AT.LDim();
+    const Int BLDim = B.LDim();
+
+    // The exchanges must be completed before the rotations since the latter
+    // touch the columns of G exchanged by the neighboring pairs
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numPairs; ++k )
+    {
+        const Int i = pairs[k];
+        std::swap( yBuf[i], yBuf[i+1] );
+        blas::Swap
+        ( Min(i+2,nm1), &GBuf[i*GLDim], 1, &GBuf[(i+1)*GLDim], 1 );
+        blas::Swap( n, &ATBuf[i*ATLDim], 1, &ATBuf[(i+1)*ATLDim], 1 );
+        blas::Swap( n, &BBuf[i*BLDim], 1, &BBuf[(i+1)*BLDim], 1 );
+    }
+
+    // Each exchange (other than of the last pair) introduces a nonzero in
+    // the strictly lower triangle of G, which is removed by a rotation of
+    // the pair of rows
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numPairs; ++k )
+    {
+        const Int i = pairs[k];
+        if( i+1 >= nm1 )
+            continue;
+        const Real alpha = GBuf[i+i*GLDim];
+        const Real beta = GBuf[(i+1)+i*GLDim];
+        const Real rho = lapack::SafeNorm( alpha, beta );
+        if( rho == Real(0) )
+            continue;
+        const Real c = alpha/rho;
+        const Real s = beta/rho;
+        for( Int j=i; j<n; ++j )
+        {
+            Real* gCol = &GBuf[j*GLDim];
+            const Real gamma0 = gCol[i];
+            const Real gamma1 = gCol[i+1];
+            gCol[i]   =  c*gamma0 + s*gamma1;
+            gCol[i+1] = -s*gamma0 + c*gamma1;
+        }
+        GBuf[(i+1)+i*GLDim] = 0;
+    }
+
+    Reduce( y, G, AT, B );
+    return numPairs;
+}
+
+template<typename Real>
+Real NormBound( const Matrix<Real>& G )
+{
+    const Int nm1 = G.Height();
+    Real maxDiag = 0;
+    for( Int j=0; j<nm1; ++j )
+        maxDiag = Max( maxDiag, Abs(G.Get(j,j)) );
+    return Real(1)/maxDiag;
+}
+
+template<typename Real>
+vector<Real> GammaPowers( Real gamma, Int n )
+{
+    vector<Real> gammaPowers(n-1);
+    Real gammaPower = gamma;
+    for( Int i=0; i<n-1; ++i )
+    {
+        gammaPowers[i] = gammaPower;
+        gammaPower *= gamma;
+    }
+    return gammaPowers;
+}
+
+// Iterate on copies of y and H in the precision of RealLower until the
+// accumulated transformation can no longer be trusted, and then apply it in
+// the original precision. The return value is the number of iterations
+// which were performed (zero if the lower precision was insufficient).
+template<typename Real,typename RealLower>
+Int LowerPrecisionIterations
+( Matrix<Real>& y,
+  Matrix<Real>& G,
+  Matrix<Real>& AT,
+  Matrix<Real>& B,
+  Int maxIts,
+  const PSLQCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("pslq::LowerPrecisionIterations"))
+    const Int n = G.Width();
+    const RealLower epsLower = limits::Epsilon<RealLower>();
+    // The smallest entry of the normalized y which is reliably resolved
+    const RealLower yTol = Pow(epsLower,RealLower(0.85));
+    // The largest entry of A or B for which the updates remain exact
+    const RealLower maxEntry = RealLower(1)/Pow(epsLower,RealLower(0.8));
+
+    // Normalize y in the original precision to avoid underflow
+    Matrix<Real> yScaled( y );
+    const Real yMax = MaxNorm( yScaled );
+    if( yMax == Real(0) )
+        return 0;
+    Scale( Real(1)/yMax, yScaled );
+
+    Matrix<RealLower> yLower, GLower, ATLower, BLower;
+    Copy( yScaled, yLower );
+    Copy( G, GLower );
+    Identity( ATLower, n, n );
+    Identity( BLower, n, n );
+    const auto gammaPowers = GammaPowers( RealLower(ctrl.gamma), n );
+    const Int maxPairs = Max( Int(double(ctrl.beta)*n), Int(1) );
+
+    Int numIts = 0;
+    // Only the transformation needs to be rolled back, as y and H are
+    // recomputed in the original precision
+    Matrix<RealLower> ATPrev, BPrev;
+    while( numIts < maxIts && MinAbsLoc(yLower).value > yTol )
+    {
+        ATPrev = ATLower;
+        BPrev = BLower;
+        Iterate( yLower, GLower, ATLower, BLower, gammaPowers, maxPairs );
+
+        // Roll back the last iteration if it was not exact
+        const RealLower GMax = MaxNorm( GLower );
+        if( !limits::IsFinite(GMax) ||
+            MaxNorm(ATLower) >= maxEntry || MaxNorm(BLower) >= maxEntry )
+        {
+            ATLower = ATPrev;
+            BLower = BPrev;
+            break;
+        }
+        ++numIts;
+    }
+    if( numIts == 0 )
+    {
+        if( ctrl.progress )
+            Output("  ",TypeName<RealLower>()," iterations were insufficient");
+        return 0;
+    }
+
+    Matrix<Real> ATStep, BStep, yNew, ATNew, BNew, GNew;
+    Copy( ATLower, ATStep );
+    Copy( BLower, BStep );
+    Zeros( yNew, n, 1 );
+    Gemv( TRANSPOSE, Real(1), BStep, y, Real(0), yNew );
+    y = yNew;
+    Gemm( NORMAL, NORMAL, Real(1), AT, ATStep, ATNew );
+    AT = ATNew;
+    Gemm( NORMAL, NORMAL, Real(1), B, BStep, BNew );
+    B = BNew;
+
+    // The rotations of the lower-precision iterations were not accumulated,
+    // and so H must be re-triangularized
+    Gemm( NORMAL, NORMAL, Real(1), G, ATStep, GNew );
+    G = GNew;
+    qr::ExplicitTriang( G );
+    Reduce( y, G, AT, B );
+
+    if( ctrl.progress )
+        Output("  ",numIts," iterations in ",TypeName<RealLower>());
+    return numIts;
+}
+
+} // namespace pslq
+
+template<typename Real>
+PSLQInfo<Real> PSLQ
+( const Matrix<Real>& x,
+        Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("PSLQ"))
+    if( x.Width() != 1 )
+        LogicError("x was assumed to be a column vector");
+    const Int n = x.Height();
+    if( n < 2 )
+        LogicError("PSLQ requires at least two entries");
+
+    PSLQInfo<Real> info;
+    Identity( U, n, n );
+
+    Matrix<Real> y( x );
+    const Real xNorm = FrobeniusNorm( x );
+    if( xNorm == Real(0) )
+        LogicError("x was zero");
+    Scale( Real(1)/xNorm, y );
+
+    // Each (nearly) zero entry of x trivially yields a relation, and the
+    // construction of H below requires that there are none
+    vector<Int> zeroInds, nonzeroInds;
+    for( Int i=0; i<n; ++i )
+    {
+        if( Abs(y.Get(i,0)) <= ctrl.zeroTol )
+            zeroInds.push_back( i );
+        else
+            nonzeroInds.push_back( i );
+    }
+    if( zeroInds.size() > 0 )
+    {
+        const Int nullity = zeroInds.size();
+        Zeros( U, n, n );
+        for( Int k=0; k<nullity; ++k )
+            U.Set( zeroInds[k], k, Real(1) );
+        for( Int k=nullity; k<n; ++k )
+            U.Set( nonzeroInds[k-nullity], k, Real(1) );
+        info.nullity = nullity;
+        return info;
+    }
+
+    // Form G = H^T, where
+    //
+    //   H(j,j) = s(j+1)/s(j),  H(i,j) = -y(i) y(j) / (s(j) s(j+1)), i > j,
+    //
+    // and s(j) = || y(j:n-1) ||_2
+    vector<Real> s(n);
+    s[n-1] = Abs(y.Get(n-1,0));
+    for( Int j=n-2; j>=0; --j )
+        s[j] = lapack::SafeNorm( s[j+1], y.Get(j,0) );
+    Matrix<Real> G;
+    Zeros( G, n-1, n );
+    for( Int j=0; j<n-1; ++j )
+    {
+        G.Set( j, j, s[j+1]/s[j] );
+        for( Int i=j+1; i<n; ++i )
+            G.Set( j, i, -y.Get(i,0)*y.Get(j,0)/(s[j]*s[j+1]) );
+    }
+    Matrix<Real> AT;
+    Identity( AT, n, n );
+    pslq::Reduce( y, G, AT, U );
+
+    const auto gammaPowers = pslq::GammaPowers( ctrl.gamma, n );
+    const Int maxPairs = Max( Int(double(ctrl.beta)*n), Int(1) );
+    Timer lowerTimer, fullTimer;
+    while( info.numIts < ctrl.maxIts &&
+           MinAbsLoc(y).value > ctrl.zeroTol )
+    {
+        const Int maxIts = ctrl.maxIts - info.numIts;
+        Int numIts = 0;
+        if( ctrl.time )
+            lowerTimer.Start();
+        if( ctrl.lowerPrecision && PrecisionIsGreater<Real,double>::value )
+            numIts =
+              pslq::LowerPrecisionIterations<Real,double>
+              ( y, G, AT, U, maxIts, ctrl );
+#ifdef EL_HAVE_QUAD
+        if( numIts == 0 && ctrl.lowerPrecision &&
+            PrecisionIsGreater<Real,Quad>::value )
+            numIts =
+              pslq::LowerPrecisionIterations<Real,Quad>
+              ( y, G, AT, U, maxIts, ctrl );
+#endif
+        if( ctrl.time )
+            lowerTimer.Stop();
+        info.numLowerIts += numIts;
+
+        if( numIts == 0 )
+        {
+            if( ctrl.time )
+                fullTimer.Start();
+            pslq::Iterate( y, G, AT, U, gammaPowers, maxPairs );
+            numIts = 1;
+            if( ctrl.time )
+                fullTimer.Stop();
+        }
+        info.numIts += numIts;
+
+        if( ctrl.progress )
+            Output
+            ("After ",info.numIts," iterations: min |y|=",MinAbsLoc(y).value,
+             ", relation norm bound=",pslq::NormBound(G));
+    }
+    if( ctrl.time )
+    {
+        Output("  Lower-precision PSLQ: ",lowerTimer.Total()," seconds");
+        Output("  Full-precision PSLQ:  ",fullTimer.Total()," seconds");
+    }
+    info.normBound = pslq::NormBound( G );
+
+    // Move the relations to the front of U
+    vector<Int> relationInds, otherInds;
+    for( Int j=0; j<n; ++j )
+    {
+        if( Abs(y.Get(j,0)) <= ctrl.zeroTol )
+            relationInds.push_back( j );
+        else
+            otherInds.push_back( j );
+    }
+    info.nullity = relationInds.size();
+    if( info.nullity > 0 )
+    {
+        relationInds.insert
+        ( relationInds.end(), otherInds.begin(), otherInds.end() );
+        Matrix<Real> UPerm;
+        Zeros( UPerm, n, n );
+        for( Int k=0; k<n; ++k )
+            for( Int i=0; i<n; ++i )
+                UPerm.Set( i, k, U.Get(i,relationInds[k]) );
+        U = UPerm;
+    }
+    return info;
+}
+
+#define PROTO(Real) \
+  template PSLQInfo<Real> PSLQ \
+  ( const Matrix<Real>& x, \
+          Matrix<Real>& U, \
+    const PSLQCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,383 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "./Sieve/Database.hpp"
+
+namespace El {
+
+namespace svp {
+namespace sieve {
+
+// Pair tests which are within this relative tolerance of the reduction
+// condition are skipped so that single-precision noise cannot cause cycling
+const double reductionTol = 1e-4;
+
+// Attempt to shorten the candidate by a multiple of the list vector in the
+// given slot, which must be no longer than the candidate. Since the new
+// vector is recomputed from its coordinates, the reduction is only accepted
+// if the norm provably decreased.
+inline bool ReduceBy
+( Candidate& c, const Database& db, Int slot, const SieveCtrl& ctrl )
+{
+    const double wNormSq = db.NormSq( slot );
+    if( wNormSq > c.normSq || wNormSq == 0. )
+        return false;
+    if( ctrl.simHash &&
+        !SimHashPasses( c.hash, db.Hash(slot), ctrl.simHashThreshold ) )
+        return false;
+    const double dot = Dot( db.Stride(), c.vec.data(), db.Vector(slot) );
+    if( 2*Abs(dot) <= (1+reductionTol)*wNormSq )
+        return false;
+
+    const Int n = db.Dimension();
+    const Int k = Int(Round(dot/wNormSq));
+    const Int* w = db.Coeffs( slot );
+    Candidate old( c );
+    for( Int i=0; i<n; ++i )
+        c.coeffs[i] -= k*w[i];
+    db.Embed( c );
+    if( c.normSq >= old.normSq )
+    {
+        c = std::move( old );
+        return false;
+    }
+    return true;
+}
+
+// Reduce the candidate against the list vectors in the given slots until no
+// further progress is made, returning whether it was modified
+inline bool ReduceByList
+( Candidate& c,
+  const Database& db,
+  const vector<Int>& slots,
+  const SieveCtrl& ctrl )
+{
+    bool reduced = false, progress = true;
+    while( progress )
+    {
+        progress = false;
+        for( const Int& slot : slots )
+            if( ReduceBy( c, db, slot, ctrl ) )
+                progress = reduced = true;
+    }
+    return reduced;
+}
+
+// Return the multiple of the candidate which should be subtracted from the
+// (longer) list vector in the given slot (zero if it cannot be reduced)
+inline Int ReductionMultiplier
+( const Candidate& c, const Database& db, Int slot, const SieveCtrl& ctrl )
+{
+    if( db.NormSq(slot) <= c.normSq )
+        return 0;
+    if( ctrl.simHash &&
+        !SimHashPasses( c.hash, db.Hash(slot), ctrl.simHashThreshold ) )
+        return 0;
+    const double dot = Dot( db.Stride(), c.vec.data(), db.Vector(slot) );
+    if( 2*Abs(dot) <= (1+reductionTol)*c.normSq )
+        return 0;
+    return Int(Round(dot/c.normSq));
+}
+
+// Klein's randomized nearest-plane algorithm (with continuous Gaussian
+// perturbations) restricted to the leading 'dim' columns of R
+inline void KleinSample
+( Candidate& c, const Matrix<double>& R, Int dim, double width )
+{
+    const Int n = R.Width();
+    c.coeffs.assign( n, 0 );
+    for( Int i=dim-1; i>=0; --i )
+    {
+        double center = 0;
+        for( Int j=i+1; j<dim; ++j )
+            center -= R.Get(i,j)*c.coeffs[j];
+        const double rho = R.Get(i,i);
+        center /= rho;
+        c.coeffs[i] = Int(Round(SampleNormal(center,width/Abs(rho))));
+    }
+}
+
+// Run the sieve on the lattice with (scaled) Gaussian Normal Form R, stopping
+// early if a vector with squared norm below 'targetNormSq' is found. The
+// coordinates of the shortest vector found are returned in 'best'.
+inline double GaussSieve
+( const Matrix<double>& R,
+  double targetNormSq,
+  vector<Int>& best,
+  const SieveCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svp::sieve::GaussSieve"))
+    const Int n = R.Width();
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads = omp_get_max_threads();
+#endif
+    const Int batchSize =
+      ( ctrl.batchSize > 0 ? ctrl.batchSize : 4*numThreads );
+
+    double maxDiag = 0;
+    for( Int i=0; i<n; ++i )
+        maxDiag = Max( maxDiag, Abs(R.Get(i,i)) );
+    const double width =
+      ctrl.samplerScale*Sqrt(Max(Log(double(n)),1.))*maxDiag;
+
+    Database db( R );
+    vector<Candidate> stack;
+    double bestNormSq = limits::Infinity<double>();
+    best.assign( n, 0 );
+    Int numSamples = 0;
+    Timer timer;
+
+    const Int startDim =
+      ( ctrl.progressive ? Min(Max(ctrl.progressiveStart,Int(1)),n) : n );
+    for( Int dim=startDim; dim<=n; ++dim )
+    {
+        if( ctrl.time )
+            timer.Start();
+        // The basis vectors of the new sublattice seed the stack
+        for( Int j=(dim==startDim ? 0 : dim-1); j<dim; ++j )
+        {
+            Candidate c;
+            c.coeffs.assign( n, 0 );
+            c.coeffs[j] = 1;
+            stack.push_back( std::move(c) );
+        }
+
+        Int numCollisions = 0;
+        bool finished = false;
+        while( true )
+        {
+            // Form a batch from the stack, topped off with fresh samples
+            vector<Candidate> batch;
+            while( Int(batch.size()) < batchSize && !stack.empty() )
+            {
+                batch.push_back( std::move(stack.back()) );
+                stack.pop_back();
+            }
+            while( Int(batch.size()) < batchSize )
+            {
+                Candidate c;
+                KleinSample( c, R, dim, width );
+                ++numSamples;
+                if( !c.IsZero() )
+                    batch.push_back( std::move(c) );
+            }
+            const Int numCandidates = batch.size();
+
+            // Reduce the batch against a snapshot of the list in parallel
+            const vector<Int> snapshot( db.Active() );
+            EL_PARALLEL_FOR
+            for( Int k=0; k<numCandidates; ++k )
+            {
+                db.Embed( batch[k] );
+                ReduceByList( batch[k], db, snapshot, ctrl );
+            }
+
+            // Insert the candidates one at a time, first reducing them against
+            // the vectors inserted since the snapshot, and then moving the
+            // list vectors which they reduce back onto the stack
+            vector<Int> inserted;
+            for( auto& c : batch )
+            {
+                if( ReduceByList( c, db, inserted, ctrl ) )
+                    ReduceByList( c, db, db.Active(), ctrl );
+                if( c.IsZero() )
+                {
+                    ++numCollisions;
+                    continue;
+                }
+
+                const vector<Int>& active = db.Active();
+                const Int numActive = active.size();
+                vector<Int> multipliers( numActive );
+                EL_PARALLEL_FOR
+                for( Int k=0; k<numActive; ++k )
+                    multipliers[k] =
+                      ReductionMultiplier( c, db, active[k], ctrl );
+
+                vector<Int> reducedSlots;
+                vector<Int> reducedMultipliers;
+                for( Int k=0; k<numActive; ++k )
+                {
+                    if( multipliers[k] != 0 )
+                    {
+                        reducedSlots.push_back( active[k] );
+                        reducedMultipliers.push_back( multipliers[k] );
+                    }
+                }
+                for( Int k=0; k<Int(reducedSlots.size()); ++k )
+                {
+                    const Int slot = reducedSlots[k];
+                    const Int mult = reducedMultipliers[k];
+                    const Int* w = db.Coeffs( slot );
+                    Candidate wNew;
+                    wNew.coeffs.resize( n );
+                    for( Int i=0; i<n; ++i )
+                        wNew.coeffs[i] = w[i] - mult*c.coeffs[i];
+                    db.Remove( slot );
+                    auto it =
+                      std::find( inserted.begin(), inserted.end(), slot );
+                    if( it != inserted.end() )
+                        inserted.erase( it );
+                    if( wNew.IsZero() )
+                        ++numCollisions;
+                    else
+                        stack.push_back( std::move(wNew) );
+                }
+
+                inserted.push_back( db.Insert( c ) );
+                if( c.normSq < bestNormSq )
+                {
+                    bestNormSq = c.normSq;
+                    best = c.coeffs;
+                }
+            }
+
+            if( bestNormSq < targetNormSq ||
+                (ctrl.maxListSize > 0 && db.Size() >= ctrl.maxListSize) )
+            {
+                finished = true;
+                break;
+            }
+            if( numCollisions >=
+                ctrl.collisionRatio*db.Size() + ctrl.minCollisions )
+                break;
+        }
+        if( ctrl.progress || ctrl.time )
+        {
+            Output
+            ("  dim=",dim,": |L|=",db.Size(),", ",numSamples," samples, ",
+             "|| b ||_2 / max_i |R(i,i)| = ",Sqrt(bestNormSq)/maxDiag);
+            if( ctrl.time )
+                Output("    took ",timer.Stop()," seconds");
+        }
+        if( finished )
+            break;
+    }
+    return bestNormSq;
+}
+
+template<typename F>
+Base<F> Sieve
+( const Matrix<F>& B,
+  const Matrix<F>& R,
+        Base<F> normUpperBound,
+        bool bounded,
+        Matrix<F>& v,
+  const SieveCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("svp::sieve::Sieve"))
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    if( R.Height() < n || R.Width() != n )
+        LogicError("Expected R to be (at least) n x n");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+
+    // Scale the Gaussian Normal Form so that its largest diagonal entry is
+    // one before converting it to double precision
+    Real scale = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real rho = Abs(R.Get(i,i));
+        if( rho == Real(0) )
+            LogicError("Expected the columns of B to be linearly independent");
+        scale = Max( scale, rho );
+    }
+    Matrix<double> RScaled;
+    Zeros( RScaled, n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<=j; ++i )
+            RScaled.Set( i, j, double(R.Get(i,j)/scale) );
+
+    double targetNormSq = 0;
+    if( bounded )
+    {
+        const double target = double(normUpperBound/scale);
+        targetNormSq = target*target;
+    }
+
+    vector<Int> coeffs;
+    GaussSieve( RScaled, targetNormSq, coeffs, ctrl );
+    for( Int i=0; i<n; ++i )
+        v.Set( i, 0, F(coeffs[i]) );
+
+    // Recompute the norm in the original precision
+    Matrix<F> x;
+    Zeros( x, B.Height(), 1 );
+    Gemv( NORMAL, F(1), B, v, F(0), x );
+    return FrobeniusNorm( x );
+}
+
+} // namespace sieve
+} // namespace svp
+
+template<typename F>
+Base<F> ShortVectorSieve
+( const Matrix<F>& B,
+  const Matrix<F>& R,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const SieveCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ShortVectorSieve"))
+    const Base<F> result =
+      svp::sieve::Sieve( B, R, normUpperBound, true, v, ctrl );
+    if( result < normUpperBound )
+        return result;
+    else
+        return 2*normUpperBound+1; // return a value above the upper bound
+}
+
+template<typename F>
+Base<F> ShortestVectorSieve
+( const Matrix<F>& B,
+  const Matrix<F>& R,
+        Matrix<F>& v,
+  const SieveCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ShortestVectorSieve"))
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    const Real result = svp::sieve::Sieve( B, R, Real(0), false, v, ctrl );
+    if( n == 0 )
+        return result;
+
+    // The sieve is heuristic, so fall back to the first basis vector
+    const Real b0Norm = FrobeniusNorm( B(ALL,IR(0)) );
+    if( result > b0Norm )
+    {
+        Zeros( v, n, 1 );
+        v.Set( 0, 0, F(1) );
+        return b0Norm;
+    }
+    return result;
+}
+
+#define PROTO(F) \
+  template Base<F> ShortVectorSieve \
+  ( const Matrix<F>& B, \
+    const Matrix<F>& R, \
+          Base<F> normUpperBound, \
+          Matrix<F>& v, \
+    const SieveCtrl& ctrl ); \
+  template Base<F> ShortestVectorSieve \
+  ( const Matrix<F>& B, \
+    const Matrix<F>& R, \
+          Matrix<F>& v, \
+    const SieveCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,235 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_SIEVE_DATABASE_HPP
+#define EL_LATTICE_SIEVE_DATABASE_HPP
+
+#include <bitset>
+#include <cstdint>
+
+// The list of a sieve is stored as a contiguous database of single-precision
+// lattice vectors (in the coordinates of the Gaussian Normal Form, R), each of
+// which is padded to a whole number of 64-byte cache lines and starts on a
+// cache-line boundary, so that the inner products of the pair tests are
+// unit-stride, aligned, and trivially vectorized. The exact integer
+// coordinates of each vector are stored alongside, and every vector is
+// recomputed from its coordinates (in double precision) whenever it changes,
+// so that rounding errors never accumulate.
+//
+// Each vector also carries a 128-bit SimHash (the signs of its inner products
+// with 128 random Gaussian directions). The expected Hamming distance between
+// the SimHashes of two vectors is proportional to the angle between them, so
+// the pairs which are too close to orthogonal to reduce one another can
+// usually be rejected with a couple of XORs and popcounts.
+
+namespace El {
+namespace svp {
+namespace sieve {
+
+typedef std::uint64_t HashWord;
+
+// The number of floats in a 64-byte cache line
+const Int lineLength = 16;
+
+const Int numHashWords = 2;
+const Int numHashBits = 64*numHashWords;
+
+inline float Dot
+( Int stride, const float* EL_RESTRICT a, const float* EL_RESTRICT b )
+{
+    // Since the stride is a multiple of the line length, each line can be
+    // accumulated into independent partial sums
+    float partials[lineLength] = { 0 };
+    for( Int i=0; i<stride; i+=lineLength )
+    {
+        EL_SIMD
+        for( Int l=0; l<lineLength; ++l )
+            partials[l] += a[i+l]*b[i+l];
+    }
+    float sum = 0;
+    for( Int l=0; l<lineLength; ++l )
+        sum += partials[l];
+    return sum;
+}
+
+inline Int HammingDistance( const HashWord* a, const HashWord* b )
+{
+    Int distance = 0;
+    for( Int k=0; k<numHashWords; ++k )
+        distance += std::bitset<64>(a[k]^b[k]).count();
+    return distance;
+}
+
+// A pair of vectors is only worth testing if the angle between them (or
+// between one and the negation of the other) is small
+inline bool SimHashPasses( const HashWord* a, const HashWord* b, Int threshold )
+{
+    const Int distance = HammingDistance( a, b );
+    return distance <= threshold || distance >= numHashBits-threshold;
+}
+
+// A lattice vector which is not (yet) in the database
+struct Candidate
+{
+    vector<Int> coeffs;
+    vector<float> vec;
+    double normSq=0;
+    HashWord hash[numHashWords];
+
+    bool IsZero() const
+    {
+        for( const Int& coeff : coeffs )
+            if( coeff != 0 )
+                return false;
+        return true;
+    }
+};
+
+class Database
+{
+public:
+    // R should be an n x n upper-triangular matrix which was scaled so that
+    // its entries are of order one
+    Database( const Matrix<double>& R )
+    : n_(R.Width()), R_(R)
+    {
+        DEBUG_ONLY(CSE cse("svp::sieve::Database::Database"))
+        stride_ = Max( ((n_+lineLength-1)/lineLength)*lineLength, lineLength );
+        directions_.resize( numHashBits*stride_, 0.f );
+        for( Int b=0; b<numHashBits; ++b )
+            for( Int i=0; i<n_; ++i )
+                directions_[b*stride_+i] = float(SampleNormal<double>());
+        Reserve( 1024 );
+    }
+
+    Int Dimension() const { return n_; }
+    Int Stride() const { return stride_; }
+    Int Size() const { return active_.size(); }
+
+    // The slots which currently hold list vectors (in no particular order)
+    const vector<Int>& Active() const { return active_; }
+
+    const float* Vector( Int slot ) const
+    { return &Data()[slot*stride_]; }
+    double NormSq( Int slot ) const { return normSqs_[slot]; }
+    const HashWord* Hash( Int slot ) const
+    { return &hashes_[slot*numHashWords]; }
+    const Int* Coeffs( Int slot ) const { return &coeffs_[slot*n_]; }
+
+    // Recompute the vector, squared norm, and SimHash of a candidate from
+    // its integer coordinates. Since this is called from within parallel
+    // loops, it must not push onto the (unsynchronized) debug call stack.
+    void Embed( Candidate& c ) const
+    {
+        vector<double> w( n_, 0. );
+        const double* RBuf = R_.LockedBuffer();
+        const Int RLDim = R_.LDim();
+        for( Int j=0; j<n_; ++j )
+        {
+            const Int coeff = c.coeffs[j];
+            if( coeff == 0 )
+                continue;
+            const double gamma = double(coeff);
+            const double* EL_RESTRICT RCol = &RBuf[j*RLDim];
+            EL_SIMD
+            for( Int i=0; i<=j; ++i )
+                w[i] += gamma*RCol[i];
+        }
+        c.vec.assign( stride_, 0.f );
+        c.normSq = 0;
+        for( Int i=0; i<n_; ++i )
+        {
+            c.vec[i] = float(w[i]);
+            c.normSq += w[i]*w[i];
+        }
+        for( Int k=0; k<numHashWords; ++k )
+            c.hash[k] = 0;
+        for( Int b=0; b<numHashBits; ++b )
+            if( Dot( stride_, &directions_[b*stride_], c.vec.data() ) > 0 )
+                c.hash[b/64] |= HashWord(1) << (b%64);
+    }
+
+    // Copy an (embedded) candidate into a free slot and return the slot
+    Int Insert( const Candidate& c )
+    {
+        DEBUG_ONLY(CSE cse("svp::sieve::Database::Insert"))
+        if( free_.empty() )
+            Reserve( 2*capacity_ );
+        const Int slot = free_.back();
+        free_.pop_back();
+
+        MemCopy( &Data()[slot*stride_], c.vec.data(), stride_ );
+        normSqs_[slot] = c.normSq;
+        MemCopy( &hashes_[slot*numHashWords], c.hash, numHashWords );
+        MemCopy( &coeffs_[slot*n_], c.coeffs.data(), n_ );
+
+        position_[slot] = active_.size();
+        active_.push_back( slot );
+        return slot;
+    }
+
+    void Remove( Int slot )
+    {
+        DEBUG_ONLY(CSE cse("svp::sieve::Database::Remove"))
+        const Int pos = position_[slot];
+        const Int lastSlot = active_.back();
+        active_[pos] = lastSlot;
+        position_[lastSlot] = pos;
+        active_.pop_back();
+        position_[slot] = -1;
+        free_.push_back( slot );
+    }
+
+private:
+    Int n_, stride_, capacity_=0;
+    Matrix<double> R_;
+    vector<float> directions_;
+
+    // The vectors are stored in 'storage_' starting from the first
+    // cache-aligned entry, 'offset_'
+    vector<float> storage_;
+    Int offset_=0;
+
+    vector<double> normSqs_;
+    vector<HashWord> hashes_;
+    vector<Int> coeffs_;
+
+    vector<Int> active_, position_, free_;
+
+    float* Data() { return &storage_[offset_]; }
+    const float* Data() const { return &storage_[offset_]; }
+
+    void Reserve( Int capacity )
+    {
+        DEBUG_ONLY(CSE cse("svp::sieve::Database::Reserve"))
+        vector<float> storage( capacity*stride_+lineLength, 0.f );
+        const std::uintptr_t address =
+          reinterpret_cast<std::uintptr_t>(storage.data());
+        const Int lineBytes = lineLength*sizeof(float);
+        const Int offset =
+          ((lineBytes-Int(address%lineBytes))%lineBytes)/sizeof(float);
+        if( capacity_ > 0 )
+            MemCopy( &storage[offset], Data(), capacity_*stride_ );
+        storage_.swap( storage );
+        offset_ = offset;
+
+        normSqs_.resize( capacity, 0. );
+        hashes_.resize( capacity*numHashWords, 0 );
+        coeffs_.resize( capacity*n_, 0 );
+        position_.resize( capacity, -1 );
+        for( Int slot=capacity-1; slot>=capacity_; --slot )
+            free_.push_back( slot );
+        capacity_ = capacity;
+    }
+};
+
+} // namespace sieve
+} // namespace svp
+} // namespace El
+
+#endif // ifndef EL_LATTICE_SIEVE_DATABASE_HPP
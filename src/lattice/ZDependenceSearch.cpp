@@ -36,6 +36,19 @@ Int ZDependenceSearch
     return info.nullity;
 }
 
+template<typename Real>
+Int ZDependenceSearch
+( const Matrix<Real>& z,
+        Matrix<Real>& U,
+  const PSLQCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ZDependenceSearch"))
+    if( z.Width() != 1 )
+        LogicError("z was assumed to be a column vector");
+    auto info = PSLQ( z, U, ctrl );
+    return info.nullity;
+}
+
 #define PROTO(F) \
   template Int ZDependenceSearch \
   ( const Matrix<F>& z, \
@@ -44,6 +57,13 @@ Int ZDependenceSearch
           Matrix<F>& U, \
     const LLLCtrl<Base<F>>& ctrl );
 
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template Int ZDependenceSearch \
+  ( const Matrix<Real>& z, \
+          Matrix<Real>& U, \
+    const PSLQCtrl<Real>& ctrl );
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
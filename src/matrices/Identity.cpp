@@ -80,6 +80,11 @@ void Identity( DistSparseMatrix<T>& I, Int m, Int n )
   template void Identity( SparseMatrix<T>& I, Int m, Int n ); \
   template void Identity( DistSparseMatrix<T>& I, Int m, Int n );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void MakeIdentity( Matrix<DoubleDouble>& I ); \
+  template void Identity( Matrix<DoubleDouble>& I, Int m, Int n );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -57,6 +57,10 @@ void Zeros( DistMultiVec<T>& A, Int m, Int n )
   template void Zeros( DistSparseMatrix<T>& A, Int m, Int n ); \
   template void Zeros( DistMultiVec<T>& A, Int m, Int n );
 
+#define PROTO_DOUBLEDOUBLE \
+  template void Zeros( Matrix<DoubleDouble>& A, Int m, Int n );
+
+#define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGFLOAT
 #include "El/macros/Instantiate.h"
@@ -138,15 +138,21 @@ ElError ElNNLSCtrlDefault_d( ElNNLSCtrl_d* ctrl )
    ================================= */
 ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl )
 {
+    ctrl->approach = EL_NMF_NNLS;
     ElNNLSCtrlDefault_s( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->tol = 0;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
 ElError ElNMFCtrlDefault_d( ElNMFCtrl_d* ctrl )
 {
+    ctrl->approach = EL_NMF_NNLS;
     ElNNLSCtrlDefault_d( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->tol = 0;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
@@ -24,7 +24,11 @@ Int ADMM
         Matrix<F>& z, 
   const ADMMCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("bp::ADMM"))
+    DEBUG_ONLY(
+      CSE cse("bp::ADMM");
+      if( 1/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
     // Find a means of quickly applyinv pinv(A) and then form pinv(A) b
     // NOTE: If m >= n and A has full column rank, then basis pursuit is 
     //       irrelevant, as there is a unique solution, which is found 
@@ -70,14 +74,12 @@ Int ADMM
 
     // Start the basis pursuit
     Int numIter=0;
-    Matrix<F> x, u, t, zOld, xHat;
+    Matrix<F> x, u, t;
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
-        zOld = z;
-
         // x := P*(z-u) + q
         //    = (I-pinv(A)*A)(z-u) + q
         //    = (z-u) - pinv(A)*A*(z-u) + q
@@ -102,34 +104,22 @@ Int ADMM
         x -= s;
         x += q;
 
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,1/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, 1/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        // xHat := alpha x + (1-alpha) zOld,
+        // z    := SoftThresh(xHat+u,1/rho),
+        // u    := u + (xHat - z),
+        // along with the norms of x, z, u, x-z, and z-zOld, in one pass
+        const Real tau = 1/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, x, z, u,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
@@ -157,7 +147,11 @@ Int ADMM
         ElementalMatrix<F>& zPre,
   const ADMMCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("bp::ADMM"))
+    DEBUG_ONLY(
+      CSE cse("bp::ADMM");
+      if( 1/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
 
     DistMatrixReadProxy<F,F,MC,MR>
       AProx( APre ),
@@ -215,14 +209,14 @@ Int ADMM
 
     // Start the basis pursuit
     Int numIter=0;
-    DistMatrix<F> x(grid), u(grid), t(grid), zOld(grid), xHat(grid);
+    DistMatrix<F> x(grid), u(grid), t(grid);
+    x.AlignWith( z );
+    u.AlignWith( z );
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
-        zOld = z;
-
         // x := P*(z-u) + q
         //    = (I-pinv(A)*A)(z-u) + q
         //    = (z-u) - pinv(A)*A*(z-u) + q
@@ -247,34 +241,22 @@ Int ADMM
         x -= s;
         x += q;
 
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,1/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, 1/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        // xHat := alpha x + (1-alpha) zOld,
+        // z    := SoftThresh(xHat+u,1/rho),
+        // u    := u + (xHat - z),
+        // along with the norms of x, z, u, x-z, and z-zOld, in one pass
+        const Real tau = 1/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, x, z, u,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
@@ -39,7 +39,11 @@ Int ADMM
         Matrix<F>& z, 
   const ADMMCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("bpdn::ADMM"))
+    DEBUG_ONLY(
+      CSE cse("bpdn::ADMM");
+      if( lambda/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
     typedef Base<F> Real;
     const Int m = A.Height();
     const Int n = A.Width();
@@ -66,14 +70,12 @@ Int ADMM
 
     // Start the LASSO
     Int numIter=0;
-    Matrix<F> x, u, s, zOld, xHat;
+    Matrix<F> x, u, s;
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
-        zOld = z;
-
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
         Axpy(  ctrl.rho, z, x );
@@ -108,34 +110,22 @@ Int ADMM
             x *= 1/ctrl.rho;
         }
 
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        // xHat := alpha x + (1-alpha) zOld,
+        // z    := SoftThresh(xHat+u,lambda/rho),
+        // u    := u + (xHat - z),
+        // along with the norms of x, z, u, x-z, and z-zOld, in one pass
+        const Real tau = lambda/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, x, z, u,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
@@ -167,7 +157,11 @@ Int ADMM
         ElementalMatrix<F>& zPre, 
   const ADMMCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("bpdn::ADMM"))
+    DEBUG_ONLY(
+      CSE cse("bpdn::ADMM");
+      if( lambda/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
 
     DistMatrixReadProxy<F,F,MC,MR>
       AProx( APre ),
@@ -205,14 +199,14 @@ Int ADMM
 
     // Start the LASSO
     Int numIter=0;
-    DistMatrix<F> x(g), u(g), s(g), zOld(g), xHat(g);
+    DistMatrix<F> x(g), u(g), s(g);
+    x.AlignWith( z );
+    u.AlignWith( z );
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
-        zOld = z;
-
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
         Axpy(  ctrl.rho, z, x );
@@ -247,34 +241,22 @@ Int ADMM
             x *= 1/ctrl.rho;
         }
 
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        // xHat := alpha x + (1-alpha) zOld,
+        // z    := SoftThresh(xHat+u,lambda/rho),
+        // u    := u + (xHat - z),
+        // along with the norms of x, z, u, x-z, and z-zOld, in one pass
+        const Real tau = lambda/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, x, z, u,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
@@ -68,7 +68,7 @@ void EN
     auto QTL = Q( IR(0,2*n), IR(0,2*n) );
     FillDiagonal( QTL, 2*lambda2 );
     auto Qrr = Q( rInd, rInd );
-    FillDiagonal( Qrr, Real(1) );
+    FillDiagonal( Qrr, Real(2) );
 
     // c := lambda_1*[1;1;0]
     // =====================
@@ -131,7 +131,7 @@ void EN
     auto QTL = Q( IR(0,2*n), IR(0,2*n) );
     FillDiagonal( QTL, 2*lambda2 );
     auto Qrr = Q( rInd, rInd );
-    FillDiagonal( Qrr, Real(1) );
+    FillDiagonal( Qrr, Real(2) );
 
     // c := lambda_1*[1;1;0]
     // =====================
@@ -195,7 +195,7 @@ void EN
     for( Int e=0; e<2*n; ++e )
         Q.QueueUpdate( e, e, 2*lambda2 );
     for( Int e=0; e<m; ++e )
-        Q.QueueUpdate( 2*n+e, 2*n+e, Real(1) );
+        Q.QueueUpdate( 2*n+e, 2*n+e, Real(2) );
     Q.ProcessQueues();
 
     // c := lambda_1*[1;1;0]
@@ -344,6 +344,40 @@ void EN
     x.ProcessQueues();
 }
 
+template<typename Real>
+Int EN
+( RowChunkStream<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("EN"))
+    if( b.Height() != A.Height() || b.Width() != 1 )
+        LogicError("b must be a column vector of height ",A.Height());
+
+    // f_i(t) = (t - b_i)^2
+    auto lossDeriv =
+      [&]( const vector<Int>& rows, Matrix<Real>& t )
+      {
+        const Int k = rows.size();
+        for( Int l=0; l<k; ++l )
+            t.Set( l, 0, 2*(t.Get(l,0)-b.Get(rows[l],0)) );
+      };
+    // The proximal map of tau (lambda_1 || w ||_1 + lambda_2 || w ||_2^2)
+    auto enProx =
+      [&]( Matrix<Real>& w, Real tau )
+      {
+        SoftThreshold( w, tau*lambda1 );
+        w *= 1/(1+2*tau*lambda2);
+      };
+
+    return StochasticModelFit
+    ( function<void(const vector<Int>&,Matrix<Real>&)>(lossDeriv), Real(2),
+      function<void(Matrix<Real>&,Real)>(enProx), A, false, x, ctrl );
+}
+
 #define PROTO(Real) \
   template void EN \
   ( const Matrix<Real>& A, \
@@ -372,7 +406,14 @@ void EN
           Real lambda1, \
           Real lambda2, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template Int EN \
+  ( RowChunkStream<Real>& A, \
+    const Matrix<Real>& b, \
+          Real lambda1, \
+          Real lambda2, \
+          Matrix<Real>& x, \
+    const StochasticCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
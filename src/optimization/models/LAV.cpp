@@ -250,6 +250,39 @@ void LAV
     x = xHat( IR(0,n), ALL );
 }
 
+template<typename Real>
+Int LAV
+( RowChunkStream<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LAV"))
+    if( b.Height() != A.Height() || b.Width() != 1 )
+        LogicError("b must be a column vector of height ",A.Height());
+    const Real mu = ctrl.smoothing;
+
+    // The derivative of the Moreau envelope of | t - b_i | is
+    // (r - SoftThreshold(r,mu)) / mu, where r = t - b_i
+    Matrix<Real> r;
+    auto lossDeriv =
+      [&]( const vector<Int>& rows, Matrix<Real>& t )
+      {
+        const Int k = rows.size();
+        for( Int l=0; l<k; ++l )
+            t.Update( l, 0, -b.Get(rows[l],0) );
+        r = t;
+        SoftThreshold( r, mu );
+        t -= r;
+        t *= 1/mu;
+      };
+    auto noProx = [&]( Matrix<Real>& w, Real tau ) { };
+
+    return StochasticModelFit
+    ( function<void(const vector<Int>&,Matrix<Real>&)>(lossDeriv), 1/mu,
+      function<void(Matrix<Real>&,Real)>(noProx), A, false, x, ctrl );
+}
+
 #define PROTO(Real) \
   template void LAV \
   ( const Matrix<Real>& A, const Matrix<Real>& b, \
@@ -266,7 +299,11 @@ void LAV
   template void LAV \
   ( const DistSparseMatrix<Real>& A, const DistMultiVec<Real>& b, \
           DistMultiVec<Real>& x, \
-    const lp::affine::Ctrl<Real>& ctrl );
+    const lp::affine::Ctrl<Real>& ctrl ); \
+  template Int LAV \
+  ( RowChunkStream<Real>& A, const Matrix<Real>& b, \
+          Matrix<Real>& x, \
+    const StochasticCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -127,6 +127,55 @@ Int LogisticRegression
     return ModelFit( logisticFunc, proxFunc, A, b, w, ctrl );
 }
 
+template<typename Real>
+Int LogisticRegression
+( RowChunkStream<Real>& G, const Matrix<Real>& q, Matrix<Real>& w,
+  Real gamma, Regularization penalty,
+  const StochasticCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LogisticRegression"))
+    if( q.Height() != G.Height() || q.Width() != 1 )
+        LogicError("q must be a column vector of height ",G.Height());
+    const Real qMax = MaxNorm( q );
+
+    // f_i(t) = log(1+exp(-q_i t)) is smooth, so its derivative,
+    // -q_i / (1+exp(q_i t)), is used directly
+    auto lossDeriv =
+      [&]( const vector<Int>& rows, Matrix<Real>& t )
+      {
+        const Int k = rows.size();
+        for( Int l=0; l<k; ++l )
+        {
+            const Real qi = q.Get(rows[l],0);
+            t.Set( l, 0, -qi/(1+Exp(qi*t.Get(l,0))) );
+        }
+      };
+
+    function<void(Matrix<Real>&,Real)> proxFunc;
+    if( penalty == NO_PENALTY )
+    {
+        auto noProx = [&]( Matrix<Real>& x, Real tau ) { };
+        proxFunc = function<void(Matrix<Real>&,Real)>(noProx);
+    }
+    else if( penalty == L1_PENALTY )
+    {
+        auto oneProx = 
+          [&]( Matrix<Real>& x, Real tau ) { SoftThreshold( x, tau*gamma ); };
+        proxFunc = function<void(Matrix<Real>&,Real)>(oneProx);
+    }
+    else if( penalty == L2_PENALTY )
+    {
+        auto frobProx = 
+          [&]( Matrix<Real>& x, Real tau )
+          { FrobeniusProx( x, 1/(tau*gamma) ); };
+        proxFunc = function<void(Matrix<Real>&,Real)>(frobProx);
+    }
+
+    return StochasticModelFit
+    ( function<void(const vector<Int>&,Matrix<Real>&)>(lossDeriv), 
+      qMax*qMax/4, proxFunc, G, true, w, ctrl );
+}
+
 #define PROTO(Real) \
   template Int LogisticRegression \
   ( const Matrix<Real>& G, const Matrix<Real>& q, Matrix<Real>& w, \
@@ -136,7 +185,11 @@ Int LogisticRegression
   ( const ElementalMatrix<Real>& G, const ElementalMatrix<Real>& q, \
           ElementalMatrix<Real>& w, \
     Real gamma, Regularization penalty, \
-    const ModelFitCtrl<Real>& ctrl );
+    const ModelFitCtrl<Real>& ctrl ); \
+  template Int LogisticRegression \
+  ( RowChunkStream<Real>& G, const Matrix<Real>& q, Matrix<Real>& w, \
+    Real gamma, Regularization penalty, \
+    const StochasticCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -7,11 +7,46 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./NMF/HALS.hpp"
+#include "./NMF/BPP.hpp"
 
 namespace El {
 
-// TODO: Better convergence criterions. E.g., accept a relative tolerance
-//       in addition to the maximum number of iterations.
+// TODO: Better convergence criterions for NMF_NNLS. E.g., accept a relative
+//       tolerance in addition to the maximum number of iterations.
+
+namespace nmf {
+
+template<typename Real>
+inline void
+UpdateFactor
+( const Matrix<Real>& G, const Matrix<Real>& R, Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    if( ctrl.approach == NMF_HALS )
+        HALS( G, R, Y );
+    else
+        BPP( G, R, Y );
+}
+
+// Returns true if the relative residual stagnated
+template<typename Real>
+inline bool
+MonitorResidual
+( Int iter, Real ANrm, Real residSq, Real& relResidOld,
+  const NMFCtrl<Real>& ctrl, bool print )
+{
+    const Real relResid =
+      ( ANrm == Real(0) ? Real(0) : Sqrt(Max(residSq,Real(0)))/ANrm );
+    if( print )
+        Output("iter ",iter,": || A - X Y^T ||_F / || A ||_F = ",relResid);
+    const bool stagnated = 
+      ( ctrl.tol > Real(0) && iter > 0 && relResidOld-relResid < ctrl.tol );
+    relResidOld = relResid;
+    return stagnated;
+}
+
+} // namespace nmf
 
 template<typename Real>
 void NMF
@@ -22,6 +57,41 @@ void NMF
 {
     DEBUG_ONLY(CSE cse("NMF"))
 
+    if( ctrl.approach == NMF_HALS || ctrl.approach == NMF_BPP )
+    {
+        const Int n = A.Width();
+        const Int k = X.Width();
+        const Real ANrm = FrobeniusNorm( A );
+        if( Y.Height() != n || Y.Width() != k )
+            Zeros( Y, n, k );
+
+        Real relResid = 1;
+        Matrix<Real> GX, GY, R;
+        for( Int iter=0; iter<ctrl.maxIter; ++iter )
+        {
+            // Update Y using G := X^T X and R := A^T X
+            Herk( LOWER, ADJOINT, Real(1), X, GX );
+            MakeSymmetric( LOWER, GX );
+            Gemm( ADJOINT, NORMAL, Real(1), A, X, R );
+            nmf::UpdateFactor( GX, R, Y, ctrl );
+
+            // || A - X Y^T ||_F^2 = || A ||_F^2 - 2 <Y,R> + <X^T X,Y^T Y>
+            Herk( LOWER, ADJOINT, Real(1), Y, GY );
+            MakeSymmetric( LOWER, GY );
+            const Real residSq =
+              ANrm*ANrm - 2*HilbertSchmidt(Y,R) + HilbertSchmidt(GX,GY);
+
+            // Update X using G := Y^T Y and R := A Y
+            Gemm( NORMAL, NORMAL, Real(1), A, Y, R );
+            nmf::UpdateFactor( GY, R, X, ctrl );
+
+            if( nmf::MonitorResidual
+                ( iter, ANrm, residSq, relResid, ctrl, ctrl.progress ) )
+                break;
+        }
+        return;
+    }
+
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
 
@@ -52,8 +122,66 @@ void NMF
     auto& A = AProx.GetLocked();
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
+    const Grid& g = A.Grid();
+
+    if( ctrl.approach == NMF_HALS || ctrl.approach == NMF_BPP )
+    {
+        const Int n = A.Width();
+        const Int k = X.Width();
+        const Real ANrm = FrobeniusNorm( A );
+        const bool print = ctrl.progress && g.Rank() == 0;
+
+        // Store the factors with their rows distributed so that each row
+        // update only requires local data and the (replicated) Gram matrix
+        DistMatrix<Real,VC,STAR> X_VC_STAR( X ), Y_VC_STAR(g), R_VC_STAR(g);
+        if( Y.Height() == n && Y.Width() == k )
+            Y_VC_STAR = Y;
+        else
+            Zeros( Y_VC_STAR, n, k );
+        auto formGram = 
+          [&]( const DistMatrix<Real,VC,STAR>& Z, Matrix<Real>& G )
+          {
+            Herk( LOWER, ADJOINT, Real(1), Z.LockedMatrix(), G );
+            mpi::AllReduce( G.Buffer(), k*k, mpi::SUM, Z.ColComm() );
+            MakeSymmetric( LOWER, G );
+          };
+
+        Real relResid = 1;
+        Matrix<Real> GX, GY;
+        DistMatrix<Real> R(g);
+        for( Int iter=0; iter<ctrl.maxIter; ++iter )
+        {
+            // Update Y using G := X^T X and R := A^T X
+            formGram( X_VC_STAR, GX );
+            Gemm( ADJOINT, NORMAL, Real(1), A, X, R );
+            R_VC_STAR = R;
+            nmf::UpdateFactor
+            ( GX, R_VC_STAR.LockedMatrix(), Y_VC_STAR.Matrix(), ctrl );
+            Y = Y_VC_STAR;
+
+            // || A - X Y^T ||_F^2 = || A ||_F^2 - 2 <Y,R> + <X^T X,Y^T Y>
+            formGram( Y_VC_STAR, GY );
+            const Real YRLocal =
+              HilbertSchmidt
+              ( Y_VC_STAR.LockedMatrix(), R_VC_STAR.LockedMatrix() );
+            const Real YR = mpi::AllReduce( YRLocal, Y_VC_STAR.ColComm() );
+            const Real residSq = ANrm*ANrm - 2*YR + HilbertSchmidt(GX,GY);
+
+            // Update X using G := Y^T Y and R := A Y
+            Gemm( NORMAL, NORMAL, Real(1), A, Y, R );
+            R_VC_STAR = R;
+            nmf::UpdateFactor
+            ( GY, R_VC_STAR.LockedMatrix(), X_VC_STAR.Matrix(), ctrl );
+            X = X_VC_STAR;
+
+            if( nmf::MonitorResidual
+                ( iter, ANrm, residSq, relResid, ctrl, print ) )
+                break;
+        }
+        return;
+    }
 
-    DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
+    DistMatrix<Real> AAdj(g), XAdj(g), YAdj(g);
     Adjoint( A, AAdj );
 
     for( Int iter=0; iter<ctrl.maxIter; ++iter )
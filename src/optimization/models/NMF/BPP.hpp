@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace nmf {
+
+// Given the Gram matrix G = X^T X and R = A^T X, solve
+//
+//   min_{Y >= 0} || A - X Y^T ||_F
+//
+// one row at a time, where each row y^T (with corresponding row r^T of R)
+// solves the NNLS problem
+//
+//   min_{y >= 0} (1/2) y^T G y - r^T y,
+//
+// using the Block Principal Pivoting method of Kim and Park. Each problem is
+// warm-started with its passive set equal to the support of the current row
+// of Y. Since G is replicated, only the local rows of Y and R are required.
+//
+// As in the combinatorial variant of Kim and Park, the rows which are still
+// being iterated upon are grouped by their passive sets at each step, so
+// that each distinct passive system is only factored once (and solved with
+// the right-hand sides of the entire group).
+//
+
+template<typename Real>
+inline void
+BPP( const Matrix<Real>& G, const Matrix<Real>& R, Matrix<Real>& Y )
+{
+    DEBUG_ONLY(CSE cse("nmf::BPP"))
+    const Int k = G.Height();
+    const Int height = Y.Height();
+    // The backup rule guarantees termination in exact arithmetic, but guard
+    // against cycling due to rounding errors
+    const Int maxIts = 10*k + 10;
+    const Int maxBackups = 3;
+
+    // A (numerically) vanishing column of the factor leaves an empty row and
+    // column in G, which would make any passive system containing it
+    // singular. Since such a variable does not affect the objective, it is
+    // held at zero.
+    Real maxDiag = 0;
+    for( Int j=0; j<k; ++j )
+        maxDiag = Max( maxDiag, G.Get(j,j) );
+    const Real emptyTol = limits::Epsilon<Real>()*maxDiag;
+    vector<bool> empty(k);
+    for( Int j=0; j<k; ++j )
+        empty[j] = ( G.Get(j,j) <= emptyTol );
+
+    vector<vector<bool>> passive( height, vector<bool>(k) );
+    vector<Int> minNumInfeasible( height, k+1 ),
+                numBackups( height, maxBackups );
+    vector<Int> unsolved( height );
+    for( Int i=0; i<height; ++i )
+    {
+        unsolved[i] = i;
+        for( Int j=0; j<k; ++j )
+            passive[i][j] = ( !empty[j] && Y.Get(i,j) > Real(0) );
+    }
+
+    vector<Int> passiveInds, infeasible, stillUnsolved;
+    Matrix<Real> x, grad, GFF, XF;
+    for( Int it=0; it<maxIts && !unsolved.empty(); ++it )
+    {
+        std::stable_sort
+        ( unsolved.begin(), unsolved.end(),
+          [&]( Int i0, Int i1 ) { return passive[i0] < passive[i1]; } );
+
+        stillUnsolved.clear();
+        const Int numUnsolved = unsolved.size();
+        for( Int groupBeg=0; groupBeg<numUnsolved; )
+        {
+            // (The passive sets of the group are updated below)
+            const vector<bool> passiveSet = passive[unsolved[groupBeg]];
+            Int groupEnd = groupBeg+1;
+            while( groupEnd < numUnsolved &&
+                   passive[unsolved[groupEnd]] == passiveSet )
+                ++groupEnd;
+            const Int groupSize = groupEnd - groupBeg;
+
+            // Solve for the passive variables of each row in the group
+            // ========================================================
+            passiveInds.clear();
+            for( Int j=0; j<k; ++j )
+                if( passiveSet[j] )
+                    passiveInds.push_back( j );
+            const Int numPassive = passiveInds.size();
+            Zeros( XF, numPassive, groupSize );
+            if( numPassive > 0 )
+            {
+                GFF = G( passiveInds, passiveInds );
+                for( Int l=0; l<groupSize; ++l )
+                {
+                    const Int i = unsolved[groupBeg+l];
+                    for( Int q=0; q<numPassive; ++q )
+                        XF.Set( q, l, R.Get(i,passiveInds[q]) );
+                }
+                LinearSolve( GFF, XF );
+            }
+
+            for( Int l=0; l<groupSize; ++l )
+            {
+                const Int i = unsolved[groupBeg+l];
+                Zeros( x, k, 1 );
+                for( Int q=0; q<numPassive; ++q )
+                    x.Set( passiveInds[q], 0, XF.Get(q,l) );
+                for( Int j=0; j<k; ++j )
+                    Y.Set( i, j, Max( x.Get(j,0), Real(0) ) );
+
+                // grad := G x - r
+                Zeros( grad, k, 1 );
+                for( Int j=0; j<k; ++j )
+                    grad.Set( j, 0, -R.Get(i,j) );
+                Gemv( NORMAL, Real(1), G, x, Real(1), grad );
+
+                // Find the infeasible variables
+                // =============================
+                infeasible.clear();
+                for( Int j=0; j<k; ++j )
+                {
+                    if( empty[j] )
+                        continue;
+                    if( passive[i][j] && x.Get(j,0) < Real(0) )
+                        infeasible.push_back( j );
+                    else if( !passive[i][j] && grad.Get(j,0) < Real(0) )
+                        infeasible.push_back( j );
+                }
+                const Int numInfeasible = infeasible.size();
+                if( numInfeasible == 0 )
+                    continue;
+
+                // Exchange variables between the passive and active sets
+                // ======================================================
+                if( numInfeasible < minNumInfeasible[i] )
+                {
+                    minNumInfeasible[i] = numInfeasible;
+                    numBackups[i] = maxBackups;
+                    for( const Int j : infeasible )
+                        passive[i][j] = !passive[i][j];
+                }
+                else if( numBackups[i] > 0 )
+                {
+                    --numBackups[i];
+                    for( const Int j : infeasible )
+                        passive[i][j] = !passive[i][j];
+                }
+                else
+                {
+                    // Fall back to exchanging only the last infeasible
+                    // variable
+                    const Int j = infeasible.back();
+                    passive[i][j] = !passive[i][j];
+                }
+                stillUnsolved.push_back( i );
+            }
+            groupBeg = groupEnd;
+        }
+        unsolved.swap( stillUnsolved );
+    }
+}
+
+} // namespace nmf
+} // namespace El
@@ -0,0 +1,51 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace nmf {
+
+// Given the Gram matrix G = X^T X and R = A^T X, approximately solve
+//
+//   min_{Y >= 0} || A - X Y^T ||_F
+//
+// with a single sweep of Hierarchical Alternating Least Squares, i.e., for
+// each column,
+//
+//   y_j := max(0, y_j + (r_j - Y g_j) / G(j,j)).
+//
+// Since G is replicated, only the local rows of Y and R are required.
+//
+
+template<typename Real>
+inline void
+HALS( const Matrix<Real>& G, const Matrix<Real>& R, Matrix<Real>& Y )
+{
+    DEBUG_ONLY(CSE cse("nmf::HALS"))
+    const Int k = G.Height();
+    const Int height = Y.Height();
+
+    Matrix<Real> t;
+    for( Int j=0; j<k; ++j )
+    {
+        const Real gamma = G.Get(j,j);
+        if( gamma <= Real(0) )
+            continue;
+
+        // t := r_j - Y g_j
+        t = R( ALL, IR(j) );
+        Gemv( NORMAL, Real(-1), Y, G(ALL,IR(j)), Real(1), t );
+
+        for( Int i=0; i<height; ++i )
+            Y.Set( i, j, Max( Y.Get(i,j)+t.Get(i,0)/gamma, Real(0) ) );
+    }
+}
+
+} // namespace nmf
+} // namespace El
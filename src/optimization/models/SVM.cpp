@@ -70,6 +70,44 @@ void SVM
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+Int SVM
+( RowChunkStream<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("SVM"))
+    if( d.Height() != A.Height() || d.Width() != 1 )
+        LogicError("d must be a column vector of height ",A.Height());
+    const Real mu = ctrl.smoothing;
+    const Real dMax = MaxNorm( d );
+
+    // f_i(t) = lambda h(d_i t), where h is the Moreau envelope of the hinge
+    // loss, whose derivative is (s - HingeLossProx(s,1/mu)) / mu
+    Matrix<Real> s;
+    auto lossDeriv =
+      [&]( const vector<Int>& rows, Matrix<Real>& t )
+      {
+        const Int k = rows.size();
+        for( Int l=0; l<k; ++l )
+            t.Set( l, 0, d.Get(rows[l],0)*t.Get(l,0) );
+        s = t;
+        HingeLossProx( s, 1/mu );
+        t -= s;
+        for( Int l=0; l<k; ++l )
+            t.Set( l, 0, lambda*d.Get(rows[l],0)*t.Get(l,0)/mu );
+      };
+    // The proximal map of (tau/2) || w ||_2^2
+    auto l2Prox = [&]( Matrix<Real>& w, Real tau ) { w *= 1/(1+tau); };
+
+    return StochasticModelFit
+    ( function<void(const vector<Int>&,Matrix<Real>&)>(lossDeriv),
+      lambda*dMax*dMax/mu,
+      function<void(Matrix<Real>&,Real)>(l2Prox), A, true, x, ctrl );
+}
+
 #define PROTO(Real) \
   template void SVM \
   ( const Matrix<Real>& A, \
@@ -94,7 +132,13 @@ void SVM
     const DistMultiVec<Real>& d, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const SVMCtrl<Real>& ctrl );
+    const SVMCtrl<Real>& ctrl ); \
+  template Int SVM \
+  ( RowChunkStream<Real>& A, \
+    const Matrix<Real>& d, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const StochasticCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
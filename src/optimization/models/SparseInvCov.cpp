@@ -26,7 +26,11 @@ Int SparseInvCov
         Matrix<F>& Z,
   const SparseInvCovCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("SparseInvCov"))
+    DEBUG_ONLY(
+      CSE cse("SparseInvCov");
+      if( lambda/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
     typedef Base<F> Real;
     const Int n = D.Width();
 
@@ -35,14 +39,12 @@ Int SparseInvCov
     MakeHermitian( LOWER, S );
    
     Int numIter=0;
-    Matrix<F> X, U, ZOld, XHat, T;
+    Matrix<F> X, U;
     Zeros( X, n, n );
     Zeros( Z, n, n );
     Zeros( U, n, n );
     while( numIter < ctrl.maxIter )
     {
-        ZOld = Z;
-
         // X := rho*(Z-U) - S
         X = Z;
         X -= U;
@@ -59,33 +61,22 @@ Int SparseInvCov
         // Hermitian.
         MakeHermitian( LOWER, X );
 
-        // XHat := alpha*X + (1-alpha)*ZOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // Z := SoftThreshold(XHat+U,lambda/rho)
-        Z = XHat;
-        Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
-
-        // U := U + (XHat-Z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || X - Z ||_F
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm(T);
-        // sNorm := |rho| || Z - ZOld ||_F
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        // XHat := alpha*X + (1-alpha)*ZOld,
+        // Z    := SoftThreshold(XHat+U,lambda/rho),
+        // U    := U + (XHat-Z),
+        // along with the norms of X, Z, U, X-Z, and Z-ZOld, in one pass
+        const Real tau = lambda/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, X, Z, U,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = n*ctrl.absTol + 
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = n*ctrl.absTol + 
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
@@ -116,7 +107,11 @@ Int SparseInvCov
         ElementalMatrix<F>& ZPre,
   const SparseInvCovCtrl<Base<F>>& ctrl )
 {
-    DEBUG_ONLY(CSE cse("SparseInvCov"))
+    DEBUG_ONLY(
+      CSE cse("SparseInvCov");
+      if( lambda/ctrl.rho < 0 )
+          LogicError("Negative threshold does not make sense");
+    )
 
     DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre );
     auto& Z = ZProx.Get();
@@ -130,14 +125,14 @@ Int SparseInvCov
     MakeHermitian( LOWER, S );
    
     Int numIter=0;
-    DistMatrix<F> X(g), U(g), ZOld(g), XHat(g), T(g);
+    DistMatrix<F> X(g), U(g);
+    X.AlignWith( Z );
+    U.AlignWith( Z );
     Zeros( X, n, n );
     Zeros( Z, n, n );
     Zeros( U, n, n );
     while( numIter < ctrl.maxIter )
     {
-        ZOld = Z;
-
         // X := rho*(Z-U) - S
         X = Z;
         X -= U;
@@ -154,33 +149,22 @@ Int SparseInvCov
         // Hermitian.
         MakeHermitian( LOWER, X );
 
-        // XHat := alpha*X + (1-alpha)*ZOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // Z := SoftThreshold(XHat+U,lambda/rho)
-        Z = XHat;
-        Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
-
-        // U := U + (XHat-Z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || X - Z ||_F
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm(T);
-        // sNorm := |rho| || Z - ZOld ||_F
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        // XHat := alpha*X + (1-alpha)*ZOld,
+        // Z    := SoftThreshold(XHat+U,lambda/rho),
+        // U    := U + (XHat-Z),
+        // along with the norms of X, Z, U, X-Z, and Z-ZOld, in one pass
+        const Real tau = lambda/ctrl.rho;
+        auto norms =
+          ProxUpdate
+          ( ctrl.alpha, X, Z, U,
+            [=]( F alpha ) { return SoftThreshold( alpha, tau ); } );
+        const Real rNorm = norms.primalNorm;
+        const Real sNorm = Abs(ctrl.rho)*norms.dualNorm;
 
         const Real epsPri = n*ctrl.absTol + 
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
+            ctrl.relTol*Max(norms.xNorm,norms.zNorm);
         const Real epsDual = n*ctrl.absTol + 
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(ctrl.rho)*norms.uNorm;
 
         if( ctrl.progress )
         {
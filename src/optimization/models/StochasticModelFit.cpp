@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+// Overwrite 'perm' with a uniformly random permutation of 0, ..., k-1
+inline void RandomPermutation( Int k, vector<Int>& perm )
+{
+    perm.resize( k );
+    for( Int i=0; i<k; ++i )
+        perm[i] = i;
+    for( Int i=k-1; i>0; --i )
+        std::swap( perm[i], perm[SampleUniform<Int>(0,i+1)] );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+Int StochasticModelFit
+( function<void(const vector<Int>&,Matrix<Real>&)> lossDeriv,
+  Real lossCurvature,
+  function<void(Matrix<Real>&,Real)> regProx,
+  RowChunkStream<Real>& A,
+  bool intercept,
+  Matrix<Real>& x,
+  const StochasticCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("StochasticModelFit"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int xHeight = ( intercept ? n+1 : n );
+    if( ctrl.batchSize <= 0 )
+        LogicError("Mini-batch size must be positive");
+    if( x.Height() != xHeight || x.Width() != 1 )
+        Zeros( x, xHeight, 1 );
+    if( m == 0 )
+        return 0;
+
+    Matrix<Real> chunk, AB, t, tSnap;
+    vector<Int> rows, perm, batch;
+    Int rowOffset;
+
+    // t := A_B w + beta
+    auto applyRows =
+      [&]( const Matrix<Real>& ARows, const Matrix<Real>& y, Matrix<Real>& z )
+      {
+        Gemv( NORMAL, Real(1), ARows, y(IR(0,n),ALL), z );
+        if( intercept )
+            Shift( z, y.Get(n,0) );
+      };
+    // g := g + alpha [A_B^T s; 1^T s]
+    auto applyRowsAdj =
+      [&]( const Matrix<Real>& ARows, const Matrix<Real>& z, Real alpha,
+           Matrix<Real>& g )
+      {
+        auto gw = g( IR(0,n), ALL );
+        Gemv( TRANSPOSE, alpha, ARows, z, Real(1), gw );
+        if( intercept )
+        {
+            Real zSum = 0;
+            for( Int k=0; k<z.Height(); ++k )
+                zSum += z.Get(k,0);
+            g.Update( n, 0, alpha*zSum );
+        }
+      };
+    // x := prox_{tau r}(x - step v), leaving any intercept unpenalized
+    auto proxStep =
+      [&]( const Matrix<Real>& v, Real step, Real tau )
+      {
+        Axpy( -step, v, x );
+        auto w = x( IR(0,n), ALL );
+        regProx( w, tau );
+      };
+    auto extractBatch =
+      [&]( Int batchBeg, Int batchEnd )
+      {
+        batch.resize( batchEnd-batchBeg );
+        rows.resize( batchEnd-batchBeg );
+        for( Int k=batchBeg; k<batchEnd; ++k )
+        {
+            batch[k-batchBeg] = perm[k];
+            rows[k-batchBeg] = rowOffset + perm[k];
+        }
+        AB = chunk( batch, IR(0,n) );
+      };
+
+    // Choose the step size
+    // ====================
+    // The objective is scaled by 1/m so that the average of the individual
+    // losses is minimized, and each loss gradient is Lipschitz with constant
+    // at most lossCurvature || [a_i; 1] ||_2^2.
+    Real step = ctrl.stepSize;
+    if( step <= Real(0) )
+    {
+        Real maxRowNormSq = 0;
+        A.Rewind();
+        while( A.Next( chunk, rowOffset ) )
+        {
+            const Int chunkHeight = chunk.Height();
+            for( Int i=0; i<chunkHeight; ++i )
+            {
+                Real rowNormSq = ( intercept ? Real(1) : Real(0) );
+                for( Int j=0; j<n; ++j )
+                    rowNormSq += chunk.Get(i,j)*chunk.Get(i,j);
+                maxRowNormSq = Max( maxRowNormSq, rowNormSq );
+            }
+        }
+        const Real L = lossCurvature*maxRowNormSq;
+        step = ( L > Real(0) ? 1/(3*L) : Real(1) );
+    }
+    const Real tau = step / Real(m);
+    if( ctrl.progress )
+        Output("Using a step size of ",step);
+
+    Matrix<Real> xOld, xSnap, mu, v, dTable, gBar;
+    if( ctrl.method == PROX_SAGA )
+    {
+        // The gradient table only requires one scalar per row since the
+        // losses are functions of a_i^T w + beta
+        Zeros( dTable, m, 1 );
+        Zeros( gBar, xHeight, 1 );
+    }
+
+    Int numEpochs=0;
+    bool converged=false;
+    for( ; numEpochs<ctrl.maxEpochs; ++numEpochs )
+    {
+        xOld = x;
+        if( ctrl.method == PROX_SVRG )
+        {
+            // Compute the full gradient at the snapshot
+            // =========================================
+            xSnap = x;
+            Zeros( mu, xHeight, 1 );
+            A.Rewind();
+            while( A.Next( chunk, rowOffset ) )
+            {
+                const Int chunkHeight = chunk.Height();
+                rows.resize( chunkHeight );
+                for( Int i=0; i<chunkHeight; ++i )
+                    rows[i] = rowOffset + i;
+                applyRows( chunk, xSnap, t );
+                lossDeriv( rows, t );
+                applyRowsAdj( chunk, t, 1/Real(m), mu );
+            }
+
+            // Take variance-reduced steps over random mini-batches
+            // ====================================================
+            A.Rewind();
+            while( A.Next( chunk, rowOffset ) )
+            {
+                const Int chunkHeight = chunk.Height();
+                RandomPermutation( chunkHeight, perm );
+                for( Int k=0; k<chunkHeight; k+=ctrl.batchSize )
+                {
+                    const Int batchEnd = Min(k+ctrl.batchSize,chunkHeight);
+                    extractBatch( k, batchEnd );
+                    applyRows( AB, x, t );
+                    applyRows( AB, xSnap, tSnap );
+                    lossDeriv( rows, t );
+                    lossDeriv( rows, tSnap );
+                    t -= tSnap;
+
+                    v = mu;
+                    applyRowsAdj( AB, t, 1/Real(batchEnd-k), v );
+                    proxStep( v, step, tau );
+                }
+            }
+        }
+        else
+        {
+            // Take SAGA steps over random mini-batches
+            // ========================================
+            A.Rewind();
+            while( A.Next( chunk, rowOffset ) )
+            {
+                const Int chunkHeight = chunk.Height();
+                RandomPermutation( chunkHeight, perm );
+                for( Int k=0; k<chunkHeight; k+=ctrl.batchSize )
+                {
+                    const Int batchEnd = Min(k+ctrl.batchSize,chunkHeight);
+                    const Int batchSize = batchEnd - k;
+                    extractBatch( k, batchEnd );
+                    applyRows( AB, x, t );
+                    lossDeriv( rows, t );
+
+                    // tSnap := t - (stored derivatives)
+                    tSnap = t;
+                    for( Int l=0; l<batchSize; ++l )
+                    {
+                        tSnap.Update( l, 0, -dTable.Get(rows[l],0) );
+                        dTable.Set( rows[l], 0, t.Get(l,0) );
+                    }
+
+                    v = gBar;
+                    applyRowsAdj( AB, tSnap, 1/Real(batchSize), v );
+                    proxStep( v, step, tau );
+                    applyRowsAdj( AB, tSnap, 1/Real(m), gBar );
+                }
+            }
+        }
+
+        // Check for convergence
+        // =====================
+        const Real xNrm2 = FrobeniusNorm( x );
+        xOld -= x;
+        const Real relChange = FrobeniusNorm( xOld ) / Max(xNrm2,Real(1));
+        if( ctrl.progress )
+            Output
+            ("epoch ",numEpochs,": || x - xOld ||_2 / max(1,|| x ||_2) = ",
+             relChange);
+        if( relChange <= ctrl.tol )
+        {
+            converged = true;
+            ++numEpochs;
+            break;
+        }
+    }
+    if( !converged && ctrl.progress )
+        Output("Stochastic model fit did not converge");
+    return numEpochs;
+}
+
+#define PROTO(Real) \
+  template Int StochasticModelFit \
+  ( function<void(const vector<Int>&,Matrix<Real>&)> lossDeriv, \
+    Real lossCurvature, \
+    function<void(Matrix<Real>&,Real)> regProx, \
+    RowChunkStream<Real>& A, \
+    bool intercept, \
+    Matrix<Real>& x, \
+    const StochasticCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -14,25 +14,51 @@ template<typename Real>
 void LowerClip( Matrix<Real>& X, Real lowerBound )
 {
     DEBUG_ONLY(CSE cse("LowerClip"))
-    auto lowerClip = [&]( Real alpha ) { return Max(lowerBound,alpha); };
-    EntrywiseMap( X, function<Real(Real)>(lowerClip) );
+    const Int m = X.Height();
+    const Int n = X.Width();
+    Real* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real* EL_RESTRICT xCol = &XBuf[j*XLDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+            xCol[i] = Max(lowerBound,xCol[i]);
+    }
 }
 
 template<typename Real>
 void UpperClip( Matrix<Real>& X, Real upperBound )
 {
     DEBUG_ONLY(CSE cse("UpperClip"))
-    auto upperClip = [&]( Real alpha ) { return Min(upperBound,alpha); };
-    EntrywiseMap( X, function<Real(Real)>(upperClip) );
+    const Int m = X.Height();
+    const Int n = X.Width();
+    Real* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real* EL_RESTRICT xCol = &XBuf[j*XLDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+            xCol[i] = Min(upperBound,xCol[i]);
+    }
 }
 
 template<typename Real>
 void Clip( Matrix<Real>& X, Real lowerBound, Real upperBound )
 {
     DEBUG_ONLY(CSE cse("Clip"))
-    auto clip = [&]( Real alpha ) 
-                { return Max(lowerBound,Min(upperBound,alpha)); };
-    EntrywiseMap( X, function<Real(Real)>(clip) );
+    const Int m = X.Height();
+    const Int n = X.Width();
+    Real* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real* EL_RESTRICT xCol = &XBuf[j*XLDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+            xCol[i] = Max(lowerBound,Min(upperBound,xCol[i]));
+    }
 }
 
 template<typename Real>
@@ -14,22 +14,29 @@ template<typename Real>
 void HingeLossProx( Matrix<Real>& A, Real tau )
 {
     DEBUG_ONLY(CSE cse("HingeLossProx"))
-    auto hingeProx = 
-      [=]( Real alpha ) -> Real
-      { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
-        else            { return alpha;                    } };
-    EntrywiseMap( A, function<Real(Real)>(hingeProx) );
+    const Real tauInv = 1/tau;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Real* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real* EL_RESTRICT aCol = &ABuf[j*ALDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+        {
+            // Entries below one are moved towards one by 1/tau
+            const Real alpha = aCol[i];
+            aCol[i] = ( alpha < Real(1) ? Min(alpha+tauInv,Real(1)) : alpha );
+        }
+    }
 }
 
 template<typename Real>
 void HingeLossProx( AbstractDistMatrix<Real>& A, Real tau )
 {
     DEBUG_ONLY(CSE cse("HingeLossProx"))
-    auto hingeProx = 
-      [=]( Real alpha ) -> Real
-      { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
-        else            { return alpha;                    } };
-    EntrywiseMap( A, function<Real(Real)>(hingeProx) );
+    HingeLossProx( A.Matrix(), tau );
 }
 
 #define PROTO(Real) \
@@ -11,25 +11,26 @@
 namespace El {
 
 template<typename F>
-F SoftThreshold( F alpha, Base<F> tau )
+void SoftThreshold( Matrix<F>& A, Base<F> tau, bool relative )
 {
     DEBUG_ONLY(
-        CSE cse("SoftThreshold");
-        if( tau < 0 )
-            LogicError("Negative threshold does not make sense");
+      CSE cse("SoftThreshold");
+      if( tau < 0 )
+          LogicError("Negative threshold does not make sense");
     )
-    const Base<F> scale = Abs(alpha);
-    return ( scale <= tau ? F(0) : alpha-(alpha/scale)*tau );
-}
-
-template<typename F>
-void SoftThreshold( Matrix<F>& A, Base<F> tau, bool relative )
-{
-    DEBUG_ONLY(CSE cse("SoftThreshold"))
     if( relative )
         tau *= MaxNorm(A);
-    auto softThresh = [&]( F alpha ) { return SoftThreshold(alpha,tau); };
-    EntrywiseMap( A, function<F(F)>(softThresh) );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        F* EL_RESTRICT aCol = &ABuf[j*ALDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+            aCol[i] = SoftThreshold( aCol[i], tau );
+    }
 }
 
 template<typename F>
@@ -38,12 +39,10 @@ void SoftThreshold( AbstractDistMatrix<F>& A, Base<F> tau, bool relative )
     DEBUG_ONLY(CSE cse("SoftThreshold"))
     if( relative )
         tau *= MaxNorm(A);
-    auto softThresh = [&]( F alpha ) { return SoftThreshold(alpha,tau); };
-    EntrywiseMap( A, function<F(F)>(softThresh) );
+    SoftThreshold( A.Matrix(), tau );
 }
 
 #define PROTO(F) \
-  template F SoftThreshold( F alpha, Base<F> tau ); \
   template void SoftThreshold \
   ( Matrix<F>& A, Base<F> tau, bool relative ); \
   template void SoftThreshold \
@@ -23,7 +23,17 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
+    ctrl->denseCols = true;
+    ctrl->denseColRatio = 10;
+    ctrl->maxDenseCols = 50;
+    ctrl->denseColMaxRefineIts = 10;
     ctrl->mehrotra = true;
+    ctrl->gondzio = false;
+    ctrl->maxGondzioCorrectors = 4;
+    ctrl->gondzioStepIncrease = 0.1;
+    ctrl->gondzioMinImprovement = 0.1;
+    ctrl->gondzioBetaMin = 0.1;
+    ctrl->gondzioBetaMax = 10;
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_s( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
@@ -56,7 +66,17 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
+    ctrl->denseCols = true;
+    ctrl->denseColRatio = 10;
+    ctrl->maxDenseCols = 50;
+    ctrl->denseColMaxRefineIts = 10;
     ctrl->mehrotra = true;
+    ctrl->gondzio = false;
+    ctrl->maxGondzioCorrectors = 4;
+    ctrl->gondzioStepIncrease = 0.1;
+    ctrl->gondzioMinImprovement = 0.1;
+    ctrl->gondzioBetaMin = 0.1;
+    ctrl->gondzioBetaMax = 10;
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_d( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
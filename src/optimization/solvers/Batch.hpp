@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_BATCH_HPP
+#define EL_OPTIMIZATION_SOLVERS_BATCH_HPP
+
+namespace El {
+namespace batch {
+
+// Drive the solution of a family of "direct" conic-form problems which share
+// their constraint matrices (which are assumed to have already been
+// equilibrated by the caller) but differ in their right-hand sides and cost
+// vectors, which are given by the columns of B and C.
+//
+// The problems are split into contiguous chains, one per process of 'comm',
+// which are solved concurrently. Within a chain, each problem is warm-started
+// from the solution of its predecessor after shifting x and z back into the
+// interior of the positive orthant (by warmStartShift*Max(1,|| . ||_max)),
+// so that the IPM begins near the central path of the perturbed problem
+// rather than on the boundary. If a warm-started solve fails, the problem is
+// solved again from a cold start.
+//
+// The functor 'solve(b,c,x,y,z,ctrl)' should run the IPM for a single
+// problem, using (x,y,z) as the initial guess if and only if
+// ctrl.primalInit and ctrl.dualInit are set, and return the number of
+// iterations. On exit, numIts(k,0) holds the number of iterations required
+// for problem k and, if 'compareCold' is true, numIts(k,1) holds the number
+// required from a cold start.
+
+template<typename Real,typename SolveType>
+void Solve
+( const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const MehrotraCtrl<Real>& ctrl,
+        bool warmStart,
+        Real warmStartShift,
+        bool compareCold,
+        bool progress,
+        mpi::Comm comm,
+        SolveType solve )
+{
+    DEBUG_ONLY(
+      CSE cse("batch::Solve");
+      if( B.Width() != C.Width() )
+          LogicError("B and C should have the same number of columns");
+    )
+    const Int m = B.Height();
+    const Int n = C.Height();
+    const Int numProblems = B.Width();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int first = (commRank*numProblems) / commSize;
+    const Int last = ((commRank+1)*numProblems) / commSize;
+
+    Zeros( X, n, numProblems );
+    Zeros( Y, m, numProblems );
+    Zeros( Z, n, numProblems );
+    Zeros( numIts, numProblems, (compareCold ? 2 : 1) );
+
+    auto coldCtrl = ctrl;
+    coldCtrl.primalInit = false;
+    coldCtrl.dualInit = false;
+    auto warmCtrl = ctrl;
+    warmCtrl.primalInit = true;
+    warmCtrl.dualInit = true;
+
+    // If a problem cannot be solved, the remaining problems of this chain are
+    // abandoned and the failure is reported on every process (rather than
+    // leaving the other processes waiting in the reductions below)
+    Int localFailure = -1;
+    string failureMsg;
+    Matrix<Real> b, c, x, y, z, xCold, yCold, zCold;
+    for( Int k=first; k<last; ++k )
+    {
+        try
+        {
+            b = B( ALL, IR(k) );
+            c = C( ALL, IR(k) );
+
+            Int its = -1;
+            if( warmStart && k > first )
+            {
+                // Shift the previous solution, which is still held in
+                // (x,y,z), back into the interior
+                Shift( x, warmStartShift*Max(MaxNorm(x),Real(1)) );
+                Shift( z, warmStartShift*Max(MaxNorm(z),Real(1)) );
+                try
+                {
+                    its = solve( b, c, x, y, z, warmCtrl );
+                }
+                catch( std::exception& e )
+                {
+                    if( progress )
+                        Output
+                        ("Warm start of problem ",k," failed (",e.what(),
+                         "); using a cold start");
+                    its = -1;
+                }
+            }
+            if( its < 0 )
+                its = solve( b, c, x, y, z, coldCtrl );
+            numIts.Set( k, 0, its );
+
+            if( compareCold )
+            {
+                const Int coldIts =
+                  solve( b, c, xCold, yCold, zCold, coldCtrl );
+                numIts.Set( k, 1, coldIts );
+                if( progress )
+                    Output
+                    ("problem ",k,": ",its," iterations (",coldIts," cold)");
+            }
+            else if( progress )
+                Output("problem ",k,": ",its," iterations");
+
+            auto xk = X( ALL, IR(k) );
+            auto yk = Y( ALL, IR(k) );
+            auto zk = Z( ALL, IR(k) );
+            xk = x;
+            yk = y;
+            zk = z;
+        }
+        catch( std::exception& e )
+        {
+            localFailure = k;
+            failureMsg = e.what();
+            break;
+        }
+    }
+    const Int failure =
+      ( commSize > 1 ? mpi::AllReduce( localFailure, mpi::MAX, comm )
+                     : localFailure );
+    if( localFailure >= 0 )
+        RuntimeError
+        ("Problem ",localFailure," of the batch failed: ",failureMsg);
+    else if( failure >= 0 )
+        RuntimeError
+        ("Problem ",failure," of the batch failed on another process");
+
+    // Each problem was solved by exactly one process, and so the results can
+    // be combined with a sum
+    if( commSize > 1 )
+    {
+        mpi::AllReduce( X.Buffer(), n*numProblems, comm );
+        mpi::AllReduce( Y.Buffer(), m*numProblems, comm );
+        mpi::AllReduce( Z.Buffer(), n*numProblems, comm );
+        mpi::AllReduce( numIts.Buffer(), numIts.Height()*numIts.Width(), comm );
+    }
+}
+
+} // namespace batch
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_BATCH_HPP
@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_GONDZIO_HPP
+#define EL_OPTIMIZATION_SOLVERS_GONDZIO_HPP
+
+namespace El {
+namespace gondzio {
+
+// Gondzio's multiple centrality correctors [1] reuse the factorization of the
+// KKT system to refine the predictor-corrector direction: given a direction
+// with step lengths (alphaPri,alphaDual), the products of the trial iterates
+//
+//   v = (s + alphaPriTarget ds) o (z + alphaDualTarget dz),
+//
+// with alphaTarget = min(alpha + gondzioStepIncrease, 1), are projected onto
+// [gondzioBetaMin,gondzioBetaMax] sigma mu, and the difference is added to
+// the complementarity right-hand side before re-solving. The new direction
+// is only kept if it lengthens the (minimum) step by at least
+// gondzioMinImprovement*gondzioStepIncrease.
+//
+// [1] J. Gondzio, "Multiple centrality corrections in a primal-dual method
+//     for linear programming", Computational Optimization and Applications,
+//     6, pp. 137--156, 1996.
+//
+
+// Since each corrector costs one solve with the existing factorization, the
+// number of correctors to attempt is chosen from the ratio of the time spent
+// forming and factoring the KKT system to the time of a single solve. The
+// timings are reduced over 'comm' so that every process makes the same
+// choice.
+template<typename Real>
+inline Int NumCorrectors
+( const MehrotraCtrl<Real>& ctrl,
+  double factTime,
+  double solveTime,
+  mpi::Comm comm=mpi::COMM_SELF )
+{
+    if( !ctrl.gondzio || ctrl.maxGondzioCorrectors <= 0 )
+        return 0;
+    factTime = mpi::AllReduce( factTime, mpi::MAX, comm );
+    solveTime = mpi::AllReduce( solveTime, mpi::MAX, comm );
+    const double ratio = factTime / Max(solveTime,1e-12);
+
+    Int numCorrectors;
+    if( ratio < 2 )
+        numCorrectors = 0;
+    else if( ratio <= 10 )
+        numCorrectors = 1;
+    else if( ratio <= 30 )
+        numCorrectors = 2;
+    else if( ratio <= 50 )
+        numCorrectors = 3;
+    else
+        numCorrectors = 4;
+    return Min(numCorrectors,ctrl.maxGondzioCorrectors);
+}
+
+// Correctors for the positive orthant
+// ===================================
+// The functor 'solve(rmuCand)' should compute the direction corresponding to
+// the complementarity right-hand side 'rmuCand' using the existing
+// factorization (throwing upon failure) and store its conic components in
+// 'dsCand' and 'dzCand', while 'accept()' should overwrite the current
+// direction, whose conic components are 'ds' and 'dz', with the candidate.
+// On exit, 'rmu' corresponds to the current direction. The number of
+// accepted correctors is returned.
+template<typename Real,class VecType,class SolveType,class AcceptType>
+Int PosOrthCorrectors
+( const MehrotraCtrl<Real>& ctrl,
+  Int numCorrectors,
+  Real sigmaMu,
+  const VecType& s,
+  const VecType& z,
+  const VecType& ds,
+  const VecType& dz,
+  const VecType& dsCand,
+  const VecType& dzCand,
+        VecType& rmu,
+  SolveType solve,
+  AcceptType accept )
+{
+    DEBUG_ONLY(CSE cse("gondzio::PosOrthCorrectors"))
+    if( numCorrectors <= 0 )
+        return 0;
+    const Real lowerBound = ctrl.gondzioBetaMin*sigmaMu;
+    const Real upperBound = ctrl.gondzioBetaMax*sigmaMu;
+    const Real minImprovement =
+      ctrl.gondzioMinImprovement*ctrl.gondzioStepIncrease;
+
+    Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+    Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+    if( ctrl.forceSameStep )
+        alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+    VecType sTrial(s), zTrial(z), rmuCand(rmu);
+    Int numAccepted = 0;
+    for( Int k=0; k<numCorrectors; ++k )
+    {
+        if( Min(alphaPri,alphaDual) == Real(1) )
+            break;
+        const Real alphaPriTarget =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTarget =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu_cand := r_mu + (v - proj(v)), with v the trial products
+        // ------------------------------------------------------------
+        // NOTE: zTrial is overwritten with the products
+        sTrial = s;
+        zTrial = z;
+        Axpy( alphaPriTarget, ds, sTrial );
+        Axpy( alphaDualTarget, dz, zTrial );
+        DiagonalScale( LEFT, NORMAL, sTrial, zTrial );
+        pos_orth::CentralityCorrection( zTrial, lowerBound, upperBound );
+        rmuCand = rmu;
+        rmuCand += zTrial;
+
+        try { solve( rmuCand ); }
+        catch(...) { break; }
+
+        Real alphaPriCand = pos_orth::MaxStep( s, dsCand, Real(1) );
+        Real alphaDualCand = pos_orth::MaxStep( z, dzCand, Real(1) );
+        if( ctrl.forceSameStep )
+            alphaPriCand = alphaDualCand = Min(alphaPriCand,alphaDualCand);
+        if( Min(alphaPriCand,alphaDualCand) <
+            Min(alphaPri,alphaDual) + minImprovement )
+            break;
+
+        accept();
+        rmu = rmuCand;
+        alphaPri = alphaPriCand;
+        alphaDual = alphaDualCand;
+        ++numAccepted;
+    }
+    return numAccepted;
+}
+
+// Correctors for products of second-order cones
+// =============================================
+// The analogue of PosOrthCorrectors in the scaled Jordan algebra: with
+// l = W z = inv(W)^T s, the trial products are
+//
+//   v = (l + alphaPriTarget inv(W)^T ds) o (l + alphaDualTarget W dz),
+//
+// whose eigenvalues are projected onto [gondzioBetaMin,gondzioBetaMax] sigma
+// mu, and inv(l) o (v - proj(v)) is added to the complementarity right-hand
+// side (as in Mehrotra's corrector).
+template<typename Real,class VecType,class IntVecType,
+         class SolveType,class AcceptType>
+Int SOCCorrectors
+( const MehrotraCtrl<Real>& ctrl,
+  Int numCorrectors,
+  Real sigmaMu,
+  const VecType& s,
+  const VecType& z,
+  const VecType& ds,
+  const VecType& dz,
+  const VecType& dsCand,
+  const VecType& dzCand,
+        VecType& rmu,
+  const VecType& wRoot,
+  const VecType& wRootInv,
+  const VecType& l,
+  const VecType& lInv,
+  const IntVecType& orders,
+  const IntVecType& firstInds,
+  SolveType solve,
+  AcceptType accept )
+{
+    DEBUG_ONLY(CSE cse("gondzio::SOCCorrectors"))
+    if( numCorrectors <= 0 )
+        return 0;
+    const Real lowerBound = ctrl.gondzioBetaMin*sigmaMu;
+    const Real upperBound = ctrl.gondzioBetaMax*sigmaMu;
+    const Real minImprovement =
+      ctrl.gondzioMinImprovement*ctrl.gondzioStepIncrease;
+
+    Real alphaPri = soc::MaxStep( s, ds, orders, firstInds, Real(1) );
+    Real alphaDual = soc::MaxStep( z, dz, orders, firstInds, Real(1) );
+    if( ctrl.forceSameStep )
+        alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+    VecType sTrial(s), zTrial(z), v(s), rmuCand(rmu);
+    Int numAccepted = 0;
+    for( Int k=0; k<numCorrectors; ++k )
+    {
+        if( Min(alphaPri,alphaDual) == Real(1) )
+            break;
+        const Real alphaPriTarget =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTarget =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu_cand := r_mu + inv(l) o (v - proj(v))
+        // ------------------------------------------
+        soc::ApplyQuadratic( wRootInv, ds, sTrial, orders, firstInds );
+        soc::ApplyQuadratic( wRoot, dz, zTrial, orders, firstInds );
+        sTrial *= alphaPriTarget;
+        zTrial *= alphaDualTarget;
+        sTrial += l;
+        zTrial += l;
+        soc::Apply( sTrial, zTrial, v, orders, firstInds );
+        soc::CentralityCorrection
+        ( v, lowerBound, upperBound, orders, firstInds );
+        soc::Apply( lInv, v, orders, firstInds );
+        rmuCand = rmu;
+        rmuCand += v;
+
+        try { solve( rmuCand ); }
+        catch(...) { break; }
+
+        Real alphaPriCand =
+          soc::MaxStep( s, dsCand, orders, firstInds, Real(1) );
+        Real alphaDualCand =
+          soc::MaxStep( z, dzCand, orders, firstInds, Real(1) );
+        if( ctrl.forceSameStep )
+            alphaPriCand = alphaDualCand = Min(alphaPriCand,alphaDualCand);
+        if( Min(alphaPriCand,alphaDualCand) <
+            Min(alphaPri,alphaDual) + minImprovement )
+            break;
+
+        accept();
+        rmu = rmuCand;
+        alphaPri = alphaPriCand;
+        alphaDual = alphaDualCand;
+        ++numAccepted;
+    }
+    return numAccepted;
+}
+
+} // namespace gondzio
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_GONDZIO_HPP
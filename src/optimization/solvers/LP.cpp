@@ -101,6 +101,30 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> ARed;
+        Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+        PresolveRecord<Real> record;
+        lp::direct::Presolve
+        ( A, b, c, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+
+        // NOTE: Initial guesses for the original problem are not mapped
+        auto ctrlRed = ctrl;
+        ctrlRed.presolve = false;
+        ctrlRed.mehrotraCtrl.primalInit = false;
+        ctrlRed.mehrotraCtrl.dualInit = false;
+        if( ARed.Width() > 0 )
+            LP( ARed, bRed, cRed, xRed, yRed, zRed, ctrlRed );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+        }
+        lp::direct::Postsolve( A, c, record, xRed, yRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -138,6 +162,32 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.presolve )
+    {
+        mpi::Comm comm = A.Comm();
+        DistSparseMatrix<Real> ARed(comm);
+        DistMultiVec<Real> bRed(comm), cRed(comm),
+                           xRed(comm), yRed(comm), zRed(comm);
+        PresolveRecord<Real> record;
+        lp::direct::Presolve
+        ( A, b, c, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+
+        // NOTE: Initial guesses for the original problem are not mapped
+        auto ctrlRed = ctrl;
+        ctrlRed.presolve = false;
+        ctrlRed.mehrotraCtrl.primalInit = false;
+        ctrlRed.mehrotraCtrl.dualInit = false;
+        if( ARed.Width() > 0 )
+            LP( ARed, bRed, cRed, xRed, yRed, zRed, ctrlRed );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+        }
+        lp::direct::Postsolve( A, c, record, xRed, yRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -158,7 +208,24 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LP"))
-    if( ctrl.approach == LP_MEHROTRA )
+    if( ctrl.approach == LP_ADMM )
+    {
+        // Treat the positive orthant as a product of SOCs of order one
+        mpi::Comm comm = A.Comm();
+        const Int n = A.Width();
+        const Int k = G.Height();
+        DistSparseMatrix<Real> Q(comm);
+        Zeros( Q, n, n );
+        DistMultiVec<Int> orders(comm), firstInds(comm);
+        Ones( orders, k, 1 );
+        Zeros( firstInds, k, 1 );
+        for( Int iLoc=0; iLoc<firstInds.LocalHeight(); ++iLoc )
+            firstInds.SetLocal( iLoc, 0, firstInds.GlobalRow(iLoc) );
+        splitting::ADMM
+        ( Q, A, G, b, c, h, orders, firstInds, x, y, z, s,
+          ctrl.splittingCtrl );
+    }
+    else if( ctrl.approach == LP_MEHROTRA )
         lp::affine::Mehrotra( A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
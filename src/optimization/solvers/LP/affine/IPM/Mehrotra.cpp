@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 #include "./util.hpp"
+#include "../../../Gondzio.hpp"
 
 namespace El {
 namespace lp {
@@ -115,10 +116,12 @@ void Mehrotra
     Matrix<Real> J, d,
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCand, dyCand, dzCand, dsCand;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -198,6 +201,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -226,6 +230,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -290,12 +296,22 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -304,7 +320,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -456,16 +486,20 @@ void Mehrotra
     DistMatrix<Real> J(grid),     d(grid), 
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
-                     dx(grid),    dy(grid),    dz(grid),    ds(grid);
+                     dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                     dxCand(grid), dyCand(grid), dzCand(grid), dsCand(grid);
     dsAff.AlignWith( s );
     dzAff.AlignWith( s );
     ds.AlignWith( s );
     dz.AlignWith( s );
+    dsCand.AlignWith( s );
+    dzCand.AlignWith( s );
     rmu.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -546,6 +580,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
         // r_mu := s o z
         // -------------
         rmu = z;
@@ -571,6 +606,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -636,12 +673,22 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMatrix<Real>& rmuStep,
+               DistMatrix<Real>& dxStep,
+               DistMatrix<Real>& dyStep,
+               DistMatrix<Real>& dzStep,
+               DistMatrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -650,7 +697,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, grid.Comm() );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const DistMatrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -800,11 +861,13 @@ void Mehrotra
                  w,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCand, dyCand, dzCand, dsCand;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -888,6 +951,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -939,6 +1003,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1004,23 +1070,30 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the proposed step
-        // ---------------------------
-        try
-        {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1029,7 +1102,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
@@ -1098,7 +1185,7 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    Timer timer, gondzioTimer;
 
     // Equilibrate the LP by diagonally scaling [A;G]
     auto A = APre;
@@ -1215,7 +1302,8 @@ void Mehrotra
                        w(comm),
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
-                       dx(comm),    dy(comm),    dz(comm),    ds(comm);
+                       dx(comm),    dy(comm),    dz(comm),    ds(comm),
+                       dxCand(comm), dyCand(comm), dzCand(comm), dsCand(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
@@ -1305,6 +1393,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -1372,6 +1461,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1438,27 +1529,34 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try
-        {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector: ",timer.Stop()," secs");
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMultiVec<Real>& rmuStep,
+               DistMultiVec<Real>& dxStep,
+               DistMultiVec<Real>& dyStep,
+               DistMultiVec<Real>& dzStep,
+               DistMultiVec<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              if( commRank == 0 && ctrl.time )
+                  timer.Start();
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              if( commRank == 0 && ctrl.time )
+                  Output("Corrector: ",timer.Stop()," secs");
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1467,7 +1565,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, comm );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const DistMultiVec<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
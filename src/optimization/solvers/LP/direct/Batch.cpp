@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "./IPM.hpp"
+#include "../../Batch.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// Equilibrate A once for the entire batch (rather than once per problem, as
+// would happen within Mehrotra) and then drive the individual solves, each
+// of which only rescales || b ||_max and || c ||_max to roughly one.
+// The functor 'solve' should run Mehrotra without outer equilibration on the
+// (equilibrated) matrix A.
+template<typename Real,class MatrixType,class SolveType>
+inline void BatchHelper
+(       MatrixType& A,
+  const Matrix<Real>& BPre,
+  const Matrix<Real>& CPre,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const BatchCtrl<Real>& ctrl,
+        mpi::Comm comm,
+        SolveType solve )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::BatchHelper"))
+    const bool outerEquil = ctrl.mehrotraCtrl.outerEquil;
+    auto B = BPre;
+    auto C = CPre;
+    Matrix<Real> dRow, dCol;
+    if( outerEquil )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.mehrotraCtrl.print );
+        DiagonalSolve( LEFT, NORMAL, dRow, B );
+        DiagonalSolve( LEFT, NORMAL, dCol, C );
+    }
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    mehrotraCtrl.outerEquil = false;
+
+    auto rescaledSolve =
+      [&]( const Matrix<Real>& bEquil, const Matrix<Real>& cEquil,
+           Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z,
+           const MehrotraCtrl<Real>& solveCtrl ) -> Int
+      {
+          if( !outerEquil )
+              return solve( bEquil, cEquil, x, y, z, solveCtrl );
+
+          // Rescale || b ||_max and || c ||_max to roughly one
+          const Real bScale = Max(MaxNorm(bEquil),Real(1));
+          const Real cScale = Max(MaxNorm(cEquil),Real(1));
+          auto b = bEquil;
+          auto c = cEquil;
+          b *= Real(1)/bScale;
+          c *= Real(1)/cScale;
+          if( solveCtrl.primalInit )
+              x *= Real(1)/bScale;
+          if( solveCtrl.dualInit )
+          {
+              y *= Real(1)/cScale;
+              z *= Real(1)/cScale;
+          }
+          const Int numIts = solve( b, c, x, y, z, solveCtrl );
+          x *= bScale;
+          y *= cScale;
+          z *= cScale;
+          return numIts;
+      };
+    batch::Solve
+    ( B, C, X, Y, Z, numIts, mehrotraCtrl,
+      ctrl.warmStart, ctrl.warmStartShift, ctrl.compareCold, ctrl.progress,
+      comm, rescaledSolve );
+
+    if( outerEquil )
+    {
+        DiagonalSolve( LEFT, NORMAL, dCol, X );
+        DiagonalSolve( LEFT, NORMAL, dRow, Y );
+        DiagonalScale( LEFT, NORMAL, dCol, Z );
+    }
+}
+
+} // namespace direct
+} // namespace lp
+
+template<typename Real>
+void LP
+( const Matrix<Real>& APre,
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const lp::direct::BatchCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    auto A = APre;
+    auto solve =
+      [&]( const Matrix<Real>& b, const Matrix<Real>& c,
+           Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z,
+           const MehrotraCtrl<Real>& solveCtrl ) -> Int
+      { return lp::direct::Mehrotra( A, b, c, x, y, z, solveCtrl ); };
+    lp::direct::BatchHelper( A, B, C, X, Y, Z, numIts, ctrl, comm, solve );
+}
+
+template<typename Real>
+void LP
+( const SparseMatrix<Real>& APre,
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const lp::direct::BatchCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    auto A = APre;
+
+    // Since every problem in the batch has a KKT system with the same
+    // sparsity pattern, the nested dissection is only computed once
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+    bool analyzed = false;
+    auto solve =
+      [&]( const Matrix<Real>& b, const Matrix<Real>& c,
+           Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z,
+           const MehrotraCtrl<Real>& solveCtrl ) -> Int
+      {
+          const Int numIts =
+            lp::direct::Mehrotra
+            ( A, b, c, x, y, z, map, invMap, rootSep, info, analyzed,
+              solveCtrl );
+          analyzed = true;
+          return numIts;
+      };
+    lp::direct::BatchHelper( A, B, C, X, Y, Z, numIts, ctrl, comm, solve );
+}
+
+#define PROTO(Real) \
+  template void LP \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& B, \
+    const Matrix<Real>& C, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+          Matrix<Real>& Z, \
+          Matrix<Int>& numIts, \
+    const lp::direct::BatchCtrl<Real>& ctrl, \
+          mpi::Comm comm ); \
+  template void LP \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& B, \
+    const Matrix<Real>& C, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+          Matrix<Real>& Z, \
+          Matrix<Int>& numIts, \
+    const lp::direct::BatchCtrl<Real>& ctrl, \
+          mpi::Comm comm );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
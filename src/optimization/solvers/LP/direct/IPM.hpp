@@ -13,7 +13,7 @@ namespace lp {
 namespace direct {
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const Matrix<Real>& A,
   const Matrix<Real>& b,
   const Matrix<Real>& c,
@@ -22,7 +22,7 @@ void Mehrotra
         Matrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const ElementalMatrix<Real>& A,
   const ElementalMatrix<Real>& b,
   const ElementalMatrix<Real>& c,
@@ -31,7 +31,7 @@ void Mehrotra
         ElementalMatrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const SparseMatrix<Real>& A,
   const Matrix<Real>& b,
   const Matrix<Real>& c,
@@ -39,8 +39,26 @@ void Mehrotra
         Matrix<Real>& y, 
         Matrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(true) );
+// This variant allows the symbolic analysis of the KKT system (the nested
+// dissection ordering and the resulting tree) to be reused across a family of
+// problems with the same sparsity structure; if 'reuseAnalysis' is false,
+// the analysis is computed and returned in the given arguments
 template<typename Real>
-void Mehrotra
+Int Mehrotra
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        vector<Int>& map,
+        vector<Int>& invMap,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  bool reuseAnalysis,
+  const MehrotraCtrl<Real>& ctrl );
+template<typename Real>
+Int Mehrotra
 ( const DistSparseMatrix<Real>& A,
   const DistMultiVec<Real>& b,
   const DistMultiVec<Real>& c,
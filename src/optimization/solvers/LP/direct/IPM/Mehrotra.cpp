@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 #include "./util.hpp"
+#include "../../../Gondzio.hpp"
 
 namespace El {
 namespace lp {
@@ -33,7 +34,7 @@ namespace direct {
 //
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const Matrix<Real>& APre, 
   const Matrix<Real>& bPre, 
   const Matrix<Real>& cPre,
@@ -127,12 +128,15 @@ void Mehrotra
     Matrix<Real> J, d, 
                  rb,    rc,    rmu,
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCand, dyCand, dzCand;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -202,6 +206,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -282,6 +287,8 @@ void Mehrotra
             ( A, gamma, x, z, rc, rmu, dxAff, dyAff, dzAff );
         }
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -350,63 +357,60 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+              {
+                  KKTRHS( rc, rb, rmuStep, z, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == AUGMENTED_KKT )
+              {
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == NORMAL_KKT )
+              {
+                  NormalKKTRHS( A, gamma, x, z, rc, rb, rmuStep, dyStep );
+                  ldl::SolveAfter( J, dSub, p, dyStep, false );
+                  ExpandNormalSolution
+                  ( A, gamma, x, z, rc, rmuStep, dxStep, dyStep, dzStep );
+              }
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else if( ctrl.system == NORMAL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dy );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, dy, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gamma, x, z, rc, rmu, dx, dy, dz );
-        }
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance ",ctrl.minTol);
+        }
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -463,10 +467,12 @@ void Mehrotra
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+
+    return numIts;
 }
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const ElementalMatrix<Real>& APre, 
   const ElementalMatrix<Real>& bPre, 
   const ElementalMatrix<Real>& cPre,
@@ -590,18 +596,23 @@ void Mehrotra
         J(grid), d(grid), 
         rc(grid),    rb(grid),    rmu(grid), 
         dxAff(grid), dyAff(grid), dzAff(grid),
-        dx(grid),    dy(grid),    dz(grid);
+        dx(grid),    dy(grid),    dz(grid),
+        dxCand(grid), dyCand(grid), dzCand(grid);
     dx.AlignWith( x );
     dz.AlignWith( x );
     dxAff.AlignWith( x );
     dzAff.AlignWith( x );
+    dxCand.AlignWith( x );
+    dzCand.AlignWith( x );
     rmu.AlignWith( x );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -672,6 +683,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -752,6 +764,8 @@ void Mehrotra
             ( A, gamma, x, z, rc, rmu, dxAff, dyAff, dzAff );
         }
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -821,63 +835,60 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMatrix<Real>& rmuStep,
+               DistMatrix<Real>& dxStep,
+               DistMatrix<Real>& dyStep,
+               DistMatrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+              {
+                  KKTRHS( rc, rb, rmuStep, z, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == AUGMENTED_KKT )
+              {
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == NORMAL_KKT )
+              {
+                  NormalKKTRHS( A, gamma, x, z, rc, rb, rmuStep, dyStep );
+                  ldl::SolveAfter( J, dSub, p, dyStep, false );
+                  ExpandNormalSolution
+                  ( A, gamma, x, z, rc, rmuStep, dxStep, dyStep, dzStep );
+              }
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else if( ctrl.system == NORMAL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dy );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, dy, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gamma, x, z, rc, rmu, dx, dy, dz );
-        }
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance ",ctrl.minTol);
+        }
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, grid.Comm() );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const DistMatrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -935,16 +946,23 @@ void Mehrotra
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+
+    return numIts;
 }
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const SparseMatrix<Real>& APre, 
   const Matrix<Real>& bPre,
   const Matrix<Real>& cPre,
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        vector<Int>& map,
+        vector<Int>& invMap,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  bool reuseAnalysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
@@ -1036,16 +1054,13 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( A, b, c, x, y, z, map, invMap, rootSep, info,
+        ( A, b, c, x, y, z, map, invMap, rootSep, info, reuseAnalysis,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
@@ -1054,7 +1069,7 @@ void Mehrotra
         ldl::NodeInfo augInfo;
         ldl::Separator augRootSep;
         Initialize
-        ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
+        ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo, false,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
 
@@ -1085,20 +1100,41 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    SparseMatrix<Real> J, JOrig;
+    // Split the dense columns of A off from the normal matrix so that they
+    // can be applied as a low-rank correction to the sparse factorization.
+    // Since the selection only depends upon the sparsity pattern of A, it is
+    // consistent with any reused analysis.
+    vector<Int> denseCols;
+    SparseMatrix<Real> ASparse;
+    if( ctrl.system == NORMAL_KKT && ctrl.denseCols )
+    {
+        SplitDenseColumns
+        ( A, ctrl.denseColRatio, ctrl.maxDenseCols, ASparse, denseCols );
+        if( ctrl.print && denseCols.size() > 0 )
+            Output
+            ("Treating ",denseCols.size()," dense columns as a low-rank ",
+             "correction");
+    }
+    const bool lowRank = denseCols.size() > 0;
+    reg_ldl::LowRankCorrection<Real> lowRankCorr;
+
+    SparseMatrix<Real> JStatic, J, JOrig;
     ldl::Front<Real> JFront;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCand, dyCand, dzCand;
 
     Real muOld = 0.1;
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -1176,6 +1212,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1186,14 +1223,25 @@ void Mehrotra
         {
             // Construct the KKT system
             // ------------------------
+            // NOTE: The iterate-independent portion of the KKT system is only
+            //       formed on the first iteration; afterwards, the diagonal
+            //       entries depending upon x and z are updated in-place
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gamma, delta, beta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticKKT( A, gamma, delta, beta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gamma, delta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticAugmentedKKT( A, gamma, delta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishAugmentedKKT( m, n, x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1220,7 +1268,7 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 )
+                if( numIts == 0 && !reuseAnalysis )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
@@ -1257,14 +1305,21 @@ void Mehrotra
             // ------------------------
             // TODO: Apply updates to a matrix of explicit zeros
             //       (with the correct sparsity pattern)
-            NormalKKT( A, gamma, delta, x, z, J, false );
+            if( lowRank )
+            {
+                NormalKKT( ASparse, gamma, delta, x, z, J, false );
+                NormalKKTLowRank
+                ( A, denseCols, gamma, x, z, J, regTmp, lowRankCorr.U );
+            }
+            else
+                NormalKKT( A, gamma, delta, x, z, J, false );
             NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dyAff );
 
             // Solve for the direction
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == 0 && !reuseAnalysis )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
@@ -1272,11 +1327,22 @@ void Mehrotra
                 JFront.Pull( J, map, info );
 
                 LDL( info, JFront, LDL_2D );
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, invMap, info, JFront, dyAff, 
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                if( lowRank )
+                {
+                    reg_ldl::FormLowRankCorrection
+                    ( invMap, info, JFront, lowRankCorr );
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, lowRankCorr, invMap, info, JFront, dyAff,
+                      ctrl.solveCtrl.relTol, ctrl.denseColMaxRefineIts,
+                      ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                }
+                else
+                    // NOTE: regTmp should be all zeros; replace with
+                    //       unregularized
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, invMap, info, JFront, dyAff, 
+                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
             }
             catch(...)
             {
@@ -1290,6 +1356,8 @@ void Mehrotra
             ( A, gamma, x, z, rc, rmu, dxAff, dyAff, dzAff );
         }
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1348,7 +1416,6 @@ void Mehrotra
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
-        // TODO: Gondzio's corrections 
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1359,77 +1426,78 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+                  KKTRHS( rc, rb, rmuStep, z, d );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+              else
+                  NormalKKTRHS( A, gamma, x, z, rc, rb, rmuStep, dyStep );
+
+              // NOTE: When ctrl.system == NORMAL_KKT, regTmp should be all
+              //       zeros (unless dense columns were split off); replace
+              //       with unregularized
+              if( ctrl.system == NORMAL_KKT && lowRank )
+                  reg_ldl::RegularizedSolveAfter
+                  ( J, regTmp, lowRankCorr, invMap, info, JFront, dyStep,
+                    ctrl.solveCtrl.relTol, ctrl.denseColMaxRefineIts,
+                    ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+              else if( ctrl.system == NORMAL_KKT )
+                  reg_ldl::RegularizedSolveAfter
+                  ( J, regTmp, invMap, info, JFront, dyStep,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+              else if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+
+              if( ctrl.system == FULL_KKT )
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              else
+                  ExpandNormalSolution
+                  ( A, gamma, x, z, rc, rmuStep, dxStep, dyStep, dzStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dy );
-            try
-            {
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, invMap, info, JFront, dy,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gamma, x, z, rc, rmu, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks 
 
         // Update the current estimates
@@ -1488,11 +1556,31 @@ void Mehrotra
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+
+    return numIts;
 }
 
 // TODO: Not use temporary regularization except in final iterations?
 template<typename Real>
-void Mehrotra
+Int Mehrotra
+( const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+    return Mehrotra
+    ( A, b, c, x, y, z, map, invMap, rootSep, info, false, ctrl );
+}
+
+template<typename Real>
+Int Mehrotra
 ( const DistSparseMatrix<Real>& APre, 
   const DistMultiVec<Real>& bPre, 
   const DistMultiVec<Real>& cPre,
@@ -1530,7 +1618,7 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    Timer timer, gondzioTimer;
 
     // Equilibrate the LP by diagonally scaling A
     auto A = APre;
@@ -1662,14 +1750,31 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Split the dense columns of A off from the normal matrix so that they
+    // can be applied as a low-rank correction to the sparse factorization
+    vector<Int> denseCols;
+    DistSparseMatrix<Real> ASparse(comm);
+    if( ctrl.system == NORMAL_KKT && ctrl.denseCols )
+    {
+        SplitDenseColumns
+        ( A, ctrl.denseColRatio, ctrl.maxDenseCols, ASparse, denseCols );
+        if( ctrl.print && denseCols.size() > 0 && commRank == 0 )
+            Output
+            ("Treating ",denseCols.size()," dense columns as a low-rank ",
+             "correction");
+    }
+    const bool lowRank = denseCols.size() > 0;
+    reg_ldl::DistLowRankCorrection<Real> lowRankCorr(comm);
+
     DistSparseMultMeta metaOrig, meta;
-    DistSparseMatrix<Real> J(comm), JOrig(comm);
+    DistSparseMatrix<Real> JStatic(comm), J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
                        dxAff(comm), dyAff(comm), dzAff(comm),
-                       dx(comm),    dy(comm),    dz(comm);
+                       dx(comm),    dy(comm),    dz(comm),
+                       dxCand(comm), dyCand(comm), dzCand(comm);
 
     Real muOld = 0.1;
     Real relError = 1;
@@ -1677,7 +1782,8 @@ void Mehrotra
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -1752,6 +1858,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1762,14 +1869,25 @@ void Mehrotra
         {
             // Assemble the KKT system
             // -----------------------
+            // NOTE: The iterate-independent portion of the KKT system is only
+            //       formed on the first iteration; afterwards, the diagonal
+            //       entries depending upon x and z are updated in-place
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gamma, delta, beta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticKKT( A, gamma, delta, beta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gamma, delta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticAugmentedKKT( A, gamma, delta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishAugmentedKKT( m, n, x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1869,7 +1987,14 @@ void Mehrotra
             // Assemble the KKT system
             // -----------------------
             // TODO: Apply updates on top of explicit zeros
-            NormalKKT( A, gamma, delta, x, z, J, false );
+            if( lowRank )
+            {
+                NormalKKT( ASparse, gamma, delta, x, z, J, false );
+                NormalKKTLowRank
+                ( A, denseCols, gamma, x, z, J, regTmp, lowRankCorr.U );
+            }
+            else
+                NormalKKT( A, gamma, delta, x, z, J, false );
             NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dyAff );
 
             // Solve for the direction
@@ -1908,10 +2033,20 @@ void Mehrotra
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start(); 
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, invMap, info, JFront, dyAff, dmvMeta,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                if( lowRank )
+                {
+                    reg_ldl::FormLowRankCorrection
+                    ( invMap, info, JFront, lowRankCorr );
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, lowRankCorr, invMap, info, JFront, dyAff,
+                      ctrl.solveCtrl.relTol, ctrl.denseColMaxRefineIts,
+                      ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                }
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, invMap, info, JFront, dyAff, dmvMeta,
+                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
                 if( commRank == 0 && ctrl.time )
                     Output("Affine: ",timer.Stop()," secs");
             }
@@ -1926,6 +2061,7 @@ void Mehrotra
             ExpandNormalSolution
             ( A, gamma, x, z, rc, rmu, dxAff, dyAff, dzAff );
         }
+        const double factTime = gondzioTimer.Stop();
 
         if( ctrl.checkResiduals && ctrl.print )
         {
@@ -1996,88 +2132,79 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMultiVec<Real>& rmuStep,
+               DistMultiVec<Real>& dxStep,
+               DistMultiVec<Real>& dyStep,
+               DistMultiVec<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+                  KKTRHS( rc, rb, rmuStep, z, d );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+              else
+                  NormalKKTRHS( A, gamma, x, z, rc, rb, rmuStep, dyStep );
+
+              if( commRank == 0 && ctrl.time )
+                  timer.Start();
+              if( ctrl.system == NORMAL_KKT && lowRank )
+                  reg_ldl::RegularizedSolveAfter
+                  ( J, regTmp, lowRankCorr, invMap, info, JFront, dyStep,
+                    ctrl.solveCtrl.relTol, ctrl.denseColMaxRefineIts,
+                    ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+              else if( ctrl.system == NORMAL_KKT )
+                  reg_ldl::RegularizedSolveAfter
+                  ( J, regTmp, invMap, info, JFront, dyStep, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+              else if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              if( commRank == 0 && ctrl.time )
+                  Output("Corrector: ",timer.Stop()," secs");
+
+              if( ctrl.system == FULL_KKT )
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              else
+                  ExpandNormalSolution
+                  ( A, gamma, x, z, rc, rmuStep, dxStep, dyStep, dzStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dy );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, invMap, info, JFront, dy, dmvMeta,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gamma, x, z, rc, rmu, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, comm );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const DistMultiVec<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks 
 
         // Update the current estimates
@@ -2135,10 +2262,12 @@ void Mehrotra
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+
+    return numIts;
 }
 
 #define PROTO(Real) \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2146,7 +2275,7 @@ void Mehrotra
           Matrix<Real>& y, \
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
     const ElementalMatrix<Real>& c, \
@@ -2154,15 +2283,28 @@ void Mehrotra
           ElementalMatrix<Real>& y, \
           ElementalMatrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template Int Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
+          vector<Int>& map, \
+          vector<Int>& invMap, \
+          ldl::Separator& rootSep, \
+          ldl::NodeInfo& info, \
+    bool reuseAnalysis, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
@@ -45,6 +45,7 @@ void Initialize
         vector<Int>& invMap,
         ldl::Separator& rootSep,
         ldl::NodeInfo& info,
+  bool reuseAnalysis,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -102,6 +103,24 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+template<typename Real>
+void StaticKKT
+( const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        SparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void StaticKKT
+( const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
+
+using qp::direct::FinishKKT;
 using qp::direct::KKTRHS;
 using qp::direct::ExpandSolution;
 
@@ -140,6 +159,22 @@ void AugmentedKKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+template<typename Real>
+void StaticAugmentedKKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        SparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void StaticAugmentedKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
+
+using qp::direct::FinishAugmentedKKT;
 using qp::direct::AugmentedKKTRHS;
 using qp::direct::ExpandAugmentedSolution;
 
@@ -268,6 +303,42 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy, 
         DistMultiVec<Real>& dz );
 
+template<typename Real>
+void SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        Real denseColRatio,
+        Int maxDenseCols,
+        SparseMatrix<Real>& ASparse,
+        vector<Int>& denseCols );
+template<typename Real>
+void SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        Real denseColRatio,
+        Int maxDenseCols,
+        DistSparseMatrix<Real>& ASparse,
+        vector<Int>& denseCols );
+
+template<typename Real>
+void NormalKKTLowRank
+( const SparseMatrix<Real>& A,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        Matrix<Real>& reg,
+        Matrix<Real>& U );
+template<typename Real>
+void NormalKKTLowRank
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistMultiVec<Real>& reg,
+        DistMultiVec<Real>& U );
+
 } // namespace direct
 } // namespace lp
 } // namespace El
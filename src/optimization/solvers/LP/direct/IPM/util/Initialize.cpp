@@ -292,6 +292,7 @@ void Initialize
         vector<Int>& invMap, 
         ldl::Separator& rootSep,
         ldl::NodeInfo& info,
+  bool reuseAnalysis,
   bool primalInit, bool dualInit, bool standardShift,  
   const RegSolveCtrl<Real>& solveCtrl )
 {
@@ -300,7 +301,7 @@ void Initialize
     SparseMatrix<Real> Q;
     Q.Resize( n, n );
     qp::direct::Initialize
-    ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
+    ( Q, A, b, c, x, y, z, map, invMap, rootSep, info, reuseAnalysis,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -361,6 +362,7 @@ void Initialize
           vector<Int>& invMap, \
           ldl::Separator& rootSep, \
           ldl::NodeInfo& info, \
+    bool reuseAnalysis, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl ); \
   template void Initialize \
@@ -606,6 +606,257 @@ void ExpandNormalSolution
     dz += rc;
 }
 
+// Dense columns
+// =============
+// Even a single dense column of A renders A D^2 A^T completely dense, so such
+// columns are split off from the normal matrix and handled as a low-rank
+// correction, i.e.,
+//
+//   A D^2 A^T + delta^2 I = (S + delta^2 I) + U U^T,
+//
+// where S is formed from the sparse columns of A and U = A_dense D_dense.
+// Since S + delta^2 I is singular whenever a row of A is only supported on
+// dense columns, any of its pivots which are too small are perturbed before
+// factoring. The negation of the perturbation is returned as the
+// regularization passed to reg_ldl::RegularizedSolveAfter so that iterative
+// refinement is performed against the exact normal matrix.
+
+namespace {
+
+template<typename Real>
+void ChooseDenseColumns
+( const vector<Int>& colCounts,
+        Real denseColRatio,
+        Int maxDenseCols,
+        vector<Int>& denseCols )
+{
+    const Int n = colCounts.size();
+    denseCols.clear();
+    if( n == 0 || maxDenseCols <= 0 )
+        return;
+
+    Int numEntries = 0;
+    for( Int j=0; j<n; ++j )
+        numEntries += colCounts[j];
+    const Real threshold = denseColRatio*Real(numEntries)/Real(n);
+
+    vector<pair<Int,Int>> candidates;
+    for( Int j=0; j<n; ++j )
+        if( colCounts[j] > 1 && Real(colCounts[j]) > threshold )
+            candidates.push_back( pair<Int,Int>(colCounts[j],j) );
+    std::sort
+    ( candidates.begin(), candidates.end(),
+      []( const pair<Int,Int>& a, const pair<Int,Int>& b )
+      {
+        return a.first > b.first ||
+               (a.first == b.first && a.second < b.second);
+      } );
+
+    const Int numDense = Min( Int(candidates.size()), maxDenseCols );
+    denseCols.resize( numDense );
+    for( Int l=0; l<numDense; ++l )
+        denseCols[l] = candidates[l].second;
+    std::sort( denseCols.begin(), denseCols.end() );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        Real denseColRatio,
+        Int maxDenseCols,
+        SparseMatrix<Real>& ASparse,
+        vector<Int>& denseCols )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::SplitDenseColumns"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+
+    vector<Int> colCounts( n, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++colCounts[A.Col(e)];
+    ChooseDenseColumns( colCounts, denseColRatio, maxDenseCols, denseCols );
+    if( denseCols.empty() )
+        return;
+
+    vector<bool> isDense( n, false );
+    for( const Int j : denseCols )
+        isDense[j] = true;
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        if( !isDense[A.Col(e)] )
+            ASparse.QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    ASparse.ProcessQueues();
+}
+
+template<typename Real>
+void SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        Real denseColRatio,
+        Int maxDenseCols,
+        DistSparseMatrix<Real>& ASparse,
+        vector<Int>& denseCols )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::SplitDenseColumns"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    mpi::Comm comm = A.Comm();
+    const Int numLocalEntries = A.NumLocalEntries();
+
+    vector<Int> colCounts( n, 0 );
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++colCounts[A.Col(e)];
+    mpi::AllReduce( colCounts.data(), n, mpi::SUM, comm );
+    ChooseDenseColumns( colCounts, denseColRatio, maxDenseCols, denseCols );
+    if( denseCols.empty() )
+        return;
+
+    vector<bool> isDense( n, false );
+    for( const Int j : denseCols )
+        isDense[j] = true;
+    ASparse.SetComm( comm );
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( !isDense[A.Col(e)] )
+            ASparse.QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    ASparse.ProcessQueues();
+}
+
+template<typename Real>
+void NormalKKTLowRank
+( const SparseMatrix<Real>& A,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        Matrix<Real>& reg,
+        Matrix<Real>& U )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::NormalKKTLowRank"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = denseCols.size();
+    const Int numEntries = A.NumEntries();
+
+    // U := A(:,denseCols) D(denseCols)
+    // ================================
+    vector<Int> denseInd( n, -1 );
+    vector<Real> d( k );
+    for( Int l=0; l<k; ++l )
+    {
+        const Int j = denseCols[l];
+        denseInd[j] = l;
+        d[l] = 1/Sqrt(z.Get(j,0)/x.Get(j,0) + gamma*gamma);
+    }
+    Zeros( U, m, k );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int l = denseInd[A.Col(e)];
+        if( l >= 0 )
+            U.Update( A.Row(e), l, A.Value(e)*d[l] );
+    }
+
+    // Perturb the small pivots of the sparse portion
+    // ==============================================
+    // TODO: Expose this value as a parameter
+    const Real pivotRatio = Pow(limits::Epsilon<Real>(),Real(0.75));
+    Real* valBuf = J.ValueBuffer();
+    Real maxDiag = 0;
+    for( Int i=0; i<m; ++i )
+        maxDiag = Max( maxDiag, Abs(valBuf[J.Offset(i,i)]) );
+    const Real minPivot = pivotRatio*Max(maxDiag,Real(1));
+    Zeros( reg, m, 1 );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int e = J.Offset( i, i );
+        if( valBuf[e] < minPivot )
+        {
+            reg.Set( i, 0, valBuf[e]-minPivot );
+            valBuf[e] = minPivot;
+        }
+    }
+}
+
+template<typename Real>
+void NormalKKTLowRank
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistMultiVec<Real>& reg,
+        DistMultiVec<Real>& U )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::NormalKKTLowRank"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = denseCols.size();
+    mpi::Comm comm = A.Comm();
+    const Int numLocalEntries = A.NumLocalEntries();
+
+    // U := A(:,denseCols) D(denseCols)
+    // ================================
+    // The k entries of D are redundantly gathered on each process
+    vector<Int> denseInd( n, -1 );
+    vector<Real> d( k, Real(0) );
+    const Int xFirstLocalRow = x.FirstLocalRow();
+    const Int xLocalHeight = x.LocalHeight();
+    for( Int l=0; l<k; ++l )
+    {
+        const Int j = denseCols[l];
+        denseInd[j] = l;
+        if( j >= xFirstLocalRow && j < xFirstLocalRow+xLocalHeight )
+        {
+            const Int jLoc = j - xFirstLocalRow;
+            d[l] = 1/Sqrt(z.GetLocal(jLoc,0)/x.GetLocal(jLoc,0) + gamma*gamma);
+        }
+    }
+    mpi::AllReduce( d.data(), k, mpi::SUM, comm );
+    U.SetComm( comm );
+    Zeros( U, m, k );
+    Matrix<Real>& ULoc = U.Matrix();
+    const Int UFirstLocalRow = U.FirstLocalRow();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int l = denseInd[A.Col(e)];
+        if( l >= 0 )
+            ULoc.Update( A.Row(e)-UFirstLocalRow, l, A.Value(e)*d[l] );
+    }
+
+    // Perturb the small pivots of the sparse portion
+    // ==============================================
+    // TODO: Expose this value as a parameter
+    const Real pivotRatio = Pow(limits::Epsilon<Real>(),Real(0.75));
+    Real* valBuf = J.ValueBuffer();
+    const Int JLocalHeight = J.LocalHeight();
+    Real maxDiag = 0;
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        maxDiag = Max( maxDiag, Abs(valBuf[J.Offset(iLoc,i)]) );
+    }
+    maxDiag = mpi::AllReduce( maxDiag, mpi::MAX, comm );
+    const Real minPivot = pivotRatio*Max(maxDiag,Real(1));
+    reg.SetComm( comm );
+    Zeros( reg, m, 1 );
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        const Int e = J.Offset( iLoc, i );
+        if( valBuf[e] < minPivot )
+        {
+            reg.SetLocal( iLoc, 0, valBuf[e]-minPivot );
+            valBuf[e] = minPivot;
+        }
+    }
+}
+
 #define PROTO(Real) \
   template void NormalKKT \
   ( const Matrix<Real>& A, \
@@ -671,6 +922,36 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& rb, \
     const DistMultiVec<Real>& rmu, \
           DistMultiVec<Real>& d ); \
+  template void SplitDenseColumns \
+  ( const SparseMatrix<Real>& A, \
+          Real denseColRatio, \
+          Int maxDenseCols, \
+          SparseMatrix<Real>& ASparse, \
+          vector<Int>& denseCols ); \
+  template void SplitDenseColumns \
+  ( const DistSparseMatrix<Real>& A, \
+          Real denseColRatio, \
+          Int maxDenseCols, \
+          DistSparseMatrix<Real>& ASparse, \
+          vector<Int>& denseCols ); \
+  template void NormalKKTLowRank \
+  ( const SparseMatrix<Real>& A, \
+    const vector<Int>& denseCols, \
+          Real gamma, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J, \
+          Matrix<Real>& reg, \
+          Matrix<Real>& U ); \
+  template void NormalKKTLowRank \
+  ( const DistSparseMatrix<Real>& A, \
+    const vector<Int>& denseCols, \
+          Real gamma, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          DistMultiVec<Real>& reg, \
+          DistMultiVec<Real>& U ); \
   template void ExpandNormalSolution \
   ( const Matrix<Real>& A, \
           Real gamma, \
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// The LP reductions are those of the QP presolve with Q = 0
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Presolve"))
+    const Int n = A.Width();
+    SparseMatrix<Real> Q, QRed;
+    Zeros( Q, n, n );
+    qp::direct::Presolve( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Presolve"))
+    const Int n = A.Width();
+    mpi::Comm comm = A.Comm();
+    DistSparseMatrix<Real> Q(comm), QRed(comm);
+    Zeros( Q, n, n );
+    qp::direct::Presolve( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Postsolve"))
+    const Int n = A.Width();
+    SparseMatrix<Real> Q;
+    Zeros( Q, n, n );
+    qp::direct::Postsolve( Q, A, c, record, xRed, yRed, x, y, z );
+}
+
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Postsolve"))
+    const Int n = A.Width();
+    DistSparseMatrix<Real> Q(A.Comm());
+    Zeros( Q, n, n );
+    qp::direct::Postsolve( Q, A, c, record, xRed, yRed, x, y, z );
+}
+
+#define PROTO(Real) \
+  template void Presolve \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& ARed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Presolve \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& ARed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Postsolve \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const PresolveRecord<Real>& record, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void Postsolve \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const PresolveRecord<Real>& record, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace lp
+} // namespace El
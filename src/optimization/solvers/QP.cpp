@@ -62,6 +62,30 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> QRed, ARed;
+        Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+        PresolveRecord<Real> record;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+
+        // NOTE: Initial guesses for the original problem are not mapped
+        auto ctrlRed = ctrl;
+        ctrlRed.presolve = false;
+        ctrlRed.mehrotraCtrl.primalInit = false;
+        ctrlRed.mehrotraCtrl.dualInit = false;
+        if( ARed.Width() > 0 )
+            QP( QRed, ARed, bRed, cRed, xRed, yRed, zRed, ctrlRed );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+        }
+        qp::direct::Postsolve( Q, A, c, record, xRed, yRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -80,6 +104,32 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.presolve )
+    {
+        mpi::Comm comm = A.Comm();
+        DistSparseMatrix<Real> QRed(comm), ARed(comm);
+        DistMultiVec<Real> bRed(comm), cRed(comm),
+                           xRed(comm), yRed(comm), zRed(comm);
+        PresolveRecord<Real> record;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, record, ctrl.presolveCtrl );
+
+        // NOTE: Initial guesses for the original problem are not mapped
+        auto ctrlRed = ctrl;
+        ctrlRed.presolve = false;
+        ctrlRed.mehrotraCtrl.primalInit = false;
+        ctrlRed.mehrotraCtrl.dualInit = false;
+        if( ARed.Width() > 0 )
+            QP( QRed, ARed, bRed, cRed, xRed, yRed, zRed, ctrlRed );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+        }
+        qp::direct::Postsolve( Q, A, c, record, xRed, yRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -166,7 +216,21 @@ void QP
   const qp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("QP"))
-    if( ctrl.approach == QP_MEHROTRA )
+    if( ctrl.approach == QP_ADMM )
+    {
+        // Treat the positive orthant as a product of SOCs of order one
+        mpi::Comm comm = A.Comm();
+        const Int k = G.Height();
+        DistMultiVec<Int> orders(comm), firstInds(comm);
+        Ones( orders, k, 1 );
+        Zeros( firstInds, k, 1 );
+        for( Int iLoc=0; iLoc<firstInds.LocalHeight(); ++iLoc )
+            firstInds.SetLocal( iLoc, 0, firstInds.GlobalRow(iLoc) );
+        splitting::ADMM
+        ( Q, A, G, b, c, h, orders, firstInds, x, y, z, s,
+          ctrl.splittingCtrl );
+    }
+    else if( ctrl.approach == QP_MEHROTRA )
         qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
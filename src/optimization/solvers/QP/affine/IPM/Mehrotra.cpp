@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 #include "./util.hpp"
+#include "../../../Gondzio.hpp"
 
 namespace El {
 namespace qp {
@@ -123,10 +124,12 @@ void Mehrotra
     Matrix<Real> J, d,
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCand, dyCand, dzCand, dsCand;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -208,6 +211,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -236,6 +240,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -301,11 +307,45 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        ldl::SolveAfter( J, dSub, p, d, false );
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -369,7 +409,7 @@ void Mehrotra
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    Timer timer, gondzioTimer;
 
     // Ensure that the inputs have the appropriate read/write properties
     DistMatrix<Real> Q(grid), A(grid), G(grid), b(grid), c(grid), h(grid);
@@ -475,11 +515,14 @@ void Mehrotra
     DistMatrix<Real> J(grid),     d(grid), 
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
-                     dx(grid),    dy(grid),    dz(grid),    ds(grid);
+                     dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                     dxCand(grid), dyCand(grid), dzCand(grid), dsCand(grid);
     dsAff.AlignWith( s );
     dzAff.AlignWith( s );
     ds.AlignWith( s );
     dz.AlignWith( s );
+    dsCand.AlignWith( s );
+    dzCand.AlignWith( s );
     rmu.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
@@ -567,6 +610,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -604,6 +648,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -670,28 +716,49 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Form the new KKT RHS
-        // --------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try 
-        { 
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
-            ldl::SolveAfter( J, dSub, p, d, false ); 
-            if( ctrl.time && commRank == 0 )
-                Output("Combined solve: ",timer.Stop()," secs");
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMatrix<Real>& rmuStep,
+               DistMatrix<Real>& dxStep,
+               DistMatrix<Real>& dyStep,
+               DistMatrix<Real>& dzStep,
+               DistMatrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              if( ctrl.time && commRank == 0 )
+                  timer.Start();
+              ldl::SolveAfter( J, dSub, p, d, false );
+              if( ctrl.time && commRank == 0 )
+                  Output("Combined solve: ",timer.Stop()," secs");
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
-            if( relError <= ctrl.minTol )    
+            if( relError <= ctrl.minTol )
                 break;
             else
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, grid.Comm() );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const DistMatrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -849,11 +916,13 @@ void Mehrotra
                  w,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCand, dyCand, dzCand, dsCand;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -940,6 +1009,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -991,6 +1061,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1057,23 +1129,30 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new KKT RHS
-        // ----------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try
-        {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1082,7 +1161,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
@@ -1154,7 +1247,7 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer, iterTimer;
+    Timer timer, iterTimer, gondzioTimer;
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
@@ -1280,7 +1373,8 @@ void Mehrotra
                        w(comm),
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
-                       dx(comm),    dy(comm),    dz(comm),    ds(comm);
+                       dx(comm),    dy(comm),    dz(comm),    ds(comm),
+                       dxCand(comm), dyCand(comm), dzCand(comm), dsCand(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
@@ -1376,6 +1470,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -1446,6 +1541,8 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1513,27 +1610,34 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new RHS
-        // ------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Compute the new direction
-        // -------------------------
-        try
-        {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMultiVec<Real>& rmuStep,
+               DistMultiVec<Real>& dxStep,
+               DistMultiVec<Real>& dyStep,
+               DistMultiVec<Real>& dzStep,
+               DistMultiVec<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, z, d );
+              if( commRank == 0 && ctrl.time )
+                  timer.Start();
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              if( commRank == 0 && ctrl.time )
+                  Output("Corrector solver: ",timer.Stop()," secs");
+              ExpandSolution
+              ( m, n, d, rmuStep, s, z, dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1542,7 +1646,21 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, comm );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          [&]( const DistMultiVec<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "./IPM.hpp"
+#include "../../Batch.hpp"
+
+namespace El {
+namespace qp {
+namespace direct {
+
+// Equilibrate A (and symmetrically rescale Q) once for the entire batch
+// rather than once per problem, as would happen within Mehrotra. The functor
+// 'solve' should run Mehrotra without outer equilibration on the
+// (equilibrated) matrices Q and A.
+template<typename Real,class MatrixType,class SolveType>
+inline void BatchHelper
+(       MatrixType& Q,
+        MatrixType& A,
+  const Matrix<Real>& BPre,
+  const Matrix<Real>& CPre,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const BatchCtrl<Real>& ctrl,
+        mpi::Comm comm,
+        SolveType solve )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::BatchHelper"))
+    const bool outerEquil = ctrl.mehrotraCtrl.outerEquil;
+    auto B = BPre;
+    auto C = CPre;
+    Matrix<Real> dRow, dCol;
+    if( outerEquil )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.mehrotraCtrl.print );
+        DiagonalSolve( LEFT, NORMAL, dRow, B );
+        DiagonalSolve( LEFT, NORMAL, dCol, C );
+        DiagonalSolve( LEFT, NORMAL, dCol, Q );
+        DiagonalSolve( RIGHT, NORMAL, dCol, Q );
+    }
+    auto mehrotraCtrl = ctrl.mehrotraCtrl;
+    mehrotraCtrl.outerEquil = false;
+
+    batch::Solve
+    ( B, C, X, Y, Z, numIts, mehrotraCtrl,
+      ctrl.warmStart, ctrl.warmStartShift, ctrl.compareCold, ctrl.progress,
+      comm, solve );
+
+    if( outerEquil )
+    {
+        DiagonalSolve( LEFT, NORMAL, dCol, X );
+        DiagonalSolve( LEFT, NORMAL, dRow, Y );
+        DiagonalScale( LEFT, NORMAL, dCol, Z );
+    }
+}
+
+} // namespace direct
+} // namespace qp
+
+template<typename Real>
+void QP
+( const Matrix<Real>& QPre,
+  const Matrix<Real>& APre,
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const qp::direct::BatchCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    auto Q = QPre;
+    auto A = APre;
+    auto solve =
+      [&]( const Matrix<Real>& b, const Matrix<Real>& c,
+           Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z,
+           const MehrotraCtrl<Real>& solveCtrl ) -> Int
+      { return qp::direct::Mehrotra( Q, A, b, c, x, y, z, solveCtrl ); };
+    qp::direct::BatchHelper( Q, A, B, C, X, Y, Z, numIts, ctrl, comm, solve );
+}
+
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& QPre,
+  const SparseMatrix<Real>& APre,
+  const Matrix<Real>& B,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+        Matrix<Real>& Z,
+        Matrix<Int>& numIts,
+  const qp::direct::BatchCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    auto Q = QPre;
+    auto A = APre;
+
+    // Since every problem in the batch has a KKT system with the same
+    // sparsity pattern, the nested dissection is only computed once
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+    bool analyzed = false;
+    auto solve =
+      [&]( const Matrix<Real>& b, const Matrix<Real>& c,
+           Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z,
+           const MehrotraCtrl<Real>& solveCtrl ) -> Int
+      {
+          const Int numIts =
+            qp::direct::Mehrotra
+            ( Q, A, b, c, x, y, z, map, invMap, rootSep, info, analyzed,
+              solveCtrl );
+          analyzed = true;
+          return numIts;
+      };
+    qp::direct::BatchHelper( Q, A, B, C, X, Y, Z, numIts, ctrl, comm, solve );
+}
+
+#define PROTO(Real) \
+  template void QP \
+  ( const Matrix<Real>& Q, \
+    const Matrix<Real>& A, \
+    const Matrix<Real>& B, \
+    const Matrix<Real>& C, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+          Matrix<Real>& Z, \
+          Matrix<Int>& numIts, \
+    const qp::direct::BatchCtrl<Real>& ctrl, \
+          mpi::Comm comm ); \
+  template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& B, \
+    const Matrix<Real>& C, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+          Matrix<Real>& Z, \
+          Matrix<Int>& numIts, \
+    const qp::direct::BatchCtrl<Real>& ctrl, \
+          mpi::Comm comm );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -13,7 +13,7 @@ namespace qp {
 namespace direct {
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const Matrix<Real>& Q,
   const Matrix<Real>& A,
   const Matrix<Real>& b,
@@ -23,7 +23,7 @@ void Mehrotra
         Matrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const ElementalMatrix<Real>& Q,
   const ElementalMatrix<Real>& A,
   const ElementalMatrix<Real>& b,
@@ -33,7 +33,7 @@ void Mehrotra
         ElementalMatrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const SparseMatrix<Real>& Q,
   const SparseMatrix<Real>& A,
   const Matrix<Real>& b,
@@ -42,8 +42,27 @@ void Mehrotra
         Matrix<Real>& y, 
         Matrix<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+// This variant allows the symbolic analysis of the KKT system (the nested
+// dissection ordering and the resulting tree) to be reused across a family of
+// problems with the same sparsity structure; if 'reuseAnalysis' is false,
+// the analysis is computed and returned in the given arguments
 template<typename Real>
-void Mehrotra
+Int Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        vector<Int>& map,
+        vector<Int>& invMap,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  bool reuseAnalysis,
+  const MehrotraCtrl<Real>& ctrl );
+template<typename Real>
+Int Mehrotra
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A,
   const DistMultiVec<Real>& b,
@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 #include "./util.hpp"
+#include "../../../Gondzio.hpp"
 
 namespace El {
 namespace qp {
@@ -33,7 +34,7 @@ namespace direct {
 //
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const Matrix<Real>& QPre,
   const Matrix<Real>& APre,
   const Matrix<Real>& bPre,
@@ -106,12 +107,15 @@ void Mehrotra
     Matrix<Real> J, d, 
                  rb,    rc,    rmu,
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCand, dyCand, dzCand;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -181,6 +185,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -238,6 +243,8 @@ void Mehrotra
         else
             LogicError("Invalid KKT system choice");
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -305,46 +312,55 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+              {
+                  KKTRHS( rc, rb, rmuStep, z, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == AUGMENTED_KKT )
+              {
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              }
+              else
+                  LogicError("Invalid KKT system choice");
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -377,10 +393,12 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+
+    return numIts;
 }
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const ElementalMatrix<Real>& QPre,
   const ElementalMatrix<Real>& APre, 
   const ElementalMatrix<Real>& bPre,
@@ -484,18 +502,23 @@ void Mehrotra
         J(grid), d(grid), 
         rc(grid),    rb(grid),    rmu(grid), 
         dxAff(grid), dyAff(grid), dzAff(grid),
-        dx(grid),    dy(grid),    dz(grid);
+        dx(grid),    dy(grid),    dz(grid),
+        dxCand(grid), dyCand(grid), dzCand(grid);
     dx.AlignWith( x );
     dz.AlignWith( x );
     dxAff.AlignWith( x );
     dzAff.AlignWith( x );
+    dxCand.AlignWith( x );
+    dzCand.AlignWith( x );
     rmu.AlignWith( x );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -566,6 +589,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -623,6 +647,8 @@ void Mehrotra
         else
             LogicError("Invalid KKT system choice");
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -691,46 +717,55 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMatrix<Real>& rmuStep,
+               DistMatrix<Real>& dxStep,
+               DistMatrix<Real>& dyStep,
+               DistMatrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+              {
+                  KKTRHS( rc, rb, rmuStep, z, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              }
+              else if( ctrl.system == AUGMENTED_KKT )
+              {
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+                  ldl::SolveAfter( J, dSub, p, d, false );
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+              }
+              else
+                  LogicError("Invalid KKT system choice");
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, grid.Comm() );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const DistMatrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -763,10 +798,12 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+
+    return numIts;
 }
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
 ( const SparseMatrix<Real>& QPre,
   const SparseMatrix<Real>& APre, 
   const Matrix<Real>& bPre,
@@ -774,6 +811,11 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        vector<Int>& map,
+        vector<Int>& invMap,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  bool reuseAnalysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
@@ -840,9 +882,6 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -850,7 +889,7 @@ void Mehrotra
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
+        ( Q, A, b, c, x, y, z, map, invMap, rootSep, info, reuseAnalysis,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
@@ -859,7 +898,7 @@ void Mehrotra
         ldl::NodeInfo augInfo;
         ldl::Separator augRootSep;
         Initialize
-        ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
+        ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo, false,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
 
@@ -885,19 +924,22 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    SparseMatrix<Real> J, JOrig;
+    SparseMatrix<Real> JStatic, J, JOrig;
     ldl::Front<Real> JFront;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCand, dyCand, dzCand;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -972,6 +1014,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -982,14 +1025,25 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            // NOTE: The iterate-independent portion of the KKT system is only
+            //       formed on the first iteration; afterwards, the diagonal
+            //       entries depending upon x and z are updated in-place
             if( ctrl.system == FULL_KKT )
             {
-                KKT( Q, A, gamma, delta, beta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticKKT( Q, A, gamma, delta, beta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( Q, A, gamma, delta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticAugmentedKKT( Q, A, gamma, delta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishAugmentedKKT( m, n, x, z, JOrig );
                 // TODO: Incorporate beta?
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
@@ -1009,7 +1063,7 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 && 
+                if( numIts == 0 && !reuseAnalysis &&
                     (ctrl.system == FULL_KKT || 
                      (ctrl.primalInit && ctrl.dualInit) ) )
                 {
@@ -1045,6 +1099,8 @@ void Mehrotra
         else
             LogicError("Invalid KKT system choice");
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1112,67 +1168,62 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            // Form the new KKT RHS
-            // --------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+                  KKTRHS( rc, rb, rmuStep, z, d );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+              else
+                  LogicError("Invalid KKT system choice");
+
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+
+              if( ctrl.system == FULL_KKT )
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              else
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Form the new KKT RHS
-            // --------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl ); 
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -1205,10 +1256,31 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+
+    return numIts;
 }
 
 template<typename Real>
-void Mehrotra
+Int Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+    return Mehrotra
+    ( Q, A, b, c, x, y, z, map, invMap, rootSep, info, false, ctrl );
+}
+
+template<typename Real>
+Int Mehrotra
 ( const DistSparseMatrix<Real>& QPre,
   const DistSparseMatrix<Real>& APre, 
   const DistMultiVec<Real>& bPre,
@@ -1237,7 +1309,7 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    Timer timer, gondzioTimer;
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -1353,20 +1425,22 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     DistSparseMultMeta metaOrig, meta;
-    DistSparseMatrix<Real> J(comm), JOrig(comm);
+    DistSparseMatrix<Real> JStatic(comm), J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
                        dxAff(comm), dyAff(comm), dzAff(comm),
-                       dx(comm),    dy(comm),    dz(comm);
+                       dx(comm),    dy(comm),    dz(comm),
+                       dxCand(comm), dyCand(comm), dzCand(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    Int numIts=0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
         // Ensure that x and z are in the cone
         // ===================================
@@ -1440,6 +1514,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1450,14 +1525,25 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            // NOTE: The iterate-independent portion of the KKT system is only
+            //       formed on the first iteration; afterwards, the diagonal
+            //       entries depending upon x and z are updated in-place
             if( ctrl.system == FULL_KKT )
             {
-                KKT( Q, A, gamma, delta, beta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticKKT( Q, A, gamma, delta, beta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( Q, A, gamma, delta, x, z, JOrig, false );
+                if( numIts == 0 )
+                    StaticAugmentedKKT( Q, A, gamma, delta, JStatic, false );
+                JOrig = JStatic;
+                JOrig.FreezeSparsity();
+                FinishAugmentedKKT( m, n, x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1551,6 +1637,8 @@ void Mehrotra
         else
             LogicError("Invalid KKT system choice");
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1619,74 +1707,66 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMultiVec<Real>& rmuStep,
+               DistMultiVec<Real>& dxStep,
+               DistMultiVec<Real>& dyStep,
+               DistMultiVec<Real>& dzStep )
+          {
+              if( ctrl.system == FULL_KKT )
+                  KKTRHS( rc, rb, rmuStep, z, d );
+              else if( ctrl.system == AUGMENTED_KKT )
+                  AugmentedKKTRHS( x, rc, rb, rmuStep, d );
+              else
+                  LogicError("Invalid KKT system choice");
+
+              if( commRank == 0 && ctrl.time )
+                  timer.Start();
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              if( commRank == 0 && ctrl.time )
+                  Output("Corrector: ",timer.Stop()," secs");
+
+              if( ctrl.system == FULL_KKT )
+                  ExpandSolution( m, n, d, dxStep, dyStep, dzStep );
+              else
+                  ExpandAugmentedSolution
+                  ( x, z, rmuStep, d, dxStep, dyStep, dzStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz ); }
+        catch(...)
         {
-            // Form the KKT system
-            // -------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Form the KKT system
-            // -------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                      ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, comm );
+        const Int numAccepted = gondzio::PosOrthCorrectors
+        ( ctrl, numCorrectors, sigma*mu, x, z, dx, dz, dxCand, dzCand, rmu,
+          [&]( const DistMultiVec<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -1719,10 +1799,12 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+
+    return numIts;
 }
 
 #define PROTO(Real) \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const Matrix<Real>& Q, \
     const Matrix<Real>& A, \
     const Matrix<Real>& b, \
@@ -1731,7 +1813,7 @@ void Mehrotra
           Matrix<Real>& y, \
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const ElementalMatrix<Real>& Q, \
     const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
@@ -1740,7 +1822,16 @@ void Mehrotra
           ElementalMatrix<Real>& y, \
           ElementalMatrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template Int Mehrotra \
   ( const SparseMatrix<Real>& Q, \
     const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
@@ -1748,8 +1839,13 @@ void Mehrotra
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
+          vector<Int>& map, \
+          vector<Int>& invMap, \
+          ldl::Separator& rootSep, \
+          ldl::NodeInfo& info, \
+    bool reuseAnalysis, \
     const MehrotraCtrl<Real>& ctrl ); \
-  template void Mehrotra \
+  template Int Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
@@ -47,6 +47,7 @@ void Initialize
         vector<Int>& invMap,
         ldl::Separator& rootSep,
         ldl::NodeInfo& info,
+  bool reuseAnalysis,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -109,6 +110,40 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+// The sparse KKT system can alternatively be formed in two stages: the
+// iterate-independent portion, whose sparsity pattern is then frozen, and
+// an in-place update of the iterate-dependent diagonal
+template<typename Real>
+void StaticKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        SparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void StaticKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J );
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J );
+
 template<typename Real>
 void KKTRHS
 ( const Matrix<Real>& rc,
@@ -192,6 +227,35 @@ void AugmentedKKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+template<typename Real>
+void StaticAugmentedKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        SparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void StaticAugmentedKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void FinishAugmentedKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J );
+template<typename Real>
+void FinishAugmentedKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J );
+
 template<typename Real>
 void AugmentedKKTRHS
 ( const Matrix<Real>& x,
@@ -81,17 +81,18 @@ void AugmentedKKT
         Transpose( A, Jxy );
 }
 
+// Form the portion of the sparse augmented system which does not depend upon
+// the current iterate, with explicit entries reserved for the diagonal of the
+// x block so that FinishAugmentedKKT can later update it in-place
 template<typename Real>
-void AugmentedKKT
+void StaticAugmentedKKT
 ( const SparseMatrix<Real>& Q,
   const SparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
-  const Matrix<Real>& x,
-  const Matrix<Real>& z,
         SparseMatrix<Real>& J, bool onlyLower )
 {
-    DEBUG_ONLY(CSE cse("qp::direct::AugmentedKKT"))
+    DEBUG_ONLY(CSE cse("qp::direct::StaticAugmentedKKT"))
     const Int m = A.Height();
     const Int n = A.Width();
     const Int numEntriesQ = Q.NumEntries();
@@ -115,9 +116,10 @@ void AugmentedKKT
     else
         J.Reserve( 2*numEntriesA + numUsedEntriesQ + n+m ); 
 
-    // x o inv(z) + gamma^2*I updates
+    // gamma^2*I updates
+    // NOTE: The iterate-dependent z <> x is added by FinishAugmentedKKT
     for( Int j=0; j<n; ++j )
-        J.QueueUpdate( j, j, z.Get(j,0)/x.Get(j,0)+gamma*gamma );
+        J.QueueUpdate( j, j, gamma*gamma );
 
     // Q update
     for( Int e=0; e<numEntriesQ; ++e )
@@ -147,16 +149,14 @@ void AugmentedKKT
 }
 
 template<typename Real>
-void AugmentedKKT
+void StaticAugmentedKKT
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A,
         Real gamma,
         Real delta,
-  const DistMultiVec<Real>& x,
-  const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J, bool onlyLower )
 {
-    DEBUG_ONLY(CSE cse("qp::direct::AugmentedKKT"))
+    DEBUG_ONLY(CSE cse("qp::direct::StaticAugmentedKKT"))
     const Int m = A.Height();
     const Int n = A.Width();
     const Int numEntriesQ = Q.NumLocalEntries();
@@ -172,7 +172,6 @@ void AugmentedKKT
     numEntries += numEntriesA;
     if( !onlyLower ) 
         numEntries += numEntriesA;
-    numEntries += x.LocalHeight(); 
     for( Int e=0; e<numEntriesQ; ++e )
     {
         const Int i = Q.Row(e);
@@ -180,12 +179,7 @@ void AugmentedKKT
         if( i >= j || !onlyLower )
             ++numEntries;
     }
-    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
-    {
-        const Int i = J.GlobalRow(iLoc);
-        if( i > n )
-            ++numEntries;
-    }
+    numEntries += JLocalHeight;
 
     // Queue the entries
     // =================
@@ -200,14 +194,6 @@ void AugmentedKKT
         if( !onlyLower )
             J.QueueUpdate( j, i, A.Value(e) );
     }
-    // Pack x o inv(z) + gamma^2*I
-    // ---------------------------
-    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
-    {
-        const Int i = x.GlobalRow(iLoc);
-        const Real value = z.GetLocal(iLoc,0)/x.GetLocal(iLoc,0)+gamma*gamma;
-        J.QueueUpdate( i, i, value );
-    }
     // Pack Q
     // ------
     for( Int e=0; e<numEntriesQ; ++e )
@@ -217,12 +203,15 @@ void AugmentedKKT
         if( i >= j || !onlyLower )
             J.QueueUpdate( i, j, Q.Value(e) );
     }
-    // Pack -delta^2*I
-    // ---------------
+    // Pack gamma^2*I and -delta^2*I
+    // -----------------------------
+    // NOTE: The iterate-dependent z <> x is added by FinishAugmentedKKT
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
         const Int i = J.GlobalRow(iLoc);
-        if( i > n )
+        if( i < n )
+            J.QueueUpdate( i, i, gamma*gamma );
+        else
             J.QueueUpdate( i, i, -delta*delta );
     }
 
@@ -230,6 +219,84 @@ void AugmentedKKT
     J.FreezeSparsity();
 }
 
+template<typename Real>
+void FinishAugmentedKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J )
+{
+    DEBUG_ONLY(
+      CSE cse("qp::direct::FinishAugmentedKKT");
+      if( J.Height() != m+n || J.Width() != m+n )
+          LogicError("J was of the wrong size");
+      if( !J.FrozenSparsity() )
+          LogicError("Sparsity pattern of J should have been frozen");
+    )
+    // Jxx += z <> x
+    // NOTE: Since the sparsity is frozen, the updates are applied in-place
+    for( Int j=0; j<n; ++j )
+        J.QueueUpdate( j, j, z.Get(j,0)/x.Get(j,0) );
+}
+
+template<typename Real>
+void FinishAugmentedKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J )
+{
+    DEBUG_ONLY(
+      CSE cse("qp::direct::FinishAugmentedKKT");
+      if( J.Height() != m+n || J.Width() != m+n )
+          LogicError("J was of the wrong size");
+      if( !J.FrozenSparsity() )
+          LogicError("Sparsity pattern of J should have been frozen");
+    )
+    // Jxx += z <> x
+    // NOTE: Since the sparsity is frozen, the local updates are applied
+    //       in-place and only the diagonal updates which are owned by
+    //       another process are communicated
+    const Int xLocalHeight = x.LocalHeight();
+    J.Reserve( 0, xLocalHeight );
+    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        J.QueueUpdate( i, i, z.GetLocal(iLoc,0)/x.GetLocal(iLoc,0) );
+    }
+    J.ProcessQueues();
+}
+
+template<typename Real>
+void AugmentedKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::AugmentedKKT"))
+    StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+    FinishAugmentedKKT( A.Height(), A.Width(), x, z, J );
+}
+
+template<typename Real>
+void AugmentedKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::AugmentedKKT"))
+    StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+    FinishAugmentedKKT( A.Height(), A.Width(), x, z, J );
+}
+
 template<typename Real>
 void AugmentedKKTRHS
 ( const Matrix<Real>& x, 
@@ -473,6 +540,28 @@ void ExpandAugmentedSolution
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, \
     bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void FinishAugmentedKKT \
+  ( Int m, Int n, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J ); \
+  template void FinishAugmentedKKT \
+  ( Int m, Int n, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J ); \
   template void AugmentedKKTRHS \
   ( const Matrix<Real>& x, \
     const Matrix<Real>& rc, \
@@ -137,18 +137,21 @@ void KKT
     }
 }
 
+// Form the portion of the sparse KKT system which does not depend upon the
+// current iterate, with explicit entries reserved for the diagonal of the
+// z block so that FinishKKT can later update it in-place. Since the sparsity
+// pattern is frozen, each subsequent iteration avoids re-sorting the
+// triplets (and, in the distributed case, redistributing them).
 template<typename Real>
-void KKT
+void StaticKKT
 ( const SparseMatrix<Real>& Q,
   const SparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
         Real beta,
-  const Matrix<Real>& x,
-  const Matrix<Real>& z,
         SparseMatrix<Real>& J, bool onlyLower )
 {
-    DEBUG_ONLY(CSE cse("qp::direct::KKT"))
+    DEBUG_ONLY(CSE cse("qp::direct::StaticKKT"))
     const Int m = A.Height();
     const Int n = A.Width();
 
@@ -199,10 +202,11 @@ void KKT
     for( Int i=0; i<n; ++i )
         J.QueueUpdate( n+m+i, i, Real(-1) );
 
-    // Jzz = - z <> x - beta^2*I
-    // =========================
+    // Jzz = -beta^2*I
+    // ===============
+    // NOTE: The iterate-dependent term, - z <> x, is added by FinishKKT
     for( Int i=0; i<n; ++i )
-        J.QueueUpdate( n+m+i, n+m+i, -x.Get(i,0)/z.Get(i,0)-beta*beta );
+        J.QueueUpdate( n+m+i, n+m+i, -beta*beta );
 
     if( !onlyLower )
     {
@@ -221,17 +225,15 @@ void KKT
 }
 
 template<typename Real>
-void KKT
+void StaticKKT
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
         Real beta,
-  const DistMultiVec<Real>& x,
-  const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J, bool onlyLower )
 {
-    DEBUG_ONLY(CSE cse("qp::direct::KKT"))
+    DEBUG_ONLY(CSE cse("qp::direct::StaticKKT"))
     const Int m = A.Height();
     const Int n = A.Width();
     const Int numEntriesQ = Q.NumLocalEntries();
@@ -239,7 +241,6 @@ void KKT
     J.SetComm( A.Comm() );
     Zeros( J, m+2*n, m+2*n );
 
-    const Int xLocalHeight = x.LocalHeight();
     const Int JLocalHeight = J.LocalHeight();
 
     // Count the number of entries to send
@@ -255,10 +256,8 @@ void KKT
     numEntries += numEntriesA;
     if( !onlyLower )
         numEntries += numEntriesA;
-    numEntries += xLocalHeight;
     // Count the number of analytical updates
     // --------------------------------------
-    // NOTE: -beta^2*I is merged in with -inv(z) o s
     Int analyticUpdates = 0;
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
@@ -274,7 +273,10 @@ void KKT
             ++analyticUpdates; // for -delta^2*I
         }
         else
+        {
             ++analyticUpdates; // for -I
+            ++analyticUpdates; // for -beta^2*I
+        }
     }
 
     // Pack and process the updates
@@ -294,7 +296,10 @@ void KKT
         else if( i < n+m )
             J.QueueUpdate( i, i, -delta*delta );
         else
+        {
             J.QueueUpdate( i, i-(n+m), Real(-1) );
+            J.QueueUpdate( i, i, -beta*beta );
+        }
     }
     // Pack Q
     // ------
@@ -315,16 +320,91 @@ void KKT
         if( !onlyLower ) 
             J.QueueUpdate( j, i, A.Value(e) );
     }
-    // Pack -inv(z) o x - beta^2*I
-    // ---------------------------
+    J.ProcessQueues();
+    J.FreezeSparsity();
+}
+
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J )
+{
+    DEBUG_ONLY(
+      CSE cse("qp::direct::FinishKKT");
+      if( J.Height() != m+2*n || J.Width() != m+2*n )
+          LogicError("J was of the wrong size");
+      if( !J.FrozenSparsity() )
+          LogicError("Sparsity pattern of J should have been frozen");
+    )
+    // Jzz += - z <> x
+    // ===============
+    // NOTE: Since the sparsity is frozen, the updates are applied in-place
+    for( Int i=0; i<n; ++i )
+        J.QueueUpdate( n+m+i, n+m+i, -x.Get(i,0)/z.Get(i,0) );
+}
+
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J )
+{
+    DEBUG_ONLY(
+      CSE cse("qp::direct::FinishKKT");
+      if( J.Height() != m+2*n || J.Width() != m+2*n )
+          LogicError("J was of the wrong size");
+      if( !J.FrozenSparsity() )
+          LogicError("Sparsity pattern of J should have been frozen");
+    )
+    // Jzz += - z <> x
+    // ===============
+    // NOTE: Since the sparsity is frozen, the local updates are applied
+    //       in-place and only the n diagonal updates which are owned by
+    //       another process are communicated
+    const Int xLocalHeight = x.LocalHeight();
+    J.Reserve( 0, xLocalHeight );
     for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
     {
-        const Int i = m+n + x.GlobalRow(iLoc);
-        const Real value = -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0)-beta*beta;
-        J.QueueUpdate( i+(n+m), i+(n+m), value );
+        const Int i = n+m + x.GlobalRow(iLoc);
+        const Real value = -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0);
+        J.QueueUpdate( i, i, value );
     }
     J.ProcessQueues();
-    J.FreezeSparsity();
+}
+
+template<typename Real>
+void KKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::KKT"))
+    StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+    FinishKKT( A.Height(), A.Width(), x, z, J );
+}
+
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::KKT"))
+    StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+    FinishKKT( A.Height(), A.Width(), x, z, J );
 }
 
 template<typename Real>
@@ -488,6 +568,30 @@ void ExpandSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void FinishKKT \
+  ( Int m, Int n, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J ); \
+  template void FinishKKT \
+  ( Int m, Int n, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J ); \
   template void KKTRHS \
   ( const Matrix<Real>& rc, \
     const Matrix<Real>& rb, \
@@ -299,6 +299,7 @@ void Initialize
         vector<Int>& invMap, 
         ldl::Separator& rootSep,
         ldl::NodeInfo& info,
+  bool reuseAnalysis,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl )
 {
@@ -349,8 +350,11 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    NestedDissection( J.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
+    if( !reuseAnalysis )
+    {
+        NestedDissection( J.LockedGraph(), map, rootSep, info );
+        InvertMap( map, invMap );
+    }
 
     ldl::Front<Real> JFront;
     JFront.Pull( J, map, info );
@@ -612,6 +616,7 @@ void Initialize
           vector<Int>& invMap, \
           ldl::Separator& rootSep, \
           ldl::NodeInfo& info, \
+    bool reuseAnalysis, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl ); \
   template void Initialize \
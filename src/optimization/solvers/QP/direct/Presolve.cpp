@@ -0,0 +1,1113 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace qp {
+namespace direct {
+
+// The reductions only require O(m+n) replicated state (the right-hand side,
+// the costs, and the active row and column flags) along with the locally
+// owned rows of A and Q. The row and column counts (and the patterns used for
+// detecting singletons, forcing rows, and duplicate rows) are formed from the
+// local rows and then summed over the communicator, and the (typically few)
+// rows which are eliminated are gathered onto every process so that each
+// process can make identical decisions.
+
+namespace {
+
+// The locally-owned rows of a sparse matrix (with global indices)
+template<typename Real>
+struct LocalRows
+{
+    Int firstRow=0;
+    vector<Int> offsets;
+    vector<Entry<Real>> entries;
+};
+
+template<typename Real>
+void GetLocalRows( const SparseMatrix<Real>& A, LocalRows<Real>& rows )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::GetLocalRows"))
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    rows.firstRow = 0;
+    rows.offsets.assign( height+1, 0 );
+    rows.entries.resize( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        ++rows.offsets[i+1];
+        rows.entries[e] = Entry<Real>{ i, A.Col(e), A.Value(e) };
+    }
+    for( Int i=0; i<height; ++i )
+        rows.offsets[i+1] += rows.offsets[i];
+}
+
+template<typename Real>
+void GetLocalRows( const DistSparseMatrix<Real>& A, LocalRows<Real>& rows )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::GetLocalRows"))
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    rows.firstRow = A.FirstLocalRow();
+    rows.offsets.assign( localHeight+1, 0 );
+    rows.entries.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        ++rows.offsets[i-rows.firstRow+1];
+        rows.entries[e] = Entry<Real>{ i, A.Col(e), A.Value(e) };
+    }
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows.offsets[iLoc+1] += rows.offsets[iLoc];
+}
+
+template<typename Real>
+void Replicate( const Matrix<Real>& x, vector<Real>& xRep )
+{
+    const Int height = x.Height();
+    xRep.resize( height );
+    for( Int i=0; i<height; ++i )
+        xRep[i] = x.Get(i,0);
+}
+
+template<typename Real>
+void Replicate( const DistMultiVec<Real>& x, vector<Real>& xRep )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Replicate"))
+    const Int height = x.Height();
+    xRep.assign( height, Real(0) );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        xRep[x.GlobalRow(iLoc)] = x.GetLocal(iLoc,0);
+    mpi::AllReduce( xRep.data(), height, mpi::SUM, x.Comm() );
+}
+
+template<typename Real>
+void Distribute( const vector<Real>& xRep, Matrix<Real>& x )
+{
+    const Int height = xRep.size();
+    Zeros( x, height, 1 );
+    for( Int i=0; i<height; ++i )
+        x.Set( i, 0, xRep[i] );
+}
+
+template<typename Real>
+void Distribute( const vector<Real>& xRep, DistMultiVec<Real>& x )
+{
+    const Int height = xRep.size();
+    Zeros( x, height, 1 );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        x.SetLocal( iLoc, 0, xRep[x.GlobalRow(iLoc)] );
+}
+
+// Form the submatrix of the rows and columns with nonnegative new indices
+template<typename Real>
+void Restrict
+( const LocalRows<Real>& rows,
+  const vector<Int>& newRows,
+  const vector<Int>& newCols,
+  Int heightRed,
+  Int widthRed,
+  SparseMatrix<Real>& ARed )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Restrict"))
+    Zeros( ARed, heightRed, widthRed );
+    Int numEntries = 0;
+    for( const auto& entry : rows.entries )
+        if( newRows[entry.i] >= 0 && newCols[entry.j] >= 0 )
+            ++numEntries;
+    ARed.Reserve( numEntries );
+    for( const auto& entry : rows.entries )
+        if( newRows[entry.i] >= 0 && newCols[entry.j] >= 0 )
+            ARed.QueueUpdate
+            ( newRows[entry.i], newCols[entry.j], entry.value );
+    ARed.ProcessQueues();
+}
+
+template<typename Real>
+void Restrict
+( const LocalRows<Real>& rows,
+  const vector<Int>& newRows,
+  const vector<Int>& newCols,
+  Int heightRed,
+  Int widthRed,
+  DistSparseMatrix<Real>& ARed )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Restrict"))
+    Zeros( ARed, heightRed, widthRed );
+    Int numEntries = 0;
+    for( const auto& entry : rows.entries )
+        if( newRows[entry.i] >= 0 && newCols[entry.j] >= 0 )
+            ++numEntries;
+    ARed.Reserve( numEntries, numEntries );
+    for( const auto& entry : rows.entries )
+        if( newRows[entry.i] >= 0 && newCols[entry.j] >= 0 )
+            ARed.QueueUpdate
+            ( newRows[entry.i], newCols[entry.j], entry.value );
+    ARed.ProcessQueues();
+}
+
+// A set of (entire) rows which have been gathered onto every process
+template<typename Real>
+struct GatheredRows
+{
+    // The sorted row indices
+    vector<Int> inds;
+    vector<Int> offsets;
+    vector<Entry<Real>> entries;
+
+    vector<Entry<Real>> Row( Int i ) const
+    {
+        auto it = std::lower_bound( inds.begin(), inds.end(), i );
+        const Int k = it - inds.begin();
+        return vector<Entry<Real>>
+          ( entries.begin()+offsets[k], entries.begin()+offsets[k+1] );
+    }
+};
+
+template<typename Real>
+void GatherRows
+( const LocalRows<Real>& rows,
+  vector<Int> inds,
+  GatheredRows<Real>& gathered,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::GatherRows"))
+    std::sort( inds.begin(), inds.end() );
+    inds.erase( std::unique( inds.begin(), inds.end() ), inds.end() );
+
+    // Pack the local entries of the requested rows (in order)
+    vector<Entry<Real>> sendEntries;
+    const Int localHeight = rows.offsets.size()-1;
+    for( const Int i : inds )
+    {
+        const Int iLoc = i - rows.firstRow;
+        if( iLoc < 0 || iLoc >= localHeight )
+            continue;
+        sendEntries.insert
+        ( sendEntries.end(),
+          rows.entries.begin()+rows.offsets[iLoc],
+          rows.entries.begin()+rows.offsets[iLoc+1] );
+    }
+
+    // Since the rows are distributed in contiguous blocks, the result is
+    // sorted by row
+    const int commSize = mpi::Size( comm );
+    const int sendCount = sendEntries.size();
+    vector<int> recvCounts(commSize), recvOffsets(commSize);
+    mpi::AllGather( &sendCount, 1, recvCounts.data(), 1, comm );
+    int totalRecv = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvOffsets[q] = totalRecv;
+        totalRecv += recvCounts[q];
+    }
+    gathered.entries.resize( totalRecv );
+    mpi::AllGather
+    ( sendEntries.data(), sendCount,
+      gathered.entries.data(), recvCounts.data(), recvOffsets.data(), comm );
+
+    const Int numRows = inds.size();
+    gathered.offsets.resize( numRows+1 );
+    Int e = 0;
+    for( Int k=0; k<numRows; ++k )
+    {
+        gathered.offsets[k] = e;
+        while( e < totalRecv && gathered.entries[e].i == inds[k] )
+            ++e;
+    }
+    gathered.offsets[numRows] = e;
+    gathered.inds = std::move(inds);
+}
+
+template<typename Real>
+class Presolver
+{
+public:
+    Presolver
+    ( Int m,
+      Int n,
+      const LocalRows<Real>& A,
+      const LocalRows<Real>& Q,
+      const vector<Real>& b,
+      const vector<Real>& c,
+            PresolveRecord<Real>& record,
+      const PresolveCtrl<Real>& ctrl,
+            mpi::Comm comm );
+
+    // On exit, bRed and cRed are the right-hand side and costs of the
+    // reduced problem
+    void Run( vector<Real>& bRed, vector<Real>& cRed );
+
+private:
+    const Int m_, n_;
+    const LocalRows<Real>& A_;
+    const LocalRows<Real>& Q_;
+    PresolveRecord<Real>& record_;
+    const PresolveCtrl<Real>& ctrl_;
+    mpi::Comm comm_;
+
+    // The right-hand side is updated as variables are fixed, whereas the
+    // costs are split into the (substituted) linear costs, cTilde, and the
+    // linear costs induced by the quadratic coupling to fixed variables, cQ
+    vector<Real> b_, cTilde_, cQ_;
+    bool haveQ_;
+
+    vector<Int> rowActive_, colActive_, qColCount_;
+
+    // The statistics of the active submatrix
+    bool statsValid_=false;
+    vector<Int> rowCount_, rowSign_, rowHash_, rowSingleCol_;
+    vector<Real> rowSingleVal_;
+    vector<Int> colCount_, colSoleRow_;
+
+    void ComputeStats();
+    vector<Entry<Real>> ActiveEntries( const vector<Entry<Real>>& row ) const;
+    void AddStep
+    ( PresolveStep type, Int i, Int j, Real value,
+      const vector<Entry<Real>>& activeEntries,
+      const vector<Entry<Real>>& entries );
+
+    void EmptyRows();
+    void SingletonRows();
+    void ForcingRows();
+    void DuplicateRows();
+    void EmptyCols();
+    void FreeColSingletons();
+};
+
+template<typename Real>
+Presolver<Real>::Presolver
+( Int m,
+  Int n,
+  const LocalRows<Real>& A,
+  const LocalRows<Real>& Q,
+  const vector<Real>& b,
+  const vector<Real>& c,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl,
+        mpi::Comm comm )
+: m_(m), n_(n), A_(A), Q_(Q), record_(record), ctrl_(ctrl), comm_(comm),
+  b_(b), cTilde_(c), cQ_(n,Real(0)),
+  rowActive_(m,1), colActive_(n,1), qColCount_(n,0)
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::Presolver"))
+    // Since Q is symmetric, the number of nonzeros in each of its columns is
+    // the number of nonzeros in the corresponding row
+    for( const auto& entry : Q.entries )
+        if( entry.value != Real(0) )
+            ++qColCount_[entry.i];
+    mpi::AllReduce( qColCount_.data(), n, mpi::SUM, comm );
+    Int numQEntries = 0;
+    for( Int j=0; j<n; ++j )
+        numQEntries += qColCount_[j];
+    haveQ_ = ( numQEntries > 0 );
+
+    record_.height = m;
+    record_.width = n;
+    record_.keptRows.clear();
+    record_.keptCols.clear();
+    record_.steps.clear();
+}
+
+template<typename Real>
+void Presolver<Real>::ComputeStats()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::ComputeStats"))
+    if( statsValid_ )
+        return;
+
+    // The pattern of each row is hashed into [0,2^30) as the (order
+    // independent) sum of a hash of each of its active column indices
+    const unsigned long long hashMod = 1ULL << 30;
+    const unsigned long long hashMult = 2654435761ULL;
+
+    // The first four statistics are summed and the last two are maximized
+    // (only the owner of a row contributes to its statistics)
+    vector<Int> sumStats(3*m_+n_,0), maxStats(m_+n_,-1);
+    rowSingleVal_.assign( m_, Real(0) );
+    Int* rowCount = &sumStats[0];
+    Int* rowSign = &sumStats[m_];
+    Int* rowHash = &sumStats[2*m_];
+    Int* colCount = &sumStats[3*m_];
+    Int* rowSingleCol = &maxStats[0];
+    Int* colSoleRow = &maxStats[m_];
+
+    const Int localHeight = A_.offsets.size()-1;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A_.firstRow + iLoc;
+        if( !rowActive_[i] )
+            continue;
+        Int count = 0;
+        bool allPos=true, allNeg=true;
+        unsigned long long hash = 0;
+        for( Int e=A_.offsets[iLoc]; e<A_.offsets[iLoc+1]; ++e )
+        {
+            const Int j = A_.entries[e].j;
+            const Real value = A_.entries[e].value;
+            if( !colActive_[j] || value == Real(0) )
+                continue;
+            ++count;
+            if( value > Real(0) )
+                allNeg = false;
+            else
+                allPos = false;
+            hash = (hash + ((j+1)*hashMult) % hashMod) % hashMod;
+            rowSingleCol[i] = j;
+            rowSingleVal_[i] = value;
+            ++colCount[j];
+            colSoleRow[j] = i;
+        }
+        rowCount[i] = count;
+        if( count > 0 )
+            rowSign[i] = ( allPos ? 1 : ( allNeg ? -1 : 0 ) );
+        rowHash[i] = Int(hash);
+    }
+    mpi::AllReduce( sumStats.data(), 3*m_+n_, mpi::SUM, comm_ );
+    mpi::AllReduce( maxStats.data(), m_+n_, mpi::MAX, comm_ );
+    mpi::AllReduce( rowSingleVal_.data(), m_, mpi::SUM, comm_ );
+
+    rowCount_.assign( rowCount, rowCount+m_ );
+    rowSign_.assign( rowSign, rowSign+m_ );
+    rowHash_.assign( rowHash, rowHash+m_ );
+    colCount_.assign( colCount, colCount+n_ );
+    rowSingleCol_.assign( rowSingleCol, rowSingleCol+m_ );
+    colSoleRow_.assign( colSoleRow, colSoleRow+n_ );
+    statsValid_ = true;
+}
+
+template<typename Real>
+vector<Entry<Real>>
+Presolver<Real>::ActiveEntries( const vector<Entry<Real>>& row ) const
+{
+    vector<Entry<Real>> activeEntries;
+    for( const auto& entry : row )
+        if( colActive_[entry.j] && entry.value != Real(0) )
+            activeEntries.push_back( entry );
+    std::sort
+    ( activeEntries.begin(), activeEntries.end(),
+      []( const Entry<Real>& a, const Entry<Real>& b ) { return a.j < b.j; } );
+    return activeEntries;
+}
+
+template<typename Real>
+void Presolver<Real>::AddStep
+( PresolveStep type, Int i, Int j, Real value,
+  const vector<Entry<Real>>& activeEntries,
+  const vector<Entry<Real>>& entries )
+{
+    typename PresolveRecord<Real>::Step step;
+    step.type = type;
+    step.row = i;
+    step.col = j;
+    step.value = value;
+    if( i >= 0 )
+        step.rhs = b_[i];
+    step.activeEntries = activeEntries;
+    for( const auto& entry : activeEntries )
+        step.activeCosts.push_back( cTilde_[entry.j] );
+    step.entries = entries;
+    record_.steps.push_back( std::move(step) );
+    statsValid_ = false;
+}
+
+template<typename Real>
+void Presolver<Real>::EmptyRows()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::EmptyRows"))
+    ComputeStats();
+    const vector<Entry<Real>> noEntries;
+    for( Int i=0; i<m_; ++i )
+    {
+        if( !rowActive_[i] || rowCount_[i] != 0 )
+            continue;
+        if( Abs(b_[i]) > ctrl_.tol )
+            RuntimeError
+            ("Infeasible: row ",i," is empty but has right-hand side ",b_[i]);
+        AddStep( PRESOLVE_EMPTY_ROW, i, -1, Real(0), noEntries, noEntries );
+        rowActive_[i] = 0;
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::SingletonRows()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::SingletonRows"))
+    ComputeStats();
+    vector<Int> candidates;
+    for( Int i=0; i<m_; ++i )
+        if( rowActive_[i] && rowCount_[i] == 1 )
+            candidates.push_back( i );
+    if( candidates.empty() )
+        return;
+    GatheredRows<Real> gathered;
+    GatherRows( A_, candidates, gathered, comm_ );
+
+    vector<Real> xFix(n_,Real(0));
+    bool fixedNonzero = false;
+    for( const Int i : candidates )
+    {
+        const Int j = rowSingleCol_[i];
+        const Real value = rowSingleVal_[i];
+        // If the column was fixed by a previous singleton row, then this row
+        // is now empty and will be checked for consistency in the next pass
+        if( !colActive_[j] )
+            continue;
+        const Real xj = b_[i] / value;
+        if( xj < -ctrl_.tol )
+            RuntimeError
+            ("Infeasible: singleton row ",i," requires x(",j,")=",xj);
+        xFix[j] = Max(xj,Real(0));
+        fixedNonzero = fixedNonzero || xFix[j] != Real(0);
+        AddStep
+        ( PRESOLVE_SINGLETON_ROW, i, j, xFix[j],
+          vector<Entry<Real>>(1,Entry<Real>{i,j,value}), gathered.Row(i) );
+        rowActive_[i] = 0;
+        colActive_[j] = 0;
+    }
+    if( !fixedNonzero )
+        return;
+
+    // b := b - A(:,fixed) x(fixed)
+    // ============================
+    vector<Real> update(m_,Real(0));
+    const Int localHeight = A_.offsets.size()-1;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A_.firstRow + iLoc;
+        if( !rowActive_[i] )
+            continue;
+        for( Int e=A_.offsets[iLoc]; e<A_.offsets[iLoc+1]; ++e )
+            update[i] += A_.entries[e].value*xFix[A_.entries[e].j];
+    }
+    mpi::AllReduce( update.data(), m_, mpi::SUM, comm_ );
+    for( Int i=0; i<m_; ++i )
+        b_[i] -= update[i];
+
+    // cQ := cQ + Q(:,fixed) x(fixed)
+    // ==============================
+    if( haveQ_ )
+    {
+        update.assign( n_, Real(0) );
+        const Int localHeightQ = Q_.offsets.size()-1;
+        for( Int iLoc=0; iLoc<localHeightQ; ++iLoc )
+        {
+            const Int i = Q_.firstRow + iLoc;
+            for( Int e=Q_.offsets[iLoc]; e<Q_.offsets[iLoc+1]; ++e )
+                update[i] += Q_.entries[e].value*xFix[Q_.entries[e].j];
+        }
+        mpi::AllReduce( update.data(), n_, mpi::SUM, comm_ );
+        for( Int j=0; j<n_; ++j )
+            cQ_[j] += update[j];
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::ForcingRows()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::ForcingRows"))
+    ComputeStats();
+    vector<Int> candidates;
+    for( Int i=0; i<m_; ++i )
+    {
+        if( !rowActive_[i] || rowSign_[i] == 0 )
+            continue;
+        // With all of the coefficients sharing the sign s, the row implies
+        // that s b_i >= 0, with equality forcing every variable to zero
+        const Real sb = rowSign_[i]*b_[i];
+        if( sb < -ctrl_.tol )
+            RuntimeError
+            ("Infeasible: the coefficients of row ",i,
+             " share a sign opposite to that of its right-hand side");
+        if( sb <= ctrl_.tol )
+            candidates.push_back( i );
+    }
+    if( candidates.empty() )
+        return;
+    GatheredRows<Real> gathered;
+    GatherRows( A_, candidates, gathered, comm_ );
+
+    // Since the fixed values are zero, b and cQ need not be updated
+    for( const Int i : candidates )
+    {
+        const auto entries = gathered.Row( i );
+        const auto activeEntries = ActiveEntries( entries );
+        AddStep( PRESOLVE_FORCING_ROW, i, -1, Real(0), activeEntries, entries );
+        for( const auto& entry : activeEntries )
+            colActive_[entry.j] = 0;
+        rowActive_[i] = 0;
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::DuplicateRows()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::DuplicateRows"))
+    ComputeStats();
+
+    // Group the rows by their (hash,count) pairs
+    vector<std::tuple<Int,Int,Int>> keys;
+    for( Int i=0; i<m_; ++i )
+        if( rowActive_[i] && rowCount_[i] >= 2 )
+            keys.emplace_back( rowHash_[i], rowCount_[i], i );
+    std::sort( keys.begin(), keys.end() );
+    vector<Int> groupOffsets, candidates;
+    const Int numKeys = keys.size();
+    for( Int k=0; k<numKeys; )
+    {
+        Int kEnd = k+1;
+        while( kEnd < numKeys &&
+               std::get<0>(keys[kEnd]) == std::get<0>(keys[k]) &&
+               std::get<1>(keys[kEnd]) == std::get<1>(keys[k]) )
+            ++kEnd;
+        if( kEnd-k >= 2 )
+        {
+            groupOffsets.push_back( candidates.size() );
+            for( Int l=k; l<kEnd; ++l )
+                candidates.push_back( std::get<2>(keys[l]) );
+        }
+        k = kEnd;
+    }
+    if( candidates.empty() )
+        return;
+    groupOffsets.push_back( candidates.size() );
+    GatheredRows<Real> gathered;
+    GatherRows( A_, candidates, gathered, comm_ );
+
+    const Int numGroups = groupOffsets.size()-1;
+    const vector<Entry<Real>> noEntries;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        vector<Int> reps;
+        vector<vector<Entry<Real>>> repEntries;
+        for( Int k=groupOffsets[group]; k<groupOffsets[group+1]; ++k )
+        {
+            const Int i = candidates[k];
+            const auto activeEntries = ActiveEntries( gathered.Row(i) );
+            const Int numActive = activeEntries.size();
+            bool duplicate = false;
+            for( size_t r=0; r<reps.size(); ++r )
+            {
+                const auto& rep = repEntries[r];
+                const Real ratio = activeEntries[0].value / rep[0].value;
+                bool proportional = true;
+                for( Int l=0; l<numActive; ++l )
+                {
+                    if( activeEntries[l].j != rep[l].j ||
+                        Abs(activeEntries[l].value-ratio*rep[l].value) >
+                        ctrl_.tol*Abs(activeEntries[l].value) )
+                    {
+                        proportional = false;
+                        break;
+                    }
+                }
+                if( !proportional )
+                    continue;
+
+                const Real bRatio = ratio*b_[reps[r]];
+                if( Abs(b_[i]-bRatio) > ctrl_.tol*Max(Abs(b_[i]),Real(1)) )
+                    RuntimeError
+                    ("Infeasible: row ",i," is a multiple of row ",reps[r],
+                     " but its right-hand side is inconsistent");
+                AddStep
+                ( PRESOLVE_DUPLICATE_ROW, i, -1, ratio, noEntries, noEntries );
+                rowActive_[i] = 0;
+                duplicate = true;
+                break;
+            }
+            if( !duplicate )
+            {
+                reps.push_back( i );
+                repEntries.push_back( activeEntries );
+            }
+        }
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::EmptyCols()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::EmptyCols"))
+    ComputeStats();
+    const vector<Entry<Real>> noEntries;
+    for( Int j=0; j<n_; ++j )
+    {
+        if( !colActive_[j] || colCount_[j] != 0 || qColCount_[j] != 0 )
+            continue;
+        if( cTilde_[j] < -ctrl_.tol )
+            RuntimeError
+            ("Unbounded (or infeasible): column ",j,
+             " is empty but has cost ",cTilde_[j]);
+        AddStep( PRESOLVE_EMPTY_COL, -1, j, Real(0), noEntries, noEntries );
+        colActive_[j] = 0;
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::FreeColSingletons()
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::FreeColSingletons"))
+    ComputeStats();
+    vector<Int> cols, candidates;
+    for( Int j=0; j<n_; ++j )
+    {
+        if( colActive_[j] && colCount_[j] == 1 && qColCount_[j] == 0 )
+        {
+            cols.push_back( j );
+            candidates.push_back( colSoleRow_[j] );
+        }
+    }
+    if( candidates.empty() )
+        return;
+    GatheredRows<Real> gathered;
+    GatherRows( A_, candidates, gathered, comm_ );
+
+    for( const Int j : cols )
+    {
+        const Int i = colSoleRow_[j];
+        if( !rowActive_[i] || !colActive_[j] )
+            continue;
+        const auto entries = gathered.Row( i );
+        const auto activeEntries = ActiveEntries( entries );
+
+        // x_j = (b_i - sum_{k != j} A(i,k) x_k) / A(i,j) is implied to be
+        // nonnegative if b_i and each -A(i,k) share the sign of A(i,j)
+        Real pivot = 0;
+        for( const auto& entry : activeEntries )
+            if( entry.j == j )
+                pivot = entry.value;
+        if( pivot == Real(0) )
+            continue;
+        const Real sgn = ( pivot > Real(0) ? Real(1) : Real(-1) );
+        bool impliedFree = ( sgn*b_[i] >= Real(0) );
+        for( const auto& entry : activeEntries )
+            if( entry.j != j && sgn*entry.value > Real(0) )
+                impliedFree = false;
+        if( !impliedFree )
+            continue;
+
+        AddStep
+        ( PRESOLVE_FREE_COL_SINGLETON, i, j, pivot, activeEntries, entries );
+        const Real cRatio = cTilde_[j] / pivot;
+        for( const auto& entry : activeEntries )
+            if( entry.j != j )
+                cTilde_[entry.j] -= cRatio*entry.value;
+        rowActive_[i] = 0;
+        colActive_[j] = 0;
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::Run( vector<Real>& bRed, vector<Real>& cRed )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolver::Run"))
+    const int commRank = mpi::Rank( comm_ );
+    auto numActive = []( const vector<Int>& active )
+    {
+        Int num = 0;
+        for( const Int flag : active )
+            num += flag;
+        return num;
+    };
+    for( Int pass=0; pass<ctrl_.maxPasses; ++pass )
+    {
+        const Int numStepsOld = record_.steps.size();
+        if( ctrl_.emptyRows )
+            EmptyRows();
+        if( ctrl_.singletonRows )
+            SingletonRows();
+        if( ctrl_.forcingRows )
+            ForcingRows();
+        if( ctrl_.duplicateRows )
+            DuplicateRows();
+        if( ctrl_.emptyCols )
+            EmptyCols();
+        if( ctrl_.freeColSingletons )
+            FreeColSingletons();
+        const Int numNewSteps = record_.steps.size() - numStepsOld;
+        if( ctrl_.progress && commRank == 0 )
+            Output
+            ("Presolve pass ",pass,": ",numNewSteps," reductions leave ",
+             numActive(rowActive_)," of ",m_," rows and ",
+             numActive(colActive_)," of ",n_," columns");
+        if( numNewSteps == 0 )
+            break;
+    }
+
+    bRed.clear();
+    for( Int i=0; i<m_; ++i )
+    {
+        if( rowActive_[i] )
+        {
+            record_.keptRows.push_back( i );
+            bRed.push_back( b_[i] );
+        }
+    }
+    cRed.clear();
+    for( Int j=0; j<n_; ++j )
+    {
+        if( colActive_[j] )
+        {
+            record_.keptCols.push_back( j );
+            cRed.push_back( cTilde_[j]+cQ_[j] );
+        }
+    }
+}
+
+template<typename Real>
+void PresolveCore
+( const LocalRows<Real>& ALoc,
+  const LocalRows<Real>& QLoc,
+  Int m,
+  Int n,
+  const vector<Real>& b,
+  const vector<Real>& c,
+        vector<Real>& bRed,
+        vector<Real>& cRed,
+        vector<Int>& newRows,
+        vector<Int>& newCols,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::PresolveCore"))
+    Presolver<Real> presolver( m, n, ALoc, QLoc, b, c, record, ctrl, comm );
+    presolver.Run( bRed, cRed );
+
+    newRows.assign( m, -1 );
+    newCols.assign( n, -1 );
+    const Int mRed = record.keptRows.size();
+    const Int nRed = record.keptCols.size();
+    for( Int iRed=0; iRed<mRed; ++iRed )
+        newRows[record.keptRows[iRed]] = iRed;
+    for( Int jRed=0; jRed<nRed; ++jRed )
+        newCols[record.keptCols[jRed]] = jRed;
+}
+
+template<typename Real>
+void PostsolveCore
+( const LocalRows<Real>& ALoc,
+  const LocalRows<Real>& QLoc,
+  const vector<Real>& c,
+  const PresolveRecord<Real>& record,
+  const vector<Real>& xRed,
+  const vector<Real>& yRed,
+        vector<Real>& x,
+        vector<Real>& y,
+        vector<Real>& z,
+        mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::PostsolveCore"))
+    const Int m = record.height;
+    const Int n = record.width;
+    const Int mRed = record.keptRows.size();
+    const Int nRed = record.keptCols.size();
+    if( Int(xRed.size()) != nRed || Int(yRed.size()) != mRed )
+        LogicError("Reduced solution was of the wrong size");
+
+    // Expand x with the kept and fixed variables
+    // ==========================================
+    x.assign( n, Real(0) );
+    for( Int jRed=0; jRed<nRed; ++jRed )
+        x[record.keptCols[jRed]] = xRed[jRed];
+    for( const auto& step : record.steps )
+        if( step.type == PRESOLVE_SINGLETON_ROW )
+            x[step.col] = step.value;
+
+    // Form Q x
+    // ========
+    // NOTE: The substituted columns have no quadratic coupling, so their
+    //       (not yet computed) values are not needed
+    vector<Real> Qx(n,Real(0));
+    const Int localHeightQ = QLoc.offsets.size()-1;
+    for( Int iLoc=0; iLoc<localHeightQ; ++iLoc )
+    {
+        const Int i = QLoc.firstRow + iLoc;
+        for( Int e=QLoc.offsets[iLoc]; e<QLoc.offsets[iLoc+1]; ++e )
+            Qx[i] += QLoc.entries[e].value*x[QLoc.entries[e].j];
+    }
+    mpi::AllReduce( Qx.data(), n, mpi::SUM, comm );
+
+    // Initialize y and w := A^T y
+    // ===========================
+    y.assign( m, Real(0) );
+    for( Int iRed=0; iRed<mRed; ++iRed )
+        y[record.keptRows[iRed]] = yRed[iRed];
+    vector<Real> w(n,Real(0));
+    const Int localHeightA = ALoc.offsets.size()-1;
+    for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+    {
+        const Int i = ALoc.firstRow + iLoc;
+        if( y[i] == Real(0) )
+            continue;
+        for( Int e=ALoc.offsets[iLoc]; e<ALoc.offsets[iLoc+1]; ++e )
+            w[ALoc.entries[e].j] += ALoc.entries[e].value*y[i];
+    }
+    mpi::AllReduce( w.data(), n, mpi::SUM, comm );
+
+    // Undo the steps in reverse order
+    // ===============================
+    // Each multiplier is chosen so that the reduced costs of the columns
+    // which were active when the row was eliminated remain nonnegative and
+    // complementary, where, at that point, the reduced cost of column k was
+    // cTilde_k + (Q x)_k + (A^T y)_k (recall that the dual residual is
+    // c + Q x + A^T y - z = 0)
+    const Int numSteps = record.steps.size();
+    for( Int s=numSteps-1; s>=0; --s )
+    {
+        const auto& step = record.steps[s];
+        const Int i = step.row;
+        const Int j = step.col;
+        const Int numActive = step.activeEntries.size();
+        if( step.type == PRESOLVE_SINGLETON_ROW )
+        {
+            const Real pivot = step.activeEntries[0].value;
+            y[i] = -(step.activeCosts[0]+Qx[j]+w[j]) / pivot;
+        }
+        else if( step.type == PRESOLVE_FREE_COL_SINGLETON )
+        {
+            Real xj = step.rhs;
+            Real cj = 0;
+            for( Int l=0; l<numActive; ++l )
+            {
+                const auto& entry = step.activeEntries[l];
+                if( entry.j == j )
+                    cj = step.activeCosts[l];
+                else
+                    xj -= entry.value*x[entry.j];
+            }
+            x[j] = xj / step.value;
+            y[i] = -(cj+Qx[j]+w[j]) / step.value;
+        }
+        else if( step.type == PRESOLVE_FORCING_ROW )
+        {
+            // The coefficients of a forcing row share a sign, and a positive
+            // (negative) coefficient bounds y_i from below (above)
+            Real yi = 0;
+            for( Int l=0; l<numActive; ++l )
+            {
+                const auto& entry = step.activeEntries[l];
+                const Real ratio =
+                  -(step.activeCosts[l]+Qx[entry.j]+w[entry.j]) / entry.value;
+                if( l == 0 )
+                    yi = ratio;
+                else if( entry.value > Real(0) )
+                    yi = Max(yi,ratio);
+                else
+                    yi = Min(yi,ratio);
+            }
+            y[i] = yi;
+        }
+        else
+            continue;
+
+        for( const auto& entry : step.entries )
+            w[entry.j] += entry.value*y[i];
+    }
+
+    // z := c + Q x + A^T y
+    // ====================
+    z.resize( n );
+    for( Int j=0; j<n; ++j )
+        z[j] = c[j] + Qx[j] + w[j];
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolve"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    LocalRows<Real> ALoc, QLoc;
+    GetLocalRows( A, ALoc );
+    GetLocalRows( Q, QLoc );
+    vector<Real> bRep, cRep, bRedRep, cRedRep;
+    Replicate( b, bRep );
+    Replicate( c, cRep );
+
+    vector<Int> newRows, newCols;
+    PresolveCore
+    ( ALoc, QLoc, m, n, bRep, cRep, bRedRep, cRedRep, newRows, newCols,
+      record, ctrl, mpi::COMM_SELF );
+    const Int mRed = bRedRep.size();
+    const Int nRed = cRedRep.size();
+
+    Restrict( ALoc, newRows, newCols, mRed, nRed, ARed );
+    Restrict( QLoc, newCols, newCols, nRed, nRed, QRed );
+    Distribute( bRedRep, bRed );
+    Distribute( cRedRep, cRed );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        PresolveRecord<Real>& record,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Presolve"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    mpi::Comm comm = A.Comm();
+    LocalRows<Real> ALoc, QLoc;
+    GetLocalRows( A, ALoc );
+    GetLocalRows( Q, QLoc );
+    vector<Real> bRep, cRep, bRedRep, cRedRep;
+    Replicate( b, bRep );
+    Replicate( c, cRep );
+
+    vector<Int> newRows, newCols;
+    PresolveCore
+    ( ALoc, QLoc, m, n, bRep, cRep, bRedRep, cRedRep, newRows, newCols,
+      record, ctrl, comm );
+    const Int mRed = bRedRep.size();
+    const Int nRed = cRedRep.size();
+
+    ARed.SetComm( comm );
+    QRed.SetComm( comm );
+    bRed.SetComm( comm );
+    cRed.SetComm( comm );
+    Restrict( ALoc, newRows, newCols, mRed, nRed, ARed );
+    Restrict( QLoc, newCols, newCols, nRed, nRed, QRed );
+    Distribute( bRedRep, bRed );
+    Distribute( cRedRep, cRed );
+}
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveRecord<Real>& record,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Postsolve"))
+    LocalRows<Real> ALoc, QLoc;
+    GetLocalRows( A, ALoc );
+    GetLocalRows( Q, QLoc );
+    vector<Real> cRep, xRedRep, yRedRep, xRep, yRep, zRep;
+    Replicate( c, cRep );
+    Replicate( xRed, xRedRep );
+    Replicate( yRed, yRedRep );
+    PostsolveCore
+    ( ALoc, QLoc, cRep, record, xRedRep, yRedRep, xRep, yRep, zRep,
+      mpi::COMM_SELF );
+    Distribute( xRep, x );
+    Distribute( yRep, y );
+    Distribute( zRep, z );
+}
+
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const PresolveRecord<Real>& record,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Postsolve"))
+    mpi::Comm comm = A.Comm();
+    LocalRows<Real> ALoc, QLoc;
+    GetLocalRows( A, ALoc );
+    GetLocalRows( Q, QLoc );
+    vector<Real> cRep, xRedRep, yRedRep, xRep, yRep, zRep;
+    Replicate( c, cRep );
+    Replicate( xRed, xRedRep );
+    Replicate( yRed, yRedRep );
+    PostsolveCore
+    ( ALoc, QLoc, cRep, record, xRedRep, yRedRep, xRep, yRep, zRep, comm );
+    x.SetComm( comm );
+    y.SetComm( comm );
+    z.SetComm( comm );
+    Distribute( xRep, x );
+    Distribute( yRep, y );
+    Distribute( zRep, z );
+}
+
+#define PROTO(Real) \
+  template void Presolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& QRed, \
+          SparseMatrix<Real>& ARed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Presolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& QRed, \
+          DistSparseMatrix<Real>& ARed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          PresolveRecord<Real>& record, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void Postsolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const PresolveRecord<Real>& record, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void Postsolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const PresolveRecord<Real>& record, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace qp
+} // namespace El
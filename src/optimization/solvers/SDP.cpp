@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "./SDP/direct/IPM.hpp"
+
+namespace El {
+
+template<typename Real>
+void SDP
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& b,
+  const vector<Matrix<Real>>& C,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  const sdp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("SDP"))
+    if( ctrl.approach == SDP_MEHROTRA )
+        sdp::direct::Mehrotra( A, b, C, X, y, Z, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
+template<typename Real>
+void SDP
+( const vector<DistMatrix<Real>>& A,
+  const ElementalMatrix<Real>& b,
+  const vector<DistMatrix<Real>>& C,
+        vector<DistMatrix<Real>>& X,
+        ElementalMatrix<Real>& y,
+        vector<DistMatrix<Real>>& Z,
+  const sdp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("SDP"))
+    if( ctrl.approach == SDP_MEHROTRA )
+        sdp::direct::Mehrotra( A, b, C, X, y, Z, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
+#define PROTO(Real) \
+  template void SDP \
+  ( const vector<Matrix<Real>>& A, \
+    const Matrix<Real>& b, \
+    const vector<Matrix<Real>>& C, \
+          vector<Matrix<Real>>& X, \
+          Matrix<Real>& y, \
+          vector<Matrix<Real>>& Z, \
+    const sdp::direct::Ctrl<Real>& ctrl ); \
+  template void SDP \
+  ( const vector<DistMatrix<Real>>& A, \
+    const ElementalMatrix<Real>& b, \
+    const vector<DistMatrix<Real>>& C, \
+          vector<DistMatrix<Real>>& X, \
+          ElementalMatrix<Real>& y, \
+          vector<DistMatrix<Real>>& Z, \
+    const sdp::direct::Ctrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
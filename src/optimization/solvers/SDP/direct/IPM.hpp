@@ -0,0 +1,36 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+template<typename Real>
+void Mehrotra
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& b,
+  const vector<Matrix<Real>>& C,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  const MehrotraCtrl<Real>& ctrl );
+template<typename Real>
+void Mehrotra
+( const vector<DistMatrix<Real>>& A,
+  const ElementalMatrix<Real>& b,
+  const vector<DistMatrix<Real>>& C,
+        vector<DistMatrix<Real>>& X,
+        ElementalMatrix<Real>& y,
+        vector<DistMatrix<Real>>& Z,
+  const MehrotraCtrl<Real>& ctrl );
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
@@ -0,0 +1,716 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "./util.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+// The following solves a pair of block-diagonal semidefinite programs in
+// "direct" conic form:
+//
+//   min <C,X>
+//   s.t. <A_i,X> = b_i, i=0,...,m-1, X in K,
+//
+//   max -b^T y
+//   s.t. sum_i y_i A_i - Z + C = 0, Z in K,
+//
+// where K is a product of cones of symmetric positive semi-definite matrices,
+// using a Mehrotra Predictor-Corrector scheme with Nesterov-Todd scaling.
+//
+// If the Nesterov-Todd scaling point is W = R R^T, with
+// inv(R) X inv(R)^T = R^T Z R = Lambda, the linearized complementarity
+// condition in the scaled space is
+//
+//   Lambda o (inv(R) dX inv(R)^T + R^T dZ R) = sigma mu I - Lambda^2 - corr,
+//
+// where 'o' is the Jordan product, (A o B) = (A B + B A)/2, and 'corr' is
+// Mehrotra's second-order correction. Since Lambda is diagonal, this
+// equation can be solved elementwise, and eliminating dX and dZ yields the
+// (dense, symmetric positive-definite) Schur complement system
+//
+//   M dy = rhs,  M(i,k) = <R^T A_i R, R^T A_k R>,
+//
+// which is formed with Gemm and Syrk and solved via a Cholesky factorization.
+//
+
+template<typename Real>
+void Mehrotra
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& bPre,
+  const vector<Matrix<Real>>& CPre,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Mehrotra"))
+
+    // TODO: Move these into the control structure
+    const bool stepLengthSigma = true;
+    function<Real(Real,Real,Real,Real)> centralityRule;
+    if( stepLengthSigma )
+        centralityRule = StepLengthCentrality<Real>;
+    else
+        centralityRule = MehrotraCentrality<Real>;
+
+    const Int numBlocks = A.size();
+    const Int m = bPre.Height();
+    if( numBlocks == 0 )
+        LogicError("Expected at least one block");
+    if( Int(CPre.size()) != numBlocks )
+        LogicError("A and C should have the same number of blocks");
+    Int degree = 0;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = CPre[j].Height();
+        if( A[j].Height() != n*n || A[j].Width() != m )
+            LogicError
+            ("Block ",j," of A was ",A[j].Height()," x ",A[j].Width(),
+             " but should have been ",n*n," x ",m);
+        degree += n;
+    }
+
+    // Rather than equilibrating the constraint operator, only rescale
+    // || b ||_max and || C ||_max to roughly one
+    auto b = bPre;
+    auto C = CPre;
+    Real bScale=1, CScale=1;
+    if( ctrl.outerEquil )
+    {
+        bScale = Max(MaxNorm(b),Real(1));
+        Real CMaxNorm = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            CMaxNorm = Max(CMaxNorm,MaxNorm(C[j]));
+        CScale = Max(CMaxNorm,Real(1));
+        b *= Real(1)/bScale;
+        for( Int j=0; j<numBlocks; ++j )
+            C[j] *= Real(1)/CScale;
+        if( ctrl.primalInit )
+            for( Int j=0; j<numBlocks; ++j )
+                X[j] *= Real(1)/bScale;
+        if( ctrl.dualInit )
+        {
+            y *= Real(1)/CScale;
+            for( Int j=0; j<numBlocks; ++j )
+                Z[j] *= Real(1)/CScale;
+        }
+    }
+
+    const Real bNrm2 = Nrm2( b );
+    Real CNrmFrob = 0;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Real CjNrmFrob = FrobeniusNorm( C[j] );
+        CNrmFrob += CjNrmFrob*CjNrmFrob;
+    }
+    CNrmFrob = Sqrt(CNrmFrob);
+    if( ctrl.print )
+    {
+        Output("|| b ||_2 = ",bNrm2);
+        Output("|| C ||_F = ",CNrmFrob);
+    }
+
+    // AWide[j] := [A_0[j], ..., A_{m-1}[j]]
+    vector<Matrix<Real>> AWide( numBlocks );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = C[j].Height();
+        Reshape( n, n*m, A[j], AWide[j] );
+    }
+
+    Initialize( A, b, C, X, y, Z, ctrl.primalInit, ctrl.dualInit );
+
+    Real relError = 1;
+    vector<Matrix<Real>> R(numBlocks), lambda(numBlocks), W(numBlocks),
+      rc(numBlocks), Y(numBlocks),
+      dXAff, dZAff, dX, dZ;
+    Matrix<Real> M, rb, dyAff, dy, lambdaSq, dXAffScaled, dZAffScaled;
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Compute the Nesterov-Todd scaling
+        // =================================
+        for( Int j=0; j<numBlocks; ++j )
+            psd::NesterovTodd( X[j], Z[j], R[j], lambda[j] );
+
+        // Check for convergence
+        // =====================
+        // |<C,X> - (-b^T y)| / (1 + |<C,X>|) <= tol ?
+        // -------------------------------------------
+        Real primObj = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            primObj += HilbertSchmidt( C[j], X[j] );
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+        // --------------------------------------
+        rb = b;
+        ApplyOperator( Real(1), A, X, Real(-1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        // || r_c ||_F / (1 + || C ||_F) <= tol ?
+        // --------------------------------------
+        rc = C;
+        for( Int j=0; j<numBlocks; ++j )
+            rc[j] -= Z[j];
+        ApplyAdjoint( Real(1), A, y, Real(1), rc );
+        Real rcNrmFrob = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Real rcjNrmFrob = FrobeniusNorm( rc[j] );
+            rcNrmFrob += rcjNrmFrob*rcjNrmFrob;
+        }
+        rcNrmFrob = Sqrt(rcNrmFrob);
+        const Real rcConv = rcNrmFrob / (1+CNrmFrob);
+
+        // Now check the pieces
+        // --------------------
+        relError = Max(Max(objConv,rbConv),rcConv);
+        if( ctrl.print )
+        {
+            const Real yNrm2 = Nrm2( y );
+            Output
+            ("iter ",numIts,":\n",Indent(),
+             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+             "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
+             "  || r_c ||_F = ",rcNrmFrob,"\n",Indent(),
+             "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+             "  || r_c ||_F / (1 + || C ||_F) = ",rcConv,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
+        }
+        if( relError <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+            RuntimeError
+            ("Reached maximum number of iterations, ",ctrl.maxIts,
+             ", with rel. error ",relError," which does not meet the minimum ",
+             "tolerance of ",ctrl.minTol);
+
+        // Ensure that the scaling point is not too ill-conditioned
+        // ========================================================
+        Real wMaxNorm = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Gemm( NORMAL, TRANSPOSE, Real(1), R[j], R[j], W[j] );
+            wMaxNorm = Max(wMaxNorm,MaxNorm(W[j]));
+        }
+        const Real wMaxNormLimit =
+          Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
+        if( wMaxNorm > wMaxNormLimit )
+        {
+            for( Int j=0; j<numBlocks; ++j )
+            {
+                psd::PushPairInto( X[j], Z[j], W[j], wMaxNormLimit );
+                psd::NesterovTodd( X[j], Z[j], R[j], lambda[j] );
+            }
+            rc = C;
+            for( Int j=0; j<numBlocks; ++j )
+                rc[j] -= Z[j];
+            ApplyAdjoint( Real(1), A, y, Real(1), rc );
+        }
+        Real mu = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            mu += HilbertSchmidt( X[j], Z[j] );
+        mu /= degree;
+
+        // Form and factor the Schur complement
+        // ====================================
+        SchurComplement( m, AWide, R, M );
+        try { Cholesky( LOWER, M ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Factorization of the Schur complement failed with rel. ",
+                 "error ",relError," which does not meet the minimum ",
+                 "tolerance of ",ctrl.minTol);
+        }
+
+        // Compute the affine search direction
+        // ===================================
+        // Y := -Lambda
+        // ------------
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            Zeros( Y[j], n, n );
+            UpdateDiagonal( Y[j], Real(-1), lambda[j] );
+        }
+        SolveDirection( A, R, M, rb, rc, Y, dXAff, dyAff, dZAff );
+
+        // Compute a centrality parameter
+        // ==============================
+        Real alphaAffPri = Real(1), alphaAffDual = Real(1);
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            alphaAffPri =
+              Min(alphaAffPri,psd::MaxStep(X[j],dXAff[j],Real(1)));
+            alphaAffDual =
+              Min(alphaAffDual,psd::MaxStep(Z[j],dZAff[j],Real(1)));
+        }
+        if( ctrl.forceSameStep )
+            alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output
+            ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
+        // NOTE: dX and dZ are used as temporaries
+        dX = X;
+        dZ = Z;
+        Real muAff = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Axpy( alphaAffPri,  dXAff[j], dX[j] );
+            Axpy( alphaAffDual, dZAff[j], dZ[j] );
+            muAff += HilbertSchmidt( dX[j], dZ[j] );
+        }
+        muAff /= degree;
+        if( ctrl.print )
+            Output("muAff = ",muAff,", mu = ",mu);
+        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output("sigma=",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        rb *= 1-sigma;
+        for( Int j=0; j<numBlocks; ++j )
+            rc[j] *= 1-sigma;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            if( ctrl.mehrotra )
+            {
+                // Y := -(dXAffScaled o dZAffScaled), where
+                // dZAffScaled = R^T dZAff R and
+                // dXAffScaled = inv(R) dXAff inv(R)^T = -Lambda - dZAffScaled
+                Congruence( TRANSPOSE, R[j], dZAff[j], dZAffScaled );
+                Zeros( dXAffScaled, n, n );
+                UpdateDiagonal( dXAffScaled, Real(-1), lambda[j] );
+                dXAffScaled -= dZAffScaled;
+                psd::Apply( dXAffScaled, dZAffScaled, Y[j] );
+                Y[j] *= -1;
+            }
+            else
+                Zeros( Y[j], n, n );
+
+            // Y := inv(Lambda) o (Y + sigma*mu*I - Lambda^2)
+            lambdaSq = lambda[j];
+            EntrywiseMap( lambdaSq, function<Real(Real)>
+              ( []( Real alpha ) { return alpha*alpha; } ) );
+            UpdateDiagonal( Y[j], Real(-1), lambdaSq );
+            ShiftDiagonal( Y[j], sigma*mu );
+            psd::ApplyInverse( lambda[j], Y[j] );
+        }
+        SolveDirection( A, R, M, rb, rc, Y, dX, dy, dZ );
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri = 1/ctrl.maxStepRatio, alphaDual = 1/ctrl.maxStepRatio;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            alphaPri = psd::MaxStep( X[j], dX[j], alphaPri );
+            alphaDual = psd::MaxStep( Z[j], dZ[j], alphaDual );
+        }
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.print )
+            Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Axpy( alphaPri, dX[j], X[j] );
+            Axpy( alphaDual, dZ[j], Z[j] );
+            MakeSymmetric( LOWER, X[j] );
+            MakeSymmetric( LOWER, Z[j] );
+        }
+        Axpy( alphaDual, dy, y );
+        if( alphaPri == Real(0) && alphaDual == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+
+    if( ctrl.outerEquil )
+    {
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            X[j] *= bScale;
+            Z[j] *= CScale;
+        }
+        y *= CScale;
+    }
+}
+
+template<typename Real>
+void Mehrotra
+( const vector<DistMatrix<Real>>& A,
+  const ElementalMatrix<Real>& bPre,
+  const vector<DistMatrix<Real>>& CPre,
+        vector<DistMatrix<Real>>& X,
+        ElementalMatrix<Real>& yPre,
+        vector<DistMatrix<Real>>& Z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Mehrotra"))
+
+    // TODO: Move these into the control structure
+    const bool stepLengthSigma = true;
+    function<Real(Real,Real,Real,Real)> centralityRule;
+    if( stepLengthSigma )
+        centralityRule = StepLengthCentrality<Real>;
+    else
+        centralityRule = MehrotraCentrality<Real>;
+
+    const Grid& grid = bPre.Grid();
+    const int commRank = grid.Rank();
+    const Int numBlocks = A.size();
+    const Int m = bPre.Height();
+    if( numBlocks == 0 )
+        LogicError("Expected at least one block");
+    if( Int(CPre.size()) != numBlocks )
+        LogicError("A and C should have the same number of blocks");
+    Int degree = 0;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = CPre[j].Height();
+        if( A[j].Height() != n*n || A[j].Width() != m )
+            LogicError
+            ("Block ",j," of A was ",A[j].Height()," x ",A[j].Width(),
+             " but should have been ",n*n," x ",m);
+        DEBUG_ONLY(AssertSameGrids( bPre, A[j], CPre[j] ))
+        degree += n;
+    }
+
+    DistMatrix<Real> b( bPre );
+    auto C = CPre;
+    DistMatrixWriteProxy<Real,Real,MC,MR> yProx( yPre );
+    auto& y = yProx.Get();
+
+    // Rather than equilibrating the constraint operator, only rescale
+    // || b ||_max and || C ||_max to roughly one
+    Real bScale=1, CScale=1;
+    if( ctrl.outerEquil )
+    {
+        bScale = Max(MaxNorm(b),Real(1));
+        Real CMaxNorm = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            CMaxNorm = Max(CMaxNorm,MaxNorm(C[j]));
+        CScale = Max(CMaxNorm,Real(1));
+        b *= Real(1)/bScale;
+        for( Int j=0; j<numBlocks; ++j )
+            C[j] *= Real(1)/CScale;
+        if( ctrl.primalInit )
+            for( Int j=0; j<numBlocks; ++j )
+                X[j] *= Real(1)/bScale;
+        if( ctrl.dualInit )
+        {
+            y *= Real(1)/CScale;
+            for( Int j=0; j<numBlocks; ++j )
+                Z[j] *= Real(1)/CScale;
+        }
+    }
+
+    const Real bNrm2 = Nrm2( b );
+    Real CNrmFrob = 0;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Real CjNrmFrob = FrobeniusNorm( C[j] );
+        CNrmFrob += CjNrmFrob*CjNrmFrob;
+    }
+    CNrmFrob = Sqrt(CNrmFrob);
+    if( ctrl.print && commRank == 0 )
+    {
+        Output("|| b ||_2 = ",bNrm2);
+        Output("|| C ||_F = ",CNrmFrob);
+    }
+
+    // AWide[j] := [A_0[j], ..., A_{m-1}[j]]
+    vector<DistMatrix<Real>> AWide( numBlocks, DistMatrix<Real>(grid) );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = C[j].Height();
+        Reshape( n, n*m, A[j], AWide[j] );
+    }
+
+    Initialize( A, b, C, X, y, Z, ctrl.primalInit, ctrl.dualInit );
+
+    Real relError = 1;
+    vector<DistMatrix<Real>>
+      R(numBlocks,DistMatrix<Real>(grid)),
+      lambda(numBlocks,DistMatrix<Real>(grid)),
+      W(numBlocks,DistMatrix<Real>(grid)),
+      rc(numBlocks,DistMatrix<Real>(grid)),
+      Y(numBlocks,DistMatrix<Real>(grid)),
+      dXAff, dZAff, dX, dZ;
+    DistMatrix<Real> M(grid), rb(grid), dyAff(grid), dy(grid),
+      lambdaSq(grid), dXAffScaled(grid), dZAffScaled(grid);
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Compute the Nesterov-Todd scaling
+        // =================================
+        for( Int j=0; j<numBlocks; ++j )
+            psd::NesterovTodd( X[j], Z[j], R[j], lambda[j] );
+
+        // Check for convergence
+        // =====================
+        // |<C,X> - (-b^T y)| / (1 + |<C,X>|) <= tol ?
+        // -------------------------------------------
+        Real primObj = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            primObj += HilbertSchmidt( C[j], X[j] );
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+        // --------------------------------------
+        rb = b;
+        ApplyOperator( Real(1), A, X, Real(-1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        // || r_c ||_F / (1 + || C ||_F) <= tol ?
+        // --------------------------------------
+        rc = C;
+        for( Int j=0; j<numBlocks; ++j )
+            rc[j] -= Z[j];
+        ApplyAdjoint( Real(1), A, y, Real(1), rc );
+        Real rcNrmFrob = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Real rcjNrmFrob = FrobeniusNorm( rc[j] );
+            rcNrmFrob += rcjNrmFrob*rcjNrmFrob;
+        }
+        rcNrmFrob = Sqrt(rcNrmFrob);
+        const Real rcConv = rcNrmFrob / (1+CNrmFrob);
+
+        // Now check the pieces
+        // --------------------
+        relError = Max(Max(objConv,rbConv),rcConv);
+        if( ctrl.print )
+        {
+            const Real yNrm2 = Nrm2( y );
+            if( commRank == 0 )
+                Output
+                ("iter ",numIts,":\n",Indent(),
+                 "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+                 "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
+                 "  || r_c ||_F = ",rcNrmFrob,"\n",Indent(),
+                 "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+                 "  || r_c ||_F / (1 + || C ||_F) = ",rcConv,"\n",Indent(),
+                 "  primal = ",primObj,"\n",Indent(),
+                 "  dual   = ",dualObj,"\n",Indent(),
+                 "  |primal - dual| / (1 + |primal|) = ",objConv);
+        }
+        if( relError <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+            RuntimeError
+            ("Reached maximum number of iterations, ",ctrl.maxIts,
+             ", with rel. error ",relError," which does not meet the minimum ",
+             "tolerance of ",ctrl.minTol);
+
+        // Ensure that the scaling point is not too ill-conditioned
+        // ========================================================
+        Real wMaxNorm = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Gemm( NORMAL, TRANSPOSE, Real(1), R[j], R[j], W[j] );
+            wMaxNorm = Max(wMaxNorm,MaxNorm(W[j]));
+        }
+        const Real wMaxNormLimit =
+          Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
+        if( wMaxNorm > wMaxNormLimit )
+        {
+            for( Int j=0; j<numBlocks; ++j )
+            {
+                psd::PushPairInto( X[j], Z[j], W[j], wMaxNormLimit );
+                psd::NesterovTodd( X[j], Z[j], R[j], lambda[j] );
+            }
+            rc = C;
+            for( Int j=0; j<numBlocks; ++j )
+                rc[j] -= Z[j];
+            ApplyAdjoint( Real(1), A, y, Real(1), rc );
+        }
+        Real mu = 0;
+        for( Int j=0; j<numBlocks; ++j )
+            mu += HilbertSchmidt( X[j], Z[j] );
+        mu /= degree;
+
+        // Form and factor the Schur complement
+        // ====================================
+        SchurComplement( m, AWide, R, M );
+        try { Cholesky( LOWER, M ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Factorization of the Schur complement failed with rel. ",
+                 "error ",relError," which does not meet the minimum ",
+                 "tolerance of ",ctrl.minTol);
+        }
+
+        // Compute the affine search direction
+        // ===================================
+        // Y := -Lambda
+        // ------------
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            Zeros( Y[j], n, n );
+            UpdateDiagonal( Y[j], Real(-1), lambda[j] );
+        }
+        SolveDirection( A, R, M, rb, rc, Y, dXAff, dyAff, dZAff );
+
+        // Compute a centrality parameter
+        // ==============================
+        Real alphaAffPri = Real(1), alphaAffDual = Real(1);
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            alphaAffPri =
+              Min(alphaAffPri,psd::MaxStep(X[j],dXAff[j],Real(1)));
+            alphaAffDual =
+              Min(alphaAffDual,psd::MaxStep(Z[j],dZAff[j],Real(1)));
+        }
+        if( ctrl.forceSameStep )
+            alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+        if( ctrl.print && commRank == 0 )
+            Output
+            ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
+        // NOTE: dX and dZ are used as temporaries
+        dX = X;
+        dZ = Z;
+        Real muAff = 0;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Axpy( alphaAffPri,  dXAff[j], dX[j] );
+            Axpy( alphaAffDual, dZAff[j], dZ[j] );
+            muAff += HilbertSchmidt( dX[j], dZ[j] );
+        }
+        muAff /= degree;
+        if( ctrl.print && commRank == 0 )
+            Output("muAff = ",muAff,", mu = ",mu);
+        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        if( ctrl.print && commRank == 0 )
+            Output("sigma=",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        rb *= 1-sigma;
+        for( Int j=0; j<numBlocks; ++j )
+            rc[j] *= 1-sigma;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            if( ctrl.mehrotra )
+            {
+                // Y := -(dXAffScaled o dZAffScaled), where
+                // dZAffScaled = R^T dZAff R and
+                // dXAffScaled = inv(R) dXAff inv(R)^T = -Lambda - dZAffScaled
+                Congruence( TRANSPOSE, R[j], dZAff[j], dZAffScaled );
+                Zeros( dXAffScaled, n, n );
+                UpdateDiagonal( dXAffScaled, Real(-1), lambda[j] );
+                dXAffScaled -= dZAffScaled;
+                psd::Apply( dXAffScaled, dZAffScaled, Y[j] );
+                Y[j] *= -1;
+            }
+            else
+                Zeros( Y[j], n, n );
+
+            // Y := inv(Lambda) o (Y + sigma*mu*I - Lambda^2)
+            lambdaSq = lambda[j];
+            EntrywiseMap( lambdaSq, function<Real(Real)>
+              ( []( Real alpha ) { return alpha*alpha; } ) );
+            UpdateDiagonal( Y[j], Real(-1), lambdaSq );
+            ShiftDiagonal( Y[j], sigma*mu );
+            psd::ApplyInverse( lambda[j], Y[j] );
+        }
+        SolveDirection( A, R, M, rb, rc, Y, dX, dy, dZ );
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri = 1/ctrl.maxStepRatio, alphaDual = 1/ctrl.maxStepRatio;
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            alphaPri = psd::MaxStep( X[j], dX[j], alphaPri );
+            alphaDual = psd::MaxStep( Z[j], dZ[j], alphaDual );
+        }
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.print && commRank == 0 )
+            Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            Axpy( alphaPri, dX[j], X[j] );
+            Axpy( alphaDual, dZ[j], Z[j] );
+            MakeSymmetric( LOWER, X[j] );
+            MakeSymmetric( LOWER, Z[j] );
+        }
+        Axpy( alphaDual, dy, y );
+        if( alphaPri == Real(0) && alphaDual == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+
+    if( ctrl.outerEquil )
+    {
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            X[j] *= bScale;
+            Z[j] *= CScale;
+        }
+        y *= CScale;
+    }
+}
+
+#define PROTO(Real) \
+  template void Mehrotra \
+  ( const vector<Matrix<Real>>& A, \
+    const Matrix<Real>& b, \
+    const vector<Matrix<Real>>& C, \
+          vector<Matrix<Real>>& X, \
+          Matrix<Real>& y, \
+          vector<Matrix<Real>>& Z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const vector<DistMatrix<Real>>& A, \
+    const ElementalMatrix<Real>& b, \
+    const vector<DistMatrix<Real>>& C, \
+          vector<DistMatrix<Real>>& X, \
+          ElementalMatrix<Real>& y, \
+          vector<DistMatrix<Real>>& Z, \
+    const MehrotraCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+// The constraints of a block-diagonal SDP are stored such that the columns of
+// A[j], which is n_j^2 x m, are the (column-major) vectorizations of the j'th
+// diagonal blocks of the m (symmetric) constraint matrices A_0, ..., A_{m-1}.
+
+// Constraint operator
+// ===================
+// y := alpha [<A_0,X>; ...; <A_{m-1},X>] + beta y
+template<typename Real>
+void ApplyOperator
+( Real alpha,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& X,
+  Real beta,
+        Matrix<Real>& y );
+template<typename Real>
+void ApplyOperator
+( Real alpha,
+  const vector<DistMatrix<Real>>& A,
+  const vector<DistMatrix<Real>>& X,
+  Real beta,
+        DistMatrix<Real>& y );
+
+// Z := alpha sum_i y(i) A_i + beta Z
+template<typename Real>
+void ApplyAdjoint
+( Real alpha,
+  const vector<Matrix<Real>>& A,
+  const Matrix<Real>& y,
+  Real beta,
+        vector<Matrix<Real>>& Z );
+template<typename Real>
+void ApplyAdjoint
+( Real alpha,
+  const vector<DistMatrix<Real>>& A,
+  const DistMatrix<Real>& y,
+  Real beta,
+        vector<DistMatrix<Real>>& Z );
+
+// Initialize
+// ==========
+// Unless they were provided by the user, set X := xi I, y := 0, and
+// Z := eta I, where xi and eta are chosen as in SDPT3 so that the initial
+// point is well-balanced relative to the problem data.
+template<typename Real>
+void Initialize
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& b,
+  const vector<Matrix<Real>>& C,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  bool primalInit, bool dualInit );
+template<typename Real>
+void Initialize
+( const vector<DistMatrix<Real>>& A,
+  const DistMatrix<Real>& b,
+  const vector<DistMatrix<Real>>& C,
+        vector<DistMatrix<Real>>& X,
+        DistMatrix<Real>& y,
+        vector<DistMatrix<Real>>& Z,
+  bool primalInit, bool dualInit );
+
+// Schur complement
+// ================
+// Form the lower triangle of the m x m Schur complement,
+//
+//   M(i,k) = <A_i, W A_k W> = <R^T A_i R, R^T A_k R>,
+//
+// where W = R R^T is the (block-diagonal) Nesterov-Todd scaling point and
+// the j'th block of AWide is the n_j x (n_j m) matrix
+// [A_0[j], ..., A_{m-1}[j]]. The congruences R^T A_i R are formed with Gemm
+// and, after stacking their vectorizations as the columns of G,
+// M := sum_j G_j^T G_j is accumulated with Syrk.
+template<typename Real>
+void SchurComplement
+( Int m,
+  const vector<Matrix<Real>>& AWide,
+  const vector<Matrix<Real>>& R,
+        Matrix<Real>& M );
+template<typename Real>
+void SchurComplement
+( Int m,
+  const vector<DistMatrix<Real>>& AWide,
+  const vector<DistMatrix<Real>>& R,
+        DistMatrix<Real>& M );
+
+// Congruence
+// ==========
+// B := R A R^T if orientation is NORMAL and B := R^T A R otherwise
+template<typename Real>
+void Congruence
+( Orientation orientation,
+  const Matrix<Real>& R,
+  const Matrix<Real>& A,
+        Matrix<Real>& B );
+template<typename Real>
+void Congruence
+( Orientation orientation,
+  const DistMatrix<Real>& R,
+  const DistMatrix<Real>& A,
+        DistMatrix<Real>& B );
+
+// Search direction
+// ================
+// Given the Cholesky factor of the Schur complement, solve
+//
+//   A(dX) = -rb,
+//   A^*(dy) - dZ = -rc,
+//   R^{-1} dX R^{-T} + R^T dZ R = Y,
+//
+// where Y is the (scaled) right-hand side of the linearized complementarity
+// condition, via
+//
+//   M dy = rb + A(R (Y - R^T rc R) R^T),
+//   dZ = rc + A^*(dy),
+//   dX = R (Y - R^T dZ R) R^T.
+template<typename Real>
+void SolveDirection
+( const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& R,
+  const Matrix<Real>& M,
+  const Matrix<Real>& rb,
+  const vector<Matrix<Real>>& rc,
+  const vector<Matrix<Real>>& Y,
+        vector<Matrix<Real>>& dX,
+        Matrix<Real>& dy,
+        vector<Matrix<Real>>& dZ );
+template<typename Real>
+void SolveDirection
+( const vector<DistMatrix<Real>>& A,
+  const vector<DistMatrix<Real>>& R,
+  const DistMatrix<Real>& M,
+  const DistMatrix<Real>& rb,
+  const vector<DistMatrix<Real>>& rc,
+  const vector<DistMatrix<Real>>& Y,
+        vector<DistMatrix<Real>>& dX,
+        DistMatrix<Real>& dy,
+        vector<DistMatrix<Real>>& dZ );
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
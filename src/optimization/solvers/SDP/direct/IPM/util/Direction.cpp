@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../util.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+template<typename Real>
+void Congruence
+( Orientation orientation,
+  const Matrix<Real>& R,
+  const Matrix<Real>& A,
+        Matrix<Real>& B )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Congruence"))
+    Matrix<Real> T;
+    if( orientation == NORMAL )
+    {
+        Gemm( NORMAL, TRANSPOSE, Real(1), A, R, T );
+        Gemm( NORMAL, NORMAL, Real(1), R, T, B );
+    }
+    else
+    {
+        Gemm( NORMAL, NORMAL, Real(1), A, R, T );
+        Gemm( TRANSPOSE, NORMAL, Real(1), R, T, B );
+    }
+}
+
+template<typename Real>
+void Congruence
+( Orientation orientation,
+  const DistMatrix<Real>& R,
+  const DistMatrix<Real>& A,
+        DistMatrix<Real>& B )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Congruence"))
+    DistMatrix<Real> T( R.Grid() );
+    if( orientation == NORMAL )
+    {
+        Gemm( NORMAL, TRANSPOSE, Real(1), A, R, T );
+        Gemm( NORMAL, NORMAL, Real(1), R, T, B );
+    }
+    else
+    {
+        Gemm( NORMAL, NORMAL, Real(1), A, R, T );
+        Gemm( TRANSPOSE, NORMAL, Real(1), R, T, B );
+    }
+}
+
+template<typename Real>
+void SolveDirection
+( const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& R,
+  const Matrix<Real>& M,
+  const Matrix<Real>& rb,
+  const vector<Matrix<Real>>& rc,
+  const vector<Matrix<Real>>& Y,
+        vector<Matrix<Real>>& dX,
+        Matrix<Real>& dy,
+        vector<Matrix<Real>>& dZ )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::SolveDirection"))
+    const Int numBlocks = A.size();
+
+    // dy := inv(M) (rb + A(R (Y - R^T rc R) R^T))
+    // ===========================================
+    Matrix<Real> H;
+    vector<Matrix<Real>> K( numBlocks );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        Congruence( TRANSPOSE, R[j], rc[j], H );
+        H *= -1;
+        H += Y[j];
+        Congruence( NORMAL, R[j], H, K[j] );
+    }
+    dy = rb;
+    ApplyOperator( Real(1), A, K, Real(1), dy );
+    cholesky::SolveAfter( LOWER, NORMAL, M, dy );
+
+    // dZ := rc + A^*(dy)
+    // ==================
+    dZ = rc;
+    ApplyAdjoint( Real(1), A, dy, Real(1), dZ );
+
+    // dX := R (Y - R^T dZ R) R^T
+    // ==========================
+    dX.resize( numBlocks );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        Congruence( TRANSPOSE, R[j], dZ[j], H );
+        H *= -1;
+        H += Y[j];
+        Congruence( NORMAL, R[j], H, dX[j] );
+    }
+}
+
+template<typename Real>
+void SolveDirection
+( const vector<DistMatrix<Real>>& A,
+  const vector<DistMatrix<Real>>& R,
+  const DistMatrix<Real>& M,
+  const DistMatrix<Real>& rb,
+  const vector<DistMatrix<Real>>& rc,
+  const vector<DistMatrix<Real>>& Y,
+        vector<DistMatrix<Real>>& dX,
+        DistMatrix<Real>& dy,
+        vector<DistMatrix<Real>>& dZ )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::SolveDirection"))
+    const Int numBlocks = A.size();
+    const Grid& g = M.Grid();
+
+    // dy := inv(M) (rb + A(R (Y - R^T rc R) R^T))
+    // ===========================================
+    DistMatrix<Real> H(g);
+    vector<DistMatrix<Real>> K( numBlocks, DistMatrix<Real>(g) );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        Congruence( TRANSPOSE, R[j], rc[j], H );
+        H *= -1;
+        H += Y[j];
+        Congruence( NORMAL, R[j], H, K[j] );
+    }
+    dy = rb;
+    ApplyOperator( Real(1), A, K, Real(1), dy );
+    cholesky::SolveAfter( LOWER, NORMAL, M, dy );
+
+    // dZ := rc + A^*(dy)
+    // ==================
+    dZ = rc;
+    ApplyAdjoint( Real(1), A, dy, Real(1), dZ );
+
+    // dX := R (Y - R^T dZ R) R^T
+    // ==========================
+    dX.resize( numBlocks, DistMatrix<Real>(g) );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        Congruence( TRANSPOSE, R[j], dZ[j], H );
+        H *= -1;
+        H += Y[j];
+        Congruence( NORMAL, R[j], H, dX[j] );
+    }
+}
+
+#define PROTO(Real) \
+  template void Congruence \
+  ( Orientation orientation, \
+    const Matrix<Real>& R, \
+    const Matrix<Real>& A, \
+          Matrix<Real>& B ); \
+  template void Congruence \
+  ( Orientation orientation, \
+    const DistMatrix<Real>& R, \
+    const DistMatrix<Real>& A, \
+          DistMatrix<Real>& B ); \
+  template void SolveDirection \
+  ( const vector<Matrix<Real>>& A, \
+    const vector<Matrix<Real>>& R, \
+    const Matrix<Real>& M, \
+    const Matrix<Real>& rb, \
+    const vector<Matrix<Real>>& rc, \
+    const vector<Matrix<Real>>& Y, \
+          vector<Matrix<Real>>& dX, \
+          Matrix<Real>& dy, \
+          vector<Matrix<Real>>& dZ ); \
+  template void SolveDirection \
+  ( const vector<DistMatrix<Real>>& A, \
+    const vector<DistMatrix<Real>>& R, \
+    const DistMatrix<Real>& M, \
+    const DistMatrix<Real>& rb, \
+    const vector<DistMatrix<Real>>& rc, \
+    const vector<DistMatrix<Real>>& Y, \
+          vector<DistMatrix<Real>>& dX, \
+          DistMatrix<Real>& dy, \
+          vector<DistMatrix<Real>>& dZ );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../util.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+// Following SDPT3 [1], the initial point is
+//
+//   X := xi I, y := 0, Z := eta I,
+//
+// with
+//
+//   xi  = max(10, sqrt(n), n max_i (1 + |b_i|) / (1 + || A_i ||_F)),
+//   eta = max(10, sqrt(n), max_i || A_i ||_F, || C ||_F),
+//
+// where n is the sum of the orders of the blocks.
+//
+// [1] K.C. Toh, M.J. Todd, and R.H. Tutuncu,
+//     "SDPT3 -- a Matlab software package for semidefinite programming",
+//     Optimization Methods and Software, 11, pp. 545--581, 1999.
+//
+
+template<typename Real>
+void Initialize
+( const vector<Matrix<Real>>& A,
+  const Matrix<Real>& b,
+  const vector<Matrix<Real>>& C,
+        vector<Matrix<Real>>& X,
+        Matrix<Real>& y,
+        vector<Matrix<Real>>& Z,
+  bool primalInit, bool dualInit )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Initialize"))
+    const Int numBlocks = A.size();
+    const Int m = b.Height();
+    if( primalInit && dualInit )
+        return;
+
+    Int degree = 0;
+    Real CFrobSquared = 0;
+    Matrix<Real> ANormsSquared, colNorms;
+    Zeros( ANormsSquared, m, 1 );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        degree += C[j].Height();
+        const Real CFrob = FrobeniusNorm( C[j] );
+        CFrobSquared += CFrob*CFrob;
+        ColumnTwoNorms( A[j], colNorms );
+        for( Int i=0; i<m; ++i )
+            ANormsSquared.Update( i, 0, colNorms.Get(i,0)*colNorms.Get(i,0) );
+    }
+
+    const Real minShift = Max(Real(10),Sqrt(Real(degree)));
+    Real xi = minShift;
+    Real eta = Max(minShift,Sqrt(CFrobSquared));
+    for( Int i=0; i<m; ++i )
+    {
+        const Real ANorm = Sqrt(ANormsSquared.Get(i,0));
+        xi = Max(xi,degree*(1+Abs(b.Get(i,0)))/(1+ANorm));
+        eta = Max(eta,ANorm);
+    }
+
+    if( !primalInit )
+    {
+        X.resize( numBlocks );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            Identity( X[j], n, n );
+            X[j] *= xi;
+        }
+    }
+    if( !dualInit )
+    {
+        Zeros( y, m, 1 );
+        Z.resize( numBlocks );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            Identity( Z[j], n, n );
+            Z[j] *= eta;
+        }
+    }
+}
+
+template<typename Real>
+void Initialize
+( const vector<DistMatrix<Real>>& A,
+  const DistMatrix<Real>& b,
+  const vector<DistMatrix<Real>>& C,
+        vector<DistMatrix<Real>>& X,
+        DistMatrix<Real>& y,
+        vector<DistMatrix<Real>>& Z,
+  bool primalInit, bool dualInit )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::Initialize"))
+    const Int numBlocks = A.size();
+    const Int m = b.Height();
+    const Grid& g = b.Grid();
+    if( primalInit && dualInit )
+        return;
+
+    Int degree = 0;
+    Real CFrobSquared = 0;
+    Matrix<Real> ANormsSquared;
+    Zeros( ANormsSquared, m, 1 );
+    DistMatrix<Real,MR,STAR> colNorms(g);
+    DistMatrix<Real,STAR,STAR> colNorms_STAR_STAR(g);
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        degree += C[j].Height();
+        const Real CFrob = FrobeniusNorm( C[j] );
+        CFrobSquared += CFrob*CFrob;
+        ColumnTwoNorms( A[j], colNorms );
+        colNorms_STAR_STAR = colNorms;
+        for( Int i=0; i<m; ++i )
+        {
+            const Real colNorm = colNorms_STAR_STAR.GetLocal(i,0);
+            ANormsSquared.Update( i, 0, colNorm*colNorm );
+        }
+    }
+    DistMatrix<Real,STAR,STAR> b_STAR_STAR( b );
+
+    const Real minShift = Max(Real(10),Sqrt(Real(degree)));
+    Real xi = minShift;
+    Real eta = Max(minShift,Sqrt(CFrobSquared));
+    for( Int i=0; i<m; ++i )
+    {
+        const Real ANorm = Sqrt(ANormsSquared.Get(i,0));
+        xi = Max(xi,degree*(1+Abs(b_STAR_STAR.GetLocal(i,0)))/(1+ANorm));
+        eta = Max(eta,ANorm);
+    }
+
+    if( !primalInit )
+    {
+        X.clear();
+        X.reserve( numBlocks );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            X.emplace_back( g );
+            Identity( X[j], n, n );
+            X[j] *= xi;
+        }
+    }
+    if( !dualInit )
+    {
+        Zeros( y, m, 1 );
+        Z.clear();
+        Z.reserve( numBlocks );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            const Int n = C[j].Height();
+            Z.emplace_back( g );
+            Identity( Z[j], n, n );
+            Z[j] *= eta;
+        }
+    }
+}
+
+#define PROTO(Real) \
+  template void Initialize \
+  ( const vector<Matrix<Real>>& A, \
+    const Matrix<Real>& b, \
+    const vector<Matrix<Real>>& C, \
+          vector<Matrix<Real>>& X, \
+          Matrix<Real>& y, \
+          vector<Matrix<Real>>& Z, \
+    bool primalInit, bool dualInit ); \
+  template void Initialize \
+  ( const vector<DistMatrix<Real>>& A, \
+    const DistMatrix<Real>& b, \
+    const vector<DistMatrix<Real>>& C, \
+          vector<DistMatrix<Real>>& X, \
+          DistMatrix<Real>& y, \
+          vector<DistMatrix<Real>>& Z, \
+    bool primalInit, bool dualInit );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
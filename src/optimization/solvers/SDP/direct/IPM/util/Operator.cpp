@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../util.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+template<typename Real>
+void ApplyOperator
+( Real alpha,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& X,
+  Real beta,
+        Matrix<Real>& y )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::ApplyOperator"))
+    const Int numBlocks = A.size();
+    const Int m = A[0].Width();
+    if( beta == Real(0) )
+        Zeros( y, m, 1 );
+    else
+        y *= beta;
+
+    Matrix<Real> xVec;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = X[j].Height();
+        Reshape( n*n, 1, X[j], xVec );
+        Gemv( TRANSPOSE, alpha, A[j], xVec, Real(1), y );
+    }
+}
+
+template<typename Real>
+void ApplyOperator
+( Real alpha,
+  const vector<DistMatrix<Real>>& A,
+  const vector<DistMatrix<Real>>& X,
+  Real beta,
+        DistMatrix<Real>& y )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::ApplyOperator"))
+    const Int numBlocks = A.size();
+    const Int m = A[0].Width();
+    if( beta == Real(0) )
+        Zeros( y, m, 1 );
+    else
+        y *= beta;
+
+    DistMatrix<Real> xVec( y.Grid() );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = X[j].Height();
+        Reshape( n*n, 1, X[j], xVec );
+        Gemv( TRANSPOSE, alpha, A[j], xVec, Real(1), y );
+    }
+}
+
+template<typename Real>
+void ApplyAdjoint
+( Real alpha,
+  const vector<Matrix<Real>>& A,
+  const Matrix<Real>& y,
+  Real beta,
+        vector<Matrix<Real>>& Z )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::ApplyAdjoint"))
+    const Int numBlocks = A.size();
+    Matrix<Real> zVec, T;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = Z[j].Height();
+        Gemv( NORMAL, alpha, A[j], y, zVec );
+        Reshape( n, n, zVec, T );
+        if( beta == Real(0) )
+        {
+            Z[j] = T;
+        }
+        else
+        {
+            Z[j] *= beta;
+            Z[j] += T;
+        }
+    }
+}
+
+template<typename Real>
+void ApplyAdjoint
+( Real alpha,
+  const vector<DistMatrix<Real>>& A,
+  const DistMatrix<Real>& y,
+  Real beta,
+        vector<DistMatrix<Real>>& Z )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::ApplyAdjoint"))
+    const Int numBlocks = A.size();
+    DistMatrix<Real> zVec( y.Grid() ), T( y.Grid() );
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = Z[j].Height();
+        Gemv( NORMAL, alpha, A[j], y, zVec );
+        Reshape( n, n, zVec, T );
+        if( beta == Real(0) )
+        {
+            Z[j] = T;
+        }
+        else
+        {
+            Z[j] *= beta;
+            Z[j] += T;
+        }
+    }
+}
+
+#define PROTO(Real) \
+  template void ApplyOperator \
+  ( Real alpha, \
+    const vector<Matrix<Real>>& A, \
+    const vector<Matrix<Real>>& X, \
+    Real beta, \
+          Matrix<Real>& y ); \
+  template void ApplyOperator \
+  ( Real alpha, \
+    const vector<DistMatrix<Real>>& A, \
+    const vector<DistMatrix<Real>>& X, \
+    Real beta, \
+          DistMatrix<Real>& y ); \
+  template void ApplyAdjoint \
+  ( Real alpha, \
+    const vector<Matrix<Real>>& A, \
+    const Matrix<Real>& y, \
+    Real beta, \
+          vector<Matrix<Real>>& Z ); \
+  template void ApplyAdjoint \
+  ( Real alpha, \
+    const vector<DistMatrix<Real>>& A, \
+    const DistMatrix<Real>& y, \
+    Real beta, \
+          vector<DistMatrix<Real>>& Z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../util.hpp"
+
+namespace El {
+namespace sdp {
+namespace direct {
+
+// For each block, the left half of each of the m congruences is applied
+// with a single n x n x (n m) Gemm, the right halves with m n x n x n Gemm's,
+// and the Gramian of their vectorizations with an (n^2) x m Syrk, so that
+// essentially all of the O(m n^3 + m^2 n^2) work is BLAS-3.
+
+template<typename Real>
+void SchurComplement
+( Int m,
+  const vector<Matrix<Real>>& AWide,
+  const vector<Matrix<Real>>& R,
+        Matrix<Real>& M )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::SchurComplement"))
+    const Int numBlocks = AWide.size();
+    Zeros( M, m, m );
+
+    Matrix<Real> T, GWide, G;
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = R[j].Height();
+        if( n == 0 )
+            continue;
+
+        // T := R^T [A_0, ..., A_{m-1}]
+        Gemm( TRANSPOSE, NORMAL, Real(1), R[j], AWide[j], T );
+
+        // GWide := [R^T A_0 R, ..., R^T A_{m-1} R]
+        Zeros( GWide, n, n*m );
+        for( Int i=0; i<m; ++i )
+        {
+            const IR blockInd( i*n, (i+1)*n );
+            auto Ti = T( ALL, blockInd );
+            auto Gi = GWide( ALL, blockInd );
+            Gemm( NORMAL, NORMAL, Real(1), Ti, R[j], Real(0), Gi );
+        }
+
+        // M += G^T G, where G = [vec(R^T A_0 R), ..., vec(R^T A_{m-1} R)]
+        Reshape( n*n, m, GWide, G );
+        Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), M );
+    }
+}
+
+template<typename Real>
+void SchurComplement
+( Int m,
+  const vector<DistMatrix<Real>>& AWide,
+  const vector<DistMatrix<Real>>& R,
+        DistMatrix<Real>& M )
+{
+    DEBUG_ONLY(CSE cse("sdp::direct::SchurComplement"))
+    const Int numBlocks = AWide.size();
+    const Grid& g = M.Grid();
+    Zeros( M, m, m );
+
+    DistMatrix<Real> T(g), GWide(g), G(g);
+    for( Int j=0; j<numBlocks; ++j )
+    {
+        const Int n = R[j].Height();
+        if( n == 0 )
+            continue;
+
+        // T := R^T [A_0, ..., A_{m-1}]
+        Gemm( TRANSPOSE, NORMAL, Real(1), R[j], AWide[j], T );
+
+        // GWide := [R^T A_0 R, ..., R^T A_{m-1} R]
+        Zeros( GWide, n, n*m );
+        for( Int i=0; i<m; ++i )
+        {
+            const IR blockInd( i*n, (i+1)*n );
+            auto Ti = T( ALL, blockInd );
+            auto Gi = GWide( ALL, blockInd );
+            Gemm( NORMAL, NORMAL, Real(1), Ti, R[j], Real(0), Gi );
+        }
+
+        // M += G^T G, where G = [vec(R^T A_0 R), ..., vec(R^T A_{m-1} R)]
+        Reshape( n*n, m, GWide, G );
+        Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), M );
+    }
+}
+
+#define PROTO(Real) \
+  template void SchurComplement \
+  ( Int m, \
+    const vector<Matrix<Real>>& AWide, \
+    const vector<Matrix<Real>>& R, \
+          Matrix<Real>& M ); \
+  template void SchurComplement \
+  ( Int m, \
+    const vector<DistMatrix<Real>>& AWide, \
+    const vector<DistMatrix<Real>>& R, \
+          DistMatrix<Real>& M );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace direct
+} // namespace sdp
+} // namespace El
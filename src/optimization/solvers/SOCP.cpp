@@ -180,7 +180,15 @@ void SOCP
   const socp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("SOCP"))
-    if( ctrl.approach == SOCP_MEHROTRA )
+    if( ctrl.approach == SOCP_ADMM )
+    {
+        DistSparseMatrix<Real> Q(A.Comm());
+        Zeros( Q, A.Width(), A.Width() );
+        splitting::ADMM
+        ( Q, A, G, b, c, h, orders, firstInds, x, y, z, s,
+          ctrl.splittingCtrl );
+    }
+    else if( ctrl.approach == SOCP_MEHROTRA )
         socp::affine::Mehrotra
         ( A, G, b, c, h, orders, firstInds, x, y, z, s,
           ctrl.mehrotraCtrl );
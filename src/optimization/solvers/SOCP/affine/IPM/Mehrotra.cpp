@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 #include "./util.hpp"
+#include "../../../Gondzio.hpp"
 
 namespace El {
 namespace socp {
@@ -120,10 +121,12 @@ void Mehrotra
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
                  dx,    dy,    dz,    ds,
-                 dzAffScaled, dsAffScaled;
+                 dzAffScaled, dsAffScaled,
+                 dxCand, dyCand, dzCand, dsCand;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -200,6 +203,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
         Real wMaxNorm = MaxNorm(w);
         const Real wMaxNormLimit = 
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
@@ -246,6 +250,8 @@ void Mehrotra
         soc::ApplyQuadratic( wRoot, dzAff, dzAffScaled, orders, firstInds );
         soc::ApplyQuadratic( wRootInv, dsAff, dsAffScaled, orders, firstInds );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -321,10 +327,23 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS( rc, rb, rh, rmu, wRoot, orders, firstInds, d );
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS( rc, rb, rh, rmuStep, wRoot, orders, firstInds, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution
+              ( m, n, d, rmuStep, wRoot, orders, firstInds,
+                dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -334,8 +353,22 @@ void Mehrotra
                 ("Solve failed with rel. error ",relError,
                  " which does not meet the minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::SOCCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          wRoot, wRootInv, l, lInv, orders, firstInds,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // TODO: Residual checks
 
@@ -483,7 +516,8 @@ void Mehrotra
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
                      dx(grid),    dy(grid),    dz(grid),    ds(grid),
-                     dsAffScaled(grid), dzAffScaled(grid);
+                     dsAffScaled(grid), dzAffScaled(grid),
+                     dxCand(grid), dyCand(grid), dzCand(grid), dsCand(grid);
     w.AlignWith( s );
     wRoot.AlignWith( s );
     wRootInv.AlignWith( s );
@@ -493,12 +527,15 @@ void Mehrotra
     dzAff.AlignWith( s );
     ds.AlignWith( s );
     dz.AlignWith( s );
+    dsCand.AlignWith( s );
+    dzCand.AlignWith( s );
     rmu.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> 
       dxError(grid), dyError(grid), dzError(grid), dmuError(grid);
     dzError.AlignWith( s );
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -575,6 +612,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
         Real wMaxNorm = MaxNorm(w);
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
@@ -625,6 +663,8 @@ void Mehrotra
         soc::ApplyQuadratic
         ( wRootInv, dsAff, dsAffScaled, orders, firstInds, cutoffPar );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -704,11 +744,24 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot, orders, firstInds, d, cutoffPar );
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMatrix<Real>& rmuStep,
+               DistMatrix<Real>& dxStep,
+               DistMatrix<Real>& dyStep,
+               DistMatrix<Real>& dzStep,
+               DistMatrix<Real>& dsStep )
+          {
+              KKTRHS
+              ( rc, rb, rh, rmuStep, wRoot, orders, firstInds, d, cutoffPar );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution
+              ( m, n, d, rmuStep, wRoot, orders, firstInds,
+                dxStep, dyStep, dzStep, dsStep, cutoffPar );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -718,9 +771,22 @@ void Mehrotra
                 ("Solve failed with rel. error ",relError,
                  " which does not meet the minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, orders, firstInds, dx, dy, dz, ds,
-          cutoffPar );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, grid.Comm() );
+        const Int numAccepted = gondzio::SOCCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          wRoot, wRootInv, l, lInv, orders, firstInds,
+          [&]( const DistMatrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
         // TODO: Residual checks
 
         // Update the current estimates
@@ -872,7 +938,8 @@ void Mehrotra
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
                  dx,    dy,    dz,    ds,
-                 dzAffScaled, dsAffScaled;
+                 dzAffScaled, dsAffScaled,
+                 dxCand, dyCand, dzCand, dsCand;
 
     // TODO: Expose regularization rules to user
     Matrix<Real> regTmp;
@@ -922,6 +989,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1000,6 +1068,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
         if( wMaxNorm > wMaxNormLimit )
@@ -1075,6 +1144,8 @@ void Mehrotra
         soc::ApplyQuadratic( wRoot, dzAff, dzAffScaled, orders, firstInds );
         soc::ApplyQuadratic( wRootInv, dsAff, dsAffScaled, orders, firstInds );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             dxError = rb;
@@ -1153,23 +1224,36 @@ void Mehrotra
             Axpy( -sigma*mu, lInv, rmu );
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot, 
-          orders, firstInds, origToSparseFirstInds, kSparse, d );
-        try 
-        {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
-                  ctrl.solveCtrl.progress );
-        } 
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const Matrix<Real>& rmuStep,
+               Matrix<Real>& dxStep,
+               Matrix<Real>& dyStep,
+               Matrix<Real>& dzStep,
+               Matrix<Real>& dsStep )
+          {
+              KKTRHS
+              ( rc, rb, rh, rmuStep, wRoot, 
+                orders, firstInds, origToSparseFirstInds, kSparse, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
+                    ctrl.solveCtrl.progress );
+              ExpandSolution
+              ( m, n, d, rmuStep, wRoot, 
+                orders, firstInds, 
+                sparseOrders, sparseFirstInds,
+                sparseToOrigOrders, sparseToOrigFirstInds,
+                dxStep, dyStep, dzStep, dsStep );
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError < ctrl.minTol )
@@ -1179,12 +1263,22 @@ void Mehrotra
                 ("Solve failed with rel. error ",relError,
                  " which does not meet the minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, 
-          orders, firstInds, 
-          sparseOrders, sparseFirstInds,
-          sparseToOrigOrders, sparseToOrigFirstInds,
-          dx, dy, dz, ds );
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime );
+        const Int numAccepted = gondzio::SOCCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          wRoot, wRootInv, l, lInv, orders, firstInds,
+          [&]( const Matrix<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
@@ -1270,7 +1364,7 @@ void Mehrotra
     const Int degree = soc::Degree( firstInds );
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer, iterTimer;
+    Timer timer, iterTimer, gondzioTimer;
 
     DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
     if( ctrl.outerEquil )
@@ -1357,7 +1451,8 @@ void Mehrotra
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
                        dx(comm),    dy(comm),    dz(comm),    ds(comm),
-                       dzAffScaled(comm), dsAffScaled(comm);
+                       dzAffScaled(comm), dsAffScaled(comm),
+                       dxCand(comm), dyCand(comm), dzCand(comm), dsCand(comm);
 
     // Form the regularization vectors
     // ===============================
@@ -1509,6 +1604,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        gondzioTimer.Start();
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
         if( ctrl.print && commRank == 0 )
@@ -1628,6 +1724,8 @@ void Mehrotra
         soc::ApplyQuadratic
         ( wRootInv, dsAff, dsAffScaled, orders, firstInds, cutoffPar );
 
+        const double factTime = gondzioTimer.Stop();
+
         if( ctrl.checkResiduals && ctrl.print )
         {
             if( ctrl.time && commRank == 0 )
@@ -1724,28 +1822,45 @@ void Mehrotra
         if( ctrl.time && commRank == 0 )
             Output("r_mu formation: ",timer.Stop()," secs");
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS
-        ( rc, rb, rh, rmu, wRoot, 
-          orders, firstInds, origToSparseFirstInds, kSparse,
-          d, cutoffPar );
-        try
-        {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
-                  ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
-                  ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
-        }
+        // Construct the new KKT RHS and solve with the existing factorization
+        // -------------------------------------------------------------------
+        auto solveCombined =
+          [&]( const DistMultiVec<Real>& rmuStep,
+               DistMultiVec<Real>& dxStep,
+               DistMultiVec<Real>& dyStep,
+               DistMultiVec<Real>& dzStep,
+               DistMultiVec<Real>& dsStep )
+          {
+              KKTRHS
+              ( rc, rb, rh, rmuStep, wRoot, 
+                orders, firstInds, origToSparseFirstInds, kSparse,
+                d, cutoffPar );
+              if( commRank == 0 && ctrl.time )
+                  timer.Start();
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
+                    ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
+                    ctrl.solveCtrl.progress );
+              if( commRank == 0 && ctrl.time )
+                  Output("Corrector solver: ",timer.Stop()," secs");
+              if( ctrl.time && commRank == 0 )
+                  timer.Start();
+              ExpandSolution
+              ( m, n, d, rmuStep, wRoot, 
+                orders, firstInds, 
+                sparseOrders, sparseFirstInds,
+                sparseToOrigOrders, sparseToOrigFirstInds,
+                dxStep, dyStep, dzStep, dsStep, cutoffPar );
+              if( ctrl.time && commRank == 0 )
+                  Output("ExpandSolution: ",timer.Stop()," secs");
+          };
+        gondzioTimer.Start();
+        try { solveCombined( rmu, dx, dy, dz, ds ); }
         catch(...)
         {
             if( relError < ctrl.minTol )
@@ -1755,16 +1870,22 @@ void Mehrotra
                 ("Solve failed with rel. error ",relError,
                  " which does not meet the minimum tolerance of ",ctrl.minTol);
         }
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
-        ExpandSolution
-        ( m, n, d, rmu, wRoot, 
-          orders, firstInds, 
-          sparseOrders, sparseFirstInds,
-          sparseToOrigOrders, sparseToOrigFirstInds,
-          dx, dy, dz, ds, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("ExpandSolution: ",timer.Stop()," secs");
+        const double solveTime = gondzioTimer.Stop();
+
+        // Apply Gondzio's centrality correctors
+        // -------------------------------------
+        const Int numCorrectors =
+          gondzio::NumCorrectors( ctrl, factTime, solveTime, comm );
+        const Int numAccepted = gondzio::SOCCorrectors
+        ( ctrl, numCorrectors, sigma*mu, s, z, ds, dz, dsCand, dzCand, rmu,
+          wRoot, wRootInv, l, lInv, orders, firstInds,
+          [&]( const DistMultiVec<Real>& rmuCand )
+          { solveCombined( rmuCand, dxCand, dyCand, dzCand, dsCand ); },
+          [&]() { dx = dxCand; dy = dyCand; dz = dzCand; ds = dsCand; } );
+        if( ctrl.print && numCorrectors > 0 && commRank == 0 )
+            Output
+            ("Accepted ",numAccepted," of ",numCorrectors,
+             " Gondzio correctors");
 
         // Update the current estimates
         // ============================
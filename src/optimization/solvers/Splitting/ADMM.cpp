@@ -0,0 +1,752 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "../QP/affine/IPM/util.hpp"
+
+namespace El {
+namespace splitting {
+
+// This is an adaptation of the operator-splitting QP solver of [1] to conic
+// constraints in the manner of [2]. Writing the constraints as
+//
+//   [A; G] x = zc, zc in C = {b} x (h - K),
+//
+// and letting rho be the diagonal matrix of step sizes (rho_A for the rows of
+// A and rho for the rows of G), each iteration computes
+//
+//   | Q + sigma I, [A;G]^T  | | xt | = | sigma x - c |
+//   |   [A;G],    -inv(rho) | | nu |   | 2 zc - w    |,
+//
+//   x := alpha xt + (1-alpha) x,
+//   w := w + alpha (zt - zc),  where zt = zc + inv(rho) (nu - y),
+//   zc := proj_C(w),  y := rho (w - zc),
+//
+// which is the Douglas-Rachford iteration on the pair (x,w) and is thus a
+// natural candidate for Anderson acceleration [3]. Since the projection onto
+// h - K is h - proj_K(h - w_G), the slack is s = proj_K(h - w_G).
+//
+// [1] B. Stellato, G. Banjac, P. Goulart, A. Bemporad, and S. Boyd,
+//     "OSQP: An operator splitting solver for quadratic programs", 2017.
+//
+// [2] B. O'Donoghue, E. Chu, N. Parikh, and S. Boyd, "Conic optimization via
+//     operator splitting and homogeneous self-dual embedding", Journal of
+//     Optimization Theory and Applications, 169(3), pp. 1042--1068, 2016.
+//
+// [3] J. Zhang, B. O'Donoghue, and S. Boyd, "Globally convergent type-I
+//     Anderson acceleration for non-smooth fixed-point iterations", 2018.
+//
+
+namespace {
+
+// Estimate the total number of nonzeros in the LDL factorization from the
+// symbolic analysis
+double NumFactorEntries( const ldl::DistNodeInfo& info, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("splitting::NumFactorEntries"))
+    double numLocalEntries = 0;
+    function<void(const ldl::NodeInfo&)> countLocal =
+      [&]( const ldl::NodeInfo& node )
+      {
+          for( const ldl::NodeInfo* child : node.children )
+              countLocal( *child );
+          const double n = node.size;
+          const double m = node.size + node.lowerStruct.size();
+          numLocalEntries += n*(n+1)/2 + (m-n)*n;
+      };
+    function<void(const ldl::DistNodeInfo&)> count =
+      [&]( const ldl::DistNodeInfo& node )
+      {
+          if( node.duplicate != nullptr )
+          {
+              countLocal( *node.duplicate );
+              return;
+          }
+          count( *node.child );
+          const double n = node.size;
+          const double m = node.size + node.lowerStruct.size();
+          numLocalEntries += (n*(n+1)/2 + (m-n)*n) / mpi::Size(node.comm);
+      };
+    count( info );
+    return mpi::AllReduce( numLocalEntries, comm );
+}
+
+// d := [dx; dA; dG]
+template<typename Real>
+void PackRHS
+( const DistMultiVec<Real>& dx,
+  const DistMultiVec<Real>& dA,
+  const DistMultiVec<Real>& dG,
+        DistMultiVec<Real>& d )
+{
+    DEBUG_ONLY(CSE cse("splitting::PackRHS"))
+    const Int n = dx.Height();
+    const Int m = dA.Height();
+    const Int k = dG.Height();
+    d.SetComm( dx.Comm() );
+    Zeros( d, n+m+k, 1 );
+
+    d.Reserve( dx.LocalHeight() + dA.LocalHeight() + dG.LocalHeight() );
+    for( Int iLoc=0; iLoc<dx.LocalHeight(); ++iLoc )
+        d.QueueUpdate( dx.GlobalRow(iLoc), 0, dx.GetLocal(iLoc,0) );
+    for( Int iLoc=0; iLoc<dA.LocalHeight(); ++iLoc )
+        d.QueueUpdate( n+dA.GlobalRow(iLoc), 0, dA.GetLocal(iLoc,0) );
+    for( Int iLoc=0; iLoc<dG.LocalHeight(); ++iLoc )
+        d.QueueUpdate( n+m+dG.GlobalRow(iLoc), 0, dG.GetLocal(iLoc,0) );
+    d.ProcessQueues();
+}
+
+// Type-II Anderson acceleration over a list of (identically distributed)
+// blocks: given the iterate u and f = F(u), f is overwritten with
+//
+//   f - dF gamma,  gamma = argmin || g - dG gamma ||_2,
+//
+// where g = f - u and the columns of dG and dF hold the differences of the
+// most recent residuals and images of F, respectively.
+template<typename Real>
+struct Anderson
+{
+    Int memory;
+    Real reg;
+    mpi::Comm comm;
+
+    Int numUpdates=0;
+    bool havePrev=false;
+    vector<Matrix<Real>> dG, dF, gPrev, fPrev;
+
+    Anderson( Int memory_, Real reg_, mpi::Comm comm_ )
+    : memory(memory_), reg(reg_), comm(comm_)
+    { }
+
+    void Reset()
+    {
+        numUpdates = 0;
+        havePrev = false;
+    }
+
+    void Extrapolate
+    ( const vector<const Matrix<Real>*>& u,
+      const vector<Matrix<Real>*>& f )
+    {
+        DEBUG_ONLY(CSE cse("splitting::Anderson::Extrapolate"))
+        const Int numBlocks = u.size();
+        if( memory <= 0 )
+            return;
+        if( Int(dG.size()) != numBlocks )
+        {
+            dG.resize( numBlocks );
+            dF.resize( numBlocks );
+            gPrev.resize( numBlocks );
+            fPrev.resize( numBlocks );
+            for( Int j=0; j<numBlocks; ++j )
+            {
+                Zeros( dG[j], u[j]->Height(), memory );
+                Zeros( dF[j], u[j]->Height(), memory );
+            }
+        }
+
+        // Append the newest differences (overwriting the oldest)
+        // ======================================================
+        vector<Matrix<Real>> g( numBlocks );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            g[j] = *f[j];
+            g[j] -= *u[j];
+        }
+        if( havePrev )
+        {
+            const Int col = numUpdates % memory;
+            for( Int j=0; j<numBlocks; ++j )
+            {
+                auto dGCol = dG[j]( ALL, IR(col) );
+                auto dFCol = dF[j]( ALL, IR(col) );
+                dGCol = g[j];
+                dGCol -= gPrev[j];
+                dFCol = *f[j];
+                dFCol -= fPrev[j];
+            }
+            ++numUpdates;
+        }
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            gPrev[j] = g[j];
+            fPrev[j] = *f[j];
+        }
+        havePrev = true;
+        const Int numCols = Min(numUpdates,memory);
+        if( numCols == 0 )
+            return;
+
+        // Solve the regularized normal equations for gamma
+        // ================================================
+        Matrix<Real> gram, gamma;
+        Zeros( gram, numCols, numCols );
+        Zeros( gamma, numCols, 1 );
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            auto dGAct = dG[j]( ALL, IR(0,numCols) );
+            Gemm( TRANSPOSE, NORMAL, Real(1), dGAct, dGAct, Real(1), gram );
+            Gemv( TRANSPOSE, Real(1), dGAct, g[j], Real(1), gamma );
+        }
+        mpi::AllReduce( gram.Buffer(), numCols*numCols, comm );
+        mpi::AllReduce( gamma.Buffer(), numCols, comm );
+        const Real gramNorm = FrobeniusNorm( gram );
+        if( gramNorm == Real(0) )
+            return;
+        ShiftDiagonal( gram, reg*gramNorm );
+        try
+        {
+            Cholesky( LOWER, gram );
+            cholesky::SolveAfter( LOWER, NORMAL, gram, gamma );
+        }
+        catch( const NonHPDMatrixException& )
+        {
+            Reset();
+            return;
+        }
+
+        // f := f - dF gamma
+        // =================
+        for( Int j=0; j<numBlocks; ++j )
+        {
+            auto dFAct = dF[j]( ALL, IR(0,numCols) );
+            Gemv( NORMAL, Real(-1), dFAct, gamma, Real(1), *f[j] );
+        }
+    }
+};
+
+} // anonymous namespace
+
+template<typename Real>
+Int ADMM
+( const DistSparseMatrix<Real>& QPre,
+  const DistSparseMatrix<Real>& APre,
+  const DistSparseMatrix<Real>& GPre,
+  const DistMultiVec<Real>& bPre,
+  const DistMultiVec<Real>& cPre,
+  const DistMultiVec<Real>& hPre,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+  const SplittingCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("splitting::ADMM"))
+    const Int cutoffPar = 1000;
+
+    auto Q = QPre;
+    auto A = APre;
+    auto G = GPre;
+    auto b = bPre;
+    auto c = cPre;
+    auto h = hPre;
+    const Int m = A.Height();
+    const Int k = G.Height();
+    const Int n = A.Width();
+    mpi::Comm comm = APre.Comm();
+    const int commRank = mpi::Rank(comm);
+    Timer timer;
+
+    // Equilibrate the problem in a manner which respects the cones
+    // ============================================================
+    DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
+    if( ctrl.outerEquil )
+    {
+        if( commRank == 0 && ctrl.time )
+            timer.Start();
+        cone::RuizEquil
+        ( A, G, dRowA, dRowG, dCol, orders, firstInds, cutoffPar, ctrl.print );
+        if( commRank == 0 && ctrl.time )
+            Output("cone::RuizEquil: ",timer.Stop()," secs");
+
+        DiagonalSolve( LEFT, NORMAL, dRowA, b );
+        DiagonalSolve( LEFT, NORMAL, dRowG, h );
+        DiagonalSolve( LEFT, NORMAL, dCol,  c );
+        DiagonalSolve( LEFT, NORMAL, dCol, Q );
+        DiagonalSolve( RIGHT, NORMAL, dCol, Q );
+        if( ctrl.primalInit )
+        {
+            DiagonalScale( LEFT, NORMAL, dCol,  x );
+            DiagonalSolve( LEFT, NORMAL, dRowG, s );
+        }
+        if( ctrl.dualInit )
+        {
+            DiagonalScale( LEFT, NORMAL, dRowA, y );
+            DiagonalScale( LEFT, NORMAL, dRowG, z );
+        }
+    }
+    else
+    {
+        Ones( dRowA, m, 1 );
+        Ones( dRowG, k, 1 );
+        Ones( dCol,  n, 1 );
+    }
+    if( !ctrl.primalInit )
+    {
+        Zeros( x, n, 1 );
+        Zeros( s, k, 1 );
+    }
+    if( !ctrl.dualInit )
+    {
+        Zeros( y, m, 1 );
+        Zeros( z, k, 1 );
+    }
+
+    const Real bNrm2 = Nrm2( b );
+    const Real cNrm2 = Nrm2( c );
+    const Real hNrm2 = Nrm2( h );
+
+    Real rho = Max(Min(ctrl.rho,ctrl.maxRho),ctrl.minRho);
+    Real rhoA = ctrl.equalityRhoScale*rho;
+
+    // Decide between the direct and indirect solvers
+    // ==============================================
+    bool direct = ( ctrl.solver != SPLITTING_INDIRECT );
+    DistSparseMatrix<Real> J(comm);
+    DistMap map, invMap;
+    ldl::DistSeparator rootSep;
+    ldl::DistNodeInfo info;
+    ldl::DistFront<Real> JFront;
+    if( direct )
+    {
+        qp::affine::StaticKKT
+        ( Q, A, G, Sqrt(ctrl.sigma), 1/Sqrt(rhoA), 1/Sqrt(rho), J, false );
+
+        if( commRank == 0 && ctrl.time )
+            timer.Start();
+        NestedDissection( J.LockedDistGraph(), map, rootSep, info );
+        InvertMap( map, invMap );
+        if( commRank == 0 && ctrl.time )
+            Output("ND: ",timer.Stop()," secs");
+
+        if( ctrl.solver == SPLITTING_AUTO )
+        {
+            const double numFactorEntries = NumFactorEntries( info, comm );
+            const double numKKTEntries = J.NumEntries();
+            if( numFactorEntries > ctrl.maxFillRatio*numKKTEntries )
+            {
+                direct = false;
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Predicted ",numFactorEntries," nonzeros in the factor "
+                     "of a KKT system with ",numKKTEntries," nonzeros, so "
+                     "falling back to the indirect solver");
+            }
+        }
+    }
+    auto factor = [&]()
+    {
+        if( commRank == 0 && ctrl.time )
+            timer.Start();
+        JFront.Pull( J, map, rootSep, info );
+        LDL( info, JFront, LDL_2D );
+        if( commRank == 0 && ctrl.time )
+            Output("LDL: ",timer.Stop()," secs");
+    };
+
+    // The diagonal of the reduced system, Q + sigma I + A^T rho_A A +
+    // G^T rho G, is used as a preconditioner for CG
+    DistMultiVec<Real> diagQ(comm), colNormsA(comm), colNormsG(comm);
+    DistMultiVec<Real> precond(comm);
+    if( direct )
+    {
+        factor();
+    }
+    else
+    {
+        Zeros( diagQ, n, 1 );
+        const Int firstLocalRow = Q.FirstLocalRow();
+        for( Int e=0; e<Q.NumLocalEntries(); ++e )
+            if( Q.Row(e) == Q.Col(e) )
+                diagQ.UpdateLocal( Q.Row(e)-firstLocalRow, 0, Q.Value(e) );
+        ColumnTwoNorms( A, colNormsA );
+        ColumnTwoNorms( G, colNormsG );
+    }
+    auto formPrecond = [&]()
+    {
+        precond = diagQ;
+        for( Int iLoc=0; iLoc<precond.LocalHeight(); ++iLoc )
+        {
+            const Real alphaA = colNormsA.GetLocal(iLoc,0);
+            const Real alphaG = colNormsG.GetLocal(iLoc,0);
+            precond.UpdateLocal
+            ( iLoc, 0, ctrl.sigma + rhoA*alphaA*alphaA + rho*alphaG*alphaG );
+        }
+    };
+    if( !direct )
+        formPrecond();
+
+    // xt := inv(Q + sigma I + A^T rho_A A + G^T rho G) r with
+    // Jacobi-preconditioned CG, warm-started from the input value of xt
+    DistMultiVec<Real> cgRes(comm), cgDir(comm), cgPrecRes(comm),
+                       cgProd(comm), cgTmpA(comm), cgTmpG(comm);
+    Real cgResidualTol = limits::Max<Real>();
+    auto reducedMultiply = [&]
+    ( const DistMultiVec<Real>& v, DistMultiVec<Real>& Kv )
+    {
+        Kv = v;
+        Kv *= ctrl.sigma;
+        Multiply( NORMAL, Real(1), Q, v, Real(1), Kv );
+        Zeros( cgTmpA, m, 1 );
+        Zeros( cgTmpG, k, 1 );
+        Multiply( NORMAL, Real(1), A, v, Real(0), cgTmpA );
+        Multiply( NORMAL, Real(1), G, v, Real(0), cgTmpG );
+        Multiply( TRANSPOSE, rhoA, A, cgTmpA, Real(1), Kv );
+        Multiply( TRANSPOSE, rho,  G, cgTmpG, Real(1), Kv );
+    };
+    auto cg = [&]( const DistMultiVec<Real>& r, DistMultiVec<Real>& xt )
+    {
+        const Real cgTol =
+          Min( ctrl.cgRelTol*Max(Nrm2(r),Real(1)), cgResidualTol );
+        reducedMultiply( xt, cgProd );
+        cgRes = r;
+        cgRes -= cgProd;
+        cgPrecRes = cgRes;
+        DiagonalSolve( LEFT, NORMAL, precond, cgPrecRes );
+        cgDir = cgPrecRes;
+        Real resDot = Dot( cgRes, cgPrecRes );
+        Int numCGIts = 0;
+        for( ; numCGIts<ctrl.maxCGIts; ++numCGIts )
+        {
+            if( Nrm2(cgRes) <= cgTol )
+                break;
+            reducedMultiply( cgDir, cgProd );
+            const Real stepSize = resDot / Dot( cgDir, cgProd );
+            Axpy(  stepSize, cgDir,  xt );
+            Axpy( -stepSize, cgProd, cgRes );
+            cgPrecRes = cgRes;
+            DiagonalSolve( LEFT, NORMAL, precond, cgPrecRes );
+            const Real resDotNew = Dot( cgRes, cgPrecRes );
+            cgDir *= resDotNew / resDot;
+            cgDir += cgPrecRes;
+            resDot = resDotNew;
+        }
+        return numCGIts;
+    };
+
+    // Initialize w = zc + inv(rho) y, with zc = [b; h - s]
+    // ====================================================
+    DistMultiVec<Real> wA(comm), wG(comm);
+    wA = y;
+    wA *= 1/rhoA;
+    wA += b;
+    wG = z;
+    wG *= 1/rho;
+    wG += h;
+    wG -= s;
+
+    // Apply a single iteration, (xNext,wNext) := F(x,w)
+    // =================================================
+    DistMultiVec<Real> xt(comm), d(comm), nuA(comm), nuG(comm),
+                       zG(comm), rx(comm), rA(comm), rG(comm);
+    Zeros( xt, n, 1 );
+    auto project = [&]( const DistMultiVec<Real>& w, DistMultiVec<Real>& sG )
+    {
+        sG = h;
+        sG -= w;
+        soc::Project( sG, orders, firstInds, cutoffPar );
+    };
+    Int numCGIts = 0;
+    auto step = [&]
+    ( const DistMultiVec<Real>& xIn,
+      const DistMultiVec<Real>& wAIn,
+      const DistMultiVec<Real>& wGIn,
+            DistMultiVec<Real>& xOut,
+            DistMultiVec<Real>& wAOut,
+            DistMultiVec<Real>& wGOut )
+    {
+        // zG := h - proj_K(h - wGIn)
+        project( wGIn, zG );
+        zG *= -1;
+        zG += h;
+
+        // rA := 2 b - wAIn, rG := 2 zG - wGIn, rx := sigma xIn - c
+        rA = b;
+        rA *= 2;
+        rA -= wAIn;
+        rG = zG;
+        rG *= 2;
+        rG -= wGIn;
+        rx = xIn;
+        rx *= ctrl.sigma;
+        rx -= c;
+
+        // Set (wAOut,wGOut) := zt - zc
+        if( direct )
+        {
+            PackRHS( rx, rA, rG, d );
+            ldl::SolveAfter( invMap, info, JFront, d );
+            qp::affine::ExpandCoreSolution( m, n, k, d, xt, nuA, nuG );
+
+            // zt - zc = inv(rho) nu - w + zc
+            wAOut = nuA;
+            wAOut *= 1/rhoA;
+            wAOut -= wAIn;
+            wAOut += b;
+            wGOut = nuG;
+            wGOut *= 1/rho;
+            wGOut -= wGIn;
+            wGOut += zG;
+        }
+        else
+        {
+            // xt := inv(Q + sigma I + A^T rho_A A + G^T rho G) *
+            //       (rx + A^T rho_A rA + G^T rho rG)
+            Multiply( TRANSPOSE, rhoA, A, rA, Real(1), rx );
+            Multiply( TRANSPOSE, rho,  G, rG, Real(1), rx );
+            numCGIts += cg( rx, xt );
+
+            // zt - zc = [A; G] xt - zc
+            wAOut = b;
+            Multiply( NORMAL, Real(1), A, xt, Real(-1), wAOut );
+            wGOut = zG;
+            Multiply( NORMAL, Real(1), G, xt, Real(-1), wGOut );
+        }
+
+        // xOut := alpha xt + (1-alpha) xIn, wOut := wIn + alpha (zt - zc)
+        xOut = xIn;
+        xOut *= 1-ctrl.alpha;
+        Axpy( ctrl.alpha, xt, xOut );
+        wAOut *= ctrl.alpha;
+        wAOut += wAIn;
+        wGOut *= ctrl.alpha;
+        wGOut += wGIn;
+    };
+
+    // Recover (y,z,s) from w
+    auto recover = [&]()
+    {
+        project( wG, s );
+        y = wA;
+        y -= b;
+        y *= rhoA;
+        z = wG;
+        z -= h;
+        z += s;
+        z *= rho;
+    };
+
+    Anderson<Real> anderson( ctrl.andersonMemory, ctrl.andersonReg, comm );
+    bool accelerated = false;
+    Real fixedResPrev = -1;
+    DistMultiVec<Real> xNext(comm), wANext(comm), wGNext(comm),
+                       xSafe(comm), wASafe(comm), wGSafe(comm);
+    DistMultiVec<Real> diff(comm);
+    auto fixedPointResidual = [&]()
+    {
+        diff = xNext;
+        diff -= x;
+        const Real xDiff = Nrm2( diff );
+        diff = wANext;
+        diff -= wA;
+        const Real wADiff = Nrm2( diff );
+        diff = wGNext;
+        diff -= wG;
+        const Real wGDiff = Nrm2( diff );
+        return Sqrt(xDiff*xDiff + wADiff*wADiff + wGDiff*wGDiff);
+    };
+
+    DistMultiVec<Real> rb(comm), rc(comm), rh(comm),
+                       Ax(comm), Gx(comm), Qx(comm), ATy(comm);
+    const Int indent = PushIndent();
+    Int numIts=0;
+    bool converged = false;
+    for( ; numIts<ctrl.maxIter; ++numIts )
+    {
+        step( x, wA, wG, xNext, wANext, wGNext );
+        if( ctrl.anderson )
+        {
+            // Fall back to the unaccelerated iterate if the fixed-point
+            // residual of the accelerated iterate was too large
+            Real fixedRes = fixedPointResidual();
+            if( accelerated && fixedRes > ctrl.andersonSafeguard*fixedResPrev )
+            {
+                x = xSafe;
+                wA = wASafe;
+                wG = wGSafe;
+                anderson.Reset();
+                step( x, wA, wG, xNext, wANext, wGNext );
+                fixedRes = fixedPointResidual();
+            }
+            xSafe = xNext;
+            wASafe = wANext;
+            wGSafe = wGNext;
+            fixedResPrev = fixedRes;
+            anderson.Extrapolate
+            ( { &x.LockedMatrix(), &wA.LockedMatrix(), &wG.LockedMatrix() },
+              { &xNext.Matrix(), &wANext.Matrix(), &wGNext.Matrix() } );
+            accelerated = true;
+        }
+        x = xNext;
+        wA = wANext;
+        wG = wGNext;
+
+        const bool adaptRho = ctrl.adaptiveRho &&
+          (numIts+1) % ctrl.adaptiveRhoInterval == 0;
+        const bool check = (numIts+1) % ctrl.checkInterval == 0 ||
+          numIts+1 == ctrl.maxIter;
+        if( !adaptRho && !check )
+            continue;
+
+        // Form the primal and dual residuals
+        // ==================================
+        recover();
+        // || A x - b ||_2 and || G x + s - h ||_2
+        Zeros( Ax, m, 1 );
+        Zeros( Gx, k, 1 );
+        Multiply( NORMAL, Real(1), A, x, Real(0), Ax );
+        Multiply( NORMAL, Real(1), G, x, Real(0), Gx );
+        rb = Ax;
+        rb -= b;
+        rh = Gx;
+        rh += s;
+        rh -= h;
+        const Real AxNrm2 = Nrm2( Ax );
+        const Real GxNrm2 = Nrm2( Gx );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rhNrm2 = Nrm2( rh );
+        const Real primErr = Sqrt(rbNrm2*rbNrm2 + rhNrm2*rhNrm2);
+        const Real primScale =
+          Max(Max(Sqrt(AxNrm2*AxNrm2+GxNrm2*GxNrm2),
+                  Sqrt(bNrm2*bNrm2+hNrm2*hNrm2)),Nrm2(s));
+        // || Q x + c + A^T y + G^T z ||_2
+        Zeros( Qx, n, 1 );
+        Zeros( ATy, n, 1 );
+        Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(0), ATy );
+        Multiply( TRANSPOSE, Real(1), G, z, Real(1), ATy );
+        rc = Qx;
+        rc += c;
+        rc += ATy;
+        const Real QxNrm2 = Nrm2( Qx );
+        const Real dualErr = Nrm2( rc );
+        const Real dualScale = Max(Max(QxNrm2,Nrm2(ATy)),cNrm2);
+
+        const Real primTol = ctrl.absTol + ctrl.relTol*primScale;
+        const Real dualTol = ctrl.absTol + ctrl.relTol*dualScale;
+        cgResidualTol = ctrl.cgResidualFactor*Min(primErr,dualErr);
+        if( check )
+        {
+            if( ctrl.print )
+            {
+                const Real primObj = Dot(x,Qx)/2 + Dot(c,x);
+                if( commRank == 0 )
+                {
+                    Output
+                    ("iter ",numIts,":\n",Indent(),
+                     "  || primal residual ||_2 = ",primErr,
+                     " (tolerance: ",primTol,")\n",Indent(),
+                     "  || dual residual   ||_2 = ",dualErr,
+                     " (tolerance: ",dualTol,")\n",Indent(),
+                     "  primal objective = ",primObj,"\n",Indent(),
+                     "  rho = ",rho);
+                    if( !direct )
+                        Output("  ",numCGIts," CG iterations");
+                }
+            }
+            numCGIts = 0;
+            if( primErr <= primTol && dualErr <= dualTol )
+            {
+                converged = true;
+                ++numIts;
+                break;
+            }
+        }
+
+        // Rebalance rho
+        // =============
+        if( adaptRho )
+        {
+            const Real primRatio = primErr / Max(primScale,ctrl.absTol);
+            const Real dualRatio = dualErr / Max(dualScale,ctrl.absTol);
+            if( dualRatio == Real(0) )
+                continue;
+            Real rhoNew = rho*Sqrt(primRatio/dualRatio);
+            rhoNew = Max(Min(rhoNew,ctrl.maxRho),ctrl.minRho);
+            if( rhoNew <= ctrl.adaptiveRhoTol*rho &&
+                rhoNew*ctrl.adaptiveRhoTol >= rho )
+                continue;
+
+            const Real rhoANew = ctrl.equalityRhoScale*rhoNew;
+            if( ctrl.print && commRank == 0 )
+                Output("Updating rho from ",rho," to ",rhoNew);
+            if( direct )
+            {
+                // Update the (frozen) dual diagonal of the KKT system in-place
+                DistMultiVec<Real> shift(comm);
+                Zeros( shift, n+m+k, 1 );
+                for( Int iLoc=0; iLoc<shift.LocalHeight(); ++iLoc )
+                {
+                    const Int i = shift.GlobalRow(iLoc);
+                    if( i >= n+m )
+                        shift.SetLocal( iLoc, 0, 1/rho - 1/rhoNew );
+                    else if( i >= n )
+                        shift.SetLocal( iLoc, 0, 1/rhoA - 1/rhoANew );
+                }
+                UpdateDiagonal( J, Real(1), shift, 0, true );
+            }
+            rho = rhoNew;
+            rhoA = rhoANew;
+            if( direct )
+                factor();
+            else
+                formPrecond();
+
+            // Preserve (zc,y) = (proj_C(w),rho (w - proj_C(w)))
+            wA = y;
+            wA *= 1/rhoA;
+            wA += b;
+            wG = z;
+            wG *= 1/rho;
+            wG += h;
+            wG -= s;
+            anderson.Reset();
+            accelerated = false;
+        }
+    }
+    SetIndent( indent );
+    if( !converged && ctrl.print && commRank == 0 )
+        Output("ADMM failed to converge within ",ctrl.maxIter," iterations");
+
+    recover();
+    if( ctrl.outerEquil )
+    {
+        DiagonalSolve( LEFT, NORMAL, dCol,  x );
+        DiagonalSolve( LEFT, NORMAL, dRowA, y );
+        DiagonalSolve( LEFT, NORMAL, dRowG, z );
+        DiagonalScale( LEFT, NORMAL, dRowG, s );
+    }
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template Int ADMM \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& G, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Real>& h, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& s, \
+    const SplittingCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace splitting
+} // namespace El
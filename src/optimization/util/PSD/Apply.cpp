@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace psd {
+
+// Since X and Y are symmetric, (X Y + Y X) / 2 = (X Y + (X Y)^T) / 2
+
+template<typename Real,typename>
+void Apply
+( const Matrix<Real>& X,
+  const Matrix<Real>& Y,
+        Matrix<Real>& Z )
+{
+    DEBUG_ONLY(CSE cse("psd::Apply"))
+    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, Y, Z );
+    Matrix<Real> ZTrans;
+    Transpose( Z, ZTrans );
+    Z += ZTrans;
+}
+
+template<typename Real,typename>
+void Apply
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& Y,
+        ElementalMatrix<Real>& Z )
+{
+    DEBUG_ONLY(CSE cse("psd::Apply"))
+    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, Y, Z );
+    DistMatrix<Real> ZTrans( Z.Grid() );
+    Transpose( Z, ZTrans );
+    Z += ZTrans;
+}
+
+template<typename Real,typename>
+void ApplyInverse
+( const Matrix<Real>& lambda,
+        Matrix<Real>& Y )
+{
+    DEBUG_ONLY(CSE cse("psd::ApplyInverse"))
+    const Int n = Y.Height();
+    const Real* lambdaBuf = lambda.LockedBuffer();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            Y.Set( i, j, 2*Y.Get(i,j)/(lambdaBuf[i]+lambdaBuf[j]) );
+}
+
+template<typename Real,typename>
+void ApplyInverse
+( const ElementalMatrix<Real>& lambda,
+        ElementalMatrix<Real>& Y )
+{
+    DEBUG_ONLY(CSE cse("psd::ApplyInverse"))
+    DistMatrix<Real,STAR,STAR> lambda_STAR_STAR( lambda );
+    const Real* lambdaBuf = lambda_STAR_STAR.LockedBuffer();
+
+    const Int localHeight = Y.LocalHeight();
+    const Int localWidth = Y.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = Y.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = Y.GlobalRow(iLoc);
+            Y.SetLocal
+            ( iLoc, jLoc,
+              2*Y.GetLocal(iLoc,jLoc)/(lambdaBuf[i]+lambdaBuf[j]) );
+        }
+    }
+}
+
+#define PROTO(Real) \
+  template void Apply \
+  ( const Matrix<Real>& X, \
+    const Matrix<Real>& Y, \
+          Matrix<Real>& Z ); \
+  template void Apply \
+  ( const ElementalMatrix<Real>& X, \
+    const ElementalMatrix<Real>& Y, \
+          ElementalMatrix<Real>& Z ); \
+  template void ApplyInverse \
+  ( const Matrix<Real>& lambda, \
+          Matrix<Real>& Y ); \
+  template void ApplyInverse \
+  ( const ElementalMatrix<Real>& lambda, \
+          ElementalMatrix<Real>& Y );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace psd {
+
+// If X = L L^T, then X + alpha dX = L (I + alpha inv(L) dX inv(L)^T) L^T
+// remains positive semi-definite as long as 1 + alpha lambda_min >= 0, where
+// lambda_min is the minimum eigenvalue of inv(L) dX inv(L)^T.
+
+template<typename Real,typename>
+Real MaxStep
+( const Matrix<Real>& X,
+  const Matrix<Real>& dX,
+        Real upperBound )
+{
+    DEBUG_ONLY(CSE cse("psd::MaxStep"))
+    if( X.Height() == 0 )
+        return upperBound;
+
+    auto L = X;
+    Cholesky( LOWER, L );
+    auto T = dX;
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), L, T );
+    Trsm( RIGHT, LOWER, TRANSPOSE, NON_UNIT, Real(1), L, T );
+
+    Matrix<Real> w;
+    HermitianEig( LOWER, T, w, ASCENDING );
+    const Real minEig = w.Get(0,0);
+    if( minEig >= Real(0) )
+        return upperBound;
+    else
+        return Min(upperBound,-1/minEig);
+}
+
+template<typename Real,typename>
+Real MaxStep
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& dX,
+        Real upperBound )
+{
+    DEBUG_ONLY(CSE cse("psd::MaxStep"))
+    if( X.Height() == 0 )
+        return upperBound;
+
+    DistMatrix<Real> L( X ), T( dX );
+    Cholesky( LOWER, L );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), L, T );
+    Trsm( RIGHT, LOWER, TRANSPOSE, NON_UNIT, Real(1), L, T );
+
+    DistMatrix<Real,VR,STAR> w( X.Grid() );
+    HermitianEig( LOWER, T, w, ASCENDING );
+    const Real minEig = w.Get(0,0);
+    if( minEig >= Real(0) )
+        return upperBound;
+    else
+        return Min(upperBound,-1/minEig);
+}
+
+#define PROTO(Real) \
+  template Real MaxStep \
+  ( const Matrix<Real>& X, \
+    const Matrix<Real>& dX, \
+          Real upperBound ); \
+  template Real MaxStep \
+  ( const ElementalMatrix<Real>& X, \
+    const ElementalMatrix<Real>& dX, \
+          Real upperBound );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace psd
+} // namespace El
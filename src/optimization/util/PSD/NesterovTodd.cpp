@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace psd {
+
+// If X = L_X L_X^T, Z = L_Z L_Z^T, and L_Z^T L_X = U diag(lambda) V^T, then
+// R = L_X V diag(lambda)^{-1/2} satisfies
+//
+//   inv(R) X inv(R)^T = diag(lambda)^{1/2} V^T V diag(lambda)^{1/2}
+//                     = diag(lambda),
+//   R^T Z R = diag(lambda)^{-1/2} (V diag(lambda)^2 V^T) diag(lambda)^{-1/2}
+//           = diag(lambda).
+
+template<typename Real,typename>
+void NesterovTodd
+( const Matrix<Real>& X,
+  const Matrix<Real>& Z,
+        Matrix<Real>& R,
+        Matrix<Real>& lambda )
+{
+    DEBUG_ONLY(CSE cse("psd::NesterovTodd"))
+    auto LX = X;
+    Cholesky( LOWER, LX );
+    MakeTrapezoidal( LOWER, LX );
+    auto LZ = Z;
+    Cholesky( LOWER, LZ );
+    MakeTrapezoidal( LOWER, LZ );
+
+    Matrix<Real> U, V;
+    Gemm( TRANSPOSE, NORMAL, Real(1), LZ, LX, U );
+    SVD( U, lambda, V );
+
+    Gemm( NORMAL, NORMAL, Real(1), LX, V, R );
+    auto lambdaRootInv = lambda;
+    EntrywiseMap( lambdaRootInv, function<Real(Real)>
+      ( []( Real alpha ) { return 1/Sqrt(alpha); } ) );
+    DiagonalScale( RIGHT, NORMAL, lambdaRootInv, R );
+}
+
+template<typename Real,typename>
+void NesterovTodd
+( const ElementalMatrix<Real>& X,
+  const ElementalMatrix<Real>& Z,
+        ElementalMatrix<Real>& R,
+        ElementalMatrix<Real>& lambda )
+{
+    DEBUG_ONLY(CSE cse("psd::NesterovTodd"))
+    const Grid& g = X.Grid();
+    DistMatrix<Real> LX( X ), LZ( Z );
+    Cholesky( LOWER, LX );
+    MakeTrapezoidal( LOWER, LX );
+    Cholesky( LOWER, LZ );
+    MakeTrapezoidal( LOWER, LZ );
+
+    DistMatrix<Real> U(g), V(g);
+    Gemm( TRANSPOSE, NORMAL, Real(1), LZ, LX, U );
+    SVD( U, lambda, V );
+
+    Gemm( NORMAL, NORMAL, Real(1), LX, V, R );
+    DistMatrix<Real,VR,STAR> lambdaRootInv( lambda );
+    EntrywiseMap( lambdaRootInv, function<Real(Real)>
+      ( []( Real alpha ) { return 1/Sqrt(alpha); } ) );
+    DiagonalScale( RIGHT, NORMAL, lambdaRootInv, R );
+}
+
+#define PROTO(Real) \
+  template void NesterovTodd \
+  ( const Matrix<Real>& X, \
+    const Matrix<Real>& Z, \
+          Matrix<Real>& R, \
+          Matrix<Real>& lambda ); \
+  template void NesterovTodd \
+  ( const ElementalMatrix<Real>& X, \
+    const ElementalMatrix<Real>& Z, \
+          ElementalMatrix<Real>& R, \
+          ElementalMatrix<Real>& lambda );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace psd
+} // namespace El
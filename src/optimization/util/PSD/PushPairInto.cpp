@@ -0,0 +1,66 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace psd {
+
+template<typename Real,typename>
+void PushPairInto
+(       Matrix<Real>& X,
+        Matrix<Real>& Z,
+  const Matrix<Real>& W,
+  Real wMaxNormLimit )
+{
+    DEBUG_ONLY(CSE cse("psd::PushPairInto"))
+    const Real maxMod = Pow(limits::Epsilon<Real>(),Real(0.5));
+    if( MaxNorm(W) > wMaxNormLimit )
+    {
+        // TODO: Switch to a non-adhoc modification
+        ShiftDiagonal( Z, Min(Real(1)/wMaxNormLimit,maxMod) );
+    }
+}
+
+template<typename Real,typename>
+void PushPairInto
+(       ElementalMatrix<Real>& X,
+        ElementalMatrix<Real>& Z,
+  const ElementalMatrix<Real>& W,
+  Real wMaxNormLimit )
+{
+    DEBUG_ONLY(
+      CSE cse("psd::PushPairInto");
+      AssertSameGrids( X, Z, W );
+    )
+    const Real maxMod = Pow(limits::Epsilon<Real>(),Real(0.5));
+    if( MaxNorm(W) > wMaxNormLimit )
+    {
+        // TODO: Switch to a non-adhoc modification
+        ShiftDiagonal( Z, Min(Real(1)/wMaxNormLimit,maxMod) );
+    }
+}
+
+#define PROTO(Real) \
+  template void PushPairInto \
+  (       Matrix<Real>& X, \
+          Matrix<Real>& Z, \
+    const Matrix<Real>& W, \
+    Real wMaxNormLimit ); \
+  template void PushPairInto \
+  (       ElementalMatrix<Real>& X, \
+          ElementalMatrix<Real>& Z, \
+    const ElementalMatrix<Real>& W, \
+    Real wMaxNormLimit );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace psd
+} // namespace El
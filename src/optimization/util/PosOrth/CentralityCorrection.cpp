@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace pos_orth {
+
+namespace {
+
+template<typename Real>
+inline Real Correction( Real v, Real lowerBound, Real upperBound )
+{
+    if( v < lowerBound )
+        return v - lowerBound;
+    else if( v > upperBound )
+        return Min( v - upperBound, upperBound );
+    else
+        return Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,typename>
+void CentralityCorrection
+( Matrix<Real>& v, Real lowerBound, Real upperBound )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::CentralityCorrection"))
+    const Int height = v.Height();
+    Real* vBuf = v.Buffer();
+    for( Int i=0; i<height; ++i )
+        vBuf[i] = Correction( vBuf[i], lowerBound, upperBound );
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+( ElementalMatrix<Real>& v, Real lowerBound, Real upperBound )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::CentralityCorrection"))
+    const Int localHeight = v.LocalHeight();
+    const Int localWidth = v.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            v.SetLocal
+            ( iLoc, jLoc, 
+              Correction( v.GetLocal(iLoc,jLoc), lowerBound, upperBound ) );
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+( DistMultiVec<Real>& v, Real lowerBound, Real upperBound )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::CentralityCorrection"))
+    CentralityCorrection( v.Matrix(), lowerBound, upperBound );
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrection \
+  ( Matrix<Real>& v, Real lowerBound, Real upperBound ); \
+  template void CentralityCorrection \
+  ( ElementalMatrix<Real>& v, Real lowerBound, Real upperBound ); \
+  template void CentralityCorrection \
+  ( DistMultiVec<Real>& v, Real lowerBound, Real upperBound );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace pos_orth
+} // namespace El
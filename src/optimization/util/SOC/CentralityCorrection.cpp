@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace soc {
+
+// Each subcone member v = (v_0,v_1) has the spectral decomposition
+//
+//   v = lambda_+ c_+ + lambda_- c_-,  
+//
+// where lambda_{+-} = v_0 +- || v_1 ||_2 and c_{+-} = (1,+-v_1/|| v_1 ||_2)/2.
+// Writing e_{+-} for the difference between lambda_{+-} and its projection
+// onto [lowerBound,upperBound], v is overwritten with e_+ c_+ + e_- c_-.
+
+namespace {
+
+template<typename Real>
+inline Real EigCorrection( Real lambda, Real lowerBound, Real upperBound )
+{
+    if( lambda < lowerBound )
+        return lambda - lowerBound;
+    else if( lambda > upperBound )
+        return Min( lambda - upperBound, upperBound );
+    else
+        return Real(0);
+}
+
+template<typename Real>
+inline Real Correction
+( Real vi, Real v0, Real lowerNorm, bool isRoot, 
+  Real lowerBound, Real upperBound )
+{
+    const Real ePlus = EigCorrection( v0+lowerNorm, lowerBound, upperBound );
+    const Real eMinus = EigCorrection( v0-lowerNorm, lowerBound, upperBound );
+    if( isRoot )
+        return (ePlus+eMinus)/2;
+    else if( lowerNorm == Real(0) )
+        return Real(0);
+    else
+        return vi*((ePlus-eMinus)/(2*lowerNorm));
+}
+
+} // anonymous namespace
+
+template<typename Real,typename>
+void CentralityCorrection
+(       Matrix<Real>& v, 
+  Real lowerBound, Real upperBound,
+  const Matrix<Int>& orders, 
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_ONLY(CSE cse("soc::CentralityCorrection"))
+
+    Matrix<Real> lowerNorms, roots;
+    soc::LowerNorms( v, lowerNorms, orders, firstInds );
+    cone::Broadcast( lowerNorms, orders, firstInds );
+    roots = v;
+    cone::Broadcast( roots, orders, firstInds );
+
+    const Int height = v.Height();
+    for( Int i=0; i<height; ++i )
+    {
+        const bool isRoot = ( i == firstInds.Get(i,0) );
+        v.Set
+        ( i, 0, 
+          Correction
+          ( v.Get(i,0), roots.Get(i,0), lowerNorms.Get(i,0), isRoot,
+            lowerBound, upperBound ) );
+    }
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+(       ElementalMatrix<Real>& vPre, 
+  Real lowerBound, Real upperBound,
+  const ElementalMatrix<Int>& ordersPre, 
+  const ElementalMatrix<Int>& firstIndsPre,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::CentralityCorrection"))
+    AssertSameGrids( vPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      vProx( vPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& v = vProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    DistMatrix<Real,VC,STAR> lowerNorms(v.Grid()), roots(v.Grid());
+    soc::LowerNorms( v, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+    roots = v;
+    cone::Broadcast( roots, orders, firstInds, cutoff );
+
+    const Int localHeight = v.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = v.GlobalRow(iLoc);
+        const bool isRoot = ( i == firstInds.GetLocal(iLoc,0) );
+        v.SetLocal
+        ( iLoc, 0,
+          Correction
+          ( v.GetLocal(iLoc,0), roots.GetLocal(iLoc,0), 
+            lowerNorms.GetLocal(iLoc,0), isRoot, lowerBound, upperBound ) );
+    }
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+(       DistMultiVec<Real>& v, 
+  Real lowerBound, Real upperBound,
+  const DistMultiVec<Int>& orders, 
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::CentralityCorrection"))
+
+    DistMultiVec<Real> lowerNorms(v.Comm()), roots(v.Comm());
+    soc::LowerNorms( v, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+    roots = v;
+    cone::Broadcast( roots, orders, firstInds, cutoff );
+
+    const int localHeight = v.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = v.GlobalRow(iLoc);
+        const bool isRoot = ( i == firstInds.GetLocal(iLoc,0) );
+        v.SetLocal
+        ( iLoc, 0,
+          Correction
+          ( v.GetLocal(iLoc,0), roots.GetLocal(iLoc,0), 
+            lowerNorms.GetLocal(iLoc,0), isRoot, lowerBound, upperBound ) );
+    }
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrection \
+  (       Matrix<Real>& v, \
+    Real lowerBound, Real upperBound, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds ); \
+  template void CentralityCorrection \
+  (       ElementalMatrix<Real>& v, \
+    Real lowerBound, Real upperBound, \
+    const ElementalMatrix<Int>& orders, \
+    const ElementalMatrix<Int>& firstInds, \
+    Int cutoff ); \
+  template void CentralityCorrection \
+  (       DistMultiVec<Real>& v, \
+    Real lowerBound, Real upperBound, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace soc
+} // namespace El
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace soc {
+
+// The projection of a subcone member x = (x_0,x_1) is
+//
+//   x,                                       if || x_1 ||_2 <= x_0,
+//   0,                                       if || x_1 ||_2 <= -x_0,
+//   ((x_0+|| x_1 ||_2)/2) (1,x_1/|| x_1 ||_2), otherwise.
+
+namespace {
+
+template<typename Real>
+inline Real Projection( Real xi, Real x0, Real lowerNorm, bool isRoot )
+{
+    if( lowerNorm <= x0 )
+        return xi;
+    else if( lowerNorm <= -x0 )
+        return Real(0);
+    else if( isRoot )
+        return (x0+lowerNorm)/2;
+    else
+        return xi*((x0+lowerNorm)/(2*lowerNorm));
+}
+
+} // anonymous namespace
+
+template<typename Real,typename>
+void Project
+(       Matrix<Real>& x, 
+  const Matrix<Int>& orders, 
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_ONLY(CSE cse("soc::Project"))
+
+    Matrix<Real> lowerNorms, roots;
+    soc::LowerNorms( x, lowerNorms, orders, firstInds );
+    cone::Broadcast( lowerNorms, orders, firstInds );
+    roots = x;
+    cone::Broadcast( roots, orders, firstInds );
+
+    const Int height = x.Height();
+    for( Int i=0; i<height; ++i )
+    {
+        const bool isRoot = ( i == firstInds.Get(i,0) );
+        x.Set
+        ( i, 0, 
+          Projection
+          ( x.Get(i,0), roots.Get(i,0), lowerNorms.Get(i,0), isRoot ) );
+    }
+}
+
+template<typename Real,typename>
+void Project
+(       ElementalMatrix<Real>& xPre, 
+  const ElementalMatrix<Int>& ordersPre, 
+  const ElementalMatrix<Int>& firstIndsPre,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::Project"))
+    AssertSameGrids( xPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      xProx( xPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& x = xProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    DistMatrix<Real,VC,STAR> lowerNorms(x.Grid()), roots(x.Grid());
+    soc::LowerNorms( x, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+    roots = x;
+    cone::Broadcast( roots, orders, firstInds, cutoff );
+
+    const Int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        const bool isRoot = ( i == firstInds.GetLocal(iLoc,0) );
+        x.SetLocal
+        ( iLoc, 0,
+          Projection
+          ( x.GetLocal(iLoc,0), roots.GetLocal(iLoc,0), 
+            lowerNorms.GetLocal(iLoc,0), isRoot ) );
+    }
+}
+
+template<typename Real,typename>
+void Project
+(       DistMultiVec<Real>& x, 
+  const DistMultiVec<Int>& orders, 
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::Project"))
+
+    DistMultiVec<Real> lowerNorms(x.Comm()), roots(x.Comm());
+    soc::LowerNorms( x, lowerNorms, orders, firstInds, cutoff );
+    cone::Broadcast( lowerNorms, orders, firstInds, cutoff );
+    roots = x;
+    cone::Broadcast( roots, orders, firstInds, cutoff );
+
+    const int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        const bool isRoot = ( i == firstInds.GetLocal(iLoc,0) );
+        x.SetLocal
+        ( iLoc, 0,
+          Projection
+          ( x.GetLocal(iLoc,0), roots.GetLocal(iLoc,0), 
+            lowerNorms.GetLocal(iLoc,0), isRoot ) );
+    }
+}
+
+#define PROTO(Real) \
+  template void Project \
+  (       Matrix<Real>& x, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds ); \
+  template void Project \
+  (       ElementalMatrix<Real>& x, \
+    const ElementalMatrix<Int>& orders, \
+    const ElementalMatrix<Int>& firstInds, \
+    Int cutoff ); \
+  template void Project \
+  (       DistMultiVec<Real>& x, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include "El/macros/Instantiate.h"
+
+} // namespace soc
+} // namespace El
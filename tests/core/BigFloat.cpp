@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+#ifdef EL_HAVE_MPC
+
+// The entries of a Matrix<BigFloat> share a single slab of limbs, so every
+// operation which copies, moves, or reallocates entries must preserve their
+// values without ever handing a slot of the slab to another BigFloat.
+// (Since Matrix::Get returns a copy, the storage of an entry is inspected
+// through the buffer.)
+
+void Fill( Matrix<BigFloat>& A, Int offset )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            A.Set( i, j, BigFloat(i+offset)/BigFloat(j+2) );
+}
+
+void CheckFill
+( const string& label, const Matrix<BigFloat>& A, Int offset )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != BigFloat(i+offset)/BigFloat(j+2) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",A.Get(i,j),
+                 " rather than ",i+offset,"/",j+2);
+    Output("  ",label,": PASSED");
+}
+
+void TestSequential( Int m, Int n )
+{
+    const mpfr_prec_t prec = mpc::Precision();
+    Output("Testing Matrix<BigFloat> with ",prec,"-bit precision");
+
+    Matrix<BigFloat> A;
+    Zeros( A, m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.LockedBuffer()[i+j*A.LDim()].OwnsLimbs() )
+                LogicError("Entries of a fresh matrix should use the slab");
+    Fill( A, 1 );
+    CheckFill( "Fill", A, 1 );
+
+    // Deep copies (via construction and assignment) and views
+    Matrix<BigFloat> B( A );
+    CheckFill( "Copy construction", B, 1 );
+    Fill( A, 2 );
+    CheckFill( "Independence of the copy", B, 1 );
+    B = A;
+    CheckFill( "Copy assignment", B, 2 );
+    auto ASub = A( IR(1,m), IR(1,n) );
+    Matrix<BigFloat> C( ASub );
+    for( Int j=0; j<n-1; ++j )
+        for( Int i=0; i<m-1; ++i )
+            if( C.Get(i,j) != A.Get(i+1,j+1) )
+                LogicError("Copy of a view was incorrect");
+    Output("  Copy of a view: PASSED");
+
+    // Growing (and hence reallocating) and shrinking
+    B.Resize( 2*m, 2*n );
+    Fill( B, 3 );
+    CheckFill( "Reallocation", B, 3 );
+    B.Resize( m/2, n/2 );
+    Fill( B, 4 );
+    CheckFill( "Reuse after shrinking", B, 4 );
+
+    // Swaps of entries within the slab go through the move operations
+    BigFloat* ABuf = A.Buffer();
+    const BigFloat a0( ABuf[0] ), a1( ABuf[1] );
+    std::swap( ABuf[0], ABuf[1] );
+    if( ABuf[0] != a1 || ABuf[1] != a0 ||
+        ABuf[0].OwnsLimbs() || ABuf[1].OwnsLimbs() )
+        LogicError("std::swap of slab entries failed");
+    std::swap( ABuf[0], ABuf[1] );
+    const BigFloat a2( ABuf[2] );
+    BigFloat moved( std::move(ABuf[2]) );
+    if( moved != a2 || ABuf[2] != a2 )
+        LogicError("Moving out of a slab entry lost its value");
+    ABuf[3] = std::move(moved);
+    if( ABuf[3] != a2 || ABuf[3].OwnsLimbs() )
+        LogicError("Moving into a slab entry failed");
+    Fill( A, 2 );
+    Fill( B, 1 );
+    B.Resize( m, n );
+    Fill( B, 1 );
+    Swap( NORMAL, A, B );
+    CheckFill( "Swap (first matrix)", A, 1 );
+    CheckFill( "Swap (second matrix)", B, 2 );
+    ColSwap( A, 0, n-1 );
+    ColSwap( A, 0, n-1 );
+    RowSwap( A, 0, m-1 );
+    RowSwap( A, 0, m-1 );
+    CheckFill( "Row and column swaps", A, 1 );
+
+    // Changing the precision without changing the number of limbs reuses the
+    // slot of the slab, and so contiguous copies remain possible
+    const mpfr_prec_t samePrec = prec-1;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            BigFloat& alpha = A.Buffer()[i+j*A.LDim()];
+            alpha.SetPrecision( samePrec );
+            if( alpha.OwnsLimbs() )
+                LogicError("SetPrecision should have kept the slab slot");
+            alpha = BigFloat(i+1,samePrec)/BigFloat(j+2,samePrec);
+        }
+    B.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B.Buffer()[i+j*B.LDim()].SetPrecision( samePrec );
+    B = A;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B.Get(i,j) != A.Get(i,j) ||
+                B.LockedBuffer()[i+j*B.LDim()].Precision() != samePrec )
+                LogicError("Copy after a same-size SetPrecision failed");
+    Output("  SetPrecision with the same number of limbs: PASSED");
+
+    // Changing the number of limbs detaches an entry from the slab
+    const mpfr_prec_t widePrec = 4*prec;
+    BigFloat& alpha = A.Buffer()[0];
+    alpha.SetPrecision( widePrec );
+    if( !alpha.OwnsLimbs() || alpha.Precision() != widePrec )
+        LogicError("SetPrecision should have detached the entry");
+    alpha = BigFloat(1,widePrec)/BigFloat(3,widePrec);
+    Matrix<BigFloat> D( A );
+    if( D.Get(0,0) != BigFloat(alpha,prec) )
+        LogicError("Copying a detached entry did not round correctly");
+    if( D.LockedBuffer()[0].OwnsLimbs() )
+        LogicError("The copy of a detached entry left the slab");
+    if( alpha != BigFloat(1,widePrec)/BigFloat(3,widePrec) )
+        LogicError("The detached entry was modified");
+    Output("  SetPrecision with more limbs: PASSED");
+}
+
+void TestDistributed( Int m, Int n, const Grid& g )
+{
+    const Int commRank = g.Rank();
+    if( commRank == 0 )
+        Output
+        ("Testing DistMatrix<BigFloat> with ",mpc::Precision(),
+         "-bit precision");
+
+    DistMatrix<BigFloat> A(g);
+    Uniform( A, m, n );
+    DistMatrix<BigFloat,STAR,STAR> A_STAR_STAR( A );
+
+    DistMatrix<BigFloat,VC,STAR> A_VC_STAR( A );
+    DistMatrix<BigFloat,MR,MC> A_MR_MC( A_VC_STAR );
+    DistMatrix<BigFloat,STAR,VR> A_STAR_VR( A_MR_MC );
+    DistMatrix<BigFloat,CIRC,CIRC> A_CIRC_CIRC( A_STAR_VR );
+    DistMatrix<BigFloat> B( A_CIRC_CIRC );
+
+    Int myErrors = 0;
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            if( B.GetLocal(iLoc,jLoc) !=
+                A_STAR_STAR.GetLocal(B.GlobalRow(iLoc),B.GlobalCol(jLoc)) )
+                ++myErrors;
+    const Int numErrors = mpi::AllReduce( myErrors, g.Comm() );
+    if( numErrors != 0 )
+        LogicError(numErrors," entries changed during redistribution");
+
+    // A column swap through a distributed matrix
+    ColSwap( B, 0, n-1 );
+    DistMatrix<BigFloat,STAR,STAR> B_STAR_STAR( B );
+    for( Int i=0; i<m; ++i )
+        if( B_STAR_STAR.GetLocal(i,0) != A_STAR_STAR.GetLocal(i,n-1) ||
+            B_STAR_STAR.GetLocal(i,n-1) != A_STAR_STAR.GetLocal(i,0) )
+            LogicError("Distributed column swap failed");
+    if( commRank == 0 )
+        Output("  Redistributions and swaps: PASSED");
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",20);
+        const Int n = Input("--width","width of matrix",10);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MPC
+        const Grid g( comm );
+        if( commRank == 0 )
+            TestSequential( m, n );
+        TestDistributed( m, n, g );
+
+        mpc::SetPrecision( 512 );
+        if( commRank == 0 )
+            TestSequential( m, n );
+        TestDistributed( m, n, g );
+#else
+        if( commRank == 0 )
+            Output("Elemental was not configured with MPC support");
+#endif
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Check the arithmetic of DoubleDouble against Quad (when available) and
+// against identities which only hold with more than double precision, the
+// exactness of its conversions to and from 64-bit integers beyond 2^53, and
+// its MPI reductions.
+
+typedef DoubleDouble DD;
+
+// A random normalized double-double whose low word is nonzero
+DD SampleDD()
+{
+    const double scale = std::ldexp( 1., SampleUniform<Int>(-20,21) );
+    const DD hi( SampleUniform<double>(-1,1)*scale );
+    const DD lo( SampleUniform<double>(-1,1)*scale*std::ldexp(1.,-60) );
+    return hi + lo;
+}
+
+void Check( const string& label, DD error, DD bound )
+{
+    if( !(error <= bound) )
+        LogicError(label,": error of ",error," exceeded ",bound);
+}
+
+void TestIdentities( Int numSamples )
+{
+    Output("Testing DoubleDouble identities");
+    const DD eps = limits::Epsilon<DD>();
+    const DD one(1), two(2), three(3);
+
+    // 2^-80 is lost entirely in double precision
+    const DD tiny( std::ldexp(1.,-80) );
+    Check( "(1 + 2^-80) - 1", Abs(((one+tiny)-one)-tiny), DD(0) );
+    Check( "3 (1/3)", Abs(three*(one/three)-one), 4*eps );
+    Check
+    ( "1/3 + 1/3 + 1/3", Abs((one/three+one/three+one/three)-one), 4*eps );
+    const DD sqrtTwo = Sqrt( two );
+    Check( "Sqrt(2)^2", Abs(sqrtTwo*sqrtTwo-two), 8*eps );
+
+    for( Int k=0; k<numSamples; ++k )
+    {
+        const DD a = SampleDD(), b = SampleDD();
+        const DD sumScale = Abs(a) + Abs(b);
+        Check( "(a + b) - b", Abs(((a+b)-b)-a), 8*eps*sumScale );
+        Check( "(a - b) + b", Abs(((a-b)+b)-a), 8*eps*sumScale );
+        Check( "(a b) / b", Abs((a*b)/b-a), 16*eps*Abs(a) );
+        Check( "(a / b) b", Abs((a/b)*b-a), 16*eps*Abs(a) );
+    }
+    Output("  PASSED");
+}
+
+#ifdef EL_HAVE_QUAD
+void TestAgainstQuad( Int numSamples )
+{
+    Output("Testing DoubleDouble arithmetic against Quad");
+    const Quad eps = Quad(limits::Epsilon<DD>());
+    Quad maxAddError=0, maxMultError=0, maxDivError=0;
+    for( Int k=0; k<numSamples; ++k )
+    {
+        const DD a = SampleDD(), b = SampleDD();
+        const Quad aQ = Quad(a), bQ = Quad(b);
+        const Quad sumScale = Abs(aQ) + Abs(bQ);
+        maxAddError =
+          Max( maxAddError, Abs(Quad(a+b)-(aQ+bQ))/sumScale );
+        maxAddError =
+          Max( maxAddError, Abs(Quad(a-b)-(aQ-bQ))/sumScale );
+        maxMultError =
+          Max( maxMultError, Abs(Quad(a*b)-aQ*bQ)/Abs(aQ*bQ) );
+        maxDivError =
+          Max( maxDivError, Abs(Quad(a/b)-aQ/bQ)/Abs(aQ/bQ) );
+    }
+    Output
+    ("  max relative errors (in units of 2^-105):\n",
+     "    +,- : ",maxAddError/eps,"\n",
+     "    *   : ",maxMultError/eps,"\n",
+     "    /   : ",maxDivError/eps);
+    if( maxAddError > 4*eps || maxMultError > 16*eps ||
+        maxDivError > 16*eps )
+        LogicError("DoubleDouble arithmetic was inaccurate");
+}
+#endif
+
+void TestIntegers()
+{
+    Output("Testing DoubleDouble conversions of 64-bit integers");
+    const long long int maxLL = std::numeric_limits<long long int>::max();
+    const long long int minLL = std::numeric_limits<long long int>::min();
+    const long long int twoTo53 = 1LL << 53;
+    const vector<long long int> values =
+      { twoTo53+1, -(twoTo53+1), (1LL<<62)+12345, -((1LL<<60)+7),
+        maxLL, maxLL-1, minLL, minLL+1, 0, -1 };
+    for( const long long int value : values )
+    {
+        const DD alpha( value );
+        if( static_cast<long long int>(alpha) != value )
+            LogicError
+            ("The round-trip of ",value," gave ",
+             static_cast<long long int>(alpha));
+        if( static_cast<long long int>(Round(alpha+DD(0.25))) != value )
+            LogicError("Round(",value," + 1/4) was inexact");
+        if( value != maxLL &&
+            static_cast<long long int>(alpha+DD(1)) != value+1 )
+            LogicError(value," + 1 was inexact");
+        if( value != minLL &&
+            static_cast<long long int>(alpha-DD(1)) != value-1 )
+            LogicError(value," - 1 was inexact");
+    }
+
+    const unsigned long long maxULL =
+      std::numeric_limits<unsigned long long>::max();
+    for( const unsigned long long value :
+         { maxULL, maxULL-2, (1ULL<<63)+3, 1ULL<<63 } )
+        if( static_cast<unsigned long long>(DD(value)) != value )
+            LogicError("The round-trip of ",value," was inexact");
+
+    // Truncation must account for a low word of the opposite sign
+    if( static_cast<int>(DD(3.,-1e-17)) != 2 ||
+        static_cast<int>(DD(-3.,1e-17)) != -2 ||
+        static_cast<long long int>(DD(3.,1e-17)) != 3 )
+        LogicError("Truncation of a near-integer was incorrect");
+    Output("  PASSED");
+}
+
+void TestAllReduce( mpi::Comm comm )
+{
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    if( commRank == 0 )
+        Output("Testing DoubleDouble AllReduce over ",commSize," processes");
+    const DD eps = limits::Epsilon<DD>();
+
+    // Each process contributes 1 + (rank+1) 2^-70, so that the sum,
+    // p + 2^-70 p (p+1) / 2, is not representable as a double
+    const DD tiny( std::ldexp(1.,-70) );
+    const DD p = DD( double(commSize) );
+    const DD mine = DD(1) + tiny*DD(double(commRank+1));
+    const DD sum = mpi::AllReduce( mine, comm );
+    const DD sumExpected = p + tiny*(p*(p+DD(1))/DD(2));
+    Check( "AllReduce sum", Abs(sum-sumExpected), 4*eps*p );
+    if( sum.lo == 0 )
+        LogicError("The low word of the sum was lost");
+
+    DD buf[2] = { mine, -mine };
+    mpi::AllReduce( buf, 2, mpi::MAX, comm );
+    if( buf[0] != DD(1)+tiny*p || buf[1] != -(DD(1)+tiny) )
+        LogicError("AllReduce max was incorrect");
+    if( commRank == 0 )
+        Output("  PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int numSamples =
+          Input("--numSamples","number of random samples",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            TestIdentities( numSamples );
+#ifdef EL_HAVE_QUAD
+            TestAgainstQuad( numSamples );
+#endif
+            TestIntegers();
+        }
+        TestAllReduce( comm );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
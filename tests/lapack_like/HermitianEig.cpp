@@ -119,6 +119,143 @@ void TestHermitianEig
         TestCorrectness( print, uplo, AOrig, A, w, Z );
 }
 
+// Check the eigenpairs of matrices whose spectra contain clusters: the
+// Wilkinson matrix (whose largest eigenvalues come in nearly equal pairs)
+// and a graded spectrum, whose small eigenvalues are close in an absolute
+// sense but well-separated in a relative sense
+template<typename F>
+void TestClusteredSpectra( Int m, const Grid& g, bool print )
+{
+    typedef Base<F> Real;
+    if( g.Rank() == 0 )
+        Output("Testing clustered spectra with ",TypeName<F>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    for( Int spectrum=0; spectrum<2; ++spectrum )
+    {
+        DistMatrix<F> A(g), AOrig(g), Z(g);
+        DistMatrix<Real,VR,STAR> w(g);
+        if( spectrum == 0 )
+        {
+            Wilkinson( A, m/2 );
+        }
+        else
+        {
+            DistMatrix<Real,VR,STAR> wGraded(g);
+            wGraded.Resize( m, 1 );
+            for( Int iLoc=0; iLoc<wGraded.LocalHeight(); ++iLoc )
+            {
+                const Int i = wGraded.GlobalRow(iLoc);
+                wGraded.SetLocal
+                ( iLoc, 0, Pow(Real(10),-Real(8*i)/Real(Max(m-1,1))) );
+            }
+            DistMatrix<F> U(g);
+            Haar( U, m );
+            HermitianFromEVD( LOWER, A, wGraded, U );
+        }
+        const Int n = A.Height();
+        AOrig = A;
+        if( print )
+            Print( A, "A" );
+
+        HermitianEig( LOWER, A, w, Z, ASCENDING );
+        if( print )
+        {
+            Print( w, "eigenvalues:" );
+            Print( Z, "eigenvectors:" );
+        }
+
+        DistMatrix<F> X(g);
+        Identity( X, n, n );
+        Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), X );
+        const Real orthError = HermitianFrobeniusNorm( LOWER, X );
+
+        Zeros( X, n, n );
+        Hemm( LEFT, LOWER, F(1), AOrig, Z, F(0), X );
+        DistMatrix<F> ZW( Z );
+        DiagonalScale( RIGHT, NORMAL, w, ZW );
+        X -= ZW;
+        const Real residError =
+          FrobeniusNorm( X ) / HermitianFrobeniusNorm( LOWER, AOrig );
+
+        if( g.Rank() == 0 )
+            Output
+            ("  ",(spectrum==0 ? "Wilkinson" : "graded")," spectrum:\n",
+             "    ||Z^H Z - I||_F           = ",orthError,"\n",
+             "    ||A Z - Z W||_F / ||A||_F = ",residError);
+        if( orthError > tol || residError > tol )
+            LogicError("Clustered eigenpairs were inaccurate");
+    }
+}
+
+// Compare the QDWH-based spectral divide and conquer (which first attempts
+// a deterministic QDWH split about the median of the diagonal) against the
+// default tridiagonal eigensolver
+template<typename F>
+void TestQDWHSDC( Int m, const Grid& g, bool print )
+{
+    typedef Base<F> Real;
+    if( g.Rank() == 0 )
+        Output("Testing QDWH spectral divide and conquer with ",TypeName<F>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    DistMatrix<F> A(g), AOrig(g), Z(g);
+    DistMatrix<Real,VR,STAR> w(g), wRef(g);
+    HermitianUniformSpectrum( A, m, -10, 10 );
+    AOrig = A;
+    if( print )
+        Print( A, "A" );
+    {
+        DistMatrix<F> ACopy( A );
+        HermitianEig( LOWER, ACopy, wRef, ASCENDING );
+    }
+
+    HermitianEigCtrl<F> ctrl;
+    ctrl.useSDC = true;
+    ctrl.sdcCtrl.qdwh = true;
+    HermitianEig
+    ( LOWER, A, w, Z, ASCENDING, HermitianEigSubset<Real>(), ctrl );
+    if( print )
+    {
+        Print( w, "eigenvalues:" );
+        Print( Z, "eigenvectors:" );
+    }
+
+    DistMatrix<F> X(g);
+    Identity( X, m, m );
+    Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), X );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, X );
+
+    Zeros( X, m, m );
+    Hemm( LEFT, LOWER, F(1), AOrig, Z, F(0), X );
+    DistMatrix<F> ZW( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZW );
+    X -= ZW;
+    const Real frobNormA = HermitianFrobeniusNorm( LOWER, AOrig );
+    const Real residError = FrobeniusNorm( X ) / frobNormA;
+
+    // The eigenvalues must be returned in ascending order and agree with
+    // those from the default path
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( w );
+    bool sorted = true;
+    for( Int i=0; i<m-1; ++i )
+        if( w_STAR_STAR.GetLocal(i,0) > w_STAR_STAR.GetLocal(i+1,0) )
+            sorted = false;
+    DistMatrix<Real,VR,STAR> wDiff( w );
+    wDiff -= wRef;
+    const Real wError = MaxNorm( wDiff ) / frobNormA;
+
+    if( g.Rank() == 0 )
+        Output
+        ("  ||Z^H Z - I||_F           = ",orthError,"\n",
+         "  ||A Z - Z W||_F / ||A||_F = ",residError,"\n",
+         "  ||w - wRef||_oo / ||A||_F = ",wError);
+    if( !sorted )
+        LogicError("QDWH SDC eigenvalues were not sorted");
+    if( orthError > tol || residError > tol || wError > tol )
+        LogicError("QDWH SDC eigenpairs were inaccurate");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -161,6 +298,10 @@ main( int argc, char* argv[] )
         const bool testReal = Input("--testReal","test real matrices?",true);
         const bool testCpx = Input("--testCpx","test complex matrices?",true);
         const bool timeStages = Input("--timeStages","time stages?",true);
+        const bool testClusters =
+          Input("--testClusters","test clustered spectra?",true);
+        const bool testQDWH =
+          Input("--testQDWH","test QDWH spectral divide and conquer?",true);
         ProcessInput();
         PrintInputReport();
 
@@ -255,8 +396,36 @@ main( int argc, char* argv[] )
             TestHermitianEig<Complex<double>,MR,MC,MC>
             ( testCorrectness, print, onlyEigvals, clustered, 
               uplo, m, sort, g, subset, ctrl_z, scalapack );
+
+        // Clustered spectra, both through the standard tridiagonal
+        // eigensolver and the templated bisection/inverse iteration solver
+        if( testClusters )
+        {
+            if( testReal )
+                TestClusteredSpectra<double>( m, g, print );
+            if( testCpx )
+                TestClusteredSpectra<Complex<double>>( m, g, print );
+#ifdef EL_HAVE_QUAD
+            if( testReal )
+                TestClusteredSpectra<Quad>( m, g, print );
+            if( testCpx )
+                TestClusteredSpectra<Complex<Quad>>( m, g, print );
+#endif
+        }
+
+        if( testQDWH )
+        {
+            if( testReal )
+                TestQDWHSDC<double>( m, g, print );
+            if( testCpx )
+                TestQDWHSDC<Complex<double>>( m, g, print );
+        }
+    }
+    catch( exception& e ) 
+    {
+        ReportException(e);
+        return 1;
     }
-    catch( exception& e ) { ReportException(e); }
 
     return 0;
 }
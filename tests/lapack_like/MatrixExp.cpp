@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the action of the matrix exponential of a sparse matrix,
+// exp(t A) B, against explicitly forming exp(t A) and multiplying by B
+
+template<typename F>
+void TestSequential( Int nx, Int numRHS, Base<F> tScale, bool print )
+{
+    typedef Base<F> Real;
+    SparseMatrix<F> A;
+    Laplacian( A, nx );
+    const Real t = tScale / OneNorm( A );
+
+    Matrix<F> B, X;
+    Uniform( B, A.Height(), numRHS );
+    X = B;
+    MatrixExpAction( A, X, t );
+
+    Matrix<F> expA, Y;
+    Copy( A, expA );
+    expA *= t;
+    MatrixExp( expA );
+    Zeros( Y, A.Height(), numRHS );
+    Gemm( NORMAL, NORMAL, F(1), expA, B, F(0), Y );
+    if( print && mpi::Rank() == 0 )
+    {
+        Print( X, "exp(t A) B via MatrixExpAction" );
+        Print( Y, "exp(t A) B via MatrixExp" );
+    }
+
+    const Real YFrob = FrobeniusNorm( Y );
+    Y -= X;
+    const Real relError = FrobeniusNorm( Y ) / YFrob;
+    if( mpi::Rank() == 0 )
+        Output("  sequential: || X - exp(t A) B ||_F / || exp(t A) B ||_F = ",
+               relError);
+    if( relError > Pow(limits::Epsilon<Real>(),Real(0.75)) )
+        LogicError("Sequential MatrixExpAction was inaccurate");
+}
+
+template<typename F>
+void TestDistributed( Int nx, Int numRHS, Base<F> tScale, bool print )
+{
+    typedef Base<F> Real;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, nx );
+    const Real t = tScale / OneNorm( A );
+
+    DistMultiVec<F> B(comm), X(comm);
+    Uniform( B, A.Height(), numRHS );
+    X = B;
+    MatrixExpAction( A, X, t );
+
+    DistMatrix<F> expA, BDense, XDense, Y;
+    Copy( A, expA );
+    expA *= t;
+    MatrixExp( expA );
+    Copy( B, BDense );
+    Copy( X, XDense );
+    Zeros( Y, A.Height(), numRHS );
+    Gemm( NORMAL, NORMAL, F(1), expA, BDense, F(0), Y );
+    if( print )
+    {
+        Print( XDense, "exp(t A) B via MatrixExpAction" );
+        Print( Y, "exp(t A) B via MatrixExp" );
+    }
+
+    const Real YFrob = FrobeniusNorm( Y );
+    Y -= XDense;
+    const Real relError = FrobeniusNorm( Y ) / YFrob;
+    if( commRank == 0 )
+        Output("  distributed: || X - exp(t A) B ||_F / || exp(t A) B ||_F = ",
+               relError);
+    if( relError > Pow(limits::Epsilon<Real>(),Real(0.75)) )
+        LogicError("Distributed MatrixExpAction was inaccurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int nx = Input("--nx","size of the 1D Laplacian",50);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const double tScale = Input("--tScale","value of t || A ||_1",4.);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestSequential<double>( nx, numRHS, tScale, print );
+        TestDistributed<double>( nx, numRHS, tScale, print );
+
+        if( commRank == 0 )
+            Output("Testing with double-precision complex:");
+        TestSequential<Complex<double>>( nx, numRHS, tScale, print );
+        TestDistributed<Complex<double>>( nx, numRHS, tScale, print );
+
+#ifdef EL_HAVE_QUAD
+        // The Taylor switchpoints are shrunk for the smaller unit roundoff
+        if( commRank == 0 )
+        {
+            Output("Testing with quad-precision:");
+            TestSequential<Quad>( nx, numRHS, tScale, print );
+        }
+#endif
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A = Q T Q^H, where Q is a Haar-distributed unitary matrix and T is
+// upper-triangular with each of the eigenvalues 1, 2, ..., numDistinct
+// appearing several times along its diagonal, but never adjacently, so that
+// the Schur-Parlett algorithm must reorder the Schur form to cluster them
+template<typename Real>
+void ClusteredMatrix( Matrix<Complex<Real>>& A, Int n, Int numDistinct )
+{
+    typedef Complex<Real> C;
+    Matrix<C> T, Q, B;
+    Uniform( T, n, n );
+    MakeTrapezoidal( UPPER, T, 1 );
+    T *= Real(1)/Real(10);
+    for( Int i=0; i<n; ++i )
+        T.Set( i, i, C(Real(i % numDistinct + 1)) );
+    Haar( Q, n );
+    Gemm( NORMAL, NORMAL, C(1), Q, T, B );
+    Gemm( NORMAL, ADJOINT, C(1), B, Q, A );
+}
+
+// The k'th derivatives of exp(z) and log(z)
+template<typename Real>
+Complex<Real> ExpDerivative( Complex<Real> z, Int k )
+{ return Exp(z); }
+
+template<typename Real>
+Complex<Real> LogDerivative( Complex<Real> z, Int k )
+{
+    if( k == 0 )
+        return Log(z);
+    // (-1)^(k-1) (k-1)! / z^k
+    Complex<Real> value = ( k % 2 == 1 ? Real(1) : Real(-1) );
+    for( Int j=1; j<=k; ++j )
+    {
+        if( j < k )
+            value *= Real(j);
+        value /= z;
+    }
+    return value;
+}
+
+template<typename Real>
+void Check
+( const string& label,
+  const Matrix<Complex<Real>>& X,
+  const Matrix<Complex<Real>>& XRef,
+        Real tol )
+{
+    Matrix<Complex<Real>> E( XRef );
+    E -= X;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    Output("  ",label,": relative error = ",relError);
+    if( relError > tol )
+        LogicError(label," was inaccurate");
+}
+
+template<typename Real>
+void TestSequential
+( Int n, Int numDistinct, const SchurParlettCtrl<Real>& ctrl, bool print )
+{
+    typedef Complex<Real> C;
+    Output("Testing with ",TypeName<C>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    Matrix<C> A;
+    ClusteredMatrix( A, n, numDistinct );
+    if( print )
+        Print( A, "A" );
+
+    // MatrixFunction with f = exp versus the scaling and squaring method
+    Matrix<C> expA( A ), FA( A );
+    MatrixExp( expA );
+    MatrixFunction( FA, function<C(C,Int)>(ExpDerivative<Real>), ctrl );
+    if( print )
+    {
+        Print( expA, "exp(A) via MatrixExp" );
+        Print( FA, "exp(A) via MatrixFunction" );
+    }
+    Check( "Schur-Parlett exp(A)", FA, expA, tol );
+
+    // MatrixFunction with f = log versus inverse scaling and squaring
+    Matrix<C> logA( A );
+    MatrixLog( logA );
+    FA = A;
+    MatrixFunction( FA, function<C(C,Int)>(LogDerivative<Real>), ctrl );
+    if( print )
+    {
+        Print( logA, "log(A) via MatrixLog" );
+        Print( FA, "log(A) via MatrixFunction" );
+    }
+    Check( "Schur-Parlett log(A)", FA, logA, tol );
+
+    // exp(log(A)) = A
+    MatrixExp( logA );
+    Check( "exp(MatrixLog(A))", logA, A, tol );
+
+    // Since the eigenvalues of X have imaginary parts in (-pi,pi), the
+    // principal logarithm of exp(X) is X
+    Matrix<Real> X;
+    Gaussian( X, n, n );
+    X *= Real(1)/Sqrt(Real(n));
+    Matrix<Real> expX( X );
+    MatrixExp( expX );
+    MatrixLog( expX );
+    Matrix<C> XComp, logExpX;
+    Copy( X, XComp );
+    Copy( expX, logExpX );
+    Check( "MatrixLog(exp(X)) for real X", logExpX, XComp, tol );
+}
+
+template<typename Real>
+void TestDistributed
+( Int n, Int numDistinct, const SchurParlettCtrl<Real>& ctrl,
+  const Grid& g )
+{
+    typedef Complex<Real> C;
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    // Generate the matrix on the root and broadcast it
+    Matrix<C> ASeq;
+    if( g.Rank() == 0 )
+        ClusteredMatrix( ASeq, n, numDistinct );
+    else
+        Zeros( ASeq, n, n );
+    mpi::Broadcast( ASeq.Buffer(), n*n, 0, g.Comm() );
+
+    DistMatrix<C,STAR,STAR> A_STAR_STAR(g);
+    A_STAR_STAR.Resize( n, n );
+    A_STAR_STAR.Matrix() = ASeq;
+    DistMatrix<C> A( A_STAR_STAR ), expA( A_STAR_STAR ), FA( A_STAR_STAR );
+    MatrixExp( expA );
+    MatrixFunction( FA, function<C(C,Int)>(ExpDerivative<Real>), ctrl );
+
+    DistMatrix<C,STAR,STAR> expA_STAR_STAR( expA ), FA_STAR_STAR( FA );
+    if( g.Rank() == 0 )
+        Check
+        ( "Distributed Schur-Parlett exp(A)", FA_STAR_STAR.Matrix(),
+          expA_STAR_STAR.Matrix(), tol );
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<C> logA( A );
+    MatrixLog( logA );
+    MatrixExp( logA );
+    DistMatrix<C,STAR,STAR> expLogA_STAR_STAR( logA );
+    if( g.Rank() == 0 )
+        Check
+        ( "Distributed exp(MatrixLog(A))", expLogA_STAR_STAR.Matrix(), ASeq,
+          tol );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",12);
+        const Int numDistinct =
+          Input("--numDistinct","number of distinct eigenvalues",4);
+        const Int blockSize =
+          Input("--blockSize","Schur-Parlett block size",4);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SchurParlettCtrl<double> ctrl;
+        ctrl.blockSize = blockSize;
+        if( commRank == 0 )
+            TestSequential( n, numDistinct, ctrl, print );
+
+        const Grid g( comm );
+        TestDistributed( n, numDistinct, ctrl, g );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Check a full SVD, A = U diag(s) V^H, for its residual, the orthogonality
+// of U and V, and the agreement of s with reference singular values
+template<typename F>
+void TestCorrectness
+( const string& label,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  const DistMatrix<Base<F>,VR,STAR>& sRef,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int k = s.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = Real(100)*Max(A.Height(),A.Width())*eps;
+    if( print )
+        Print( s, label+" singular values" );
+
+    // || A - U diag(s) V^H ||_F / || A ||_F
+    DistMatrix<F> US( U ), E( A );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    Gemm( NORMAL, ADJOINT, F(-1), US, V, F(1), E );
+    const Real residual = FrobeniusNorm( E ) / FrobeniusNorm( A );
+
+    // || I - U^H U ||_F and || I - V^H V ||_F
+    DistMatrix<F> Z(g);
+    Identity( Z, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real UOrth = HermitianFrobeniusNorm( LOWER, Z );
+    Identity( Z, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real VOrth = HermitianFrobeniusNorm( LOWER, Z );
+
+    // || s - sRef ||_oo / || sRef ||_oo
+    DistMatrix<Real,VR,STAR> sDiff( s );
+    sDiff -= sRef;
+    const Real sError = MaxNorm( sDiff ) / MaxNorm( sRef );
+
+    if( g.Rank() == 0 )
+        Output
+        ("  ",label,":\n",
+         "    || A - U S V^H ||_F / || A ||_F = ",residual,"\n",
+         "    || I - U^H U ||_F               = ",UOrth,"\n",
+         "    || I - V^H V ||_F               = ",VOrth,"\n",
+         "    || s - sRef ||_oo / || s ||_oo  = ",sError);
+    if( residual > tol || UOrth > tol || VOrth > tol || sError > tol )
+        LogicError(label," SVD was inaccurate");
+}
+
+template<typename F>
+void TestSVD( Int m, Int n, Int dcCutoff, const Grid& g, bool print )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g);
+    Uniform( A, m, n );
+    if( print )
+        Print( A, "A" );
+
+    // The reference singular values from the bidiagonal DQDS algorithm
+    DistMatrix<Real,VR,STAR> sRef(g);
+    {
+        DistMatrix<F> ACopy( A );
+        SVD( ACopy, sRef );
+    }
+
+    // The existing bidiagonal QR algorithm
+    {
+        DistMatrix<F> U( A ), V(g);
+        DistMatrix<Real,VR,STAR> s(g);
+        SVDCtrl<Real> ctrl;
+        SVD( U, s, V, ctrl );
+        TestCorrectness( "Bidiagonal QR", A, U, s, V, sRef, print );
+    }
+
+    // The parallel bidiagonal divide and conquer (with a small enough
+    // cutoff that several distributed merges take place)
+    {
+        DistMatrix<F> U( A ), V(g);
+        DistMatrix<Real,VR,STAR> s(g);
+        SVDCtrl<Real> ctrl;
+        ctrl.distDC = true;
+        ctrl.dcCutoff = dcCutoff;
+        SVD( U, s, V, ctrl );
+        TestCorrectness( "Bidiagonal D&C", A, U, s, V, sRef, print );
+    }
+
+    // The QDWH-SVD: a QDWH polar decomposition, A = Q H, followed by a
+    // QDWH-based spectral divide and conquer of H (the comparison against
+    // sRef also checks that the singular values are sorted)
+    SVDCtrl<Real> qdwhCtrl;
+    qdwhCtrl.useQDWH = true;
+    {
+        DistMatrix<F> U( A ), V(g);
+        DistMatrix<Real,VR,STAR> s(g);
+        SVD( U, s, V, qdwhCtrl );
+        TestCorrectness( "QDWH", A, U, s, V, sRef, print );
+    }
+
+    // The sequential QDWH-SVD, (redundantly) run on each process
+    {
+        Matrix<F> ULoc, VLoc;
+        Matrix<Real> sLoc;
+        {
+            DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+            ULoc = A_STAR_STAR.Matrix();
+        }
+        SVD( ULoc, sLoc, VLoc, qdwhCtrl );
+        DistMatrix<F,STAR,STAR> U_STAR_STAR(g), V_STAR_STAR(g);
+        DistMatrix<Real,STAR,STAR> s_STAR_STAR(g);
+        U_STAR_STAR.Resize( ULoc.Height(), ULoc.Width() );
+        U_STAR_STAR.Matrix() = ULoc;
+        V_STAR_STAR.Resize( VLoc.Height(), VLoc.Width() );
+        V_STAR_STAR.Matrix() = VLoc;
+        s_STAR_STAR.Resize( sLoc.Height(), 1 );
+        s_STAR_STAR.Matrix() = sLoc;
+        DistMatrix<F> U( U_STAR_STAR ), V( V_STAR_STAR );
+        DistMatrix<Real,VR,STAR> s( s_STAR_STAR );
+        TestCorrectness( "Sequential QDWH", A, U, s, V, sRef, print );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",120);
+        const Int n = Input("--width","width of matrix",100);
+        const Int dcCutoff =
+          Input("--dcCutoff","bidiagonal D&C leaf size",8);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestSVD<double>( m, n, dcCutoff, g, print );
+        TestSVD<double>( n, m, dcCutoff, g, print );
+
+        if( commRank == 0 )
+            Output("Testing with double-precision complex:");
+        TestSVD<Complex<double>>( m, n, dcCutoff, g, print );
+        TestSVD<Complex<double>>( n, m, dcCutoff, g, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
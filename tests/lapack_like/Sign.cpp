@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the matrix sign function computed with the scaled Newton iteration
+// alone against the hybrid which switches to the inverse-free [k/0] Pade
+// iterations (Newton-Schulz for k=1) once the iterates are close to
+// convergence. The test matrix, A = V D inv(V), has a known (non-normal)
+// eigendecomposition with eigenvalues of both signs, so that
+// sign(A) = V sign(D) inv(V).
+
+template<typename F>
+void TestMatrix( Matrix<F>& A, Matrix<F>& S, Int n )
+{
+    typedef Base<F> Real;
+    Matrix<F> V, VInv, VD, d, dSign;
+    Uniform( V, n, n );
+    V *= Real(1)/(2*Sqrt(Real(n)));
+    ShiftDiagonal( V, F(1) );
+    VInv = V;
+    Inverse( VInv );
+
+    // The eigenvalues +/- (1/2 + i/n) are bounded away from the imaginary axis
+    Zeros( d, n, 1 );
+    Zeros( dSign, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Real sgn = ( i % 2 == 0 ? Real(1) : Real(-1) );
+        d.Set( i, 0, sgn*(Real(1)/Real(2)+Real(i)/Real(n)) );
+        dSign.Set( i, 0, sgn );
+    }
+
+    VD = V;
+    DiagonalScale( RIGHT, NORMAL, d, VD );
+    Gemm( NORMAL, NORMAL, F(1), VD, VInv, A );
+    VD = V;
+    DiagonalScale( RIGHT, NORMAL, dSign, VD );
+    Gemm( NORMAL, NORMAL, F(1), VD, VInv, S );
+}
+
+template<typename F>
+Base<F> RelError( const Matrix<F>& X, const Matrix<F>& S )
+{
+    Matrix<F> E( S );
+    E -= X;
+    return FrobeniusNorm( E ) / FrobeniusNorm( S );
+}
+
+template<typename F>
+void TestSign( Int n, const Grid& g, bool print )
+{
+    typedef Base<F> Real;
+    const bool amRoot = ( g.Rank() == 0 );
+    if( amRoot )
+        Output("Testing with ",TypeName<F>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    // Generate the matrix on the root and broadcast it
+    Matrix<F> A, S;
+    if( amRoot )
+        TestMatrix( A, S, n );
+    else
+    {
+        Zeros( A, n, n );
+        Zeros( S, n, n );
+    }
+    mpi::Broadcast( A.Buffer(), n*n, 0, g.Comm() );
+    mpi::Broadcast( S.Buffer(), n*n, 0, g.Comm() );
+    if( print && amRoot )
+    {
+        Print( A, "A" );
+        Print( S, "sign(A)" );
+    }
+
+    SignCtrl<Real> ctrl;
+    Matrix<F> XNewton( A );
+    Sign( XNewton, ctrl );
+    const Int newtonIts = ctrl.numIts;
+    const Real newtonError = RelError( XNewton, S );
+
+    ctrl.newtonSchulz = true;
+    Matrix<F> XHybrid( A );
+    Sign( XHybrid, ctrl );
+    const Int hybridIts = ctrl.numIts;
+    const Real hybridError = RelError( XHybrid, S );
+    const Real hybridDiff = RelError( XHybrid, XNewton );
+
+    ctrl.newtonSchulzDegree = 2;
+    Matrix<F> XPade( A );
+    Sign( XPade, ctrl );
+    const Int padeIts = ctrl.numIts;
+    const Real padeError = RelError( XPade, S );
+
+    // The distributed hybrid iteration
+    ctrl.newtonSchulzDegree = 1;
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(g);
+    A_STAR_STAR.Resize( n, n );
+    A_STAR_STAR.Matrix() = A;
+    DistMatrix<F> XDist( A_STAR_STAR );
+    Sign( XDist, ctrl );
+    const Int distIts = ctrl.numIts;
+    DistMatrix<F,STAR,STAR> XDist_STAR_STAR( XDist );
+    const Real distError = RelError( XDist_STAR_STAR.Matrix(), S );
+
+    if( amRoot )
+        Output
+        ("  Newton:           ",newtonIts," iterations, "
+         "|| X - sign(A) ||_F / || sign(A) ||_F = ",newtonError,"\n",
+         "  Newton-Schulz:    ",hybridIts," iterations, "
+         "|| X - sign(A) ||_F / || sign(A) ||_F = ",hybridError,"\n",
+         "  [2/0] Pade:       ",padeIts," iterations, "
+         "|| X - sign(A) ||_F / || sign(A) ||_F = ",padeError,"\n",
+         "  Distributed:      ",distIts," iterations, "
+         "|| X - sign(A) ||_F / || sign(A) ||_F = ",distError,"\n",
+         "  || XHybrid - XNewton ||_F / || XNewton ||_F = ",hybridDiff);
+    if( newtonError > tol || hybridError > tol || padeError > tol ||
+        distError > tol || hybridDiff > tol )
+        LogicError("The sign function was inaccurate");
+
+    // Both iterations converge quadratically (or faster) near the solution,
+    // so the hybrid should only require a couple of extra (inverse-free)
+    // iterations at most
+    if( hybridIts > newtonIts+2 || padeIts > newtonIts+2 )
+        LogicError
+        ("The hybrid iterations took ",hybridIts," and ",padeIts,
+         " iterations, whereas Newton took ",newtonIts);
+    if( distIts != hybridIts )
+        LogicError
+        ("The distributed hybrid took ",distIts," iterations, whereas the "
+         "sequential hybrid took ",hybridIts);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",50);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSign<double>( n, g, print );
+        TestSign<Complex<double>>( n, g, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,263 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A knapsack-style lattice, B = [I; N a^T], with a drawn uniformly from
+// the integers in [0,range). Since the top n rows of any basis B U of this
+// lattice are the unimodular transformation U itself, each reduction can be
+// checked without access to U.
+void KnapsackLattice( Matrix<double>& B, Int n, double range, double N )
+{
+    Zeros( B, n+1, n );
+    for( Int j=0; j<n; ++j )
+    {
+        B.Set( j, j, 1. );
+        B.Set( n, j, N*Round(SampleUniform(0.,range)) );
+    }
+}
+
+// Check that B is an LLL-reduced basis for the same lattice as BOrig,
+// returning || b_0 ||_2
+double CheckBasis
+( const string& label,
+  const Matrix<double>& BOrig,
+  const Matrix<double>& B,
+  const LLLCtrl<double>& ctrl,
+  bool print )
+{
+    const Int n = B.Width();
+    const double slack = Sqrt(limits::Epsilon<double>());
+    if( print )
+        Print( B, label+" basis" );
+
+    auto U = B( IR(0,n), ALL );
+    Matrix<double> E( U );
+    Round( E );
+    E -= U;
+    const double roundError = MaxNorm( E );
+    Matrix<double> BU;
+    Zeros( BU, n+1, n );
+    Gemm( NORMAL, NORMAL, 1., BOrig, U, 0., BU );
+    BU -= B;
+    const double basisError = MaxNorm( BU );
+
+    // U is typically far too ill-conditioned for its determinant to be
+    // computed accurately, but, since BOrig = [I; w^T] has volume
+    // sqrt(1 + || w ||_2^2), | det(U) | = vol(B) / vol(BOrig) can instead be
+    // computed from the (reduced, and hence well-conditioned) basis B
+    Matrix<double> R( B );
+    qr::ExplicitTriang( R );
+    const double wNorm = FrobeniusNorm( BOrig(IR(n),ALL) );
+    double logDet = -Log(1+wNorm*wNorm)/2;
+    for( Int i=0; i<n; ++i )
+        logDet += Log(Abs(R.Get(i,i)));
+
+    double delta = limits::Max<double>();
+    for( Int i=0; i<n-1; ++i )
+    {
+        const double rho_i_i = R.Get(i,i);
+        const double rho_i_ip1 = R.Get(i,i+1);
+        const double rho_ip1_ip1 = R.Get(i+1,i+1);
+        delta =
+          Min
+          (delta,
+           (rho_ip1_ip1*rho_ip1_ip1+rho_i_ip1*rho_i_ip1)/(rho_i_i*rho_i_i));
+    }
+    const double b0Norm = FrobeniusNorm( B(ALL,IR(0)) );
+
+    Output
+    ("  ",label,":\n",
+     "    || round(U) - U ||_max  = ",roundError,"\n",
+     "    || BOrig U - B ||_max   = ",basisError,"\n",
+     "    log |det(U)|            = ",logDet,"\n",
+     "    achieved delta          = ",delta,"\n",
+     "    || b_0 ||_2             = ",b0Norm);
+    if( roundError != 0. || basisError != 0. || Abs(logDet) > n*slack )
+        LogicError(label," did not return a basis of the same lattice");
+    if( delta < ctrl.delta-slack )
+        LogicError(label," did not return an LLL-reduced basis");
+    return b0Norm;
+}
+
+void TestBKZ
+( Int n, double range, Int blocksize, Int numTrials, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const double eps = limits::Epsilon<double>();
+    const double tol = Sqrt(eps);
+    // ShortestVectorEnumeration drops to single precision when the entries
+    // of the (reduced) basis are small enough, and so the norms which it
+    // returns are only compared to within single-precision accuracy
+    const double enumTol = Sqrt(double(limits::Epsilon<float>()));
+
+    // The sequential reductions are performed on the root process, and the
+    // resulting upper-triangular factor is then handed to every process for
+    // a distributed enumeration
+    Matrix<double> R, RSquare, v;
+    double lambda=0;
+    if( commRank == 0 )
+    {
+        Matrix<double> BOrig;
+        KnapsackLattice( BOrig, n, range, 100. );
+        if( print )
+            Print( BOrig, "BOrig" );
+
+        BKZCtrl<double> ctrl;
+        ctrl.lllCtrl.delta = 0.99;
+
+        Matrix<double> B( BOrig );
+        LLL( B, ctrl.lllCtrl );
+        const double lllNorm =
+          CheckBasis( "LLL", BOrig, B, ctrl.lllCtrl, print );
+
+        // Pruned BKZ (with several rerandomized trials per block)
+        ctrl.blocksize = blocksize;
+        ctrl.numTrials = numTrials;
+        B = BOrig;
+        auto info = BKZ( B, R, ctrl );
+        Output
+        ("  BKZ(",blocksize,") took ",info.numTours," tours and ",
+         info.numInsertions," insertions");
+        const double bkzNorm =
+          CheckBasis( "Pruned BKZ", BOrig, B, ctrl.lllCtrl, print );
+        if( bkzNorm > lllNorm*(1+tol) )
+            LogicError("BKZ lengthened the leading basis vector");
+
+        // With a single block spanning the entire basis and neither pruning
+        // nor a Gaussian heuristic bound, the leading vector is within a
+        // factor of 1/sqrt(delta) of the shortest vector
+        ctrl.blocksize = n;
+        ctrl.numTrials = 1;
+        ctrl.prune = false;
+        ctrl.ghFactor = 0;
+        B = BOrig;
+        BKZ( B, R, ctrl );
+        const double hkzNorm =
+          CheckBasis( "Unpruned BKZ(n)", BOrig, B, ctrl.lllCtrl, print );
+
+        lambda = ShortestVectorEnumeration( B, R, v );
+        Output("  lambda_1 from enumeration = ",lambda);
+        if( hkzNorm > lambda/Sqrt(ctrl.lllCtrl.delta)*(1+enumTol) )
+            LogicError
+            ("BKZ(n) returned || b_0 ||_2 = ",hkzNorm,", but lambda_1 = ",
+             lambda);
+        Matrix<double> Bv;
+        Zeros( Bv, n+1, 1 );
+        Gemv( NORMAL, 1., B, v, 0., Bv );
+        const double enumNorm = FrobeniusNorm( Bv );
+        if( Abs(enumNorm-lambda) > enumTol*lambda )
+            LogicError
+            ("Enumeration returned ",lambda," but || B v ||_2 = ",enumNorm);
+
+        // A pruned enumeration may miss the shortest vector, but it cannot
+        // beat it
+        Matrix<double> vProb;
+        const double probNorm =
+          ShortestVectorEnumeration( B, R, vProb, true );
+        Output("  Norm from pruned enumeration = ",probNorm);
+        if( probNorm < lambda*(1-enumTol) )
+            LogicError("Pruned enumeration beat the shortest vector");
+
+        RSquare = R( IR(0,n), ALL );
+    }
+    else
+        Zeros( RSquare, n, n );
+    mpi::Broadcast( RSquare.Buffer(), n*n, 0, comm );
+    mpi::Broadcast( lambda, 0, comm );
+
+    // Since no vector is shorter than lambda_1, the distributed enumeration
+    // must reach lambda_1 starting from a looser bound
+    Matrix<double> coeffs, vPar;
+    const double parNorm =
+      svp::ParallelEnumeration( RSquare, coeffs, 2*lambda, vPar, comm );
+    if( commRank == 0 )
+        Output("  Norm from distributed enumeration = ",parNorm);
+    if( Abs(parNorm-lambda) > enumTol*lambda )
+        LogicError
+        ("Distributed enumeration returned ",parNorm,", but lambda_1 = ",
+         lambda);
+}
+
+// The block lattice with Gaussian Normal Form diag(10,...,10,1) has the
+// unique (up to sign) shortest vector e_{k-1}, and every other vector is at
+// least ten times longer. With linear pruning, the partial norm of e_{k-1}
+// over the last coordinate exceeds its pruning bound, so the first trial is
+// certain to miss, and the vector can only be found by a rerandomized trial.
+void TestRerandomizedTrials( Int k, Int numTrials, bool print )
+{
+    Output("Testing rerandomized block enumeration");
+    Matrix<double> R, coeffs, v;
+    Zeros( R, k, k );
+    for( Int i=0; i<k-1; ++i )
+        R.Set( i, i, 10. );
+    R.Set( k-1, k-1, 1. );
+    Zeros( coeffs, k, 1 );
+    for( Int i=0; i<k; ++i )
+        coeffs.Set( i, 0, double(i+1)/k );
+    const double radius = 1.5;
+    if( coeffs.Get(0,0)*radius*radius >= 1. )
+        LogicError("The first trial would not be certain to miss");
+
+    const double firstNorm =
+      bkz::BlockEnumeration( R, radius, coeffs, 1, v );
+    Output("  Single-trial result = ",firstNorm);
+    if( firstNorm < radius )
+        LogicError("The first trial was expected to miss");
+
+    const double norm =
+      bkz::BlockEnumeration( R, radius, coeffs, numTrials, v );
+    if( print )
+        Print( v, "v" );
+    Output("  ",numTrials,"-trial result = ",norm);
+    if( norm >= radius )
+        LogicError("None of the rerandomized trials succeeded");
+    if( v.Height() != k || v.Width() != 1 )
+        LogicError
+        ("v was ",v.Height()," x ",v.Width()," rather than ",k," x 1");
+    for( Int i=0; i<k-1; ++i )
+        if( v.Get(i,0) != 0. )
+            LogicError("v was not a multiple of e_{k-1}");
+    if( Abs(v.Get(k-1,0)) != 1. || norm != 1. )
+        LogicError("v was not +/- e_{k-1}");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int n = Input("--n","lattice dimension",30);
+        const double range =
+          Input("--range","range of the knapsack weights",1099511627776.);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",10);
+        const Int numTrials =
+          Input("--numTrials","enumeration trials per block",4);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestBKZ( n, range, blocksize, numTrials, print );
+        if( commRank == 0 )
+            TestRerandomizedTrials( 8, 20, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A wide integer matrix, B = G H, where G is m x r and H is r x n, so that
+// (generically) B has rank r <= m and a kernel of dimension n-r
+template<typename Real>
+void WideMatrix( Matrix<Real>& B, Int m, Int r, Int n )
+{
+    Matrix<Real> G, H;
+    Zeros( G, m, r );
+    Zeros( H, r, n );
+    for( Int j=0; j<r; ++j )
+        for( Int i=0; i<m; ++i )
+            G.Set( i, j, Real(Round(SampleUniform(-2.,2.))) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<r; ++i )
+            H.Set( i, j, Real(Round(SampleUniform(-3.,3.))) );
+    Zeros( B, m, n );
+    Gemm( NORMAL, NORMAL, Real(1), G, H, Real(0), B );
+}
+
+// Return || X - round(X) ||_max, overwriting X with round(X)
+template<typename Real>
+Real RoundError( Matrix<Real>& X )
+{
+    Matrix<Real> E( X );
+    Round( X );
+    E -= X;
+    return MaxNorm( E );
+}
+
+// Check that K is an integral basis for the kernel of B which generates the
+// same lattice as KRef. Since KRef is formed from the leading columns of a
+// unimodular transformation, it is a basis for the full integer kernel,
+// Z^n intersected with null(B), and so K is as well (i.e., K is saturated).
+template<typename Real>
+void CheckKernel
+( const string& label,
+  const Matrix<Real>& BOrig,
+  const Matrix<Real>& K,
+  const Matrix<Real>& KRef,
+  bool print )
+{
+    const Int m = BOrig.Height();
+    const Int k = K.Width();
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    if( print )
+        Print( K, label+" kernel" );
+    if( K.Height() != BOrig.Width() )
+        LogicError(label," kernel basis had the wrong height");
+
+    Matrix<Real> KRound( K );
+    const Real roundError = RoundError( KRound );
+    Matrix<Real> BK;
+    Zeros( BK, m, k );
+    Gemm( NORMAL, NORMAL, Real(1), BOrig, K, Real(0), BK );
+    const Real productNorm = MaxNorm( BK );
+
+    // K = KRef X and KRef = K Y for integral X and Y
+    Real coeffError=0, latticeError=0;
+    if( k == KRef.Width() && k > 0 )
+    {
+        Matrix<Real> X, Y, E;
+        LeastSquares( NORMAL, KRef, K, X );
+        LeastSquares( NORMAL, K, KRef, Y );
+        coeffError = Max( RoundError(X), RoundError(Y) );
+        E = K;
+        Gemm( NORMAL, NORMAL, Real(-1), KRef, X, Real(1), E );
+        latticeError = MaxNorm( E );
+        E = KRef;
+        Gemm( NORMAL, NORMAL, Real(-1), K, Y, Real(1), E );
+        latticeError = Max( latticeError, MaxNorm(E) );
+    }
+
+    Output
+    ("  ",label,":\n",
+     "    nullity (reference)         = ",k," (",KRef.Width(),")\n",
+     "    || round(K) - K ||_max      = ",roundError,"\n",
+     "    || B K ||_max               = ",productNorm,"\n",
+     "    || round(X) - X ||_max      = ",coeffError,"\n",
+     "    || K - KRef X ||_max        = ",latticeError);
+    if( k != KRef.Width() )
+        LogicError(label," kernel had the wrong dimension");
+    if( roundError != Real(0) || productNorm != Real(0) )
+        LogicError(label," did not return an integral kernel basis");
+    if( coeffError > tol || latticeError != Real(0) )
+        LogicError(label," kernel basis was not saturated");
+}
+
+template<typename Real>
+void TestKernel( Int m, Int r, Int n, Int blocksize, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    Matrix<Real> BOrig;
+    WideMatrix( BOrig, m, r, n );
+    if( print )
+        Print( BOrig, "BOrig" );
+
+    // The kernel from the unimodular transformation of an unblocked LLL
+    // (of B beneath n zero rows, which are claimed by the zero columns)
+    LLLCtrl<Real> ctrl;
+    ctrl.blockedCutoff = n+1;
+    Matrix<Real> B, U, UInv, R;
+    Zeros( B, n+m, n );
+    auto BB = B( IR(n,n+m), ALL );
+    BB = BOrig;
+    auto info = LLL( B, U, UInv, R, ctrl );
+    Matrix<Real> KRef = U( ALL, IR(0,info.nullity) );
+
+    // The streamed kernel, both directly and through LatticeKernel
+    ctrl.kernelBlocksize = blocksize;
+    Matrix<Real> M, K;
+    BlockedLatticeImageAndKernel( BOrig, M, K, ctrl );
+    CheckKernel( "BlockedLatticeImageAndKernel", BOrig, K, KRef, print );
+    if( M.Width() != n-info.nullity )
+        LogicError("The image had the wrong rank");
+
+    ctrl.kernelBlockedCutoff = 2;
+    B = BOrig;
+    LatticeKernel( B, K, ctrl );
+    CheckKernel( "Streamed LatticeKernel", BOrig, K, KRef, print );
+    const Int nullity = K.Width();
+    if( MaxNorm( B(ALL,IR(0,nullity)) ) != Real(0) )
+        LogicError("The leading columns of the overwritten B were nonzero");
+
+    // A single block should agree with the unblocked path
+    ctrl.kernelBlocksize = n;
+    BlockedLatticeImageAndKernel( BOrig, M, K, ctrl );
+    CheckKernel( "Single block", BOrig, K, KRef, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",6);
+        const Int r = Input("--r","rank of matrix",4);
+        const Int n = Input("--n","width of matrix",40);
+        const Int blocksize =
+          Input("--blocksize","number of streamed columns",8);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+        if( r > m || m >= n )
+            LogicError("Expected r <= m < n");
+
+        if( commRank == 0 )
+        {
+            TestKernel<float>( m, r, n/2, blocksize, print );
+            TestKernel<double>( m, r, n, blocksize, print );
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
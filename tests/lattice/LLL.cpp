@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A knapsack-style lattice, B = [I; N a^T], with a drawn uniformly from
+// the integers in [0,range). Since the top n rows of any basis B U of this
+// lattice are the unimodular transformation U itself, each reduction can be
+// checked without access to U.
+template<typename Real>
+void KnapsackLattice( Matrix<Real>& B, Int n, double range, Real N )
+{
+    Zeros( B, n+1, n );
+    for( Int j=0; j<n; ++j )
+    {
+        B.Set( j, j, Real(1) );
+        B.Set( n, j, N*Real(Round(SampleUniform(0.,range))) );
+    }
+}
+
+// Check that B is a basis for the same lattice as BOrig (with BOrig as
+// above) and that it is (delta,eta) LLL-reduced, returning || b_0 ||_2
+template<typename Real>
+Real CheckReduction
+( const string& label,
+  const Matrix<Real>& BOrig,
+  const Matrix<Real>& B,
+  const LLLCtrl<Real>& ctrl,
+  bool print )
+{
+    const Int n = B.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real slack = Sqrt(eps);
+    if( print )
+        Print( B, label+" basis" );
+
+    // U = B(0:n,:) must be integral, unimodular, and satisfy BOrig U = B
+    auto U = B( IR(0,n), ALL );
+    Matrix<Real> E( U );
+    Round( E );
+    E -= U;
+    const Real roundError = MaxNorm( E );
+    Matrix<Real> BU;
+    Zeros( BU, n+1, n );
+    Gemm( NORMAL, NORMAL, Real(1), BOrig, U, Real(0), BU );
+    BU -= B;
+    const Real basisError = MaxNorm( BU );
+    Matrix<Real> RU( U );
+    qr::ExplicitTriang( RU );
+    Real logDet = 0;
+    for( Int i=0; i<n; ++i )
+        logDet += Log(Abs(RU.Get(i,i)));
+
+    // The (delta,eta) reduction properties of a fresh QR factorization
+    Matrix<Real> R( B );
+    qr::ExplicitTriang( R );
+    Real delta = limits::Max<Real>(), eta = 0;
+    for( Int i=0; i<n-1; ++i )
+    {
+        const Real rho_i_i = R.Get(i,i);
+        const Real rho_i_ip1 = R.Get(i,i+1);
+        const Real rho_ip1_ip1 = R.Get(i+1,i+1);
+        delta =
+          Min
+          (delta,
+           (rho_ip1_ip1*rho_ip1_ip1+rho_i_ip1*rho_i_ip1)/(rho_i_i*rho_i_i));
+        for( Int j=i+1; j<n; ++j )
+            eta = Max(eta,Abs(R.Get(i,j)/rho_i_i));
+    }
+    const Real b0Norm = FrobeniusNorm( B(ALL,IR(0)) );
+
+    Output
+    ("  ",label,":\n",
+     "    || round(U) - U ||_max  = ",roundError,"\n",
+     "    || BOrig U - B ||_max   = ",basisError,"\n",
+     "    log |det(U)|            = ",logDet,"\n",
+     "    achieved (delta,eta)    = (",delta,",",eta,")\n",
+     "    || b_0 ||_2             = ",b0Norm);
+    if( roundError != Real(0) || basisError != Real(0) )
+        LogicError(label," did not return a basis of the same lattice");
+    if( Abs(logDet) > n*slack )
+        LogicError(label," did not apply a unimodular transformation");
+    if( delta < ctrl.delta-slack || eta > ctrl.eta+slack )
+        LogicError(label," did not return an LLL-reduced basis");
+    return b0Norm;
+}
+
+template<typename Real>
+void TestLLL( Int n, double range, Int blocksize, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    Matrix<Real> BOrig;
+    KnapsackLattice( BOrig, n, range, Real(100) );
+    if( print )
+        Print( BOrig, "BOrig" );
+
+    LLLCtrl<Real> ctrl;
+    ctrl.delta = Real(0.99);
+    ctrl.blocksize = blocksize;
+
+    // The unblocked LLL_NORMAL algorithm, which also returns U and U^{-1}
+    ctrl.variant = LLL_NORMAL;
+    ctrl.blockedCutoff = n+1;
+    Matrix<Real> B( BOrig ), U, UInv, R;
+    LLL( B, U, UInv, R, ctrl );
+    const Real normalNorm =
+      CheckReduction( "Unblocked LLL_NORMAL", BOrig, B, ctrl, print );
+    Matrix<Real> E;
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, Real(-1), U, UInv, Real(1), E );
+    const Real inverseError = MaxNorm( E );
+    Output("    || I - U inv(U) ||_max  = ",inverseError);
+    if( inverseError != Real(0) )
+        LogicError("U and inv(U) were not inverses");
+
+    // The windowed (Level 3) LLL_NORMAL algorithm
+    ctrl.blockedCutoff = 2;
+    B = BOrig;
+    LLL( B, ctrl );
+    CheckReduction( "Blocked LLL_NORMAL", BOrig, B, ctrl, print );
+    ctrl.blockedCutoff = n+1;
+
+    // Deep insertion should not produce a longer leading vector in practice,
+    // but this is not guaranteed, so it is only reported
+    ctrl.variant = LLL_DEEP;
+    B = BOrig;
+    LLL( B, ctrl );
+    const Real deepNorm =
+      CheckReduction( "LLL_DEEP", BOrig, B, ctrl, print );
+    Output
+    ("  || b_0 ||_2 for LLL_DEEP / LLL_NORMAL = ",deepNorm/normalNorm);
+
+    ctrl.variant = LLL_DEEP_REDUCE;
+    B = BOrig;
+    LLL( B, ctrl );
+    CheckReduction( "LLL_DEEP_REDUCE", BOrig, B, ctrl, print );
+
+    ctrl.variant = LLL_NORMAL;
+    B = BOrig;
+    AllSwapsLLL( B, ctrl );
+    CheckReduction( "Sequential all-swaps LLL", BOrig, B, ctrl, print );
+
+    B = BOrig;
+    AdaptiveLLL( B, ctrl );
+    CheckReduction( "Adaptive LLL", BOrig, B, ctrl, print );
+}
+
+void TestDistributedAllSwaps( Int n, double range, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    if( commRank == 0 )
+        Output("Testing distributed all-swaps LLL with double");
+
+    Matrix<double> BOrig;
+    if( commRank == 0 )
+        KnapsackLattice( BOrig, n, range, 100. );
+    else
+        Zeros( BOrig, n+1, n );
+    mpi::Broadcast( BOrig.Buffer(), (n+1)*n, 0, comm );
+
+    LLLCtrl<double> ctrl;
+    ctrl.delta = 0.99;
+    const Grid g( comm );
+    DistMatrix<double> B(g), R(g);
+    B.Resize( n+1, n );
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            B.SetLocal
+            ( iLoc, jLoc, BOrig.Get(B.GlobalRow(iLoc),B.GlobalCol(jLoc)) );
+    AllSwapsLLL( B, R, ctrl );
+
+    DistMatrix<double,STAR,STAR> B_STAR_STAR( B );
+    if( commRank == 0 )
+        CheckReduction
+        ( "Distributed all-swaps LLL", BOrig, B_STAR_STAR.Matrix(), ctrl,
+          print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int n = Input("--n","lattice dimension",40);
+        const double range =
+          Input("--range","range of the knapsack weights",1048576.);
+        const Int blocksize = Input("--blocksize","LLL window size",8);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            TestLLL<float>( n/2, range/1024, blocksize, print );
+            TestLLL<double>( n, range, blocksize, print );
+#ifdef EL_HAVE_QUAD
+            // Large enough weights that the adaptive LLL must proceed past
+            // double precision (to DoubleDouble)
+            TestLLL<Quad>( n/2, range*range*1024, blocksize, print );
+#endif
+        }
+        TestDistributedAllSwaps( n, range, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Since the integer relations of each x below form a one-dimensional
+// lattice, PSLQ must return exactly one relation, and it must be equal to
+// the known relation (up to its sign)
+template<typename Real>
+void CheckRelation
+( const string& label,
+  const Matrix<Real>& x,
+  const Matrix<Real>& U,
+        Int nullity,
+  const vector<Int>& relation,
+  bool print )
+{
+    const Int n = x.Height();
+    if( print )
+        Print( U, label+" U" );
+    Output("  ",label,": found ",nullity," relation(s)");
+    if( nullity != 1 )
+        LogicError(label," found ",nullity," relations rather than one");
+
+    auto u = U( ALL, IR(0) );
+    const Real sign =
+      ( u.Get(0,0)*Real(relation[0]) >= Real(0) ? Real(1) : Real(-1) );
+    Real relationError = 0;
+    for( Int i=0; i<n; ++i )
+        relationError =
+          Max( relationError, Abs(u.Get(i,0)-sign*Real(relation[i])) );
+    const Real residual = Abs(Dot(x,u)) / (FrobeniusNorm(x)*FrobeniusNorm(u));
+    Output
+    ("    || u -/+ uKnown ||_max          = ",relationError,"\n",
+     "    |x^T u| / (|| x ||_2 || u ||_2) = ",residual);
+    if( relationError != Real(0) )
+        LogicError(label," did not return the known relation");
+}
+
+template<typename Real>
+void TestPSLQ( bool lowerPrecision, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    PSLQCtrl<Real> ctrl;
+    ctrl.lowerPrecision = lowerPrecision;
+    ctrl.zeroTol = Pow(limits::Epsilon<Real>(),Real(0.8));
+
+    // log(2) + log(3) - log(6) = 0
+    Matrix<Real> x, U;
+    Zeros( x, 5, 1 );
+    x.Set( 0, 0, Log(Real(2)) );
+    x.Set( 1, 0, Log(Real(3)) );
+    x.Set( 2, 0, Log(Real(5)) );
+    x.Set( 3, 0, Log(Real(6)) );
+    x.Set( 4, 0, Log(Real(7)) );
+    auto info = PSLQ( x, U, ctrl );
+    Output
+    ("  PSLQ took ",info.numIts," iterations (",info.numLowerIts,
+     " in lower precision)");
+    CheckRelation( "Logarithms", x, U, info.nullity, {1,1,0,-1,0}, print );
+
+    Int nullity = ZDependenceSearch( x, U, ctrl );
+    CheckRelation
+    ( "Z-dependence search", x, U, nullity, {1,1,0,-1,0}, print );
+
+    // alpha = sqrt(2) + sqrt(3) is a root of 1 - 10 alpha^2 + alpha^4
+    Real alpha = Sqrt(Real(2)) + Sqrt(Real(3));
+    nullity = AlgebraicRelationSearch( alpha, 5, U, ctrl );
+    Zeros( x, 5, 1 );
+    for( Int j=0; j<5; ++j )
+        x.Set( j, 0, Pow(alpha,Real(j)) );
+    CheckRelation
+    ( "sqrt(2)+sqrt(3)", x, U, nullity, {1,0,-10,0,1}, print );
+
+    // alpha = 2^(1/3) + sqrt(3) is a root of
+    // -23 - 36 alpha + 27 alpha^2 - 4 alpha^3 - 9 alpha^4 + alpha^6
+    alpha = Pow(Real(2),Real(1)/Real(3)) + Sqrt(Real(3));
+    nullity = AlgebraicRelationSearch( alpha, 7, U, ctrl );
+    Zeros( x, 7, 1 );
+    for( Int j=0; j<7; ++j )
+        x.Set( j, 0, Pow(alpha,Real(j)) );
+    CheckRelation
+    ( "2^(1/3)+sqrt(3)", x, U, nullity, {-23,-36,27,-4,-9,0,1}, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            TestPSLQ<double>( true, print );
+#ifdef EL_HAVE_QUAD
+            // Once with every iteration in Quad precision, and once with
+            // most of the iterations in double precision
+            TestPSLQ<Quad>( false, print );
+            TestPSLQ<Quad>( true, print );
+#endif
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Check that v is an integer vector and that || B v ||_2 is the returned
+// norm, returning said norm
+double CheckVector
+( const string& label,
+  const Matrix<double>& B,
+  const Matrix<double>& v,
+        double norm,
+  bool print )
+{
+    if( print )
+        Print( v, label+" coordinates" );
+    Matrix<double> E( v );
+    Round( E );
+    E -= v;
+    const double roundError = MaxNorm( E );
+    Matrix<double> Bv;
+    Zeros( Bv, B.Height(), 1 );
+    Gemv( NORMAL, 1., B, v, 0., Bv );
+    const double BvNorm = FrobeniusNorm( Bv );
+    Output
+    ("  ",label,":\n",
+     "    || round(v) - v ||_max = ",roundError,"\n",
+     "    returned norm          = ",norm,"\n",
+     "    || B v ||_2            = ",BvNorm);
+    if( roundError != 0. )
+        LogicError(label," returned non-integer coordinates");
+    if( BvNorm == 0. )
+        LogicError(label," returned the zero vector");
+    if( Abs(BvNorm-norm) > Sqrt(limits::Epsilon<double>())*norm )
+        LogicError(label," returned an inconsistent norm");
+    return BvNorm;
+}
+
+// The checkerboard lattice D_n = { x in Z^n : sum(x) is even }, whose
+// minimum is sqrt(2), hidden behind a random unimodular transformation
+void TestCheckerboard( Int n, const SieveCtrl& ctrl, bool print )
+{
+    Output("Testing D_",n);
+    Matrix<double> B;
+    Zeros( B, n, n );
+    B.Set( 0, 0, 1. );
+    B.Set( 1, 0, 1. );
+    for( Int j=1; j<n; ++j )
+    {
+        B.Set( j-1, j, -1. );
+        B.Set( j, j, 1. );
+    }
+    for( Int round=0; round<3; ++round )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            const Int c = SampleUniform<Int>( 0, n );
+            const Int scale = SampleUniform<Int>( -2, 3 );
+            if( c == j || scale == 0 )
+                continue;
+            auto bj = B( ALL, IR(j) );
+            auto bc = B( ALL, IR(c) );
+            Axpy( double(scale), bc, bj );
+        }
+    }
+
+    Matrix<double> R, v;
+    LLLCtrl<double> lllCtrl;
+    lllCtrl.delta = 0.75;
+    LLL( B, R, lllCtrl );
+    Output("  || b_0 ||_2 after LLL = ",FrobeniusNorm(B(ALL,IR(0))));
+
+    const double lambda = Sqrt(2.);
+    const double tol = Sqrt(limits::Epsilon<double>());
+    const double sieveNorm = ShortestVectorSieve( B, R, v, ctrl );
+    CheckVector( "Shortest vector sieve", B, v, sieveNorm, print );
+    if( Abs(sieveNorm-lambda) > tol*lambda )
+        LogicError("The sieve did not find a shortest vector of D_",n);
+
+    const double bound = lambda*(1+Sqrt(tol));
+    const double shortNorm = ShortVectorSieve( B, R, bound, v, ctrl );
+    if( shortNorm >= bound )
+        LogicError("The sieve did not find a vector shorter than ",bound);
+    CheckVector( "Short vector sieve", B, v, shortNorm, print );
+}
+
+// A knapsack-style lattice, B = [I; N a^T], whose minimum is computed via
+// enumeration. Since the sieve is heuristic, it is only required to return
+// a lattice vector which is no longer than the leading LLL basis vector.
+void TestKnapsack
+( Int n, double range, const SieveCtrl& ctrl, bool print )
+{
+    Output("Testing a ",n,"-dimensional knapsack lattice");
+    Matrix<double> B;
+    Zeros( B, n+1, n );
+    for( Int j=0; j<n; ++j )
+    {
+        B.Set( j, j, 1. );
+        B.Set( n, j, 100*Round(SampleUniform(0.,range)) );
+    }
+
+    Matrix<double> R, v;
+    LLLCtrl<double> lllCtrl;
+    lllCtrl.delta = 0.99;
+    LLL( B, R, lllCtrl );
+    const double b0Norm = FrobeniusNorm( B(ALL,IR(0)) );
+
+    const double tol = Sqrt(limits::Epsilon<double>());
+    const double sieveNorm = ShortestVectorSieve( B, R, v, ctrl );
+    CheckVector( "Shortest vector sieve", B, v, sieveNorm, print );
+
+    Matrix<double> BEnum( B ), REnum, vEnum;
+    BKZCtrl<double> bkzCtrl;
+    bkzCtrl.lllCtrl = lllCtrl;
+    BKZ( BEnum, REnum, bkzCtrl );
+    const double lambda = ShortestVectorEnumeration( BEnum, REnum, vEnum );
+    Output
+    ("  || b_0 ||_2 after LLL = ",b0Norm,"\n",
+     "  lambda_1 from enumeration = ",lambda,"\n",
+     "  sieve norm / lambda_1 = ",sieveNorm/lambda);
+    if( sieveNorm > b0Norm*(1+tol) )
+        LogicError("The sieve returned a vector longer than b_0");
+    if( sieveNorm < lambda*(1-tol) )
+        LogicError("The sieve beat the shortest vector");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int nCheck =
+          Input("--nCheck","dimension of the checkerboard lattice",24);
+        const Int n = Input("--n","dimension of the knapsack lattice",40);
+        const double range =
+          Input("--range","range of the knapsack weights",1099511627776.);
+        const bool progressive =
+          Input("--progressive","progressive sieving?",true);
+        const bool simHash = Input("--simHash","SimHash filtering?",true);
+        const bool print = Input("--print","print vectors?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SieveCtrl ctrl;
+        ctrl.progressive = progressive;
+        ctrl.simHash = simHash;
+        if( commRank == 0 )
+        {
+            TestCheckerboard( nCheck, ctrl, print );
+            TestKnapsack( n, range, ctrl, print );
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
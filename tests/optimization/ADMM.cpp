@@ -0,0 +1,339 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve small sparse conic programs in affine form,
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, -x + s = 0, s in K,
+//
+// where K is either the positive orthant (a QP) or a product of second-order
+// cones (an SOCP, with Q = 0), using the operator-splitting ADMM with both
+// the sparse-direct (quasi-definite LDL) and the indirect (preconditioned CG)
+// solvers for its KKT systems, and compare the results against those of the
+// Interior Point Methods. The cone projection which each ADMM iteration
+// relies upon, soc::Project, is also checked against known projections.
+
+// Row i of the m x n test matrix (with m <= n) has a unit diagonal entry and
+// three deterministic entries from the trailing n-m columns
+template<typename Real>
+void TestMatrix( DistSparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 4*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueUpdate( i, i, Real(1) );
+        for( Int t=1; t<4; ++t )
+            A.QueueUpdate
+            ( i, m+(3*i+7*t)%(n-m), Real(1+(i+t)%5)/Real(4) );
+    }
+    A.ProcessQueues();
+}
+
+// Each cone of order 'order' has its root at the first of its indices
+void TestCones
+( DistMultiVec<Int>& orders, DistMultiVec<Int>& firstInds,
+  Int n, Int order )
+{
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int iLoc=0; iLoc<orders.LocalHeight(); ++iLoc )
+    {
+        const Int i = orders.GlobalRow(iLoc);
+        orders.SetLocal( iLoc, 0, order );
+        firstInds.SetLocal( iLoc, 0, i-(i%order) );
+    }
+}
+
+// The member of the interior of each cone with root 1 and remaining entries
+// 1/(2 order)
+template<typename Real>
+void InteriorPoint( DistMultiVec<Real>& x, Int n, Int order )
+{
+    Zeros( x, n, 1 );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        x.SetLocal
+        ( iLoc, 0, i%order == 0 ? Real(1) : Real(1)/Real(2*order) );
+    }
+}
+
+// Form b and c from a strictly feasible primal-dual point so that the
+// problem has a finite optimum
+template<typename Real>
+void TestProblem
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  Int order,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm()), z0(A.Comm());
+    InteriorPoint( x0, n, order );
+    Uniform( y0, m, 1 );
+    InteriorPoint( z0, n, order );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( NORMAL, Real(-1), Q, x0, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+Real Objective
+( const DistSparseMatrix<Real>& Q,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& x )
+{
+    DistMultiVec<Real> Qx(x.Comm());
+    Zeros( Qx, x.Height(), 1 );
+    Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+    return Dot(x,Qx)/Real(2) + Dot(c,x);
+}
+
+// Check that x is (nearly) feasible and that its objective (nearly) matches
+// that of the reference solution
+template<typename Real>
+void CheckSolution
+( const string& label,
+  const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const DistMultiVec<Real>& x,
+        Real refObj,
+        Real tol,
+        Int numIts )
+{
+    const bool amRoot = ( mpi::Rank(A.Comm()) == 0 );
+
+    // || A x - b ||_2 / (1 + || b ||_2)
+    DistMultiVec<Real> r( b );
+    Multiply( NORMAL, Real(1), A, x, Real(-1), r );
+    const Real primalRes = FrobeniusNorm( r ) / (1+FrobeniusNorm(b));
+
+    // The distance of x from the cone, relative to || x ||_2
+    DistMultiVec<Real> xProj( x );
+    soc::Project( xProj, orders, firstInds );
+    xProj -= x;
+    const Real coneDist = FrobeniusNorm( xProj ) / (1+FrobeniusNorm(x));
+
+    const Real obj = Objective( Q, c, x );
+    const Real objError = Abs(obj-refObj) / (1+Abs(refObj));
+    if( amRoot )
+        Output
+        ("  ",label,(numIts >= 0 ? " ("+std::to_string(numIts)+" its)" : ""),
+         ":\n",
+         "    || A x - b ||_2 / (1 + || b ||_2) = ",primalRes,"\n",
+         "    dist(x,K) / (1 + || x ||_2)     = ",coneDist,"\n",
+         "    objective                       = ",obj,"\n",
+         "    relative objective error        = ",objError);
+    if( primalRes > tol || coneDist > tol )
+        LogicError(label," returned an infeasible point");
+    if( objError > tol )
+        LogicError(label," did not reach the optimal objective");
+}
+
+template<typename Real>
+void TestADMM
+( const string& label,
+  const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        Real refObj,
+  bool print )
+{
+    mpi::Comm comm = A.Comm();
+    const Int n = A.Width();
+
+    // G = -I and h = 0
+    DistSparseMatrix<Real> G(comm);
+    Identity( G, n, n );
+    G *= Real(-1);
+    DistMultiVec<Real> h(comm), x(comm), y(comm), z(comm), s(comm);
+    Zeros( h, n, 1 );
+
+    SplittingCtrl<Real> ctrl;
+    ctrl.absTol = Pow(limits::Epsilon<Real>(),Real(0.4));
+    ctrl.relTol = Pow(limits::Epsilon<Real>(),Real(0.4));
+    ctrl.maxIter = 20000;
+    ctrl.print = print && mpi::Rank(comm) == 0;
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    ctrl.solver = SPLITTING_DIRECT;
+    Int numIts =
+      splitting::ADMM( Q, A, G, b, c, h, orders, firstInds, x, y, z, s, ctrl );
+    CheckSolution
+    ( label+" ADMM with LDL", Q, A, b, c, orders, firstInds, x, refObj, tol,
+      numIts );
+
+    ctrl.solver = SPLITTING_INDIRECT;
+    numIts =
+      splitting::ADMM( Q, A, G, b, c, h, orders, firstInds, x, y, z, s, ctrl );
+    CheckSolution
+    ( label+" ADMM with CG", Q, A, b, c, orders, firstInds, x, refObj, tol,
+      numIts );
+}
+
+template<typename Real>
+void TestQP( Int m, Int n, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    if( amRoot )
+        Output("Testing a QP over the positive orthant");
+
+    // Since Elemental's 1D Laplacian is negative-definite, Q is its (scaled)
+    // negation, which is symmetric positive-definite
+    DistSparseMatrix<Real> Q(comm), A(comm);
+    Laplacian( Q, n );
+    Q *= Real(-1)/Real((n+1)*(n+1));
+    TestMatrix( A, m, n );
+    DistMultiVec<Real> b(comm), c(comm);
+    TestProblem( Q, A, 1, b, c );
+    DistMultiVec<Int> orders(comm), firstInds(comm);
+    TestCones( orders, firstInds, n, 1 );
+
+    DistMultiVec<Real> x(comm), y(comm), z(comm);
+    qp::direct::Ctrl<Real> ipmCtrl;
+    QP( Q, A, b, c, x, y, z, ipmCtrl );
+    const Real refObj = Objective( Q, c, x );
+    CheckSolution
+    ( "QP IPM", Q, A, b, c, orders, firstInds, x, refObj,
+      Pow(limits::Epsilon<Real>(),Real(0.3)), -1 );
+
+    TestADMM( "QP", Q, A, b, c, orders, firstInds, refObj, print );
+}
+
+template<typename Real>
+void TestSOCP( Int m, Int n, Int order, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    if( amRoot )
+        Output("Testing an SOCP over cones of order ",order);
+
+    DistSparseMatrix<Real> Q(comm), A(comm);
+    Zeros( Q, n, n );
+    TestMatrix( A, m, n );
+    DistMultiVec<Real> b(comm), c(comm);
+    TestProblem( Q, A, order, b, c );
+    DistMultiVec<Int> orders(comm), firstInds(comm);
+    TestCones( orders, firstInds, n, order );
+
+    DistMultiVec<Real> x(comm), y(comm), z(comm);
+    socp::direct::Ctrl<Real> ipmCtrl;
+    SOCP( A, b, c, orders, firstInds, x, y, z, ipmCtrl );
+    const Real refObj = Objective( Q, c, x );
+    CheckSolution
+    ( "SOCP IPM", Q, A, b, c, orders, firstInds, x, refObj,
+      Pow(limits::Epsilon<Real>(),Real(0.3)), -1 );
+
+    TestADMM( "SOCP", Q, A, b, c, orders, firstInds, refObj, print );
+}
+
+// Three cones of order three, with members (2,1,1) inside the cone,
+// (-2,1,1) inside the polar cone, and (0,3,4) outside of both, whose
+// projections are (2,1,1), (0,0,0), and (5/2)(1,3/5,4/5) = (5/2,3/2,2),
+// followed by two cones of order one with members 3 and -2, whose
+// projections are 3 and 0.
+template<typename Real>
+void TestProject()
+{
+    const Real eps = limits::Epsilon<Real>();
+    const Int n = 11;
+    const Real xVals[n] = { 2, 1, 1, -2, 1, 1, 0, 3, 4, 3, -2 };
+    const Real pVals[n] =
+      { 2, 1, 1, 0, 0, 0, Real(5)/Real(2), Real(3)/Real(2), 2, 3, 0 };
+    const Int firstVals[n] = { 0, 0, 0, 3, 3, 3, 6, 6, 6, 9, 10 };
+    const Int orderVals[n] = { 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1 };
+
+    Matrix<Real> x;
+    Matrix<Int> orders, firstInds;
+    Zeros( x, n, 1 );
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        x.Set( i, 0, xVals[i] );
+        orders.Set( i, 0, orderVals[i] );
+        firstInds.Set( i, 0, firstVals[i] );
+    }
+    soc::Project( x, orders, firstInds );
+    for( Int i=0; i<n; ++i )
+        if( Abs(x.Get(i,0)-pVals[i]) > 10*eps )
+            LogicError
+            ("soc::Project returned ",x.Get(i,0)," rather than ",pVals[i],
+             " for entry ",i);
+
+    // The distributed variant (with a cutoff forcing the distributed path)
+    mpi::Comm comm = mpi::COMM_WORLD;
+    DistMultiVec<Real> xDist(comm);
+    DistMultiVec<Int> ordersDist(comm), firstIndsDist(comm);
+    Zeros( xDist, n, 1 );
+    Zeros( ordersDist, n, 1 );
+    Zeros( firstIndsDist, n, 1 );
+    for( Int iLoc=0; iLoc<xDist.LocalHeight(); ++iLoc )
+    {
+        const Int i = xDist.GlobalRow(iLoc);
+        xDist.SetLocal( iLoc, 0, xVals[i] );
+        ordersDist.SetLocal( iLoc, 0, orderVals[i] );
+        firstIndsDist.SetLocal( iLoc, 0, firstVals[i] );
+    }
+    soc::Project( xDist, ordersDist, firstIndsDist, 1 );
+    for( Int iLoc=0; iLoc<xDist.LocalHeight(); ++iLoc )
+    {
+        const Int i = xDist.GlobalRow(iLoc);
+        if( Abs(xDist.GetLocal(iLoc,0)-pVals[i]) > 10*eps )
+            LogicError
+            ("Distributed soc::Project returned ",xDist.GetLocal(iLoc,0),
+             " rather than ",pVals[i]," for entry ",i);
+    }
+    if( mpi::Rank(comm) == 0 )
+        Output("soc::Project: PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",20);
+        const Int n = Input("--n","number of variables",40);
+        const Int order = Input("--order","order of the SOCs",4);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+        if( n % order != 0 )
+            LogicError("The SOC order must divide the number of variables");
+
+        TestProject<double>();
+        TestQP<double>( m, n, print );
+        TestSOCP<double>( m, n, order, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,458 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve sparse "direct" conic-form LPs,
+//
+//   min c^T x, s.t. A x = b, x >= 0,
+//   max -b^T y, s.t. A^T y - z + c = 0, z >= 0,
+//
+// with each of the sparse KKT formulations (which run several Interior Point
+// iterations that update a cached KKT matrix in-place), as well as in
+// batches, with presolve, and with dense columns, and check the primal and
+// dual residuals and the duality gap of the results.
+
+// Row i of the m x n test matrix (with m <= n) has a unit diagonal entry and
+// three deterministic entries from the trailing n-m columns
+template<typename Real>
+void QueueTestRow( Int i, Int m, Int n, vector<Int>& cols, vector<Real>& vals )
+{
+    cols.resize( 4 );
+    vals.resize( 4 );
+    cols[0] = i;
+    vals[0] = Real(1);
+    for( Int t=1; t<4; ++t )
+    {
+        cols[t] = m + (3*i+7*t) % (n-m);
+        vals[t] = Real(1+(i+t)%5) / Real(4);
+    }
+}
+
+template<typename Real>
+void TestMatrix( SparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 4*m );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int i=0; i<m; ++i )
+    {
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void TestMatrix( DistSparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 4*localHeight );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.ProcessQueues();
+}
+
+// Form b and c from a strictly feasible primal-dual point so that the
+// problem has a finite optimum
+template<typename Real>
+void TestProblem
+( const SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Real> x0, y0, z0;
+    Uniform( x0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Uniform( y0, m, 1 );
+    Uniform( z0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void TestProblem
+( const DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm()), z0(A.Comm());
+    Uniform( x0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Uniform( y0, m, 1 );
+    Uniform( z0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real,class SparseMat,class Vec>
+void CheckSolution
+( const string& label,
+  const SparseMat& A, const Vec& b, const Vec& c,
+  const Vec& x, const Vec& y, const Vec& z,
+  bool print )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    // || A x - b ||_2 / (1 + || b ||_2)
+    Vec r( b );
+    Multiply( NORMAL, Real(1), A, x, Real(-1), r );
+    const Real primalRes = FrobeniusNorm( r ) / (1+FrobeniusNorm(b));
+
+    // || A^T y - z + c ||_2 / (1 + || c ||_2)
+    Vec s( c );
+    s -= z;
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), s );
+    const Real dualRes = FrobeniusNorm( s ) / (1+FrobeniusNorm(c));
+
+    // | c^T x + b^T y | / (1 + | c^T x |)
+    const Real primObj = Dot( c, x );
+    const Real dualObj = -Dot( b, y );
+    const Real relGap = Abs(primObj-dualObj) / (1+Abs(primObj));
+
+    if( print )
+        Output
+        ("  ",label,":\n",
+         "    || A x - b ||_2 / (1 + || b ||_2)         = ",primalRes,"\n",
+         "    || A^T y - z + c ||_2 / (1 + || c ||_2)   = ",dualRes,"\n",
+         "    | c^T x + b^T y | / (1 + | c^T x |)       = ",relGap);
+    if( primalRes > tol || dualRes > tol || relGap > tol )
+        LogicError(label," LP solution was inaccurate");
+}
+
+template<typename Real>
+void TestSequential( Int m, Int n, bool print )
+{
+    const bool amRoot = ( mpi::Rank() == 0 );
+    SparseMatrix<Real> A;
+    Matrix<Real> b, c, x, y, z;
+    TestMatrix( A, m, n );
+    TestProblem( A, b, c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print && amRoot;
+
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Sequential FULL_KKT", A, b, c, x, y, z, amRoot );
+
+    ctrl.mehrotraCtrl.system = AUGMENTED_KKT;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Sequential AUGMENTED_KKT", A, b, c, x, y, z, amRoot );
+}
+
+template<typename Real>
+void TestDistributed( Int m, Int n, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    DistSparseMatrix<Real> A(comm);
+    DistMultiVec<Real> b(comm), c(comm), x(comm), y(comm), z(comm);
+    TestMatrix( A, m, n );
+    TestProblem( A, b, c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print && amRoot;
+
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed FULL_KKT", A, b, c, x, y, z, amRoot );
+
+    ctrl.mehrotraCtrl.system = AUGMENTED_KKT;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed AUGMENTED_KKT", A, b, c, x, y, z, amRoot );
+}
+
+// Solve a batch of problems which share their matrices across the processes
+// of COMM_WORLD (with warm starts) and check each of the solutions. Then
+// make the last problem infeasible and ensure that every process throws.
+template<typename Real>
+void TestBatch( Int m, Int n, Int numProblems, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    SparseMatrix<Real> A;
+    TestMatrix( A, m, n );
+
+    // Since the random right-hand sides and costs differ between processes,
+    // those of the root are broadcast
+    Matrix<Real> B, C, b, c, x, y, z;
+    Zeros( B, m, numProblems );
+    Zeros( C, n, numProblems );
+    for( Int k=0; k<numProblems; ++k )
+    {
+        TestProblem( A, b, c );
+        auto bk = B( ALL, IR(k) );
+        auto ck = C( ALL, IR(k) );
+        bk = b;
+        ck = c;
+    }
+    mpi::Broadcast( B.Buffer(), m*numProblems, 0, comm );
+    mpi::Broadcast( C.Buffer(), n*numProblems, 0, comm );
+
+    lp::direct::BatchCtrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    ctrl.progress = print && amRoot;
+    Matrix<Real> X, Y, Z;
+    Matrix<Int> numIts;
+    LP( A, B, C, X, Y, Z, numIts, ctrl, comm );
+    for( Int k=0; k<numProblems; ++k )
+    {
+        b = B( ALL, IR(k) );
+        c = C( ALL, IR(k) );
+        x = X( ALL, IR(k) );
+        y = Y( ALL, IR(k) );
+        z = Z( ALL, IR(k) );
+        CheckSolution<Real>
+        ( BuildString("Batch problem ",k), A, b, c, x, y, z, amRoot );
+    }
+
+    // Since every entry of A is positive, A x = -1 has no solution x >= 0
+    auto bLast = B( ALL, IR(numProblems-1) );
+    Fill( bLast, Real(-1) );
+    ctrl.mehrotraCtrl.maxIts = 30;
+    bool threw = false;
+    try
+    {
+        LP( A, B, C, X, Y, Z, numIts, ctrl, comm );
+    }
+    catch( std::exception& e )
+    {
+        threw = true;
+        if( amRoot )
+            Output("  Infeasible batch threw: ",e.what());
+    }
+    if( !threw )
+        LogicError("An infeasible batch problem did not throw");
+}
+
+// An (m+1) x (n+1) problem with a singleton row, which fixes x(n-1), and a
+// column, x(n), which only appears in row 0 and is implied to be
+// nonnegative, so that presolve eliminates both rows and the postsolve must
+// recover their multipliers
+template<typename Real>
+void PresolveTestMatrix( SparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m+1, n+1 );
+    A.Reserve( 4*m+2 );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int i=0; i<m; ++i )
+    {
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.QueueUpdate( 0, n, Real(-1) );
+    A.QueueUpdate( m, n-1, Real(2) );
+    A.ProcessQueues();
+}
+
+// Solve a small problem with and without presolve and check that the
+// postsolved primal-dual solution is as accurate as the original one
+template<typename Real>
+void TestPresolve( Int m, Int n, bool print )
+{
+    const bool amRoot = ( mpi::Rank() == 0 );
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    SparseMatrix<Real> A;
+    PresolveTestMatrix( A, m, n );
+
+    // Since the other entries of row 0 are positive and at most 5/4, making
+    // x0(n) large ensures that b(0) <= 0, so that x(n) is implied free
+    Matrix<Real> b, c, x0, y0, z0;
+    Uniform( x0, n+1, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    x0.Set( n, 0, Real(20) );
+    Uniform( y0, m+1, 1 );
+    Uniform( z0, n+1, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m+1, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+    auto objective = [&]( const Matrix<Real>& x ) { return Dot( c, x ); };
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    Matrix<Real> x, y, z;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Without presolve", A, b, c, x, y, z, amRoot );
+    const Real obj = objective( x );
+
+    ctrl.presolve = true;
+    ctrl.presolveCtrl.progress = print && amRoot;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "With presolve", A, b, c, x, y, z, amRoot );
+    for( Int j=0; j<n+1; ++j )
+        if( z.Get(j,0) < -tol*(1+MaxNorm(c)) )
+            LogicError("Postsolved z(",j,")=",z.Get(j,0)," was negative");
+    const Real objPre = objective( x );
+    if( amRoot )
+        Output("  objectives without and with presolve: ",obj,", ",objPre);
+    if( Abs(obj-objPre) > tol*(1+Abs(obj)) )
+        LogicError("Presolve changed the optimal objective");
+}
+
+// An m x (n+numDense) problem whose trailing 'numDense' columns are
+// completely dense, so that, with NORMAL_KKT, they are split off of the sparse
+// normal matrix and handled as a low-rank correction
+template<typename Real>
+void DenseColumnTestMatrix( SparseMatrix<Real>& A, Int m, Int n, Int numDense )
+{
+    Zeros( A, m, n+numDense );
+    A.Reserve( (4+numDense)*m );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int i=0; i<m; ++i )
+    {
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+        for( Int l=0; l<numDense; ++l )
+            A.QueueUpdate( i, n+l, Real(1+(i+l)%3)/Real(2) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void DenseColumnTestMatrix
+( DistSparseMatrix<Real>& A, Int m, Int n, Int numDense )
+{
+    Zeros( A, m, n+numDense );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( (4+numDense)*localHeight );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+        for( Int l=0; l<numDense; ++l )
+            A.QueueUpdate( i, n+l, Real(1+(i+l)%3)/Real(2) );
+    }
+    A.ProcessQueues();
+}
+
+// Solve a problem with a few dense columns via NORMAL_KKT with and without
+// the low-rank treatment of the dense columns and check that both solutions
+// are accurate and have the same objective
+template<typename Real>
+void TestDenseColumns( Int m, Int n, Int numDense, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+
+    if( amRoot )
+    {
+        SparseMatrix<Real> A;
+        Matrix<Real> b, c, x, y, z;
+        DenseColumnTestMatrix( A, m, n, numDense );
+        TestProblem( A, b, c );
+
+        ctrl.mehrotraCtrl.denseCols = false;
+        LP( A, b, c, x, y, z, ctrl );
+        CheckSolution<Real>
+        ( "Sequential NORMAL_KKT", A, b, c, x, y, z, true );
+        const Real obj = Dot( c, x );
+
+        ctrl.mehrotraCtrl.denseCols = true;
+        LP( A, b, c, x, y, z, ctrl );
+        CheckSolution<Real>
+        ( "Sequential NORMAL_KKT with dense columns", A, b, c, x, y, z,
+          true );
+        const Real objDense = Dot( c, x );
+        Output
+        ("  objectives without and with dense columns: ",obj,", ",objDense);
+        if( Abs(obj-objDense) > tol*(1+Abs(obj)) )
+            LogicError("The dense column treatment changed the objective");
+    }
+
+    DistSparseMatrix<Real> A(comm);
+    DistMultiVec<Real> b(comm), c(comm), x(comm), y(comm), z(comm);
+    DenseColumnTestMatrix( A, m, n, numDense );
+    TestProblem( A, b, c );
+
+    ctrl.mehrotraCtrl.denseCols = false;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed NORMAL_KKT", A, b, c, x, y, z, amRoot );
+    const Real obj = Dot( c, x );
+
+    ctrl.mehrotraCtrl.denseCols = true;
+    LP( A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed NORMAL_KKT with dense columns", A, b, c, x, y, z,
+      amRoot );
+    const Real objDense = Dot( c, x );
+    if( amRoot )
+        Output
+        ("  objectives without and with dense columns: ",obj,", ",objDense);
+    if( Abs(obj-objDense) > tol*(1+Abs(obj)) )
+        LogicError("The dense column treatment changed the objective");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int m = Input("--m","height of A",60);
+        const Int n = Input("--n","width of A",100);
+        const Int numProblems =
+          Input("--numProblems","number of problems in the batch",6);
+        const Int numDense =
+          Input("--numDense","number of dense columns",3);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestSequential<double>( m, n, print );
+        TestDistributed<double>( m, n, print );
+        TestBatch<double>( m, n, numProblems, print );
+        TestPresolve<double>( m, n, print );
+        TestDenseColumns<double>( m, n, numDense, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Run the HALS and block principal pivoting NMF approaches one iteration at
+// a time on a (slightly perturbed) nonnegative matrix of rank k and check
+// that the factors remain nonnegative and that the relative residual,
+// || A - X Y^T ||_F / || A ||_F, never increases (each half-step exactly
+// minimizes over a block of variables). The distributed implementation is
+// then checked against the sequential one.
+
+template<typename Real>
+Real RelResidual
+( const Matrix<Real>& A, const Matrix<Real>& X, const Matrix<Real>& Y )
+{
+    Matrix<Real> E( A );
+    Gemm( NORMAL, ADJOINT, Real(-1), X, Y, Real(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( A );
+}
+
+string ApproachName( NMFApproach approach )
+{ return approach == NMF_HALS ? "NMF_HALS" : "NMF_BPP"; }
+
+template<typename Real>
+Real TestApproach
+( NMFApproach approach,
+  const Matrix<Real>& A, const Matrix<Real>& XInit, Int numIts, bool print )
+{
+    const Real slack = 10*limits::Epsilon<Real>();
+    NMFCtrl<Real> ctrl;
+    ctrl.approach = approach;
+    ctrl.maxIter = 1;
+
+    Matrix<Real> X( XInit ), Y;
+    Real relResid = limits::Max<Real>(), firstResid = 0;
+    for( Int iter=0; iter<numIts; ++iter )
+    {
+        NMF( A, X, Y, ctrl );
+        if( MinLoc(X).value < Real(0) )
+            LogicError(ApproachName(approach)," produced a negative X");
+        if( MinLoc(Y).value < Real(0) )
+            LogicError(ApproachName(approach)," produced a negative Y");
+        const Real newResid = RelResidual( A, X, Y );
+        if( print )
+            Output("    iteration ",iter,": ",newResid);
+        if( newResid > relResid*(1+slack) )
+            LogicError
+            (ApproachName(approach)," increased the residual from ",
+             relResid," to ",newResid," in iteration ",iter);
+        if( iter == 0 )
+            firstResid = newResid;
+        relResid = newResid;
+    }
+    Output
+    ("  ",ApproachName(approach),": relative residual decreased from ",
+     firstResid," to ",relResid);
+    if( relResid >= firstResid )
+        LogicError(ApproachName(approach)," made no progress");
+    return relResid;
+}
+
+template<typename Real>
+void TestNMF( Int m, Int n, Int k, Int numIts, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    if( amRoot )
+        Output("Testing with ",TypeName<Real>());
+
+    // A = X0 Y0^T + E, with nonnegative X0, Y0, and E
+    Matrix<Real> A, XInit;
+    if( amRoot )
+    {
+        Matrix<Real> X0, Y0;
+        Uniform( X0, m, k, Real(1)/Real(2), Real(1)/Real(2) );
+        Uniform( Y0, n, k, Real(1)/Real(2), Real(1)/Real(2) );
+        Uniform( A, m, n, Real(1)/Real(200), Real(1)/Real(200) );
+        Gemm( NORMAL, ADJOINT, Real(1), X0, Y0, Real(1), A );
+        Uniform( XInit, m, k, Real(1)/Real(2), Real(1)/Real(2) );
+    }
+    else
+    {
+        Zeros( A, m, n );
+        Zeros( XInit, m, k );
+    }
+    mpi::Broadcast( A.Buffer(), m*n, 0, comm );
+    mpi::Broadcast( XInit.Buffer(), m*k, 0, comm );
+
+    for( auto approach : { NMF_HALS, NMF_BPP } )
+    {
+        Real seqResid = 0;
+        if( amRoot )
+            seqResid = TestApproach( approach, A, XInit, numIts, print );
+        mpi::Broadcast( seqResid, 0, comm );
+
+        const Grid g( comm );
+        DistMatrix<Real,STAR,STAR> A_STAR_STAR(g), X_STAR_STAR(g);
+        A_STAR_STAR.Resize( m, n );
+        A_STAR_STAR.Matrix() = A;
+        X_STAR_STAR.Resize( m, k );
+        X_STAR_STAR.Matrix() = XInit;
+        DistMatrix<Real> ADist( A_STAR_STAR ), X( X_STAR_STAR ), Y(g);
+        NMFCtrl<Real> ctrl;
+        ctrl.approach = approach;
+        ctrl.maxIter = numIts;
+        NMF( ADist, X, Y, ctrl );
+        DistMatrix<Real,STAR,STAR> XFinal( X ), YFinal( Y );
+        const Real distResid =
+          RelResidual( A, XFinal.Matrix(), YFinal.Matrix() );
+        if( amRoot )
+            Output
+            ("  Distributed ",ApproachName(approach),
+             ": relative residual = ",distResid);
+        if( MinLoc(XFinal.Matrix()).value < Real(0) ||
+            MinLoc(YFinal.Matrix()).value < Real(0) )
+            LogicError
+            ("Distributed ",ApproachName(approach),
+             " produced a negative factor");
+        if( Abs(distResid-seqResid) > tol*seqResid )
+            LogicError
+            ("Distributed ",ApproachName(approach),
+             " did not match the sequential residual");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of A",60);
+        const Int n = Input("--n","width of A",40);
+        const Int k = Input("--k","rank of the factorization",5);
+        const Int numIts = Input("--numIts","number of iterations",20);
+        const bool print = Input("--print","print residuals?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestNMF<double>( m, n, k, numIts, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the (vectorized) entrywise proximal maps and the fused ADMM
+// proximal update against straightforward scalar implementations. The maps
+// are applied to views with a leading dimension larger than their height so
+// that the column-wise loops must skip the surrounding entries, which are
+// checked to be left untouched.
+
+template<typename Real>
+Real RefSoftThreshold( Real alpha, Real tau )
+{
+    if( alpha > tau )
+        return alpha - tau;
+    else if( alpha < -tau )
+        return alpha + tau;
+    else
+        return 0;
+}
+
+template<typename Real>
+Complex<Real> RefSoftThreshold( const Complex<Real>& alpha, Real tau )
+{
+    const Real scale = Abs(alpha);
+    if( scale <= tau )
+        return 0;
+    return alpha*((scale-tau)/scale);
+}
+
+template<typename Real>
+Real RefHingeLossProx( Real alpha, Real tau )
+{
+    if( alpha >= Real(1) )
+        return alpha;
+    return Min( alpha+1/tau, Real(1) );
+}
+
+template<typename F>
+void CheckMap
+( const string& label,
+  const Matrix<F>& AOrig,
+  const Matrix<F>& A,
+  function<F(const F&)> refMap,
+  Base<F> tol )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Base<F> maxError = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            // The view is A(IR(1,m-1),IR(1,n-1))
+            const F ref =
+              ( i == 0 || i == m-1 || j == 0 || j == n-1 ?
+                AOrig.Get(i,j) : refMap(AOrig.Get(i,j)) );
+            maxError = Max( maxError, Abs(A.Get(i,j)-ref) );
+        }
+    }
+    Output("  ",label,": max error = ",maxError);
+    if( maxError > tol )
+        LogicError(label," did not match the scalar map");
+}
+
+template<typename F>
+void TestEntrywise( Int m, Int n )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    const Real eps = limits::Epsilon<Real>();
+    const Real tau = Real(1)/Real(3);
+
+    // Spread the entries over [-2,2] so that every branch is exercised
+    Matrix<F> AOrig, A;
+    Uniform( AOrig, m, n, F(0), Real(2) );
+    auto apply =
+      [&]( function<void(Matrix<F>&)> map )
+      {
+        A = AOrig;
+        auto AView = A( IR(1,m-1), IR(1,n-1) );
+        map( AView );
+      };
+
+    apply( [&]( Matrix<F>& B ) { SoftThreshold( B, tau ); } );
+    CheckMap
+    ( "SoftThreshold", AOrig, A,
+      function<F(const F&)>
+      ( [&]( const F& alpha ) { return RefSoftThreshold(alpha,tau); } ),
+      4*eps );
+
+    const Real maxAbs = MaxNorm( AOrig( IR(1,m-1), IR(1,n-1) ) );
+    apply( [&]( Matrix<F>& B ) { SoftThreshold( B, tau/4, true ); } );
+    CheckMap
+    ( "Relative SoftThreshold", AOrig, A,
+      function<F(const F&)>
+      ( [&]( const F& alpha )
+        { return RefSoftThreshold(alpha,maxAbs*tau/4); } ),
+      4*eps );
+}
+
+template<typename Real>
+void TestRealMaps( Int m, Int n )
+{
+    const Real lower = Real(-1)/Real(2), upper = Real(3)/Real(4);
+    const Real tau = Real(3)/Real(2);
+
+    Matrix<Real> AOrig, A;
+    Uniform( AOrig, m, n, Real(0), Real(2) );
+    auto apply =
+      [&]( function<void(Matrix<Real>&)> map )
+      {
+        A = AOrig;
+        auto AView = A( IR(1,m-1), IR(1,n-1) );
+        map( AView );
+      };
+    typedef function<Real(const Real&)> RealMap;
+
+    apply( [&]( Matrix<Real>& B ) { LowerClip( B, lower ); } );
+    CheckMap
+    ( "LowerClip", AOrig, A,
+      RealMap( [&]( const Real& alpha ) { return Max(alpha,lower); } ),
+      Real(0) );
+    apply( [&]( Matrix<Real>& B ) { UpperClip( B, upper ); } );
+    CheckMap
+    ( "UpperClip", AOrig, A,
+      RealMap( [&]( const Real& alpha ) { return Min(alpha,upper); } ),
+      Real(0) );
+    apply( [&]( Matrix<Real>& B ) { Clip( B, lower, upper ); } );
+    CheckMap
+    ( "Clip", AOrig, A,
+      RealMap
+      ( [&]( const Real& alpha ) { return Min(Max(alpha,lower),upper); } ),
+      Real(0) );
+    apply( [&]( Matrix<Real>& B ) { HingeLossProx( B, tau ); } );
+    CheckMap
+    ( "HingeLossProx", AOrig, A,
+      RealMap
+      ( [&]( const Real& alpha ) { return RefHingeLossProx(alpha,tau); } ),
+      Real(0) );
+}
+
+// The unfused sequence of operations replaced by ProxUpdate
+template<typename Real>
+void TestProxUpdate( Int m, Int n, const Grid& g )
+{
+    const Real alpha = Real(6)/Real(5), tau = Real(1)/Real(4);
+    const Real tol = 10*Max(m,n)*limits::Epsilon<Real>();
+    auto prox = [&]( Real chi ) { return SoftThreshold( chi, tau ); };
+
+    DistMatrix<Real> X(g), Z(g), U(g);
+    Uniform( X, m, n );
+    Uniform( Z, m, n );
+    Uniform( U, m, n );
+
+    // xHat := alpha x + (1-alpha) z, z := prox(xHat+u), u += xHat - z
+    DistMatrix<Real> xHat( X ), ZRef( Z ), URef( U ), ZOld( Z );
+    xHat *= alpha;
+    Axpy( 1-alpha, Z, xHat );
+    ZRef = xHat;
+    ZRef += U;
+    SoftThreshold( ZRef, tau );
+    URef += xHat;
+    URef -= ZRef;
+    const Real xNorm = FrobeniusNorm( X );
+    const Real zNorm = FrobeniusNorm( ZRef );
+    const Real uNorm = FrobeniusNorm( URef );
+    DistMatrix<Real> E( X );
+    E -= ZRef;
+    const Real primalNorm = FrobeniusNorm( E );
+    E = ZRef;
+    E -= ZOld;
+    const Real dualNorm = FrobeniusNorm( E );
+
+    auto norms = ProxUpdate( alpha, X, Z, U, prox );
+    Z -= ZRef;
+    U -= URef;
+    const Real zError = MaxNorm( Z );
+    const Real uError = MaxNorm( U );
+    const Real normError =
+      Max( Max( Abs(norms.xNorm-xNorm), Abs(norms.zNorm-zNorm) ),
+           Max( Max( Abs(norms.uNorm-uNorm),
+                     Abs(norms.primalNorm-primalNorm) ),
+                Abs(norms.dualNorm-dualNorm) ) ) / (1+xNorm+zNorm+uNorm);
+    if( g.Rank() == 0 )
+        Output
+        ("  ProxUpdate: || Z - ZRef ||_max = ",zError,
+         ", || U - URef ||_max = ",uError,
+         ", relative norm error = ",normError);
+    if( zError > tol || uError > tol || normError > tol )
+        LogicError("ProxUpdate did not match the unfused updates");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",67);
+        const Int n = Input("--n","width of matrix",13);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            TestEntrywise<float>( m, n );
+            TestRealMaps<float>( m, n );
+            TestEntrywise<double>( m, n );
+            TestRealMaps<double>( m, n );
+            TestEntrywise<Complex<double>>( m, n );
+        }
+        const Grid g( comm );
+        if( commRank == 0 )
+            Output("Testing ProxUpdate with double");
+        TestProxUpdate<double>( m, n, g );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,404 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve sparse "direct" conic-form QPs,
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, x >= 0,
+//
+// with each of the sparse KKT formulations (which run several Interior Point
+// iterations that update a cached KKT matrix in-place), as well as in
+// batches and with presolve, and check the primal residual, the dual
+// residual, Q x + A^T y - z + c, and the duality gap of the results.
+
+// Row i of the m x n test matrix (with m <= n) has a unit diagonal entry and
+// three deterministic entries from the trailing n-m columns
+template<typename Real>
+void QueueTestRow( Int i, Int m, Int n, vector<Int>& cols, vector<Real>& vals )
+{
+    cols.resize( 4 );
+    vals.resize( 4 );
+    cols[0] = i;
+    vals[0] = Real(1);
+    for( Int t=1; t<4; ++t )
+    {
+        cols[t] = m + (3*i+7*t) % (n-m);
+        vals[t] = Real(1+(i+t)%5) / Real(4);
+    }
+}
+
+template<typename Real>
+void TestMatrix( SparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 4*m );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int i=0; i<m; ++i )
+    {
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void TestMatrix( DistSparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 4*localHeight );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.ProcessQueues();
+}
+
+// Since Elemental's 1D Laplacian is negative-definite, Q is its (scaled)
+// negation, which is symmetric positive-definite
+template<typename Real>
+void TestQuadratic( SparseMatrix<Real>& Q, Int n )
+{
+    Laplacian( Q, n );
+    Q *= Real(-1)/Real((n+1)*(n+1));
+}
+
+template<typename Real>
+void TestQuadratic( DistSparseMatrix<Real>& Q, Int n )
+{
+    Laplacian( Q, n );
+    Q *= Real(-1)/Real((n+1)*(n+1));
+}
+
+// Form b and c from a strictly feasible primal-dual point so that the
+// problem has a finite optimum
+template<typename Real>
+void TestProblem
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Real> x0, y0, z0;
+    Uniform( x0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Uniform( y0, m, 1 );
+    Uniform( z0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( NORMAL, Real(-1), Q, x0, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void TestProblem
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm()), z0(A.Comm());
+    Uniform( x0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Uniform( y0, m, 1 );
+    Uniform( z0, n, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( NORMAL, Real(-1), Q, x0, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real,class SparseMat,class Vec>
+void CheckSolution
+( const string& label,
+  const SparseMat& Q, const SparseMat& A, const Vec& b, const Vec& c,
+  const Vec& x, const Vec& y, const Vec& z,
+  bool print )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    // || A x - b ||_2 / (1 + || b ||_2)
+    Vec r( b );
+    Multiply( NORMAL, Real(1), A, x, Real(-1), r );
+    const Real primalRes = FrobeniusNorm( r ) / (1+FrobeniusNorm(b));
+
+    // || Q x + A^T y - z + c ||_2 / (1 + || c ||_2)
+    Vec s( c );
+    s -= z;
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), s );
+    Vec Qx( c );
+    Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+    s += Qx;
+    const Real dualRes = FrobeniusNorm( s ) / (1+FrobeniusNorm(c));
+
+    // The primal objective is (1/2) x^T Q x + c^T x and the dual objective
+    // is -(1/2) x^T Q x - b^T y
+    const Real xQx = Dot( x, Qx );
+    const Real primObj = xQx/2 + Dot( c, x );
+    const Real dualObj = -xQx/2 - Dot( b, y );
+    const Real relGap = Abs(primObj-dualObj) / (1+Abs(primObj));
+
+    if( print )
+        Output
+        ("  ",label,":\n",
+         "    || A x - b ||_2 / (1 + || b ||_2)             = ",primalRes,"\n",
+         "    || Q x + A^T y - z + c ||_2 / (1 + || c ||_2) = ",dualRes,"\n",
+         "    | primal - dual | / (1 + | primal |)          = ",relGap);
+    if( primalRes > tol || dualRes > tol || relGap > tol )
+        LogicError(label," QP solution was inaccurate");
+}
+
+template<typename Real>
+void TestSequential( Int m, Int n, bool print )
+{
+    const bool amRoot = ( mpi::Rank() == 0 );
+    SparseMatrix<Real> Q, A;
+    Matrix<Real> b, c, x, y, z;
+    TestQuadratic( Q, n );
+    TestMatrix( A, m, n );
+    TestProblem( Q, A, b, c );
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print && amRoot;
+
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Sequential FULL_KKT", Q, A, b, c, x, y, z, amRoot );
+
+    ctrl.mehrotraCtrl.system = AUGMENTED_KKT;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Sequential AUGMENTED_KKT", Q, A, b, c, x, y, z, amRoot );
+}
+
+template<typename Real>
+void TestDistributed( Int m, Int n, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    DistSparseMatrix<Real> Q(comm), A(comm);
+    DistMultiVec<Real> b(comm), c(comm), x(comm), y(comm), z(comm);
+    TestQuadratic( Q, n );
+    TestMatrix( A, m, n );
+    TestProblem( Q, A, b, c );
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print && amRoot;
+
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed FULL_KKT", Q, A, b, c, x, y, z, amRoot );
+
+    ctrl.mehrotraCtrl.system = AUGMENTED_KKT;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Distributed AUGMENTED_KKT", Q, A, b, c, x, y, z, amRoot );
+}
+
+// Solve a batch of problems which share their matrices across the processes
+// of COMM_WORLD (with warm starts) and check each of the solutions. Then
+// make the last problem infeasible and ensure that every process throws.
+template<typename Real>
+void TestBatch( Int m, Int n, Int numProblems, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const bool amRoot = ( mpi::Rank(comm) == 0 );
+    SparseMatrix<Real> Q, A;
+    TestQuadratic( Q, n );
+    TestMatrix( A, m, n );
+
+    // Since the random right-hand sides and costs differ between processes,
+    // those of the root are broadcast
+    Matrix<Real> B, C, b, c, x, y, z;
+    Zeros( B, m, numProblems );
+    Zeros( C, n, numProblems );
+    for( Int k=0; k<numProblems; ++k )
+    {
+        TestProblem( Q, A, b, c );
+        auto bk = B( ALL, IR(k) );
+        auto ck = C( ALL, IR(k) );
+        bk = b;
+        ck = c;
+    }
+    mpi::Broadcast( B.Buffer(), m*numProblems, 0, comm );
+    mpi::Broadcast( C.Buffer(), n*numProblems, 0, comm );
+
+    qp::direct::BatchCtrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    ctrl.progress = print && amRoot;
+    Matrix<Real> X, Y, Z;
+    Matrix<Int> numIts;
+    QP( Q, A, B, C, X, Y, Z, numIts, ctrl, comm );
+    for( Int k=0; k<numProblems; ++k )
+    {
+        b = B( ALL, IR(k) );
+        c = C( ALL, IR(k) );
+        x = X( ALL, IR(k) );
+        y = Y( ALL, IR(k) );
+        z = Z( ALL, IR(k) );
+        CheckSolution<Real>
+        ( BuildString("Batch problem ",k), Q, A, b, c, x, y, z, amRoot );
+    }
+
+    // Since every entry of A is positive, A x = -1 has no solution x >= 0
+    auto bLast = B( ALL, IR(numProblems-1) );
+    Fill( bLast, Real(-1) );
+    ctrl.mehrotraCtrl.maxIts = 30;
+    bool threw = false;
+    try
+    {
+        QP( Q, A, B, C, X, Y, Z, numIts, ctrl, comm );
+    }
+    catch( std::exception& e )
+    {
+        threw = true;
+        if( amRoot )
+            Output("  Infeasible batch threw: ",e.what());
+    }
+    if( !threw )
+        LogicError("An infeasible batch problem did not throw");
+}
+
+// An (m+1) x (n+1) problem with a singleton row, which fixes x(n-1), and a
+// column, x(n), which only appears in row 0 and is implied to be
+// nonnegative, so that presolve eliminates both rows and the postsolve must
+// recover their multipliers
+template<typename Real>
+void PresolveTestMatrix( SparseMatrix<Real>& A, Int m, Int n )
+{
+    Zeros( A, m+1, n+1 );
+    A.Reserve( 4*m+2 );
+    vector<Int> cols;
+    vector<Real> vals;
+    for( Int i=0; i<m; ++i )
+    {
+        QueueTestRow( i, m, n, cols, vals );
+        for( Int t=0; t<4; ++t )
+            A.QueueUpdate( i, cols[t], vals[t] );
+    }
+    A.QueueUpdate( 0, n, Real(-1) );
+    A.QueueUpdate( m, n-1, Real(2) );
+    A.ProcessQueues();
+}
+
+// The 1D Laplacian on all but the last variable, which must not be coupled
+// quadratically in order to be a free column singleton
+template<typename Real>
+void PresolveTestQuadratic( SparseMatrix<Real>& Q, Int n )
+{
+    Zeros( Q, n+1, n+1 );
+    Q.Reserve( 3*n );
+    for( Int i=0; i<n; ++i )
+    {
+        Q.QueueUpdate( i, i, Real(2) );
+        if( i != 0 )
+            Q.QueueUpdate( i, i-1, Real(-1) );
+        if( i != n-1 )
+            Q.QueueUpdate( i, i+1, Real(-1) );
+    }
+    Q.ProcessQueues();
+}
+
+// Solve a small problem with and without presolve and check that the
+// postsolved primal-dual solution is as accurate as the original one
+template<typename Real>
+void TestPresolve( Int m, Int n, bool print )
+{
+    const bool amRoot = ( mpi::Rank() == 0 );
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    SparseMatrix<Real> Q, A;
+    PresolveTestQuadratic( Q, n );
+    PresolveTestMatrix( A, m, n );
+
+    // Since the other entries of row 0 are positive and at most 5/4, making
+    // x0(n) large ensures that b(0) <= 0, so that x(n) is implied free
+    Matrix<Real> b, c, x0, y0, z0;
+    Uniform( x0, n+1, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    x0.Set( n, 0, Real(20) );
+    Uniform( y0, m+1, 1 );
+    Uniform( z0, n+1, 1, Real(3)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m+1, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Multiply( NORMAL, Real(-1), Q, x0, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+    auto objective = [&]( const Matrix<Real>& x )
+    {
+        Matrix<Real> Qx;
+        Zeros( Qx, n+1, 1 );
+        Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+        return Dot( x, Qx )/2 + Dot( c, x );
+    };
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    Matrix<Real> x, y, z;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "Without presolve", Q, A, b, c, x, y, z, amRoot );
+    const Real obj = objective( x );
+
+    ctrl.presolve = true;
+    ctrl.presolveCtrl.progress = print && amRoot;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    CheckSolution<Real>
+    ( "With presolve", Q, A, b, c, x, y, z, amRoot );
+    for( Int j=0; j<n+1; ++j )
+        if( z.Get(j,0) < -tol*(1+MaxNorm(c)) )
+            LogicError("Postsolved z(",j,")=",z.Get(j,0)," was negative");
+    const Real objPre = objective( x );
+    if( amRoot )
+        Output("  objectives without and with presolve: ",obj,", ",objPre);
+    if( Abs(obj-objPre) > tol*(1+Abs(obj)) )
+        LogicError("Presolve changed the optimal objective");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int m = Input("--m","height of A",60);
+        const Int n = Input("--n","width of A",100);
+        const Int numProblems =
+          Input("--numProblems","number of problems in the batch",6);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestSequential<double>( m, n, print );
+        TestDistributed<double>( m, n, print );
+        TestBatch<double>( m, n, numProblems, print );
+        TestPresolve<double>( m, n, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve a block-diagonal "direct" conic-form SDP,
+//
+//   min <C,X>, s.t. diag(X) = 1, X in K,
+//   max -1^T y, s.t. Diag(y) - Z + C = 0, Z in K,
+//
+// whose first block, C_0 = -L/4, with L the Laplacian of a cycle of odd
+// length n_0, is the Goemans-Williamson max-cut relaxation of the cycle, with
+// optimal value -(n_0/2) (1 + cos(pi/n_0)), and whose second block,
+// C_1 = -ones(n_1,n_1), has the optimal value -n_1^2 (attained by
+// X_1 = ones(n_1,n_1) and y_1 = n_1 ones(n_1,1)). The objectives of the
+// returned primal and dual points are checked against the known optimum,
+// along with their feasibility.
+
+template<typename Real>
+Real OptimalValue( Int n0, Int n1 )
+{
+    return -(Real(n0)/Real(2))*(1+Cos(Pi<Real>()/Real(n0))) - Real(n1*n1);
+}
+
+template<typename Real,class Mat>
+void TestProblem
+( Int n0, Int n1,
+  vector<Mat>& A, Mat& b, vector<Mat>& C )
+{
+    const Int m = n0 + n1;
+    Zeros( A[0], n0*n0, m );
+    Zeros( A[1], n1*n1, m );
+    for( Int i=0; i<n0; ++i )
+        A[0].Set( i+i*n0, i, Real(1) );
+    for( Int i=0; i<n1; ++i )
+        A[1].Set( i+i*n1, n0+i, Real(1) );
+    Ones( b, m, 1 );
+
+    Zeros( C[0], n0, n0 );
+    for( Int i=0; i<n0; ++i )
+    {
+        C[0].Set( i, i, Real(-1)/Real(2) );
+        C[0].Set( i, (i+1)%n0, Real(1)/Real(4) );
+        C[0].Set( (i+1)%n0, i, Real(1)/Real(4) );
+    }
+    Ones( C[1], n1, n1 );
+    C[1] *= Real(-1);
+}
+
+template<typename Real>
+Real MinEig( const Matrix<Real>& A )
+{
+    Matrix<Real> ACopy( A ), w;
+    HermitianEig( LOWER, ACopy, w );
+    return w.Get(0,0);
+}
+
+template<typename Real>
+Real MinEig( const DistMatrix<Real>& A )
+{
+    DistMatrix<Real> ACopy( A );
+    DistMatrix<Real,VR,STAR> w( A.Grid() );
+    HermitianEig( LOWER, ACopy, w );
+    return w.Get(0,0);
+}
+
+template<typename Real,class Mat>
+void CheckSolution
+( const string& label,
+  Int n0, Int n1,
+  const Mat& b,
+  const vector<Mat>& C,
+  const vector<Mat>& X,
+  const Mat& y,
+  const vector<Mat>& Z,
+  bool amRoot )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    const Real optimum = OptimalValue<Real>( n0, n1 );
+
+    Real primalRes=0, dualRes=0, minXEig=0, minZEig=0, primObj=0;
+    Int offset = 0;
+    for( Int j=0; j<2; ++j )
+    {
+        const Int n = X[j].Height();
+
+        // || diag(X_j) - 1 ||_max
+        auto d = GetDiagonal( X[j] );
+        Shift( d, Real(-1) );
+        primalRes = Max( primalRes, MaxNorm(d) );
+
+        // || Diag(y_j) - Z_j + C_j ||_F / (1 + || C_j ||_F)
+        Mat R( C[j] );
+        R -= Z[j];
+        auto yj = y( IR(offset,offset+n), ALL );
+        UpdateDiagonal( R, Real(1), yj );
+        dualRes =
+          Max( dualRes, FrobeniusNorm(R)/(1+FrobeniusNorm(C[j])) );
+
+        // Both X_j and Z_j must be (numerically) positive semi-definite
+        minXEig = Min( minXEig, MinEig(X[j])/(1+FrobeniusNorm(X[j])) );
+        minZEig = Min( minZEig, MinEig(Z[j])/(1+FrobeniusNorm(Z[j])) );
+
+        primObj += Dot( C[j], X[j] );
+        offset += n;
+    }
+    const Real dualObj = -Dot( b, y );
+    const Real primError = Abs(primObj-optimum) / (1+Abs(optimum));
+    const Real dualError = Abs(dualObj-optimum) / (1+Abs(optimum));
+
+    if( amRoot )
+        Output
+        ("  ",label,":\n",
+         "    known optimum                            = ",optimum,"\n",
+         "    <C,X>                                    = ",primObj,"\n",
+         "    -b^T y                                   = ",dualObj,"\n",
+         "    || diag(X) - 1 ||_max                    = ",primalRes,"\n",
+         "    || Diag(y) - Z + C ||_F / (1 + || C ||_F) = ",dualRes,"\n",
+         "    min eig(X) / (1 + || X ||_F)             = ",minXEig,"\n",
+         "    min eig(Z) / (1 + || Z ||_F)             = ",minZEig);
+    if( primalRes > tol || dualRes > tol )
+        LogicError(label," SDP solution was infeasible");
+    if( minXEig < -tol || minZEig < -tol )
+        LogicError(label," SDP solution left the cone");
+    if( primError > tol || dualError > tol )
+        LogicError(label," SDP objectives missed the known optimum");
+}
+
+template<typename Real>
+void TestSequential( Int n0, Int n1, bool print )
+{
+    vector<Matrix<Real>> A(2), C(2), X(2), Z(2);
+    Matrix<Real> b, y;
+    TestProblem<Real>( n0, n1, A, b, C );
+
+    sdp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    SDP( A, b, C, X, y, Z, ctrl );
+    CheckSolution<Real>( "Sequential", n0, n1, b, C, X, y, Z, true );
+}
+
+template<typename Real>
+void TestDistributed( Int n0, Int n1, bool print )
+{
+    const Grid g( mpi::COMM_WORLD );
+    const bool amRoot = ( g.Rank() == 0 );
+    vector<DistMatrix<Real>> A(2,DistMatrix<Real>(g)),
+      C(2,DistMatrix<Real>(g)), X(2,DistMatrix<Real>(g)),
+      Z(2,DistMatrix<Real>(g));
+    DistMatrix<Real> b(g), y(g);
+    TestProblem<Real>( n0, n1, A, b, C );
+
+    sdp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print && amRoot;
+    SDP( A, b, C, X, y, Z, ctrl );
+    CheckSolution<Real>( "Distributed", n0, n1, b, C, X, y, Z, amRoot );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int n0 = Input("--n0","(odd) length of the cycle",7);
+        const Int n1 = Input("--n1","size of the all-ones block",5);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+        if( n0 % 2 == 0 || n0 < 3 )
+            LogicError("The cycle length must be odd and at least three");
+
+        if( commRank == 0 )
+        {
+            Output("Testing with doubles:");
+            TestSequential<double>( n0, n1, print );
+        }
+        TestDistributed<double>( n0, n1, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
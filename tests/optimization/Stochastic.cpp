@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Fit the elastic net and least absolute value models with the streaming
+// Prox-SVRG and SAGA solvers (reading the design matrix from disk in blocks
+// of rows) and compare their objectives against those of the (in-memory)
+// Interior Point solutions.
+//
+// Since the streaming LAV minimizes the sum of the Moreau envelopes of
+// | a_i^T x - b_i | with parameter mu, each of which lies within mu/2 of the
+// absolute value, its solution is only suboptimal by at most m mu / 2.
+
+template<typename Real>
+Real ENObjective
+( const Matrix<Real>& A, const Matrix<Real>& b,
+  Real lambda1, Real lambda2, const Matrix<Real>& x )
+{
+    Matrix<Real> r( b );
+    Gemv( NORMAL, Real(-1), A, x, Real(1), r );
+    const Real rNorm = FrobeniusNorm( r );
+    const Real xNorm = FrobeniusNorm( x );
+    return rNorm*rNorm + lambda1*EntrywiseNorm(x,Real(1)) +
+           lambda2*xNorm*xNorm;
+}
+
+template<typename Real>
+Real LAVObjective
+( const Matrix<Real>& A, const Matrix<Real>& b, const Matrix<Real>& x )
+{
+    Matrix<Real> r( b );
+    Gemv( NORMAL, Real(-1), A, x, Real(1), r );
+    return EntrywiseNorm( r, Real(1) );
+}
+
+string MethodName( StochasticMethod method )
+{ return method == PROX_SVRG ? "Prox-SVRG" : "SAGA"; }
+
+template<typename Real>
+void TestEN
+( const Matrix<Real>& A, const Matrix<Real>& b,
+  RowChunkStream<Real>& AStream, StochasticCtrl<Real>& ctrl )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    const Real lambda1 = 1, lambda2 = Real(1)/Real(2);
+
+    // The sequential dense Ruiz equilibration is not yet written
+    qp::affine::Ctrl<Real> ipmCtrl;
+    ipmCtrl.mehrotraCtrl.outerEquil = false;
+    Matrix<Real> x;
+    EN( A, b, lambda1, lambda2, x, ipmCtrl );
+    const Real objIPM = ENObjective( A, b, lambda1, lambda2, x );
+
+    for( auto method : { PROX_SVRG, PROX_SAGA } )
+    {
+        ctrl.method = method;
+        Zeros( x, A.Width(), 1 );
+        const Int numEpochs = EN( AStream, b, lambda1, lambda2, x, ctrl );
+        const Real obj = ENObjective( A, b, lambda1, lambda2, x );
+        const Real relGap = (obj-objIPM) / (1+Abs(objIPM));
+        Output
+        ("  EN with ",MethodName(method)," (",numEpochs," epochs): ",
+         "objective = ",obj," (IPM: ",objIPM,"), relative gap = ",relGap);
+        if( Abs(relGap) > tol )
+            LogicError
+            ("Streaming EN with ",MethodName(method)," was inaccurate");
+    }
+}
+
+template<typename Real>
+void TestLAV
+( const Matrix<Real>& A, const Matrix<Real>& b,
+  RowChunkStream<Real>& AStream, StochasticCtrl<Real>& ctrl )
+{
+    const Int m = A.Height();
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    lp::affine::Ctrl<Real> ipmCtrl;
+    ipmCtrl.mehrotraCtrl.outerEquil = false;
+    Matrix<Real> x;
+    LAV( A, b, x, ipmCtrl );
+    const Real objIPM = LAVObjective( A, b, x );
+    const Real maxGap = m*ctrl.smoothing/2 + tol*(1+objIPM);
+
+    for( auto method : { PROX_SVRG, PROX_SAGA } )
+    {
+        ctrl.method = method;
+        Zeros( x, A.Width(), 1 );
+        const Int numEpochs = LAV( AStream, b, x, ctrl );
+        const Real obj = LAVObjective( A, b, x );
+        Output
+        ("  LAV with ",MethodName(method)," (",numEpochs," epochs): ",
+         "objective = ",obj," (IPM: ",objIPM,"), allowed gap = ",maxGap);
+        if( obj < objIPM-tol*(1+objIPM) || obj > objIPM+maxGap )
+            LogicError
+            ("Streaming LAV with ",MethodName(method)," was inaccurate");
+    }
+}
+
+template<typename Real>
+void TestStochastic
+( Int m, Int n, Int chunkSize, Int batchSize, bool prefetch, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    Matrix<Real> A, x0, b;
+    Gaussian( A, m, n );
+    Gaussian( x0, n, 1 );
+    Gaussian( b, m, 1, Real(0), Real(1)/Real(10) );
+    Gemv( NORMAL, Real(1), A, x0, Real(1), b );
+
+    const string basename = "StochasticTest";
+    Write( A, basename, BINARY );
+    const string filename = basename + "." + FileExtension(BINARY);
+    {
+        RowChunkStream<Real> AStream
+        ( filename, chunkSize, BINARY, -1, -1, prefetch );
+
+        StochasticCtrl<Real> ctrl;
+        ctrl.batchSize = batchSize;
+        ctrl.maxEpochs = 1000;
+        ctrl.tol = Pow(limits::Epsilon<Real>(),Real(0.75));
+        ctrl.progress = print;
+        TestEN( A, b, AStream, ctrl );
+
+        ctrl.smoothing = Real(1)/Real(10);
+        TestLAV( A, b, AStream, ctrl );
+    }
+    std::remove( filename.c_str() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank();
+
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A",10);
+        const Int chunkSize =
+          Input("--chunkSize","number of rows read at a time",64);
+        const Int batchSize = Input("--batchSize","mini-batch size",8);
+        const bool prefetch =
+          Input("--prefetch","read the next chunk asynchronously?",true);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            TestStochastic<double>
+            ( m, n, chunkSize, batchSize, prefetch, print );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}